@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../_Experimental/_EXAMPLES_.c ../_Experimental/_LOG.c ../_Experimental/e_pca9685.c ../_External_Components/e_mcp23s17.c ../_External_Components/e_ws2812b.c ../_External_Components/e_amis30621.c ../_External_Components/e_qt2100.c ../_External_Components/e_tmc429.c ../_External_Components/e_25lc512.c ../_High_Level_Driver/lin.c ../_High_Level_Driver/ble.c ../_High_Level_Driver/one_wire_communication.c ../_High_Level_Driver/utilities.c ../_High_Level_Driver/string_advance.c ../_Low_Level_Driver/s14_timers.c ../_Low_Level_Driver/s08_interrupt_mapping.c ../_Low_Level_Driver/s23_spi.c ../_Low_Level_Driver/s17_adc.c ../_Low_Level_Driver/s16_output_compare.c ../_Low_Level_Driver/s24_i2c.c ../_Low_Level_Driver/s34_can.c ../_Low_Level_Driver/s35_ethernet_Applications.c ../_Low_Level_Driver/s35_ethernet_OSI-2_DataLinkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-3_NetworkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-4_TransportLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-5_ApplicationLayer.c ../_Low_Level_Driver/s35_ethernet_TCPIP.c ../_Low_Level_Driver/s12_ports.c ../_Low_Level_Driver/s21_uart.c
+SOURCEFILES_QUOTED_IF_SPACED=../_Experimental/_EXAMPLES_.c ../_Experimental/_LOG.c ../_Experimental/e_pca9685.c ../_External_Components/e_mcp23s17.c ../_External_Components/e_ws2812b.c ../_External_Components/e_amis30621.c ../_External_Components/e_qt2100.c ../_External_Components/e_tmc429.c ../_External_Components/e_25lc512.c ../_High_Level_Driver/lin.c ../_High_Level_Driver/ble.c ../_High_Level_Driver/one_wire_communication.c ../_High_Level_Driver/utilities.c ../_High_Level_Driver/string_advance.c ../_Low_Level_Driver/s14_timers.c ../_Low_Level_Driver/s08_interrupt_mapping.c ../_Low_Level_Driver/s23_spi.c ../_Low_Level_Driver/s17_adc.c ../_Low_Level_Driver/s16_output_compare.c ../_Low_Level_Driver/s24_i2c.c ../_Low_Level_Driver/s34_can.c ../_Low_Level_Driver/s35_ethernet_Applications.c ../_Low_Level_Driver/s35_ethernet_OSI-2_DataLinkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-3_NetworkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-4_TransportLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-5_ApplicationLayer.c ../_Low_Level_Driver/s35_ethernet_TCPIP.c ../_Low_Level_Driver/s12_ports.c ../_Low_Level_Driver/s21_uart.c ../_High_Level_Driver/scheduler.c ../_External_Components/e_ws2812b_encoder.c ../_High_Level_Driver/color.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o ${OBJECTDIR}/_ext/1717005096/_LOG.o ${OBJECTDIR}/_ext/1717005096/e_pca9685.o ${OBJECTDIR}/_ext/830869050/e_mcp23s17.o ${OBJECTDIR}/_ext/830869050/e_ws2812b.o ${OBJECTDIR}/_ext/830869050/e_amis30621.o ${OBJECTDIR}/_ext/830869050/e_qt2100.o ${OBJECTDIR}/_ext/830869050/e_tmc429.o ${OBJECTDIR}/_ext/830869050/e_25lc512.o ${OBJECTDIR}/_ext/1180237584/lin.o ${OBJECTDIR}/_ext/1180237584/ble.o ${OBJECTDIR}/_ext/1180237584/one_wire_communication.o ${OBJECTDIR}/_ext/1180237584/utilities.o ${OBJECTDIR}/_ext/1180237584/string_advance.o ${OBJECTDIR}/_ext/376376446/s14_timers.o ${OBJECTDIR}/_ext/376376446/s08_interrupt_mapping.o ${OBJECTDIR}/_ext/376376446/s23_spi.o ${OBJECTDIR}/_ext/376376446/s17_adc.o ${OBJECTDIR}/_ext/376376446/s16_output_compare.o ${OBJECTDIR}/_ext/376376446/s24_i2c.o ${OBJECTDIR}/_ext/376376446/s34_can.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_Applications.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-2_DataLinkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-3_NetworkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-4_TransportLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-5_ApplicationLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_TCPIP.o ${OBJECTDIR}/_ext/376376446/s12_ports.o ${OBJECTDIR}/_ext/376376446/s21_uart.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o.d ${OBJECTDIR}/_ext/1717005096/_LOG.o.d ${OBJECTDIR}/_ext/1717005096/e_pca9685.o.d ${OBJECTDIR}/_ext/830869050/e_mcp23s17.o.d ${OBJECTDIR}/_ext/830869050/e_ws2812b.o.d ${OBJECTDIR}/_ext/830869050/e_amis30621.o.d ${OBJECTDIR}/_ext/830869050/e_qt2100.o.d ${OBJECTDIR}/_ext/830869050/e_tmc429.o.d ${OBJECTDIR}/_ext/830869050/e_25lc512.o.d ${OBJECTDIR}/_ext/1180237584/lin.o.d ${OBJECTDIR}/_ext/1180237584/ble.o.d ${OBJECTDIR}/_ext/1180237584/one_wire_communication.o.d ${OBJECTDIR}/_ext/1180237584/utilities.o.d ${OBJECTDIR}/_ext/1180237584/string_advance.o.d ${OBJECTDIR}/_ext/376376446/s14_timers.o.d ${OBJECTDIR}/_ext/376376446/s08_interrupt_mapping.o.d ${OBJECTDIR}/_ext/376376446/s23_spi.o.d ${OBJECTDIR}/_ext/376376446/s17_adc.o.d ${OBJECTDIR}/_ext/376376446/s16_output_compare.o.d ${OBJECTDIR}/_ext/376376446/s24_i2c.o.d ${OBJECTDIR}/_ext/376376446/s34_can.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_Applications.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-2_DataLinkLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-3_NetworkLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-4_TransportLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-5_ApplicationLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_TCPIP.o.d ${OBJECTDIR}/_ext/376376446/s12_ports.o.d ${OBJECTDIR}/_ext/376376446/s21_uart.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o ${OBJECTDIR}/_ext/1717005096/_LOG.o ${OBJECTDIR}/_ext/1717005096/e_pca9685.o ${OBJECTDIR}/_ext/830869050/e_mcp23s17.o ${OBJECTDIR}/_ext/830869050/e_ws2812b.o ${OBJECTDIR}/_ext/830869050/e_amis30621.o ${OBJECTDIR}/_ext/830869050/e_qt2100.o ${OBJECTDIR}/_ext/830869050/e_tmc429.o ${OBJECTDIR}/_ext/830869050/e_25lc512.o ${OBJECTDIR}/_ext/1180237584/lin.o ${OBJECTDIR}/_ext/1180237584/ble.o ${OBJECTDIR}/_ext/1180237584/one_wire_communication.o ${OBJECTDIR}/_ext/1180237584/utilities.o ${OBJECTDIR}/_ext/1180237584/string_advance.o ${OBJECTDIR}/_ext/376376446/s14_timers.o ${OBJECTDIR}/_ext/376376446/s08_interrupt_mapping.o ${OBJECTDIR}/_ext/376376446/s23_spi.o ${OBJECTDIR}/_ext/376376446/s17_adc.o ${OBJECTDIR}/_ext/376376446/s16_output_compare.o ${OBJECTDIR}/_ext/376376446/s24_i2c.o ${OBJECTDIR}/_ext/376376446/s34_can.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_Applications.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-2_DataLinkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-3_NetworkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-4_TransportLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-5_ApplicationLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_TCPIP.o ${OBJECTDIR}/_ext/376376446/s12_ports.o ${OBJECTDIR}/_ext/376376446/s21_uart.o ${OBJECTDIR}/_ext/1180237584/scheduler.o ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o ${OBJECTDIR}/_ext/1180237584/color.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o.d ${OBJECTDIR}/_ext/1717005096/_LOG.o.d ${OBJECTDIR}/_ext/1717005096/e_pca9685.o.d ${OBJECTDIR}/_ext/830869050/e_mcp23s17.o.d ${OBJECTDIR}/_ext/830869050/e_ws2812b.o.d ${OBJECTDIR}/_ext/830869050/e_amis30621.o.d ${OBJECTDIR}/_ext/830869050/e_qt2100.o.d ${OBJECTDIR}/_ext/830869050/e_tmc429.o.d ${OBJECTDIR}/_ext/830869050/e_25lc512.o.d ${OBJECTDIR}/_ext/1180237584/lin.o.d ${OBJECTDIR}/_ext/1180237584/ble.o.d ${OBJECTDIR}/_ext/1180237584/one_wire_communication.o.d ${OBJECTDIR}/_ext/1180237584/utilities.o.d ${OBJECTDIR}/_ext/1180237584/string_advance.o.d ${OBJECTDIR}/_ext/376376446/s14_timers.o.d ${OBJECTDIR}/_ext/376376446/s08_interrupt_mapping.o.d ${OBJECTDIR}/_ext/376376446/s23_spi.o.d ${OBJECTDIR}/_ext/376376446/s17_adc.o.d ${OBJECTDIR}/_ext/376376446/s16_output_compare.o.d ${OBJECTDIR}/_ext/376376446/s24_i2c.o.d ${OBJECTDIR}/_ext/376376446/s34_can.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_Applications.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-2_DataLinkLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-3_NetworkLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-4_TransportLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-5_ApplicationLayer.o.d ${OBJECTDIR}/_ext/376376446/s35_ethernet_TCPIP.o.d ${OBJECTDIR}/_ext/376376446/s12_ports.o.d ${OBJECTDIR}/_ext/376376446/s21_uart.o.d ${OBJECTDIR}/_ext/1180237584/scheduler.o.d ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d ${OBJECTDIR}/_ext/1180237584/color.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o ${OBJECTDIR}/_ext/1717005096/_LOG.o ${OBJECTDIR}/_ext/1717005096/e_pca9685.o ${OBJECTDIR}/_ext/830869050/e_mcp23s17.o ${OBJECTDIR}/_ext/830869050/e_ws2812b.o ${OBJECTDIR}/_ext/830869050/e_amis30621.o ${OBJECTDIR}/_ext/830869050/e_qt2100.o ${OBJECTDIR}/_ext/830869050/e_tmc429.o ${OBJECTDIR}/_ext/830869050/e_25lc512.o ${OBJECTDIR}/_ext/1180237584/lin.o ${OBJECTDIR}/_ext/1180237584/ble.o ${OBJECTDIR}/_ext/1180237584/one_wire_communication.o ${OBJECTDIR}/_ext/1180237584/utilities.o ${OBJECTDIR}/_ext/1180237584/string_advance.o ${OBJECTDIR}/_ext/376376446/s14_timers.o ${OBJECTDIR}/_ext/376376446/s08_interrupt_mapping.o ${OBJECTDIR}/_ext/376376446/s23_spi.o ${OBJECTDIR}/_ext/376376446/s17_adc.o ${OBJECTDIR}/_ext/376376446/s16_output_compare.o ${OBJECTDIR}/_ext/376376446/s24_i2c.o ${OBJECTDIR}/_ext/376376446/s34_can.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_Applications.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-2_DataLinkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-3_NetworkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-4_TransportLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-5_ApplicationLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_TCPIP.o ${OBJECTDIR}/_ext/376376446/s12_ports.o ${OBJECTDIR}/_ext/376376446/s21_uart.o
+OBJECTFILES=${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o ${OBJECTDIR}/_ext/1717005096/_LOG.o ${OBJECTDIR}/_ext/1717005096/e_pca9685.o ${OBJECTDIR}/_ext/830869050/e_mcp23s17.o ${OBJECTDIR}/_ext/830869050/e_ws2812b.o ${OBJECTDIR}/_ext/830869050/e_amis30621.o ${OBJECTDIR}/_ext/830869050/e_qt2100.o ${OBJECTDIR}/_ext/830869050/e_tmc429.o ${OBJECTDIR}/_ext/830869050/e_25lc512.o ${OBJECTDIR}/_ext/1180237584/lin.o ${OBJECTDIR}/_ext/1180237584/ble.o ${OBJECTDIR}/_ext/1180237584/one_wire_communication.o ${OBJECTDIR}/_ext/1180237584/utilities.o ${OBJECTDIR}/_ext/1180237584/string_advance.o ${OBJECTDIR}/_ext/376376446/s14_timers.o ${OBJECTDIR}/_ext/376376446/s08_interrupt_mapping.o ${OBJECTDIR}/_ext/376376446/s23_spi.o ${OBJECTDIR}/_ext/376376446/s17_adc.o ${OBJECTDIR}/_ext/376376446/s16_output_compare.o ${OBJECTDIR}/_ext/376376446/s24_i2c.o ${OBJECTDIR}/_ext/376376446/s34_can.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_Applications.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-2_DataLinkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-3_NetworkLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-4_TransportLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_OSI-5_ApplicationLayer.o ${OBJECTDIR}/_ext/376376446/s35_ethernet_TCPIP.o ${OBJECTDIR}/_ext/376376446/s12_ports.o ${OBJECTDIR}/_ext/376376446/s21_uart.o ${OBJECTDIR}/_ext/1180237584/scheduler.o ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o ${OBJECTDIR}/_ext/1180237584/color.o
 
 # Source Files
-SOURCEFILES=../_Experimental/_EXAMPLES_.c ../_Experimental/_LOG.c ../_Experimental/e_pca9685.c ../_External_Components/e_mcp23s17.c ../_External_Components/e_ws2812b.c ../_External_Components/e_amis30621.c ../_External_Components/e_qt2100.c ../_External_Components/e_tmc429.c ../_External_Components/e_25lc512.c ../_High_Level_Driver/lin.c ../_High_Level_Driver/ble.c ../_High_Level_Driver/one_wire_communication.c ../_High_Level_Driver/utilities.c ../_High_Level_Driver/string_advance.c ../_Low_Level_Driver/s14_timers.c ../_Low_Level_Driver/s08_interrupt_mapping.c ../_Low_Level_Driver/s23_spi.c ../_Low_Level_Driver/s17_adc.c ../_Low_Level_Driver/s16_output_compare.c ../_Low_Level_Driver/s24_i2c.c ../_Low_Level_Driver/s34_can.c ../_Low_Level_Driver/s35_ethernet_Applications.c ../_Low_Level_Driver/s35_ethernet_OSI-2_DataLinkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-3_NetworkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-4_TransportLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-5_ApplicationLayer.c ../_Low_Level_Driver/s35_ethernet_TCPIP.c ../_Low_Level_Driver/s12_ports.c ../_Low_Level_Driver/s21_uart.c
+SOURCEFILES=../_Experimental/_EXAMPLES_.c ../_Experimental/_LOG.c ../_Experimental/e_pca9685.c ../_External_Components/e_mcp23s17.c ../_External_Components/e_ws2812b.c ../_External_Components/e_amis30621.c ../_External_Components/e_qt2100.c ../_External_Components/e_tmc429.c ../_External_Components/e_25lc512.c ../_High_Level_Driver/lin.c ../_High_Level_Driver/ble.c ../_High_Level_Driver/one_wire_communication.c ../_High_Level_Driver/utilities.c ../_High_Level_Driver/string_advance.c ../_Low_Level_Driver/s14_timers.c ../_Low_Level_Driver/s08_interrupt_mapping.c ../_Low_Level_Driver/s23_spi.c ../_Low_Level_Driver/s17_adc.c ../_Low_Level_Driver/s16_output_compare.c ../_Low_Level_Driver/s24_i2c.c ../_Low_Level_Driver/s34_can.c ../_Low_Level_Driver/s35_ethernet_Applications.c ../_Low_Level_Driver/s35_ethernet_OSI-2_DataLinkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-3_NetworkLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-4_TransportLayer.c ../_Low_Level_Driver/s35_ethernet_OSI-5_ApplicationLayer.c ../_Low_Level_Driver/s35_ethernet_TCPIP.c ../_Low_Level_Driver/s12_ports.c ../_Low_Level_Driver/s21_uart.c ../_High_Level_Driver/scheduler.c ../_External_Components/e_ws2812b_encoder.c ../_High_Level_Driver/color.c
 
 
 CFLAGS=
@@ -280,6 +280,24 @@ ${OBJECTDIR}/_ext/376376446/s21_uart.o: ../_Low_Level_Driver/s21_uart.c  nbproje
 	@${RM} ${OBJECTDIR}/_ext/376376446/s21_uart.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/376376446/s21_uart.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD4=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/376376446/s21_uart.o.d" -o ${OBJECTDIR}/_ext/376376446/s21_uart.o ../_Low_Level_Driver/s21_uart.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/_ext/1180237584/scheduler.o: ../_High_Level_Driver/scheduler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1180237584" 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/scheduler.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1180237584/scheduler.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD4=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/1180237584/scheduler.o.d" -o ${OBJECTDIR}/_ext/1180237584/scheduler.o ../_High_Level_Driver/scheduler.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o: ../_External_Components/e_ws2812b_encoder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/830869050" 
+	@${RM} ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d 
+	@${RM} ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD4=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d" -o ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o ../_External_Components/e_ws2812b_encoder.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/_ext/1180237584/color.o: ../_High_Level_Driver/color.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1180237584" 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/color.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/color.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1180237584/color.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_ICD4=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/1180237584/color.o.d" -o ${OBJECTDIR}/_ext/1180237584/color.o ../_High_Level_Driver/color.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
 else
 ${OBJECTDIR}/_ext/1717005096/_EXAMPLES_.o: ../_Experimental/_EXAMPLES_.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} "${OBJECTDIR}/_ext/1717005096" 
@@ -455,6 +473,24 @@ ${OBJECTDIR}/_ext/376376446/s21_uart.o: ../_Low_Level_Driver/s21_uart.c  nbproje
 	@${RM} ${OBJECTDIR}/_ext/376376446/s21_uart.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/376376446/s21_uart.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/376376446/s21_uart.o.d" -o ${OBJECTDIR}/_ext/376376446/s21_uart.o ../_Low_Level_Driver/s21_uart.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
 	
+${OBJECTDIR}/_ext/1180237584/scheduler.o: ../_High_Level_Driver/scheduler.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1180237584" 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/scheduler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/scheduler.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1180237584/scheduler.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/1180237584/scheduler.o.d" -o ${OBJECTDIR}/_ext/1180237584/scheduler.o ../_High_Level_Driver/scheduler.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o: ../_External_Components/e_ws2812b_encoder.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/830869050" 
+	@${RM} ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d 
+	@${RM} ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o.d" -o ${OBJECTDIR}/_ext/830869050/e_ws2812b_encoder.o ../_External_Components/e_ws2812b_encoder.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
+${OBJECTDIR}/_ext/1180237584/color.o: ../_High_Level_Driver/color.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} "${OBJECTDIR}/_ext/1180237584" 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/color.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1180237584/color.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1180237584/color.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -O3 -MMD -MF "${OBJECTDIR}/_ext/1180237584/color.o.d" -o ${OBJECTDIR}/_ext/1180237584/color.o ../_High_Level_Driver/color.c    -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD) 
+	
 endif
 
 # ------------------------------------------------------------------------------------
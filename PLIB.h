@@ -37,14 +37,17 @@
 #include "_Low_Level_Driver/s35_ethernet_Applications.h"
 
 #include "_High_Level_Driver/utilities.h"
+#include "_High_Level_Driver/color.h"
 #include "_High_Level_Driver/string_advance.h"
 #include "_High_Level_Driver/one_wire_communication.h"
 #include "_High_Level_Driver/lin.h"
 #include "_High_Level_Driver/ble.h"
+#include "_High_Level_Driver/scheduler.h"
 
 #include "_External_Components/e_25lc512.h"
 #include "_External_Components/e_mcp23s17.h"
 #include "_External_Components/e_ws2812b.h"
+#include "_External_Components/e_ws2812b_encoder.h"
 #include "_External_Components/e_qt2100.h"
 #include "_External_Components/e_amis30621.h"
 #include "_External_Components/e_tmc429.h"
@@ -333,6 +333,7 @@ void _EXAMPLE_LOG(ACQUISITIONS_VAR var)
             break;
             
         case _MAIN:
+            log_deamon();   // Send the messages stored by LOG() (one at a time, when the DMA is free)
             switch (sm_log.index)
             {
                 case 0:
@@ -740,7 +741,7 @@ void _EXAMPLE_UART()
 
 void _EXAMPLE_PCA9685()
 {
-    PCA9685_DEF(pca9685, I2C2, 0x80);
+    PCA9685_DEF(pca9685, I2C2, 0x80, TICK_20MS);
     BUS_MANAGEMENT_DEF(bm_i2c2, &pca9685.i2c_params.bus_management_params);
     static state_machine_t sm_example = {0};
     
@@ -748,6 +749,13 @@ void _EXAMPLE_PCA9685()
     {
         case _SETUP:          
       
+            // The I2C transactions are driven by the interruption. The application defines the vector (IPL3 = IRQ_PRIORITY_LEVEL_3):
+            //      void __ISR(_I2C_2_VECTOR, IPL3SOFT) I2c2Handler(void)
+            //      {
+            //          i2c_master_interrupt_handler(I2C2);
+            //      }
+            // Without this line (and the vector), they are polled by e_pca9685_deamon.
+            i2c_queue_init(I2C2, IRQ_PRIORITY_LEVEL_3);
             sm_example.index = _MAIN;
             break;
             
@@ -760,8 +768,7 @@ void _EXAMPLE_PCA9685()
             e_pca9685_set_pwm_with_phase(pca9685, 4, 1024, 2048);
             e_pca9685_set_pwm_with_phase(pca9685, 5, 1280, 2048);
             e_pca9685_set_pwm_with_phase(pca9685, 6, 1536, 2048);
-            pca9685.registers.PWM[7].phase = 1792;
-            pca9685.registers.PWM[7].dc = 244;
+            e_pca9685_set_pwm_with_phase(pca9685, 7, 1792, 2548);
             e_pca9685_set_pwm_with_phase(pca9685, 8, 2048, 2048);
             e_pca9685_set_pwm_with_phase(pca9685, 9, 2304, 2048);
             e_pca9685_set_pwm_with_phase(pca9685, 10, 2560, 2048);
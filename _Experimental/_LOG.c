@@ -3,18 +3,72 @@
 *
 *	Revision history	:
 *		19/10/2018		- Initial release
+*		17/10/2026		- Deferred logger: LOG() only stores the message
+*						  (tick, format, arguments) in a ring, log_deamon()
+*						  formats it and sends it by DMA in the main loop
+*		17/10/2026		- Binary mode (log_set_mode): compact records
+*						  decoded on the PC by _LOG_DECODER.py
 * 
 *   Description:
 *   ------------ 
+*   LOG(), LOG_SHORT() and LOG_BLANCK() can be called from the main loop
+*   and from the interrupts: the caller copies its arguments in a free
+*   entry of the ring (LOG_RING_SIZE entries) and returns. It never waits
+*   for the UART. log_deamon() must be called in the main loop: when the
+*   DMA is free, it formats the oldest entry in the line buffer and starts
+*   its transmission.
+*   If the ring is full the message is lost and counted (log_get_dropped()).
+*   The number of lost messages is printed before the next message sent.
+*   Be careful: %s stores the pointer of the string (not a copy), the
+*   string must be constant or static. p_float() stores the value of the
+*   float when LOG() is called.
+*
+*   Binary mode (LOG_MODE_BINARY):
+*   ------------------------------
+*   The messages are not formatted: log_deamon() sends as many records as
+*   possible in each DMA transfer and the PC rebuilds the text lines with
+*   _LOG_DECODER.py. The dictionary of the format strings is the ELF file
+*   of the application (a format is identified by its address in flash).
+*   All the integers are varints (7 bits per byte, LSB first, bit 7 set if
+*   another byte follows).
+*   - Sync record: 0xF0, TICK_1S, tick (low 32 bits), tick (high 32 bits),
+*     total number of lost messages. Sent before the first message, every
+*     LOG_BIN_SYNC_PERIOD messages, when a message is lost or when the
+*     delta does not fit in 32 bits.
+*   - Message record: 0x80 | (level << 4) | nargs, address of the format
+*     - LOG_BIN_FMT_BASE, ticks since the previous record, arguments.
+*   - Argument: varint, except %f (4 bytes, IEEE754 little endian) and %s:
+*     (address - LOG_BIN_FMT_BASE) << 1 if the string is in flash,
+*     (length << 1) | 1 followed by the characters otherwise (the string
+*     is truncated to LOG_BIN_STRING_MAX characters).
+*
  * TO DO
- * STOP to print if overtaken buffer
  * Compatible with UART & DMA perso
 *********************************************************************/
 
 #include "../PLIB.h"
 
+typedef struct
+{
+    uint64_t        tick;
+    const char      *p_message;
+    uint8_t         level;
+    uint8_t         nargs;
+    volatile bool   is_ready;
+    uint32_t        args[LOG_MAX_ARGS];
+} LOG_ENTRY_t;
+
 static UART_MODULE module_id;
 static bool dma_tx_in_progress = false;
+static LOG_ENTRY_t log_ring[LOG_RING_SIZE];
+static volatile uint32_t log_head = 0;          // Next entry to reserve (LOG)
+static volatile uint32_t log_tail = 0;          // Next entry to send (log_deamon)
+static volatile uint32_t log_dropped = 0;
+static uint32_t log_dropped_reported = 0;
+static char log_line[LOG_LINE_SIZE];
+static LOG_MODE_t log_mode = LOG_MODE_TEXT;
+static uint64_t log_bin_last_tick = 0;
+static uint32_t log_bin_count = 0;             // Messages sent since the last sync record
 const uint8_t uart_tx_irq[] = 
 {
     _UART1_TX_IRQ,
@@ -51,10 +105,10 @@ void log_init(UART_MODULE id, uint32_t data_rate)
 
 static uint16_t _transform_integer_to_string(char *p_buffer, uint16_t index_p_buffer, uint32_t value, LOG_BASE_t _base, uint8_t number_of_char)
 {
-    static char dictionary_char[]= "0123456789ABCDEF";
-	static char buffer[20] = {0}; 
-	char *ptr = &buffer[19];
-    uint8_t _number_of_char = number_of_char;
+    static const char dictionary_char[]= "0123456789ABCDEF";
+	char buffer[LOG_MAX_DIGITS + 1];
+	char *ptr = &buffer[LOG_MAX_DIGITS];
+    uint8_t _number_of_char = (number_of_char > LOG_MAX_DIGITS) ? LOG_MAX_DIGITS : number_of_char;
     
     if (_base == BASE_2)
     {
@@ -66,7 +120,7 @@ static uint16_t _transform_integer_to_string(char *p_buffer, uint16_t index_p_bu
         p_buffer[index_p_buffer++] = 'x';
     }
     
-    if (number_of_char == 0)    
+    if (_number_of_char == 0)
     {
         do 
         { 
@@ -85,19 +139,16 @@ static uint16_t _transform_integer_to_string(char *p_buffer, uint16_t index_p_bu
         while (--_number_of_char != 0); 
     }
     
-    do
+    while (ptr != &buffer[LOG_MAX_DIGITS])
     {
         p_buffer[index_p_buffer++] = *ptr++;
     }
-    while (*ptr != '\0');
     
     return index_p_buffer;
 }
 
-static uint16_t _get_header_to_string(char *p_buffer, uint16_t index_buffer, LOG_LEVEL_t level)
+static uint16_t _get_header_to_string(char *p_buffer, uint16_t index_buffer, LOG_LEVEL_t level, uint64_t time)
 {
-    uint8_t i = 0;
-    uint64_t time           = mGetTick();
     uint64_t time_us        = (time / TICK_1US);
     uint64_t time_ms        = (time / TICK_1MS);
     uint64_t time_s         = ((time / TICK_1S) % 60);
@@ -133,36 +184,30 @@ static uint16_t _get_header_to_string(char *p_buffer, uint16_t index_buffer, LOG
     return index_buffer;
 }
 
-void log_wait_end_of_transmission()
-{
-    while (dma_tx_in_progress)
-    {
-        if (irq_get_flag(IRQ_DMA6))
-        {
-            irq_clr_flag(IRQ_DMA6);
-            dma_tx_in_progress = false;
-        }
-    }
-}
-
-void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_args, uint8_t nargs)
+/*
+ * Format one entry of the ring in p_buffer (LOG_LINE_SIZE bytes). The message
+ * is truncated if it does not fit: each field is written only if at least
+ * LOG_FIELD_SIZE_MAX bytes are free (the biggest field is a %32b).
+ */
+static uint16_t _format_entry(char *p_buffer, const LOG_ENTRY_t *p_entry)
 {
-    char *p_str = (char *) p_message;
-    char buffer[16000] = {0};
+    const char *p_str = p_entry->p_message;
+    const uint32_t *p_args = p_entry->args;
+    uint8_t nargs = p_entry->nargs;
     uint16_t index_buffer = 0;
     uint8_t index_args = 0;
     uint8_t _number_of_char_to_print = 0;
     
-    if (level != LEVEL_2)
+    if (p_entry->level != LEVEL_2)
     {
-        index_buffer = _get_header_to_string(buffer, index_buffer, level);
+        index_buffer = _get_header_to_string(p_buffer, index_buffer, p_entry->level, p_entry->tick);
     }
     
-    while (*p_str != '\0')
+    while ((*p_str != '\0') && (index_buffer < (LOG_LINE_SIZE - LOG_FIELD_SIZE_MAX)))
     {
         if (*p_str != '%')
         {
-            buffer[index_buffer++] = *p_str;
+            p_buffer[index_buffer++] = *p_str;
         }
         else
         {
@@ -185,7 +230,7 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 'c':
                     if (index_args < nargs)
                     {
-                        buffer[index_buffer++] = p_args[index_args];
+                        p_buffer[index_buffer++] = p_args[index_args];
                         index_args++;
                     }
                     break;
@@ -193,12 +238,11 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 's':
                     if (index_args < nargs)
                     {
-                        char *str = (char *) p_args[index_args];
-                        do
+                        const char *str = (const char *) p_args[index_args];
+                        while ((*str != '\0') && (index_buffer < (LOG_LINE_SIZE - LOG_FIELD_SIZE_MAX)))
                         {
-                            buffer[index_buffer++] = *str++;
+                            p_buffer[index_buffer++] = *str++;
                         }
-                        while (*str != '\0');
                         index_args++;
                     }
                     break;
@@ -206,7 +250,7 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 'b':
                     if (index_args < nargs)
                     {
-                        index_buffer = _transform_integer_to_string(buffer, index_buffer, p_args[index_args], BASE_2, _number_of_char_to_print);
+                        index_buffer = _transform_integer_to_string(p_buffer, index_buffer, p_args[index_args], BASE_2, _number_of_char_to_print);
                         index_args++;
                     }
                     break;
@@ -214,7 +258,7 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 'o':
                     if (index_args < nargs)
                     {
-                        index_buffer = _transform_integer_to_string(buffer, index_buffer, p_args[index_args], BASE_8, _number_of_char_to_print);
+                        index_buffer = _transform_integer_to_string(p_buffer, index_buffer, p_args[index_args], BASE_8, _number_of_char_to_print);
                         index_args++;
                     }
                     break;
@@ -222,7 +266,7 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 'd':
                     if (index_args < nargs)
                     {
-                        index_buffer = _transform_integer_to_string(buffer, index_buffer, p_args[index_args], BASE_10, _number_of_char_to_print);
+                        index_buffer = _transform_integer_to_string(p_buffer, index_buffer, p_args[index_args], BASE_10, _number_of_char_to_print);
                         index_args++;
                     }
                     break;
@@ -230,7 +274,7 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 'x':
                     if (index_args < nargs)
                     {
-                        index_buffer = _transform_integer_to_string(buffer, index_buffer, p_args[index_args], BASE_16, _number_of_char_to_print);
+                        index_buffer = _transform_integer_to_string(p_buffer, index_buffer, p_args[index_args], BASE_16, _number_of_char_to_print);
                         index_args++;
                     }
                     break;
@@ -238,17 +282,25 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
                 case 'f':
                     if (index_args < nargs)
                     {
-                        float *p_val = (float *) (uint32_t *) p_args[index_args];
-                        float v = *p_val;
-                        uint32_t integer = fu_get_integer_value(v);
-                        uint32_t decimal = fu_get_decimal_value(v, (_number_of_char_to_print == 0) ? 3 : _number_of_char_to_print);
+                        LOG_FLOAT_t val = { .u = p_args[index_args] };
+                        uint8_t digits = (_number_of_char_to_print == 0) ? 3 : ((_number_of_char_to_print > 9) ? 9 : _number_of_char_to_print);
+                        uint32_t integer = fu_get_integer_value(val.f);
+                        uint32_t decimal = fu_get_decimal_value(val.f, digits);
                         
-                        index_buffer = _transform_integer_to_string(buffer, index_buffer, integer, BASE_10, 0);
-                        buffer[index_buffer++] = ',';
-                        index_buffer = _transform_integer_to_string(buffer, index_buffer, decimal, BASE_10, (_number_of_char_to_print == 0) ? 3 : _number_of_char_to_print);
+                        index_buffer = _transform_integer_to_string(p_buffer, index_buffer, integer, BASE_10, 0);
+                        p_buffer[index_buffer++] = ',';
+                        index_buffer = _transform_integer_to_string(p_buffer, index_buffer, decimal, BASE_10, digits);
                         index_args++;
                     }
                     break;
+
+                case '%':
+                    p_buffer[index_buffer++] = '%';
+                    break;
+
+                case '\0':
+                    p_str--;        // Single '%' at the end of the format
+                    break;
                     
                 default:
                     if (index_args < nargs)
@@ -261,9 +313,293 @@ void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_ar
         p_str++;
     }
     
-    buffer[index_buffer++] = '\n'; 
-    buffer[index_buffer++] = '\r';
-    DmaChnSetTxfer(DMA_CHANNEL6, buffer, (void *)p_tx_reg[module_id], index_buffer, 1, 1);
+    p_buffer[index_buffer++] = '\n';
+    p_buffer[index_buffer++] = '\r';
+    return index_buffer;
+}
+
+static uint16_t _put_varint(uint8_t *p_buffer, uint16_t index_buffer, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        p_buffer[index_buffer++] = (uint8_t) value | 0x80;
+        value >>= 7;
+    }
+    p_buffer[index_buffer++] = (uint8_t) value;
+    return index_buffer;
+}
+
+/*
+ * Return the next conversion of the format which consumes an argument
+ * ('\0' at the end of the format). Same parsing as _format_entry().
+ */
+static char _get_next_conversion(const char **pp_str)
+{
+    const char *p_str = *pp_str;
+    char conversion = '\0';
+
+    while ((conversion == '\0') && (*p_str != '\0'))
+    {
+        if (*p_str++ == '%')
+        {
+            if ((*p_str >= '0') && (*p_str <= '9'))
+            {
+                p_str++;
+                if ((*p_str >= '0') && (*p_str <= '9'))
+                {
+                    p_str++;
+                }
+            }
+            if (*p_str == '\0')
+            {
+                break;
+            }
+            if (*p_str != '%')
+            {
+                conversion = *p_str;
+            }
+            p_str++;
+        }
+    }
+    *pp_str = p_str;
+    return conversion;
+}
+
+static bool _is_in_flash(uint32_t address)
+{
+    return (((address & 0x1ff00000) == 0x1d000000) || ((address & 0x1fc00000) == 0x1fc00000));
+}
+
+static uint16_t _encode_sync(uint8_t *p_buffer, uint16_t index_buffer, uint64_t tick, uint32_t dropped)
+{
+    p_buffer[index_buffer++] = LOG_BIN_SYNC;
+    index_buffer = _put_varint(p_buffer, index_buffer, TICK_1S);
+    index_buffer = _put_varint(p_buffer, index_buffer, (uint32_t) tick);
+    index_buffer = _put_varint(p_buffer, index_buffer, (uint32_t) (tick >> 32));
+    index_buffer = _put_varint(p_buffer, index_buffer, dropped);
+    log_bin_last_tick = tick;
+    log_bin_count = 0;
+    return index_buffer;
+}
+
+static uint16_t _encode_entry(uint8_t *p_buffer, uint16_t index_buffer, const LOG_ENTRY_t *p_entry)
+{
+    const char *p_str = p_entry->p_message;
+    uint8_t i;
+
+    p_buffer[index_buffer++] = LOG_BIN_MESSAGE | (p_entry->level << 4) | p_entry->nargs;
+    index_buffer = _put_varint(p_buffer, index_buffer, (uint32_t) p_entry->p_message - LOG_BIN_FMT_BASE);
+    index_buffer = _put_varint(p_buffer, index_buffer, (uint32_t) (p_entry->tick - log_bin_last_tick));
+    log_bin_last_tick = p_entry->tick;
+
+    for (i = 0 ; i < p_entry->nargs ; i++)
+    {
+        uint32_t arg = p_entry->args[i];
+
+        switch (_get_next_conversion(&p_str))
+        {
+            case 'f':
+                p_buffer[index_buffer++] = (uint8_t) arg;
+                p_buffer[index_buffer++] = (uint8_t) (arg >> 8);
+                p_buffer[index_buffer++] = (uint8_t) (arg >> 16);
+                p_buffer[index_buffer++] = (uint8_t) (arg >> 24);
+                break;
+
+            case 's':
+                if (_is_in_flash(arg))
+                {
+                    index_buffer = _put_varint(p_buffer, index_buffer, (arg - LOG_BIN_FMT_BASE) << 1);
+                }
+                else
+                {
+                    const char *str = (const char *) arg;
+                    uint8_t length = 0;
+
+                    while ((length < LOG_BIN_STRING_MAX) && (str[length] != '\0'))
+                    {
+                        length++;
+                    }
+                    index_buffer = _put_varint(p_buffer, index_buffer, (length << 1) | 1);
+                    memcpy(&p_buffer[index_buffer], str, length);
+                    index_buffer += length;
+                }
+                break;
+
+            default:
+                index_buffer = _put_varint(p_buffer, index_buffer, arg);
+                break;
+        }
+    }
+
+    log_bin_count++;
+    return index_buffer;
+}
+
+/*
+ * Encode (binary mode) the ready entries of the ring in p_buffer, as many
+ * as possible in LOG_LINE_SIZE bytes. Return the size of the transfer.
+ */
+static uint16_t _encode_ready_entries(uint8_t *p_buffer)
+{
+    LOG_ENTRY_t *p_entry;
+    uint16_t index_buffer = 0;
+    uint32_t dropped;
+
+    while ((index_buffer <= (LOG_LINE_SIZE - LOG_BIN_RECORD_SIZE_MAX)) && (log_tail != log_head))
+    {
+        p_entry = &log_ring[log_tail & (LOG_RING_SIZE - 1)];
+        if (!p_entry->is_ready)
+        {
+            break;
+        }
+        __sync_synchronize();       // The entry is read after 'is_ready'
+
+        dropped = log_dropped;
+        if ((log_bin_count == 0) || (log_bin_count >= LOG_BIN_SYNC_PERIOD) || (dropped != log_dropped_reported) || ((p_entry->tick - log_bin_last_tick) > 0xffffffff))
+        {
+            index_buffer = _encode_sync(p_buffer, index_buffer, p_entry->tick, dropped);
+            log_dropped_reported = dropped;
+        }
+        index_buffer = _encode_entry(p_buffer, index_buffer, p_entry);
+
+        p_entry->is_ready = false;
+        __sync_synchronize();       // The entry is read before being released
+        log_tail++;
+    }
+
+    return index_buffer;
+}
+
+static void _start_transmission(uint16_t size)
+{
+    DmaChnSetTxfer(DMA_CHANNEL6, log_line, (void *)p_tx_reg[module_id], size, 1, 1);
     DmaChnStartTxfer(DMA_CHANNEL6, DMA_WAIT_NOT, 0);
     dma_tx_in_progress = true;
 }
+
+static bool _is_transmission_in_progress()
+{
+    if (dma_tx_in_progress && irq_get_flag(IRQ_DMA6))
+    {
+        irq_clr_flag(IRQ_DMA6);
+        dma_tx_in_progress = false;
+    }
+    return dma_tx_in_progress;
+}
+
+void log_wait_end_of_transmission()
+{
+    while (_is_transmission_in_progress());
+}
+
+/*
+ * Hot path of LOG() (main loop or interrupt): reserve an entry with the
+ * interrupts disabled (a few instructions) then copy the message in it.
+ * The entry is published with 'is_ready' so log_deamon() never reads an
+ * entry still written by a preempted caller.
+ */
+void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_args, uint8_t nargs)
+{
+    LOG_ENTRY_t *p_entry;
+    uint32_t head;
+    uint8_t i;
+    uint32_t status = __builtin_disable_interrupts();
+
+    head = log_head;
+    if ((head - log_tail) >= LOG_RING_SIZE)
+    {
+        log_dropped++;
+        if (status & 0x00000001)
+        {
+            __builtin_enable_interrupts();
+        }
+        return;
+    }
+    log_head = head + 1;
+
+    if (status & 0x00000001)
+    {
+        __builtin_enable_interrupts();
+    }
+
+    p_entry = &log_ring[head & (LOG_RING_SIZE - 1)];
+    p_entry->tick = mGetTick();
+    p_entry->p_message = p_message;
+    p_entry->level = level;
+    p_entry->nargs = (nargs > LOG_MAX_ARGS) ? LOG_MAX_ARGS : nargs;
+    for (i = 0 ; i < p_entry->nargs ; i++)
+    {
+        p_entry->args[i] = p_args[i];
+    }
+    __sync_synchronize();       // The entry is written before being published
+    p_entry->is_ready = true;
+}
+
+/*
+ * Must be called in the main loop (not in an interrupt). Send one message
+ * (the oldest one) each time the DMA is free in text mode, all the
+ * messages which fit in LOG_LINE_SIZE bytes in binary mode.
+ */
+void log_deamon()
+{
+    LOG_ENTRY_t *p_entry;
+    uint32_t dropped;
+    uint16_t size;
+
+    if (_is_transmission_in_progress())
+    {
+        return;
+    }
+
+    if (log_mode == LOG_MODE_BINARY)
+    {
+        size = _encode_ready_entries((uint8_t *) log_line);
+        if (size > 0)
+        {
+            _start_transmission(size);
+        }
+        return;
+    }
+
+    dropped = log_dropped;
+    if (dropped != log_dropped_reported)
+    {
+        LOG_ENTRY_t report = {.tick = mGetTick(), .p_message = "!! %d log(s) lost !!", .level = LEVEL_2, .nargs = 1, .args = {dropped - log_dropped_reported}};
+
+        log_dropped_reported = dropped;
+        _start_transmission(_format_entry(log_line, &report));
+        return;
+    }
+
+    if (log_tail == log_head)
+    {
+        return;
+    }
+    p_entry = &log_ring[log_tail & (LOG_RING_SIZE - 1)];
+    if (!p_entry->is_ready)
+    {
+        return;
+    }
+    __sync_synchronize();       // The entry is read after 'is_ready'
+    size = _format_entry(log_line, p_entry);
+    p_entry->is_ready = false;
+    __sync_synchronize();       // The entry is read before being released
+    log_tail++;
+
+    _start_transmission(size);
+}
+
+uint32_t log_get_dropped()
+{
+    return log_dropped;
+}
+
+/*
+ * LOG_MODE_TEXT (default) or LOG_MODE_BINARY (decoded with _LOG_DECODER.py).
+ * Must be called in the main loop (as log_deamon()).
+ */
+void log_set_mode(LOG_MODE_t mode)
+{
+    log_mode = mode;
+    log_bin_count = 0;      // The first binary record is a sync record
+}
@@ -1,6 +1,43 @@
 #ifndef __DEF_LOG
 #define __DEF_LOG
 
+#ifndef LOG_RING_SIZE
+#define LOG_RING_SIZE                           32      // Number of messages waiting to be sent (power of 2)
+#endif
+#ifndef LOG_MAX_ARGS
+#define LOG_MAX_ARGS                            8       // Arguments stored per message (the next ones are ignored)
+#endif
+#ifndef LOG_LINE_SIZE
+#define LOG_LINE_SIZE                           512     // Size max of a formatted message (truncated after)
+#endif
+#ifndef LOG_BIN_FMT_BASE
+#define LOG_BIN_FMT_BASE                        0x9d000000  // Binary mode: the addresses are sent relative to the program flash (KSEG0)
+#endif
+#ifndef LOG_BIN_SYNC_PERIOD
+#define LOG_BIN_SYNC_PERIOD                     64      // Binary mode: messages between two sync records
+#endif
+#ifndef LOG_BIN_STRING_MAX
+#define LOG_BIN_STRING_MAX                      32      // Binary mode: characters sent for a %s in RAM
+#endif
+#define LOG_MAX_DIGITS                          32
+#define LOG_FIELD_SIZE_MAX                      (LOG_MAX_DIGITS + 4)
+#define LOG_BIN_SYNC                            0xf0
+#define LOG_BIN_MESSAGE                         0x80
+#define LOG_BIN_RECORD_SIZE_MAX                 (21 + 11 + LOG_MAX_ARGS * (1 + LOG_BIN_STRING_MAX))
+
+#if ((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) != 0)
+#error "LOG_RING_SIZE must be a power of 2"
+#endif
+#if (LOG_MAX_ARGS > 15)
+#error "LOG_MAX_ARGS must be lower than 16 (binary mode)"
+#endif
+#if ((LOG_BIN_STRING_MAX < 4) || (LOG_BIN_STRING_MAX > 63))
+#error "LOG_BIN_STRING_MAX must be in 4..63"
+#endif
+#if (LOG_LINE_SIZE < LOG_BIN_RECORD_SIZE_MAX)
+#error "LOG_LINE_SIZE is too small for a binary record"
+#endif
+
 typedef enum
 {
     BASE_2  = 2,
@@ -16,16 +53,32 @@ typedef enum
     LEVEL_2     = 2,        // LOG_BLANCK(...)  -> your_str
 } LOG_LEVEL_t;
 
+typedef enum
+{
+    LOG_MODE_TEXT   = 0,    // Formatted by the PIC32
+    LOG_MODE_BINARY = 1,    // Compact records formatted by _LOG_DECODER.py
+} LOG_MODE_t;
+
+typedef union
+{
+    float       f;
+    uint32_t    u;
+} LOG_FLOAT_t;
+
 #define p_string(s)                             (uint32_t) (s)
-#define p_float(f)                              (uint32_t) (&f)
+#define p_float(v)                              (((LOG_FLOAT_t) { .f = (v) }).u)
 
-#define LOG_INTERNAL_X(level, str, N, ...)      log_wait_end_of_transmission(); log_frontend(str, level, ((uint32_t[]){ __VA_ARGS__ }), N)
-#define LOG(str, ...)                           LOG_INTERNAL_X(LEVEL_0, str, COUNT_ARGUMENTS( __VA_ARGS__ ), __VA_ARGS__)
-#define LOG_SHORT(str, ...)                     LOG_INTERNAL_X(LEVEL_1, str, COUNT_ARGUMENTS( __VA_ARGS__ ), __VA_ARGS__)
-#define LOG_BLANCK(str, ...)                    LOG_INTERNAL_X(LEVEL_2, str, COUNT_ARGUMENTS( __VA_ARGS__ ), __VA_ARGS__)
+#define LOG_NARGS(...)                          (sizeof((uint32_t[]){ __VA_ARGS__ }) / sizeof(uint32_t))
+#define LOG_INTERNAL_X(level, str, N, ...)      log_frontend(str, level, ((uint32_t[]){ __VA_ARGS__ }), N)
+#define LOG(str, ...)                           LOG_INTERNAL_X(LEVEL_0, str, LOG_NARGS( __VA_ARGS__ ), __VA_ARGS__)
+#define LOG_SHORT(str, ...)                     LOG_INTERNAL_X(LEVEL_1, str, LOG_NARGS( __VA_ARGS__ ), __VA_ARGS__)
+#define LOG_BLANCK(str, ...)                    LOG_INTERNAL_X(LEVEL_2, str, LOG_NARGS( __VA_ARGS__ ), __VA_ARGS__)
 
 void log_init(UART_MODULE id, uint32_t data_rate);
 void log_wait_end_of_transmission();
 void log_frontend(const char *p_message, LOG_LEVEL_t level, const uint32_t *p_args, uint8_t nargs);
+void log_deamon();
+uint32_t log_get_dropped();
+void log_set_mode(LOG_MODE_t mode);
 
 #endif
@@ -0,0 +1,225 @@
+#!/usr/bin/env python3
+"""
+Decoder of the binary logs (_LOG.c, LOG_MODE_BINARY).
+
+The format strings are read in the ELF file of the application (the one
+programmed in the PIC32) and the records received on the UART are
+printed as the text mode of _LOG.c would have printed them.
+
+    stty -F /dev/ttyUSB0 921600 raw
+    python3 _LOG_DECODER.py application.elf /dev/ttyUSB0
+
+The input can also be a file (capture of the UART).
+"""
+
+import argparse
+import struct
+import sys
+
+LOG_BIN_SYNC = 0xf0
+LOG_BIN_MESSAGE = 0x80
+LOG_BIN_FMT_BASE = 0x9d000000
+DIGITS = "0123456789ABCDEF"
+
+
+class Dictionary:
+    """Read only access to the allocated sections of an ELF32 file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            elf = f.read()
+        if elf[:4] != b"\x7fELF" or elf[4] != 1:
+            raise ValueError("%s is not an ELF32 file" % path)
+        endian = "<" if elf[5] == 1 else ">"
+        shoff, = struct.unpack_from(endian + "I", elf, 0x20)
+        shentsize, shnum = struct.unpack_from(endian + "HH", elf, 0x2e)
+        self.sections = []
+        for i in range(shnum):
+            sh_type, sh_flags, sh_addr, sh_offset, sh_size = struct.unpack_from(endian + "IIIII", elf, shoff + i * shentsize + 4)
+            if (sh_flags & 0x2) and sh_addr != 0 and sh_type != 8:     # SHF_ALLOC, not SHT_NOBITS
+                self.sections.append((sh_addr, elf[sh_offset:sh_offset + sh_size]))
+
+    def string(self, address):
+        for a in (address, address ^ 0x20000000):       # KSEG0 / KSEG1
+            for base, data in self.sections:
+                if base <= a < base + len(data):
+                    end = data.find(b"\0", a - base)
+                    return data[a - base:end if end >= 0 else len(data)].decode("latin-1")
+        return None
+
+
+class Stream:
+    def __init__(self, f):
+        self.f = f
+
+    def byte(self):
+        b = self.f.read(1)
+        if not b:
+            raise EOFError
+        return b[0]
+
+    def bytes(self, n):
+        return bytes(self.byte() for _ in range(n))
+
+    def varint(self):
+        value, shift = 0, 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7f) << shift
+            shift += 7
+            if not (b & 0x80):
+                return value
+            if shift > 35:
+                raise ValueError("bad varint")
+
+
+def conversions(fmt):
+    """Same parsing as _format_entry() / _get_next_conversion() of _LOG.c."""
+    i = 0
+    while i < len(fmt):
+        if fmt[i] == "%":
+            i += 1
+            for _ in range(2):
+                if i < len(fmt) and fmt[i].isdigit():
+                    i += 1
+            if i >= len(fmt):
+                return
+            if fmt[i] != "%":
+                yield fmt[i]
+        i += 1
+
+
+def integer_to_string(value, base, number_of_char):
+    s = ""
+    n = min(number_of_char, 32)
+    while True:
+        s = DIGITS[value % base] + s
+        value //= base
+        if n == 0:
+            if value == 0:
+                break
+        else:
+            n -= 1
+            if n == 0:
+                break
+    return {2: "b", 16: "0x"}.get(base, "") + s
+
+
+def f32(v):
+    return struct.unpack("<f", struct.pack("<f", v))[0]
+
+
+def float_to_string(bits, number_of_char):
+    v = struct.unpack("<f", struct.pack("<I", bits))[0]
+    digits = 3 if number_of_char == 0 else min(number_of_char, 9)
+    integer = int(v) & 0xffffffff
+    decimal = int(f32(f32(v - f32(integer)) * f32(10 ** digits))) & 0xffffffff
+    return integer_to_string(integer, 10, 0) + "," + integer_to_string(decimal, 10, digits)
+
+
+def header(level, tick, tick_1s):
+    tick_1us, tick_1ms = tick_1s // 1000000, tick_1s // 1000
+    us, ms = tick // tick_1us, tick // tick_1ms
+    if level == 0:
+        return "%s:%s:%s:%s:%s:%s: " % (integer_to_string(tick // tick_1s // 86400 & 0xffffffff, 10, 0),
+                                        integer_to_string(tick // tick_1s // 3600 % 24, 10, 2),
+                                        integer_to_string(tick // tick_1s // 60 % 60, 10, 2),
+                                        integer_to_string(tick // tick_1s % 60, 10, 2),
+                                        integer_to_string(ms & 0xffffffff, 10, 3),
+                                        integer_to_string(us & 0xffffffff, 10, 3))
+    if level == 1:
+        return "%s:%s: " % (integer_to_string(ms & 0xffffffff, 10, 0), integer_to_string(us & 0xffffffff, 10, 3))
+    return ""
+
+
+def format_message(fmt, level, tick, tick_1s, args):
+    out = [header(level, tick, tick_1s)]
+    index_args = 0
+    i = 0
+    while i < len(fmt):
+        if fmt[i] != "%":
+            out.append(fmt[i])
+        else:
+            n = 0
+            i += 1
+            for _ in range(2):
+                if i < len(fmt) and fmt[i].isdigit():
+                    n = n * 10 + int(fmt[i])
+                    i += 1
+            if i >= len(fmt):
+                break
+            c = fmt[i]
+            if c == "%":
+                out.append("%")
+            elif index_args < len(args):
+                arg = args[index_args]
+                index_args += 1
+                if c == "c":
+                    out.append(chr(arg & 0xff))
+                elif c == "s":
+                    out.append(arg)
+                elif c in "bodx":
+                    out.append(integer_to_string(arg, {"b": 2, "o": 8, "d": 10, "x": 16}[c], n))
+                elif c == "f":
+                    out.append(float_to_string(arg, n))
+        i += 1
+    return "".join(out)
+
+
+def decode(dictionary, stream, out):
+    tick, tick_1s, dropped, synced = 0, 10000000, 0, False
+    while True:
+        b = stream.byte()
+        if b == LOG_BIN_SYNC:
+            tick_1s = stream.varint()
+            tick = stream.varint() | (stream.varint() << 32)
+            total = stream.varint()
+            if synced and total > dropped:
+                out.write("!! %d log(s) lost !!\n" % (total - dropped))
+            dropped, synced = total, True
+        elif synced and (b & 0xc0) == LOG_BIN_MESSAGE and ((b >> 4) & 0x03) != 3:
+            level, nargs = (b >> 4) & 0x03, b & 0x0f
+            address = (stream.varint() + LOG_BIN_FMT_BASE) & 0xffffffff
+            tick += stream.varint()
+            fmt = dictionary.string(address)
+            if fmt is None:
+                out.write("!! unknown format 0x%08x (wrong ELF file?) !!\n" % address)
+                synced = False
+                continue
+            types = list(conversions(fmt))
+            args = []
+            for i in range(nargs):
+                c = types[i] if i < len(types) else ""
+                if c == "f":
+                    args.append(struct.unpack("<I", stream.bytes(4))[0])
+                elif c == "s":
+                    v = stream.varint()
+                    if v & 1:
+                        args.append(stream.bytes(v >> 1).decode("latin-1"))
+                    else:
+                        s = dictionary.string(((v >> 1) + LOG_BIN_FMT_BASE) & 0xffffffff)
+                        args.append("<?>" if s is None else s)
+                else:
+                    args.append(stream.varint())
+            out.write(format_message(fmt, level, tick, tick_1s, args) + "\n")
+        else:
+            synced = False      # Wait for the next sync record
+        out.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode the binary logs of _LOG.c (LOG_MODE_BINARY).")
+    parser.add_argument("elf", help="ELF file of the application (dictionary of the format strings)")
+    parser.add_argument("input", nargs="?", help="serial port or capture file (stdin by default)")
+    args = parser.parse_args()
+
+    dictionary = Dictionary(args.elf)
+    f = open(args.input, "rb", buffering=0) if args.input else sys.stdin.buffer
+    try:
+        decode(dictionary, Stream(f), sys.stdout)
+    except (EOFError, KeyboardInterrupt):
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -4,188 +4,280 @@
 *
 *	Revision history	:
 *		09/12/2018		- Initial release
+*		17/10/2026		- The registers are sent with one I2C transaction (i2c_transaction_submit).
+*		17/10/2026		- Only the modified channels are sent (auto-increment bursts or
+*						ALL_LED) at the update period of the PCA9685_DEF.
 * 
 *********************************************************************/
 
 #include "../PLIB.h"
 
-static void e_pca9685_handler(uint8_t id, IRQ_EVENT_TYPE evt_type, uint32_t data)
+/*******************************************************************************
+ * Function: 
+ *      void e_pca9685_write_pwm(PCA9685_CONFIG *var, uint8_t id, uint16_t phase, uint16_t dc)
+ * 
+ * Description:
+ *      This routine writes a channel in the RAM copy of the registers. The 
+ *      channel is sent at the next update only if its value has changed.
+ *      Use the macros e_pca9685_set_pwm, e_pca9685_set_pwm_with_phase, 
+ *      e_pca9685_clear_output and e_pca9685_set_output.
+ * 
+ * Parameters:
+ *      *var: The PCA9685_CONFIG variable.
+ *      id: The channel (0 to 15).
+ *      phase: LEDn_ON value (bit 12: full ON).
+ *      dc: LEDn_OFF value (bit 12: full OFF).
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+void e_pca9685_write_pwm(PCA9685_CONFIG *var, uint8_t id, uint16_t phase, uint16_t dc)
 {
-    switch (evt_type)
+    if (id < PCA9685_NUMBER_OF_CHANNELS)
     {
-        case IRQ_I2C_MASTER:
-            /*
-             * Events: 
-             * - Start
-             * - Repeated Start
-             * - Stop
-             * - data transmit + ACK receive (9th clock)
-             * _ data receive + ACK transmit (9th clock)
-             */
-            break;
-        case IRQ_I2C_SLAVE:
-            break;
-        case IRQ_I2C_BUS_COLISION:
+        if ((var->registers.PWM[id].phase != phase) || (var->registers.PWM[id].dc != dc))
+        {
+            var->registers.PWM[id].phase = phase;
+            var->registers.PWM[id].dc = dc;
+            var->dirty_channels |= (1 << id);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void e_pca9685_submit(PCA9685_CONFIG *var, uint8_t address_register, const void *p_tx, uint16_t size)
+ * 
+ * Description:
+ *      This routine queues the write of size bytes from address_register 
+ *      with the next free transaction of the variable.
+ * 
+ * Parameters:
+ *      *var: The PCA9685_CONFIG variable.
+ *      address_register: The first register.
+ *      *p_tx: The bytes to send (must not change until the end).
+ *      size: The number of bytes.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void e_pca9685_submit(PCA9685_CONFIG *var, uint8_t address_register, const void *p_tx, uint16_t size)
+{
+    I2C_TRANSACTION *p_transaction = &var->transaction[var->number_of_transactions];
+    
+    p_transaction->address_component = var->i2c_params.address_component;
+    p_transaction->address_register = address_register;
+    p_transaction->register_size = 1;
+    p_transaction->p_tx = (const uint8_t *) p_tx;
+    p_transaction->tx_size = size;
+    p_transaction->p_rx = NULL;
+    p_transaction->rx_size = 0;
+    p_transaction->callback = NULL;
+    p_transaction->p_context = NULL;
+    if (i2c_transaction_submit(var->i2c_params.module, p_transaction))
+    {
+        var->number_of_transactions++;
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void e_pca9685_submit_channels(PCA9685_CONFIG *var, uint8_t max_bursts)
+ * 
+ * Description:
+ *      This routine sends the dirty channels. The contiguous channels are 
+ *      merged in one auto-increment burst (4 bytes per channel). If there 
+ *      are more bursts than max_bursts, the bursts separated by the smallest
+ *      gap are merged (the clean channels between them are sent again).
+ *      If all the channels have the same value, only ALL_LED is sent.
+ *      The channels are copied in tx_pwm so they can be modified during the
+ *      transfer.
+ * 
+ * Parameters:
+ *      *var: The PCA9685_CONFIG variable.
+ *      max_bursts: The number of transactions available.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void e_pca9685_submit_channels(PCA9685_CONFIG *var, uint8_t max_bursts)
+{
+    uint8_t first[PCA9685_NUMBER_OF_CHANNELS / 2];
+    uint8_t last[PCA9685_NUMBER_OF_CHANNELS / 2];
+    uint8_t number_of_bursts = 0;
+    uint8_t i, j, k;
+    bool is_same_value = true;
+    
+    for (i = 1 ; i < PCA9685_NUMBER_OF_CHANNELS ; i++)
+    {
+        if ((var->registers.PWM[i].phase != var->registers.PWM[0].phase) || (var->registers.PWM[i].dc != var->registers.PWM[0].dc))
+        {
+            is_same_value = false;
             break;
+        }
+    }
+    
+    if (is_same_value && ((var->dirty_channels & (var->dirty_channels - 1)) != 0))
+    {
+        var->tx_pwm[0] = var->registers.PWM[0];
+        e_pca9685_submit(var, PCA9685_REG_ALL_LED, &var->tx_pwm[0], sizeof(PCA9685_PWM));
     }
+    else
+    {
+        for (i = 0 ; i < PCA9685_NUMBER_OF_CHANNELS ; i++)
+        {
+            if (GET_BIT(var->dirty_channels, i))
+            {
+                if ((number_of_bursts > 0) && (last[number_of_bursts - 1] == (i - 1)))
+                {
+                    last[number_of_bursts - 1] = i;
+                }
+                else
+                {
+                    first[number_of_bursts] = i;
+                    last[number_of_bursts] = i;
+                    number_of_bursts++;
+                }
+            }
+        }
+        
+        while (number_of_bursts > max_bursts)
+        {
+            for (j = 1, k = 1 ; j < number_of_bursts ; j++)
+            {
+                if ((first[j] - last[j - 1]) < (first[k] - last[k - 1]))
+                {
+                    k = j;
+                }
+            }
+            last[k - 1] = last[k];
+            for (j = k ; j < (number_of_bursts - 1) ; j++)
+            {
+                first[j] = first[j + 1];
+                last[j] = last[j + 1];
+            }
+            number_of_bursts--;
+        }
+        
+        for (j = 0 ; j < number_of_bursts ; j++)
+        {
+            for (i = first[j] ; i <= last[j] ; i++)
+            {
+                var->tx_pwm[i] = var->registers.PWM[i];
+            }
+            e_pca9685_submit(var, PCA9685_REG_LED0 + 4 * first[j], &var->tx_pwm[first[j]], (last[j] - first[j] + 1) * sizeof(PCA9685_PWM));
+        }
+    }
+    
+    var->sent_channels = var->dirty_channels;
+    var->dirty_channels = 0;
 }
 
-/*
- * TO DO :
- * Init sequence:
- * 1. Restart
- * 2. Set frequency
- * 3. Set params
- * 4. pwm in a loop
- */
+/*******************************************************************************
+ * Function: 
+ *      static void e_pca9685_submit_config(PCA9685_CONFIG *var)
+ * 
+ * Description:
+ *      This routine sends MODE1 to ALLCALLADR. If PRESCALE is not 0, it is 
+ *      sent before (the oscillator must be off: MODE1.SLEEP).
+ * 
+ * Parameters:
+ *      *var: The PCA9685_CONFIG variable.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void e_pca9685_submit_config(PCA9685_CONFIG *var)
+{
+    if (var->registers.PRESCALE != 0)
+    {
+        var->mode1_sleep = (var->registers.MODE1 & ~PCA9685_RESTART) | PCA9685_PUT_IN_SLEEP_MODE;
+        e_pca9685_submit(var, PCA9685_REG_MODE1, &var->mode1_sleep, 1);
+        e_pca9685_submit(var, PCA9685_REG_PRESCALE, &var->registers.PRESCALE, 1);
+    }
+    e_pca9685_submit(var, PCA9685_REG_MODE1, &var->registers.MODE1, PCA9685_REG_LED0 - PCA9685_REG_MODE1);
+    
+    var->is_config_sent = true;
+    var->is_config_dirty = false;
+}
 
+/*******************************************************************************
+ * Function: 
+ *      void e_pca9685_deamon(PCA9685_CONFIG *var)
+ * 
+ * Description:
+ *      This routine sends the modifications of the registers each time the 
+ *      bus is granted (update period of the PCA9685_DEF). The bus is released
+ *      immediately if nothing has changed. At the first update, all the 
+ *      registers are sent. If a transaction fails, its registers are sent 
+ *      again at the next update.
+ * 
+ * Parameters:
+ *      *var: The PCA9685_CONFIG variable.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      See. _EXAMPLE_PCA9685
+ ******************************************************************************/
 void e_pca9685_deamon(PCA9685_CONFIG *var)
 {
+    uint8_t i;
+    
     if (!var->is_init_done)
     {
         i2c_init_as_master(var->i2c_params.module, NULL, I2C_FREQUENCY_400KHZ, I2C_CONTINUE_ON_IDLE | I2C_DISABLE_SMBUS);
-        IRQInit(IRQ_I2C2B, IRQ_DISABLED, IRQ_PRIORITY_LEVEL_3, IRQ_SUB_PRIORITY_LEVEL_1);
-        IRQInit(IRQ_I2C2S, IRQ_DISABLED, IRQ_PRIORITY_LEVEL_3, IRQ_SUB_PRIORITY_LEVEL_1);
-        IRQInit(IRQ_I2C2M, IRQ_DISABLED, IRQ_PRIORITY_LEVEL_3, IRQ_SUB_PRIORITY_LEVEL_1);
         var->is_init_done = true;
     }
     else
     {
         if (var->i2c_params.bus_management_params.is_running)
         {
-            if (!i2c_is_busy(var->i2c_params.module))
+            switch (var->i2c_params.state_machine.index)
             {
-                switch (var->i2c_params.state_machine.index)
-                {
-                    case _HOME:
-
-                        var->tx_buffer.index = 0;
-                        var->tx_buffer.p = (uint8_t*) &var->registers.MODE1;
-                        
-                        var->i2c_params.address_registers = 0;
-                        SET_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_COMPONENT_LSB);
-                        SET_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_REGISTERS_LSB);
-                        
-                        var->i2c_params.state_machine.index = _START;
-                        break;
-
-                    case _START:
+                case _HOME:
 
-                        i2c_start(var->i2c_params.module);
-                        var->i2c_params.state_machine.index = _ADDRESS_COMPONENT_LSB;
-                        break;
+                    var->number_of_transactions = 0;
+                    var->sent_channels = 0;
+                    var->is_config_sent = false;
+                    if (var->is_config_dirty)
+                    {
+                        e_pca9685_submit_config(var);
+                    }
+                    if (var->dirty_channels != 0)
+                    {
+                        e_pca9685_submit_channels(var, PCA9685_MAX_TRANSACTIONS - var->number_of_transactions);
+                    }
+                    var->i2c_params.state_machine.index = _WAIT_AND_VERIFY;
+                    break;
 
-                    case _RESTART:
+                case _WAIT_AND_VERIFY:
 
-                        break;
-                        
-                    case _ADDRESS_COMPONENT_LSB:
-                        
-                        if (!i2c_send_byte(var->i2c_params.module, (var->i2c_params.address_component >> 0) & 0xff))
+                    // The transactions are done in order: the last one ends the update.
+                    if ((var->number_of_transactions == 0) || !var->transaction[var->number_of_transactions - 1].is_pending)
+                    {
+                        for (i = 0 ; i < var->number_of_transactions ; i++)
                         {
-                            CLR_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_COMPONENT_LSB);
-                            var->i2c_params.state_machine.index = _WAIT_AND_VERIFY;
-                        }
-                        break;
-                        
-                    case _ADDRESS_COMPONENT_MSB:
-                        
-                        if (!i2c_send_byte(var->i2c_params.module, (var->i2c_params.address_component >> 8) & 0xff))
-                        {
-                            CLR_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_COMPONENT_MSB);
-                            var->i2c_params.state_machine.index = _WAIT_AND_VERIFY;
-                        }
-                        break;
-                        
-                    case _ADDRESS_REGISTER_LSB:
-                        
-                        if (!i2c_send_byte(var->i2c_params.module, (var->i2c_params.address_registers >> 0) & 0xff))
-                        {
-                            CLR_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_REGISTERS_LSB);
-                            var->i2c_params.state_machine.index = _WAIT_AND_VERIFY;
-                        }
-                        break;
-                        
-                    case _ADDRESS_REGISTER_MSB:
-                        
-                        if (!i2c_send_byte(var->i2c_params.module, (var->i2c_params.address_registers >> 8) & 0xff))
-                        {
-                            CLR_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_REGISTERS_MSB);
-                            var->i2c_params.state_machine.index = _WAIT_AND_VERIFY;
-                        }
-                        break;
-
-                    case _SEND_BYTE:
-
-                        if (!i2c_send_byte(var->i2c_params.module, var->tx_buffer.p[var->tx_buffer.index - 1]))
-                        {
-                            var->i2c_params.state_machine.index = _WAIT_AND_VERIFY;
-                        }
-                        break;
-
-                    case _READ_BYTE:
-
-                        break;
-
-                    case _WAIT_AND_VERIFY:
-
-                        if (i2c_is_byte_transmitted(var->i2c_params.module))
-                        {
-                            if (i2c_is_ack_received(var->i2c_params.module))
-                            {
-                                if (var->i2c_params.flags > 0)
-                                {
-                                    if (GET_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_COMPONENT_MSB))
-                                    {
-                                        var->i2c_params.state_machine.index = _ADDRESS_COMPONENT_MSB;
-                                    }
-                                    else if (GET_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_REGISTERS_LSB))
-                                    {
-                                        var->i2c_params.state_machine.index = _ADDRESS_REGISTER_LSB;
-                                    }
-                                    else if (GET_BIT(var->i2c_params.flags, I2C_SEND_ADDRESS_REGISTERS_MSB))
-                                    {
-                                        var->i2c_params.state_machine.index = _ADDRESS_REGISTER_MSB;
-                                    }
-                                }
-                                else
-                                {
-                                    var->i2c_params.state_machine.index = _SEND_BYTE;
-                                    if (++var->tx_buffer.index >= var->tx_buffer.size)
-                                    {
-                                        var->i2c_params.state_machine.index = _STOP;
-                                    }
-                                }
-                            }
-                            else
+                            if (var->transaction[i].result != I2C_TRANSACTION_SUCCESS)
                             {
-                                var->i2c_params.state_machine.index = _FAIL;
+                                var->dirty_channels |= var->sent_channels;
+                                var->is_config_dirty |= var->is_config_sent;
+                                break;
                             }
                         }
-                        break;
-
-                    case _STOP:
-
-                        i2c_stop(var->i2c_params.module);
                         var->i2c_params.state_machine.index = _HOME;
                         var->i2c_params.state_machine.tick = mGetTick();
                         var->i2c_params.bus_management_params.is_running = false;
                         var->i2c_params.bus_management_params.tick = mGetTick();
-                        break;
-
-                    case _FAIL:
+                    }
+                    break;
 
-                        i2c_stop(var->i2c_params.module);
-                        var->i2c_params.state_machine.index = _HOME;
-                        var->i2c_params.state_machine.tick = mGetTick();
-                        var->i2c_params.bus_management_params.is_running = false;
-                        var->i2c_params.bus_management_params.tick = mGetTick();
-                        break;
-
-                    default:
-                        break;
-                }
+                default:
+                    var->i2c_params.state_machine.index = _HOME;
+                    break;
             }
         }
+        i2c_queue_deamon(var->i2c_params.module);
     }
 }
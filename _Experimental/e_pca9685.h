@@ -1,6 +1,25 @@
 #ifndef __DEF_E_PCA9685
 #define	__DEF_E_PCA9685
 
+#ifndef PCA9685_MAX_TRANSACTIONS
+#define PCA9685_MAX_TRANSACTIONS            8       // I2C transactions per update (3 for the configuration, 1 per burst of channels)
+#endif
+
+#if (PCA9685_MAX_TRANSACTIONS < 4)
+#error "PCA9685_MAX_TRANSACTIONS must be at least 4"
+#endif
+
+#define PCA9685_NUMBER_OF_CHANNELS          16
+#define PCA9685_ALL_CHANNELS                0xffff
+
+typedef enum
+{
+    PCA9685_REG_MODE1                   = 0x00,
+    PCA9685_REG_LED0                    = 0x06,     // LEDn_ON_L = 0x06 + 4*n
+    PCA9685_REG_ALL_LED                 = 0xfa,
+    PCA9685_REG_PRESCALE                = 0xfe
+} PCA9685_REGISTER_ADDRESS;
+
 typedef enum
 {
     PCA9685_RESTART                     = 0x80,     // *
@@ -55,7 +74,14 @@ typedef struct
 {
     bool                    is_init_done;
     I2C_PARAMS              i2c_params;
-    DYNAMIC_TAB_BYTE        tx_buffer;
+    uint16_t                dirty_channels;     // 1 bit per channel modified since the last update
+    bool                    is_config_dirty;    // MODE1 to ALLCALLADR and PRESCALE
+    uint16_t                sent_channels;      // Dirty again if the update fails
+    bool                    is_config_sent;
+    uint8_t                 mode1_sleep;
+    uint8_t                 number_of_transactions;
+    I2C_TRANSACTION         transaction[PCA9685_MAX_TRANSACTIONS];
+    PCA9685_PWM             tx_pwm[PCA9685_NUMBER_OF_CHANNELS];     // Copy of the channels in progress
     PCA9685_REGS            registers;
 } PCA9685_CONFIG;
 
@@ -63,7 +89,14 @@ typedef struct
 {                                                                                       \
     .is_init_done = false,                                                              \
     .i2c_params = I2C_PARAMS_INSTANCE(_i2c_module, _i2c_address, _periodic_time, 0),    \
-    .tx_buffer = {NULL, sizeof(PCA9685_REGS), 0},                                       \
+    .dirty_channels = PCA9685_ALL_CHANNELS,                                             \
+    .is_config_dirty = true,                                                            \
+    .sent_channels = 0,                                                                 \
+    .is_config_sent = false,                                                            \
+    .mode1_sleep = 0,                                                                   \
+    .number_of_transactions = 0,                                                        \
+    .transaction = {{0}},                                                               \
+    .tx_pwm = {{0}},                                                                    \
     .registers =                                                                        \
     {                                                                                   \
         .MODE1 = (PCA9685_USE_INTERNAL_CLOCK | PCA9685_ENABLE_AUTO_INCREMENT_REG | PCA9685_PUT_IN_NORMAL_MODE),         \
@@ -78,14 +111,18 @@ typedef struct
     }                                                                                   \
 }
 
-#define PCA9685_DEF(_name, _i2c_module, _i2c_address)           \
-static PCA9685_CONFIG _name = PCA9685_INSTANCE(_i2c_module, _i2c_address, TICK_1S)
+// _update_period: minimum time between two updates (only the modified channels are sent).
+#define PCA9685_DEF(_name, _i2c_module, _i2c_address, _update_period)           \
+static PCA9685_CONFIG _name = PCA9685_INSTANCE(_i2c_module, _i2c_address, _update_period)
 
-#define e_pca9685_set_pwm(_var, _id, _duty_cycle)                       _var.registers.PWM[_id].phase = 0, _var.registers.PWM[_id].dc = (_duty_cycle & 0x0fff)
-#define e_pca9685_set_pwm_with_phase(_var, _id, _phase, _duty_cycle)    _var.registers.PWM[_id].phase = (_phase & 0x0fff), _var.registers.PWM[_id].dc = ((_phase + _duty_cycle)&0x0fff)
-#define e_pca9685_clear_output(_var, _id)                               _var.registers.PWM[_id].phase = 0x0000, _var.registers.PWM[_id].dc = 0x1000
-#define e_pca9685_set_output(_var, _id)                                 _var.registers.PWM[_id].phase = 0x1000, _var.registers.PWM[_id].dc = 0x0000
+#define e_pca9685_set_pwm(_var, _id, _duty_cycle)                       e_pca9685_write_pwm(&_var, _id, 0, (_duty_cycle & 0x0fff))
+#define e_pca9685_set_pwm_with_phase(_var, _id, _phase, _duty_cycle)    e_pca9685_write_pwm(&_var, _id, (_phase & 0x0fff), ((_phase + _duty_cycle)&0x0fff))
+#define e_pca9685_clear_output(_var, _id)                               e_pca9685_write_pwm(&_var, _id, 0x0000, 0x1000)
+#define e_pca9685_set_output(_var, _id)                                 e_pca9685_write_pwm(&_var, _id, 0x1000, 0x0000)
+// To call after a modification of registers.MODE1 to ALLCALLADR / PRESCALE or to resend all the registers.
+#define e_pca9685_force_update(_var)                                    _var.is_config_dirty = true, _var.dirty_channels = PCA9685_ALL_CHANNELS
 
+void e_pca9685_write_pwm(PCA9685_CONFIG *var, uint8_t id, uint16_t phase, uint16_t dc);
 void e_pca9685_deamon(PCA9685_CONFIG *var);
 
 #endif
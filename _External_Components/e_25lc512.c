@@ -7,6 +7,12 @@
                         - Compatible with all SPI bus in same time but only
                         one device by SPI bus.
 *       18/04/2016      - Add BUS management with "Deamon Parent".
+*       17/10/2026      - Header and data are sent as SPI segments: the data
+*                       buffers are no more shifted/copied and do not need
+*                       the 3 extra bytes.
+*                       - WREN / RDSR / WRSR / CE are queued transfers too
+*                       (e_25lc512_send_command): the SPI mode is no more
+*                       switched to 16 bits for the status register.
 * 
 *   Description:
 *   ------------ 
@@ -28,7 +34,7 @@
 
 #warning "e_eeprom.c - SPI Frequency should be maximum 20 MHz"
 
-static uint32_t readingDwordValue[SPI_NUMBER_OF_MODULES];
+static const uint8_t e_25lc512_erased_page[128] = {[0 ... 127] = 0xff};
 
 /*******************************************************************************
   Function:
@@ -67,7 +73,7 @@ void e_25lc512_deamon(_25LC512_CONFIG *var)
                 }
                 break;
             case SM_25LC512_WRITE_STATUS_REGISTER:
-                if(!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, (_25LC512_INST_WRSR << 8) | _25LC512_DISABLE_ALL_SECTOR_PROTECTION, NULL, SPI_CONF_MODE16))
+                if(!e_25lc512_send_command(var, _25LC512_INST_WRSR, _25LC512_DISABLE_ALL_SECTOR_PROTECTION))
                 {
                     CLR_BIT(var->spi_params.flags, var->spi_params.state_machine.index);
                     if(!var->spi_params.flags){var->spi_params.state_machine.index = SM_25LC512_END;}else{var->spi_params.state_machine.index = SM_25LC512_HOME;}
@@ -124,6 +130,42 @@ void e_25lc512_deamon(_25LC512_CONFIG *var)
     }
 }
 
+/*******************************************************************************
+  Function:
+    static BYTE e_25lc512_send_command(_25LC512_CONFIG *var, _25LC512_INSTRUCTION instruction, uint8_t data)
+
+  Description:
+    This routine sends a short instruction through the SPI queue: WREN / CE
+    (instruction only) or RDSR / WRSR (instruction + 1 byte). The status
+    register read by RDSR is copied in var->registers.status_bit.
+
+  Parameters:
+    var         - The variable assign to the 25xx512 device.
+
+    instruction - The instruction (_25LC512_INST_xxx).
+
+    data        - The byte sent after the instruction (RDSR / WRSR only).
+
+  Return:
+    0 when the transfer is completed (the function must be called until it
+    returns 0).
+  *****************************************************************************/
+static BYTE e_25lc512_send_command(_25LC512_CONFIG *var, _25LC512_INSTRUCTION instruction, uint8_t data)
+{
+    bool is_two_bytes = (instruction == _25LC512_INST_RDSR) || (instruction == _25LC512_INST_WRSR);
+    BYTE ret;
+    
+    var->registers.command[0] = instruction;
+    var->registers.command[1] = data;
+    ret = SPIWriteAndStoreByteArray(var->spi_params.spi_module, var->spi_params.chip_select, var->registers.command, (instruction == _25LC512_INST_RDSR) ? var->registers.response : NULL, is_two_bytes ? 2 : 1);
+    if (!ret && (instruction == _25LC512_INST_RDSR))
+    {
+        var->registers.status_bit.w = var->registers.response[1];
+    }
+    
+    return ret;
+}
+
 /*******************************************************************************
   Function:
     static char e_25lc512_read_sequences(_25LC512_CONFIG *var)
@@ -146,15 +188,20 @@ static char e_25lc512_read_sequences(_25LC512_CONFIG *var)
     switch (functionState[var->spi_params.spi_module])
     {
         case SM_FREE:
-            var->registers.dR.p[0] = _25LC512_INST_READ;
-            var->registers.dR.p[1] = (var->registers.aR >> 8);
-            var->registers.dR.p[2] = (var->registers.aR >> 0);
+            var->registers.header[0] = _25LC512_INST_READ;
+            var->registers.header[1] = (var->registers.aR >> 8);
+            var->registers.header[2] = (var->registers.aR >> 0);
+            var->registers.segments[0].p_tx = var->registers.header;
+            var->registers.segments[0].p_rx = NULL;
+            var->registers.segments[0].size = 3;
+            var->registers.segments[1].p_tx = NULL;
+            var->registers.segments[1].p_rx = var->registers.dR.p;
+            var->registers.segments[1].size = var->registers.dR.size;
             
             functionState[var->spi_params.spi_module] = SM_GET_STATUS;
         case SM_GET_STATUS:
-            if (!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, (_25LC512_INST_RDSR << 8), &readingDwordValue[var->spi_params.spi_module], SPI_CONF_MODE16))
+            if (!e_25lc512_send_command(var, _25LC512_INST_RDSR, 0xff))
             {
-                var->registers.status_bit.w = (BYTE) (readingDwordValue[var->spi_params.spi_module] & 0xFF);
                 if (!var->registers.status_bit.WIP)
                 {
                     functionState[var->spi_params.spi_module] = SM_DATA_READ;
@@ -162,13 +209,8 @@ static char e_25lc512_read_sequences(_25LC512_CONFIG *var)
             }
             break;
         case SM_DATA_READ:
-            if (!SPIWriteAndStoreByteArray(var->spi_params.spi_module, var->spi_params.chip_select, (void*)var->registers.dR.p, (void*)var->registers.dR.p, (var->registers.dR.size + 3)))
+            if (!SPIWriteAndStoreSegments(var->spi_params.spi_module, var->spi_params.chip_select, var->registers.segments, 2))
             {
-                WORD i = 0;
-                for (i = 0 ; i < var->registers.dR.size ; i++)
-                {
-                    var->registers.dR.p[i] = var->registers.dR.p[i + 3];
-                }
                 functionState[var->spi_params.spi_module] = SM_FREE;
             }
             break;
@@ -215,9 +257,8 @@ static char e_25lc512_erase_sequences(_25LC512_CONFIG *var, uint8_t typeOfErase)
             tHeader[var->spi_params.spi_module][2] = (var->registers.aW >> 0);
             functionState[var->spi_params.spi_module] = SM_GET_STATUS;
         case SM_GET_STATUS:
-            if (!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, (_25LC512_INST_RDSR << 8), &readingDwordValue[var->spi_params.spi_module], SPI_CONF_MODE16))
+            if (!e_25lc512_send_command(var, _25LC512_INST_RDSR, 0xff))
             {
-                var->registers.status_bit.w = (BYTE) (readingDwordValue[var->spi_params.spi_module] & 0xFF);
                 if (!var->registers.status_bit.WIP)
                 {
                     if (!var->registers.status_bit.WEL)
@@ -232,7 +273,7 @@ static char e_25lc512_erase_sequences(_25LC512_CONFIG *var, uint8_t typeOfErase)
             }
             break;
         case SM_WREN:
-            if (!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, _25LC512_INST_WREN, NULL, SPI_CONF_MODE8))
+            if (!e_25lc512_send_command(var, _25LC512_INST_WREN, 0))
             {
                 functionState[var->spi_params.spi_module] = SM_ERASE;
             }
@@ -247,7 +288,7 @@ static char e_25lc512_erase_sequences(_25LC512_CONFIG *var, uint8_t typeOfErase)
             }
             else
             {
-                if (!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, _25LC512_INST_CHIP_ERASE, NULL, SPI_CONF_MODE8))
+                if (!e_25lc512_send_command(var, _25LC512_INST_CHIP_ERASE, 0))
                 {
                     functionState[var->spi_params.spi_module] = SM_FREE;
                 }
@@ -274,7 +315,7 @@ static char e_25lc512_erase_sequences(_25LC512_CONFIG *var, uint8_t typeOfErase)
   *****************************************************************************/
 static char e_25lc512_write_sequences(_25LC512_CONFIG *var, bool writeOrErase)
 {    
-    static WORD i[SPI_NUMBER_OF_MODULES] = {0};
+    static WORD offset[SPI_NUMBER_OF_MODULES] = {0};
     static WORD maximumNumberOfByteToWriteInCurrentPage[SPI_NUMBER_OF_MODULES] = {0};
     static enum _functionState
     {
@@ -288,33 +329,30 @@ static char e_25lc512_write_sequences(_25LC512_CONFIG *var, bool writeOrErase)
     switch(functionState[var->spi_params.spi_module])
     {
         case SM_FREE:    
-            maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module] = 0;
-            for (i[var->spi_params.spi_module] = 0 ; i[var->spi_params.spi_module] < var->registers.dW.size ; i[var->spi_params.spi_module]++)
-            {
-                var->registers.dW.p[3 + var->registers.dW.size - 1 - i[var->spi_params.spi_module]] = (writeOrErase)?0xff:(var->registers.dW.p[var->registers.dW.size - 1 - i[var->spi_params.spi_module]]);
-            }
-            var->registers.dW.p[0] = _25LC512_INST_WRITE;
+            offset[var->spi_params.spi_module] = 0;
+            var->registers.header[0] = _25LC512_INST_WRITE;
             functionState[var->spi_params.spi_module] = SM_MEMORY_ORGANIZATION;
         case SM_MEMORY_ORGANIZATION:   
             // Set adress into header
-            var->registers.dW.p[1] = (var->registers.aW >> 8);
-            var->registers.dW.p[2] = (var->registers.aW >> 0);
-            // Shift left buffer
-            for (i[var->spi_params.spi_module] = 0 ; i[var->spi_params.spi_module] < var->registers.dW.size ; i[var->spi_params.spi_module]++)
-            {
-                var->registers.dW.p[3 + i[var->spi_params.spi_module]] = (writeOrErase)?0xff:(var->registers.dW.p[3 + maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module] + i[var->spi_params.spi_module]]);
-            }
+            var->registers.header[1] = (var->registers.aW >> 8);
+            var->registers.header[2] = (var->registers.aW >> 0);
             // Get number of byte to write in the current Page (max 128 bytes per page)
             maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module] = 128 - (var->registers.aW % 128);
             if (var->registers.dW.size < maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module])
             {
                 maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module] = var->registers.dW.size;
             }
+            // Header + data (in place or 0xff for an erase)
+            var->registers.segments[0].p_tx = var->registers.header;
+            var->registers.segments[0].p_rx = NULL;
+            var->registers.segments[0].size = 3;
+            var->registers.segments[1].p_tx = (writeOrErase) ? e_25lc512_erased_page : &var->registers.dW.p[offset[var->spi_params.spi_module]];
+            var->registers.segments[1].p_rx = NULL;
+            var->registers.segments[1].size = maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module];
             functionState[var->spi_params.spi_module] = SM_GET_STATUS;
         case SM_GET_STATUS:
-            if (!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, (_25LC512_INST_RDSR << 8), &readingDwordValue[var->spi_params.spi_module], SPI_CONF_MODE16))
+            if (!e_25lc512_send_command(var, _25LC512_INST_RDSR, 0xff))
             {
-                var->registers.status_bit.w = (BYTE) (readingDwordValue[var->spi_params.spi_module] & 0xFF);
                 if (!var->registers.status_bit.WIP)
                 {
                     if (!var->registers.status_bit.WEL)
@@ -329,16 +367,17 @@ static char e_25lc512_write_sequences(_25LC512_CONFIG *var, bool writeOrErase)
             }
             break;
         case SM_WREN:
-            if (!SPIWriteAndStore8_16_32(var->spi_params.spi_module, var->spi_params.chip_select, _25LC512_INST_WREN, NULL, SPI_CONF_MODE8))
+            if (!e_25lc512_send_command(var, _25LC512_INST_WREN, 0))
             {
                 functionState[var->spi_params.spi_module] = SM_WRITE;
             }
             break;
         case SM_WRITE:
-            if (!SPIWriteAndStoreByteArray(var->spi_params.spi_module, var->spi_params.chip_select, (void*)var->registers.dW.p, NULL, (maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module] + 3)))
+            if (!SPIWriteAndStoreSegments(var->spi_params.spi_module, var->spi_params.chip_select, var->registers.segments, 2))
             {
                 if (var->registers.dW.size > maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module])
                 {
+                    offset[var->spi_params.spi_module] += maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module];
                     var->registers.dW.size -= maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module];
                     var->registers.aW += maximumNumberOfByteToWriteInCurrentPage[var->spi_params.spi_module];
                     functionState[var->spi_params.spi_module] = SM_MEMORY_ORGANIZATION;
@@ -64,6 +64,10 @@ typedef struct
     uint16_t                            aW;
     uint16_t                            aR;
     __25LC512_STATUS_REGISTERbits       status_bit;
+    uint8_t                             header[3];      // Instruction + address
+    uint8_t                             command[2];     // WREN / CE (1 byte), RDSR / WRSR (2 bytes)
+    uint8_t                             response[2];    // RDSR: status register in response[1]
+    SPI_SEGMENT                         segments[2];    // header + payload (in place)
 } _25LC512_REGISTERS;
 
 typedef struct
@@ -78,7 +82,11 @@ typedef struct
     .dR = {b, 0, 0},                                \
     .aW = 0,                                        \
     .aR = 0,                                        \
-    .status_bit = {0}                               \
+    .status_bit = {0},                              \
+    .header = {0},                                  \
+    .command = {0},                                 \
+    .response = {0},                                \
+    .segments = {{0}}                               \
 }
 
 #define _25LC512_INSTANCE(_spi_module, _io_port, _io_indice, _periodic_time, _buffer_tx, _buffer_rx)\
@@ -88,11 +96,12 @@ typedef struct
 }
 
 #define _25LC512_DEF(_name, _spi_module, _cs_pin, _periodic_time, _size_tx, _size_rx)               \
-static uint8_t _name ## _buffer_tx_ram_allocation[3+_size_tx] = {0xff};                             \
-static uint8_t _name ## _buffer_rx_ram_allocation[3+_size_rx] = {0xff};                             \
+static uint8_t _name ## _buffer_tx_ram_allocation[_size_tx] = {0xff};                               \
+static uint8_t _name ## _buffer_rx_ram_allocation[_size_rx] = {0xff};                               \
 static _25LC512_CONFIG _name = _25LC512_INSTANCE(_spi_module, _XBR(_cs_pin), _IND(_cs_pin), _periodic_time, _name ## _buffer_tx_ram_allocation, _name ## _buffer_rx_ram_allocation)
 
 void e_25lc512_deamon(_25LC512_CONFIG *var);
+static BYTE e_25lc512_send_command(_25LC512_CONFIG *var, _25LC512_INSTRUCTION instruction, uint8_t data);
 static char e_25lc512_read_sequences(_25LC512_CONFIG *var);
 static char e_25lc512_erase_sequences(_25LC512_CONFIG *var, uint8_t typeOfErase);
 static char e_25lc512_write_sequences(_25LC512_CONFIG *var, bool writeOrErase);
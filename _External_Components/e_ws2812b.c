@@ -28,12 +28,29 @@
 *                           + Remove unsupported functions (init & add segment) 
 *                           Example - New variable in main.c:
 *                           WS2812B_DEF(ledsOnSPI3A, SPI3A, csRA1, TOTAL_NUMBER_OF_LEDS, LED_END_SEG1, LED_END_SEG2, LED_END_SEG3, LED_END_SEG4); 
+*       17/10/2026      - Release 1.30
+*                           + Frame synchronous rendering: all the LEDs are evaluated for a frame
+*                           + Double buffer swapped at the end of the DMA transfer
+*                           + Only the modified LEDs are encoded
+*                           + Table driven encoder (e_ws2812b_encoder.c)
+*                           + LED store split in arrays: output colors (hot), effect states 
+*                             and colors used by the effects (cold)
+*                           + Idle LEDs (or segments) are no more evaluated
+*                           + WS2812B_DEF_SEGMENT_EFFECTS: one effect state by segment
+*                           + The tick is read once by frame (same step for all the effects)
+*                           + Range check of the segments (indice, empty segment, end beyond the
+*                             LED array) and 64 bits timing of the effects
 *********************************************************************/
 
 #include "../PLIB.h"
 
 #warning "e_ws2812b.c - SPI Frequency should be equal to 2,4MHz & SPI interruption should be disable"
 
+static bool eWS2812BIsSegmentValid(const WS2812B_PARAMS *var, uint16_t segmentIndice);
+static uint16_t eWS2812BGetNumberOfLeds(const WS2812B_PARAMS *var);
+static void eWS2812BSetDirty(WS2812B_PARAMS *var, uint16_t from, uint16_t to);
+static void eWS2812BSetEffect(WS2812B_EFFECT *p_effect, WS2812B_EFFECTS effectParams, uint16_t numberOfRepetition, uint64_t executionTime);
+
 /*******************************************************************************
   Function:
     BYTE eWS2812BPutSegment(WORD segmentIndice, WORD from, WORD to, TSV_COLOR tsvParams1, TSV_COLOR tsvParams2, WS2812B_EFFECTS effectParams, WORD numberOfRepetition, QWORD executionTime, WS2812B_PARAMS *var);
@@ -45,6 +62,8 @@
     You are able to put simple or gradient colors and simple basics animations such
     as triangle, sawsooth and gaussian.
     The second method is an advance routine used for animations.
+    With WS2812B_DEF_SEGMENT_EFFECTS, the effect (type, repetitions, execution time)
+    is the one of the whole segment: only the colors are assigned LED by LED.
  
     For instance (All LEDs attach to the segment 2 will have a SAWTOOTH_INV animation (56 iterations and then a restoration of previous colors) with a gradient and a superposition with the previous colors: 
     eWS2812BPutSegment(2, FIRST_LED, LAST_LED, myCustomColor1, myCustomColor2, WS2812B_EFFECT_SAWTOOTH_INV | WS2812B_SUPERPOSE_EFFECT | WS2812B_RESTORE_COLOR, 56, TICK_1S, &leds);
@@ -84,7 +103,7 @@
   *****************************************************************************/
 uint8_t eWS2812BPutSegment(uint16_t segmentIndice, uint16_t from, uint16_t to, WS2812B_STEP_LED step, TSV_COLOR tsvParams1, TSV_COLOR tsvParams2, WS2812B_EFFECTS effectParams, uint16_t numberOfRepetition, uint64_t executionTime, WS2812B_PARAMS *var)
 {    
-    if(segmentIndice <= (var->segments.size-1))
+    if(eWS2812BIsSegmentValid(var, segmentIndice))
     {
         uint16_t tTo = to;
         (from > to)?(to = from, from = tTo):0;
@@ -96,40 +115,42 @@ uint8_t eWS2812BPutSegment(uint16_t segmentIndice, uint16_t from, uint16_t to, W
 
         if(to < (var->segments.p[segmentIndice+1] - var->segments.p[segmentIndice]))
         {
-            uint16_t ledIndice;
+            uint16_t ledIndice, led;
             for(ledIndice = from ; ledIndice <= to ; ledIndice+=step)
             {
-                var->leds[var->segments.p[segmentIndice]+ledIndice].effect.qw = 0;
-                var->leds[var->segments.p[segmentIndice]+ledIndice].effect.TYPE_OF_EFFECT = (effectParams >> 0) & 0x07;
-                if(!var->leds[var->segments.p[segmentIndice]+ledIndice].effect.TYPE_OF_EFFECT)
+                led = var->segments.p[segmentIndice] + ledIndice;
+                if(!(effectParams & 0x07))
                 {
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].next_params = fUtilitiesGetMiddleTsvColor(tsvParams1, tsvParams2, (ledIndice-from), (to-from));
+                    var->p_colors[led].next_params = fUtilitiesGetMiddleTsvColor(tsvParams1, tsvParams2, (ledIndice-from), (to-from));
                     if(executionTime == TICK_0)
                     {
-                        var->leds[var->segments.p[segmentIndice]+ledIndice].output_params = var->leds[var->segments.p[segmentIndice]+ledIndice].next_params;
+                        var->p_output[led] = var->p_colors[led].next_params;
                     }
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].effect.CHANGEMENT_EFFECT = (effectParams >> 3) & 0x07;
                 }
                 else
                 {
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].save_params = var->leds[var->segments.p[segmentIndice]+ledIndice].output_params;
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].next_params = fUtilitiesGetMiddleTsvColor(tsvParams1, tsvParams2, (ledIndice-from), (to-from));
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].effect.NUMBER_OF_REPETITION = (numberOfRepetition & 0xff);
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].effect.INFINITE_REPETITION = ((numberOfRepetition >> 8) & 0x01);
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].effect.RESTORE_PREVIOUS_PARAMS = (effectParams >> 6) & 0x01;
-                    var->leds[var->segments.p[segmentIndice]+ledIndice].effect.SUPERPOSED_PREVIOUS_PARAMS = (effectParams >> 7) & 0x01;
-                    if(var->leds[var->segments.p[segmentIndice]+ledIndice].effect.SUPERPOSED_PREVIOUS_PARAMS)
+                    var->p_colors[led].save_params = var->p_output[led];
+                    var->p_colors[led].next_params = fUtilitiesGetMiddleTsvColor(tsvParams1, tsvParams2, (ledIndice-from), (to-from));
+                    if((effectParams >> 7) & 0x01)
                     {
-                        var->leds[var->segments.p[segmentIndice]+ledIndice].previous_params = var->leds[var->segments.p[segmentIndice]+ledIndice].save_params;
+                        var->p_colors[led].previous_params = var->p_colors[led].save_params;
                     }
                     else
                     {
-                        var->leds[var->segments.p[segmentIndice]+ledIndice].previous_params = var->leds[var->segments.p[segmentIndice]+ledIndice].next_params;
-                        var->leds[var->segments.p[segmentIndice]+ledIndice].previous_params.intensity = 0;
+                        var->p_colors[led].previous_params = var->p_colors[led].next_params;
+                        var->p_colors[led].previous_params.intensity = 0;
                     }
                 }
-                var->leds[var->segments.p[segmentIndice]+ledIndice].time_execution = executionTime;
+                if(!var->is_effect_by_segment)
+                {
+                    eWS2812BSetEffect(&var->p_effects[led], effectParams, numberOfRepetition, executionTime);
+                }
+            }
+            if(var->is_effect_by_segment)
+            {
+                eWS2812BSetEffect(&var->p_effects[segmentIndice], effectParams, numberOfRepetition, executionTime);
             }
+            eWS2812BSetDirty(var, var->segments.p[segmentIndice]+from, var->segments.p[segmentIndice]+to);
             return 0;
         }
         else
@@ -166,7 +187,7 @@ uint8_t eWS2812BPutSegment(uint16_t segmentIndice, uint16_t from, uint16_t to, W
   *****************************************************************************/
 bool eWS2812BIsSegmentUpdated(uint16_t segmentIndice, uint16_t from, uint16_t to, WS2812B_PARAMS var)
 {
-    if(segmentIndice <= (var.segments.size-1))
+    if(eWS2812BIsSegmentValid(&var, segmentIndice))
     {
         uint16_t tTo = to;
         (from > to)?(to = from, from = tTo):0;
@@ -178,21 +199,22 @@ bool eWS2812BIsSegmentUpdated(uint16_t segmentIndice, uint16_t from, uint16_t to
 
         if(to < (var.segments.p[segmentIndice+1] - var.segments.p[segmentIndice]))
         {
-            uint16_t ledIndice = 0;
+            uint16_t ledIndice, led;
+            WS2812B_EFFECT *p_effect;
             for(ledIndice = from ; ledIndice <= to ; ledIndice++)
             {
-                if(var.leds[var.segments.p[segmentIndice]+ledIndice].effect.TYPE_OF_EFFECT == 0)
+                led = var.segments.p[segmentIndice] + ledIndice;
+                p_effect = var.is_effect_by_segment ? &var.p_effects[segmentIndice] : &var.p_effects[led];
+                if(p_effect->effect.TYPE_OF_EFFECT == 0)
                 {
-                    uint32_t out = (var.leds[var.segments.p[segmentIndice]+ledIndice].output_params.shade << 0) | (var.leds[var.segments.p[segmentIndice]+ledIndice].output_params.saturation << 16) | (var.leds[var.segments.p[segmentIndice]+ledIndice].output_params.intensity << 24);
-                    uint32_t next = (var.leds[var.segments.p[segmentIndice]+ledIndice].next_params.shade << 0) | (var.leds[var.segments.p[segmentIndice]+ledIndice].next_params.saturation << 16) | (var.leds[var.segments.p[segmentIndice]+ledIndice].next_params.intensity << 24);
-                    if(out != next)
+                    if((var.p_output[led].shade != var.p_colors[led].next_params.shade) || (var.p_output[led].saturation != var.p_colors[led].next_params.saturation) || (var.p_output[led].intensity != var.p_colors[led].next_params.intensity))
                     {
                         return 0;
                     }
                 }
                 else
                 {
-                    if((var.leds[var.segments.p[segmentIndice]+ledIndice].effect.NUMBER_OF_REPETITION > 0) || (var.leds[var.segments.p[segmentIndice]+ledIndice].effect.INFINITE_REPETITION > 0))
+                    if((p_effect->effect.NUMBER_OF_REPETITION > 0) || (p_effect->effect.INFINITE_REPETITION > 0))
                     {
                         return 0;
                     }
@@ -280,6 +302,12 @@ bool eWS2812BIsSegmentUpdated(uint16_t segmentIndice, uint16_t from, uint16_t to
 void eWS2812BSetAnimationParams(bool animationType, uint16_t segmentIndice, uint16_t from, uint16_t to, uint16_t numberOfLed, uint32_t timeKeepOn, uint32_t timeKeepOff, TSV_COLOR tsvParams1, TSV_COLOR tsvParams2, uint8_t loopOption, uint8_t ledEffectHeader, uint8_t ledEffectQueue, uint16_t numberOfRepetition, uint64_t ledTimming, uint64_t speedScrolling, WS2812B_ANIMATION *anim, WS2812B_PARAMS var)
 {    
     anim->typeOfAnimation = animationType;
+    anim->segment_indice = segmentIndice;
+    if(!eWS2812BIsSegmentValid(&var, segmentIndice))
+    {
+        anim->number_of_repetition = 0;
+        return;
+    }
     if(from < to)
     {
         anim->from = from;
@@ -296,7 +324,6 @@ void eWS2812BSetAnimationParams(bool animationType, uint16_t segmentIndice, uint
     {
         anim->to = (var.segments.p[segmentIndice+1] - var.segments.p[segmentIndice] - 1);
     }
-    anim->segment_indice = segmentIndice;
     anim->tsv_params1 = tsvParams1;
     anim->tsv_params2 = tsvParams2;
     anim->number_of_repetition = numberOfRepetition;
@@ -329,7 +356,7 @@ void eWS2812BSetAnimationParams(bool animationType, uint16_t segmentIndice, uint
  
   Return:
     255: animation is in progress (nothing special)
-    0: animation fully finished
+    0: animation fully finished (or not available with WS2812B_DEF_SEGMENT_EFFECTS, or invalid segment)
     1: first step, the animation is in progress (from -> to) and do not reach the other side
     2: end of the first step (first LED reaches the other side)
     3: second step, the animation is still in progress and is in its last step
@@ -342,7 +369,11 @@ void eWS2812BSetAnimationParams(bool animationType, uint16_t segmentIndice, uint
 uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
 {
     BYTE ret = 255;
-    if(anim->segment_indice < var->segments.size)
+    if(var->is_effect_by_segment)
+    {
+        return 0;
+    }
+    if(eWS2812BIsSegmentValid(var, anim->segment_indice))
     {
         if(anim->number_of_repetition > 0)
         {                 
@@ -365,11 +396,11 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                             currentIndice = var->segments.p[anim->segment_indice] + anim->from + anim->indice;
                         }
 
-                        var->leds[currentIndice].save_params = var->leds[currentIndice].output_params;
-                        var->leds[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
-                        var->leds[currentIndice].effect.qw = 0;
-                        var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
-                        var->leds[currentIndice].time_execution = anim->execution_time_led;
+                        var->p_colors[currentIndice].save_params = var->p_output[currentIndice];
+                        var->p_colors[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
+                        var->p_effects[currentIndice].effect.qw = 0;
+                        var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
+                        var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                         anim->number_of_led_on++;
 
                         if(anim->number_of_led_on > anim->number_of_led)
@@ -383,10 +414,10 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                                 currentIndice = var->segments.p[anim->segment_indice] + anim->from + anim->indice - anim->number_of_led;
                             }       
 
-                            var->leds[currentIndice].next_params = var->leds[currentIndice].save_params;
-                            var->leds[currentIndice].effect.qw = 0;
-                            var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
-                            var->leds[currentIndice].time_execution = anim->execution_time_led;
+                            var->p_colors[currentIndice].next_params = var->p_colors[currentIndice].save_params;
+                            var->p_effects[currentIndice].effect.qw = 0;
+                            var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
+                            var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                             anim->number_of_led_on--;
                         } 
                         if(anim->indice == (anim->to - anim->from))
@@ -409,10 +440,10 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                             currentIndice = var->segments.p[anim->segment_indice] + anim->from + anim->indice - anim->number_of_led;
                         }
 
-                        var->leds[currentIndice].next_params = var->leds[currentIndice].save_params;
-                        var->leds[currentIndice].effect.qw = 0;
-                        var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
-                        var->leds[currentIndice].time_execution = anim->execution_time_led;
+                        var->p_colors[currentIndice].next_params = var->p_colors[currentIndice].save_params;
+                        var->p_effects[currentIndice].effect.qw = 0;
+                        var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
+                        var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                         anim->number_of_led_on--;
 
                         if(((anim->options&0x03) == WS2812B_ANIM_CHENILLARD_END_LOOP_TFTF) && (anim->number_of_repetition > 1))
@@ -426,11 +457,11 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                                 currentIndice = var->segments.p[anim->segment_indice] + anim->from + (anim->indice - (anim->to - anim->from + 1));
                             }
 
-                            var->leds[currentIndice].save_params = var->leds[currentIndice].output_params; 
-                            var->leds[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice - (anim->to - anim->from), (anim->to - anim->from));
-                            var->leds[currentIndice].effect.qw = 0;
-                            var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
-                            var->leds[currentIndice].time_execution = anim->execution_time_led;
+                            var->p_colors[currentIndice].save_params = var->p_output[currentIndice]; 
+                            var->p_colors[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice - (anim->to - anim->from), (anim->to - anim->from));
+                            var->p_effects[currentIndice].effect.qw = 0;
+                            var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
+                            var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                             anim->number_of_led_on++;
                         }
                         ret = 3;
@@ -457,11 +488,11 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                                     currentIndice = var->segments.p[anim->segment_indice] + anim->from;
                                 } 
 
-                                var->leds[currentIndice].save_params = var->leds[currentIndice].output_params;
-                                var->leds[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
-                                var->leds[currentIndice].effect.qw = 0;
-                                var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
-                                var->leds[currentIndice].time_execution = anim->execution_time_led;
+                                var->p_colors[currentIndice].save_params = var->p_output[currentIndice];
+                                var->p_colors[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
+                                var->p_effects[currentIndice].effect.qw = 0;
+                                var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
+                                var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                                 anim->number_of_led_on++;
                             }
                             else if((anim->options&0x03) == WS2812B_ANIM_CHENILLARD_END_LOOP_TFTF)
@@ -477,11 +508,11 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                                     currentIndice = var->segments.p[anim->segment_indice] + anim->from + anim->number_of_led;
                                 } 
 
-                                var->leds[currentIndice].save_params = var->leds[currentIndice].output_params;
-                                var->leds[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
-                                var->leds[currentIndice].effect.qw = 0;
-                                var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
-                                var->leds[currentIndice].time_execution = anim->execution_time_led;
+                                var->p_colors[currentIndice].save_params = var->p_output[currentIndice];
+                                var->p_colors[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
+                                var->p_effects[currentIndice].effect.qw = 0;
+                                var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
+                                var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                                 anim->number_of_led_on++;
 
                                 if(anim->number_of_led_on > anim->number_of_led)
@@ -495,10 +526,10 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                                         currentIndice = var->segments.p[anim->segment_indice] + anim->from;
                                     } 
 
-                                    var->leds[currentIndice].next_params = var->leds[currentIndice].save_params;
-                                    var->leds[currentIndice].effect.qw = 0;
-                                    var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
-                                    var->leds[currentIndice].time_execution = anim->execution_time_led;
+                                    var->p_colors[currentIndice].next_params = var->p_colors[currentIndice].save_params;
+                                    var->p_effects[currentIndice].effect.qw = 0;
+                                    var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
+                                    var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                                     anim->number_of_led_on--;
                                 } 
                             }
@@ -516,10 +547,10 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                                     currentIndice = var->segments.p[anim->segment_indice] + anim->from;
                                 } 
 
-                                var->leds[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
-                                var->leds[currentIndice].effect.qw = 0;
-                                var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
-                                var->leds[currentIndice].time_execution = anim->execution_time_led;
+                                var->p_colors[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
+                                var->p_effects[currentIndice].effect.qw = 0;
+                                var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
+                                var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                                 anim->number_of_led_on++;
                             }
                             ret = 4;
@@ -544,11 +575,11 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                             currentIndice = var->segments.p[anim->segment_indice] + anim->from + anim->indice;
                         }
 
-                        var->leds[currentIndice].save_params = var->leds[currentIndice].output_params;
-                        var->leds[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
-                        var->leds[currentIndice].effect.qw = 0;
-                        var->leds[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
-                        var->leds[currentIndice].time_execution = anim->execution_time_led;
+                        var->p_colors[currentIndice].save_params = var->p_output[currentIndice];
+                        var->p_colors[currentIndice].next_params = fUtilitiesGetMiddleTsvColor(anim->tsv_params1, anim->tsv_params2, anim->indice, (anim->to - anim->from));
+                        var->p_effects[currentIndice].effect.qw = 0;
+                        var->p_effects[currentIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 2)&0x07;
+                        var->p_effects[currentIndice].time_execution = anim->execution_time_led;
                         if(anim->indice == (anim->to - anim->from))
                         {
                             ret = 2;
@@ -565,10 +596,10 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
                             WORD ledIndice;
                             for(ledIndice = anim->from ; ledIndice <= anim->to ; ledIndice++)
                             {                                    
-                                var->leds[var->segments.p[anim->segment_indice]+ledIndice].next_params = var->leds[var->segments.p[anim->segment_indice]+ledIndice].save_params;
-                                var->leds[var->segments.p[anim->segment_indice]+ledIndice].effect.qw = 0;
-                                var->leds[var->segments.p[anim->segment_indice]+ledIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
-                                var->leds[var->segments.p[anim->segment_indice]+ledIndice].time_execution = anim->execution_time_led;
+                                var->p_colors[var->segments.p[anim->segment_indice]+ledIndice].next_params = var->p_colors[var->segments.p[anim->segment_indice]+ledIndice].save_params;
+                                var->p_effects[var->segments.p[anim->segment_indice]+ledIndice].effect.qw = 0;
+                                var->p_effects[var->segments.p[anim->segment_indice]+ledIndice].effect.CHANGEMENT_EFFECT = (anim->options >> 5)&0x07;
+                                var->p_effects[var->segments.p[anim->segment_indice]+ledIndice].time_execution = anim->execution_time_led;
                             }
                            }
                         else if((anim->options&0x03) == 2)
@@ -616,355 +647,518 @@ uint8_t eWS2812BAnimation(WS2812B_ANIMATION *anim, WS2812B_PARAMS *var)
             ret = 0;
         }
     }
+    else
+    {
+        ret = 0;
+    }
     return ret;
 }
 
 /*******************************************************************************
   Function:
-    BYTE eWS2812BFlush(QWORD periodRefresh, WS2812B_PARAMS *var);
+    static void eWS2812BSetEffect(WS2812B_EFFECT *p_effect, WS2812B_EFFECTS effectParams, uint16_t numberOfRepetition, uint64_t executionTime);
 
   Description:
-    This routine is the deamon for the WS2812B LED.
-    It must be called as more as possible in the main routine. The data is transmit
-    on the SDO pin (using DMA). The CLK, SDI and CS pins are not used.
- 
-  Return:
-    1: data not being send on the SPI bus.
-    0: request for data transmission send. The DMA module manage the transmission without
-    any external intervention. All the buffer begin to be transmitted.
+    This routine (re)initializes an effect state with the params of 
+    eWS2812BPutSegment.
 
   Parameters:
-    periodRefresh   - The period between each transmission on the SPI bus.
-    *var            - The variable assign to the WS2812B LED array.
+    *p_effect           - The effect state (of a LED or of a segment).
+    effectParams        - cf. eWS2812BPutSegment.
+    numberOfRepetition  - cf. eWS2812BPutSegment.
+    executionTime       - cf. eWS2812BPutSegment.
   *****************************************************************************/
-uint8_t eWS2812BFlush(uint64_t periodRefresh, WS2812B_PARAMS *var)
+static void eWS2812BSetEffect(WS2812B_EFFECT *p_effect, WS2812B_EFFECTS effectParams, uint16_t numberOfRepetition, uint64_t executionTime)
 {
-    uint8_t ret = 1;
-    static uint16_t i[4] = {0};
+    p_effect->effect.qw = 0;
+    p_effect->effect.TYPE_OF_EFFECT = (effectParams >> 0) & 0x07;
+    if(!p_effect->effect.TYPE_OF_EFFECT)
+    {
+        p_effect->effect.CHANGEMENT_EFFECT = (effectParams >> 3) & 0x07;
+    }
+    else
+    {
+        p_effect->effect.NUMBER_OF_REPETITION = (numberOfRepetition & 0xff);
+        p_effect->effect.INFINITE_REPETITION = ((numberOfRepetition >> 8) & 0x01);
+        p_effect->effect.RESTORE_PREVIOUS_PARAMS = (effectParams >> 6) & 0x01;
+        p_effect->effect.SUPERPOSED_PREVIOUS_PARAMS = (effectParams >> 7) & 0x01;
+    }
+    p_effect->time_execution = executionTime;
+}
+
+/*******************************************************************************
+  Function:
+    static void eWS2812BStartSteps(WS2812B_EFFECT *p_effect, uint64_t tick);
+
+  Description:
+    This routine starts the steps of an effect: MAX_INDICE steps during
+    time_execution. The first step is due one step period later.
+
+  Parameters:
+    *p_effect       - The effect state (MAX_INDICE already set).
+    tick            - The time of the frame.
+  *****************************************************************************/
+static void eWS2812BStartSteps(WS2812B_EFFECT *p_effect, uint64_t tick)
+{
+    p_effect->effect.EFFECT_IN_PROGRESS = 1;
+    p_effect->effect.COUNTER = 0;
+    p_effect->time_step = p_effect->time_execution / p_effect->effect.MAX_INDICE;
+    if(!p_effect->time_step)
+    {
+        p_effect->time_step = 1;
+    }
+    p_effect->tick_next_step = tick + p_effect->time_step;
+}
+
+/*******************************************************************************
+  Function:
+    static uint16_t eWS2812BGetElapsedSteps(WS2812B_EFFECT *p_effect, uint64_t tick);
+
+  Description:
+    This routine returns the number of steps elapsed since the last call
+    and moves the deadline of the next step (no drift when a frame is late).
+
+  Parameters:
+    *p_effect       - The effect state.
+    tick            - The time of the frame.
+
+  Return:
+    The number of elapsed steps (0 if the next step is not due).
+  *****************************************************************************/
+static uint16_t eWS2812BGetElapsedSteps(WS2812B_EFFECT *p_effect, uint64_t tick)
+{
+    uint64_t late, steps;
     
-    if (!var->is_chip_select_init)
+    if(tick < p_effect->tick_next_step)
     {
-        SPIInitIOAsChipSelect(var->chip_select);
-        var->is_chip_select_init = true;
+        return 0;
     }
+    // The 64 bits division is only done when a frame is late of a step or more.
+    late = tick - p_effect->tick_next_step;
+    steps = (late < p_effect->time_step) ? 1 : (1 + late / p_effect->time_step);
+    p_effect->tick_next_step += steps * p_effect->time_step;
+    return (steps > 0x3ff) ? 0x3ff : steps;
+}
+
+/*******************************************************************************
+  Function:
+    static bool eWS2812BUpdateEffect(WS2812B_PARAMS *var, WS2812B_EFFECT *p_effect, uint16_t from, uint16_t to, uint64_t tick);
+
+  Description:
+    This routine evaluates an effect state once and computes the output 
+    colors of all the LEDs which share it (a single LED with WS2812B_DEF or
+    all the LEDs of a segment with WS2812B_DEF_SEGMENT_EFFECTS). The colors 
+    (previous, next, save) stay by LED. An effect with nothing left to do is
+    marked IS_IDLE and is no more evaluated until it is modified.
 
-    switch(var->leds[i[var->spi_module]].effect.TYPE_OF_EFFECT)
+  Parameters:
+    *var            - The variable assign to the WS2812B LED array.
+    *p_effect       - The effect state.
+    from            - The first LED (absolute indice) sharing the effect.
+    to              - The last LED (absolute indice) sharing the effect.
+    tick            - The time of the frame (the same for all the effects).
+
+  Return:
+    true if the output colors have been written.
+  *****************************************************************************/
+static bool eWS2812BUpdateEffect(WS2812B_PARAMS *var, WS2812B_EFFECT *p_effect, uint16_t from, uint16_t to, uint64_t tick)
+{
+    uint16_t led, steps, cpt, max;
+    bool is_updated = false;
+    
+    if(p_effect->effect.TYPE_OF_EFFECT == WS2812B_EFFECT_NONE)
     {
-        case WS2812B_EFFECT_NONE:
-            if(!var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS)
+        if(!p_effect->effect.EFFECT_IN_PROGRESS)
+        {
+            if(!p_effect->time_execution)
             {
-                if(!__WS2812BExecutionTime)
-                {
-                    var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].next_params;
-                }
-                else
+                for(led = from ; led <= to ; led++)
                 {
-                    if(var->leds[i[var->spi_module]].effect.CHANGEMENT_EFFECT == 1)
-                    {
-                        var->leds[i[var->spi_module]].effect.CHANGEMENT_EFFECT = 0;
-                        var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].next_params;
-                        var->leds[i[var->spi_module]].output_params.intensity = 0;
-                    }
-                    else if(var->leds[i[var->spi_module]].effect.CHANGEMENT_EFFECT == 2)
-                    {
-                        var->leds[i[var->spi_module]].save_params = var->leds[i[var->spi_module]].next_params;
-                        var->leds[i[var->spi_module]].next_params = var->leds[i[var->spi_module]].output_params;
-                        var->leds[i[var->spi_module]].next_params.intensity = 0;
-                    }
-                    
-                    var->leds[i[var->spi_module]].effect.MAX_INDICE = fUtilitiesGetNumberOfStep(var->leds[i[var->spi_module]].output_params, var->leds[i[var->spi_module]].next_params);
-                    if(var->leds[i[var->spi_module]].effect.MAX_INDICE > 0)
-                    {
-                        var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 1;
-                        var->leds[i[var->spi_module]].previous_params = var->leds[i[var->spi_module]].output_params;
-                        var->leds[i[var->spi_module]].effect.COUNTER = 0;
-                        __WS2812BExecutionTime2 = __WS2812BExecutionTime / var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                        __WS2812BTick = mGetTick();
-                        __WS2812BTickSynchro = 0;
-                    }
+                    var->p_output[led] = var->p_colors[led].next_params;
                 }
+                is_updated = true;
+                p_effect->effect.IS_IDLE = 1;
             }
             else
             {
-                if((mTickCompare(__WS2812BTick) + __WS2812BTickSynchro) >= __WS2812BExecutionTime2)
+                if(p_effect->effect.CHANGEMENT_EFFECT == 1)
                 {
-                    QWORD get_tick = mGetTick();
-                    WORD inc = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) / __WS2812BExecutionTime2;
-                    __WS2812BTickSynchro = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) % __WS2812BExecutionTime2;
-                    __WS2812BTick = get_tick;
-                    WORD cpt = (var->leds[i[var->spi_module]].effect.COUNTER + inc);
-
-                    if(cpt <= var->leds[i[var->spi_module]].effect.MAX_INDICE)
+                    p_effect->effect.CHANGEMENT_EFFECT = 0;
+                    for(led = from ; led <= to ; led++)
                     {
-                        var->leds[i[var->spi_module]].effect.COUNTER = cpt;
-                        var->leds[i[var->spi_module]].output_params = fUtilitiesGetMiddleTsvColor(var->leds[i[var->spi_module]].previous_params, var->leds[i[var->spi_module]].next_params, cpt, var->leds[i[var->spi_module]].effect.MAX_INDICE);
+                        var->p_output[led] = var->p_colors[led].next_params;
+                        var->p_output[led].intensity = 0;
                     }
-                    else
+                    is_updated = true;
+                }
+                else if(p_effect->effect.CHANGEMENT_EFFECT == 2)
+                {
+                    for(led = from ; led <= to ; led++)
                     {
-                        var->leds[i[var->spi_module]].effect.COUNTER = 0;
-                        var->leds[i[var->spi_module]].effect.MAX_INDICE = 0;
-                        var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].next_params;
-                        if(var->leds[i[var->spi_module]].effect.CHANGEMENT_EFFECT == 2)
-                        {
-                            var->leds[i[var->spi_module]].effect.CHANGEMENT_EFFECT = 0;
-                            var->leds[i[var->spi_module]].next_params = var->leds[i[var->spi_module]].save_params;
-                            var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].next_params;
-                        }
-                        var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 0;
+                        var->p_colors[led].save_params = var->p_colors[led].next_params;
+                        var->p_colors[led].next_params = var->p_output[led];
+                        var->p_colors[led].next_params.intensity = 0;
                     }
                 }
-            }
-            break;
-        case WS2812B_EFFECT_TRIANGLE:
-            if(((var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) || (var->leds[i[var->spi_module]].effect.INFINITE_REPETITION > 0)) > 0)
-            {
-                if(!var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS)
+                
+                // The LEDs sharing the effect move together: the longest transition gives the number of steps.
+                max = 0;
+                for(led = from ; led <= to ; led++)
                 {
-                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 1;
-                    var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                    var->leds[i[var->spi_module]].effect.COUNTER = 0;
-                    var->leds[i[var->spi_module]].effect.MAX_INDICE = 200;
-                    __WS2812BExecutionTime2 = __WS2812BExecutionTime/var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                    __WS2812BTick = mGetTick();
-                    __WS2812BTickSynchro = 0;
+                    steps = fUtilitiesGetNumberOfStep(var->p_output[led], var->p_colors[led].next_params);
+                    (steps > max) ? (max = steps) : 0;
                 }
-                else
+                p_effect->effect.MAX_INDICE = max;
+                if(max > 0)
                 {
-                    if((mTickCompare(__WS2812BTick) + __WS2812BTickSynchro) >= __WS2812BExecutionTime2)
+                    for(led = from ; led <= to ; led++)
                     {
-                        QWORD get_tick = mGetTick();
-                        WORD inc = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) / __WS2812BExecutionTime2;
-                        __WS2812BTickSynchro = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) % __WS2812BExecutionTime2;
-                        __WS2812BTick = get_tick;
-                        WORD cpt = (var->leds[i[var->spi_module]].effect.COUNTER + inc);
-                        
-                        if(cpt <= var->leds[i[var->spi_module]].effect.MAX_INDICE)
-                        {
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt;
-                            if(cpt <= (var->leds[i[var->spi_module]].effect.MAX_INDICE / 2))
-                            {
-                                var->leds[i[var->spi_module]].output_params = fUtilitiesGetMiddleTsvColor(var->leds[i[var->spi_module]].previous_params, var->leds[i[var->spi_module]].next_params, cpt, var->leds[i[var->spi_module]].effect.MAX_INDICE/2);
-                            }
-                            else
-                            {
-                                var->leds[i[var->spi_module]].output_params = fUtilitiesGetMiddleTsvColor(var->leds[i[var->spi_module]].previous_params, var->leds[i[var->spi_module]].next_params, var->leds[i[var->spi_module]].effect.MAX_INDICE - cpt, var->leds[i[var->spi_module]].effect.MAX_INDICE/2);
-                            }
-                        }
-                        else
-                        {
-                            var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt - var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                            if(!var->leds[i[var->spi_module]].effect.INFINITE_REPETITION) 
-                            { 
-                                if(var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) 
-                                { 
-                                    var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION--; 
-                                } 
-                                else
-                                {
-                                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 0;
-                                }
-                            }
-                        }
+                        var->p_colors[led].previous_params = var->p_output[led];
                     }
+                    eWS2812BStartSteps(p_effect, tick);
+                }
+                else
+                {
+                    p_effect->effect.IS_IDLE = 1;
                 }
             }
-            else if(var->leds[i[var->spi_module]].effect.RESTORE_PREVIOUS_PARAMS)
-            {
-                var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].save_params;
-            }
-            break;
-        case WS2812B_EFFECT_SAWTOOTH:
-            if(((var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) || (var->leds[i[var->spi_module]].effect.INFINITE_REPETITION > 0)) > 0)
+        }
+        else if((steps = eWS2812BGetElapsedSteps(p_effect, tick)) > 0)
+        {
+            cpt = p_effect->effect.COUNTER + steps;
+            max = p_effect->effect.MAX_INDICE;
+            if(cpt <= max)
             {
-                if(!var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS)
+                p_effect->effect.COUNTER = cpt;
+                for(led = from ; led <= to ; led++)
                 {
-                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 1;
-                    var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                    var->leds[i[var->spi_module]].effect.COUNTER = 0;
-                    var->leds[i[var->spi_module]].effect.MAX_INDICE = 100;
-                    __WS2812BExecutionTime2 = __WS2812BExecutionTime/var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                    __WS2812BTick = mGetTick();
-                    __WS2812BTickSynchro = 0;
+                    var->p_output[led] = fUtilitiesGetMiddleTsvColor(var->p_colors[led].previous_params, var->p_colors[led].next_params, cpt, max);
                 }
-                else
+                is_updated = true;
+            }
+            else
+            {
+                for(led = from ; led <= to ; led++)
                 {
-                    if((mTickCompare(__WS2812BTick) + __WS2812BTickSynchro) >= __WS2812BExecutionTime2)
+                    if(p_effect->effect.CHANGEMENT_EFFECT == 2)
                     {
-                        QWORD get_tick = mGetTick();
-                        WORD inc = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) / __WS2812BExecutionTime2;
-                        __WS2812BTickSynchro = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) % __WS2812BExecutionTime2;
-                        __WS2812BTick = get_tick;
-                        WORD cpt = (var->leds[i[var->spi_module]].effect.COUNTER + inc);
-
-                        if(cpt <= var->leds[i[var->spi_module]].effect.MAX_INDICE)
-                        {
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt;
-                            var->leds[i[var->spi_module]].output_params = fUtilitiesGetMiddleTsvColor(var->leds[i[var->spi_module]].previous_params, var->leds[i[var->spi_module]].next_params, cpt, var->leds[i[var->spi_module]].effect.MAX_INDICE);
-                        }
-                        else
-                        {
-                            var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt - var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                            if(!var->leds[i[var->spi_module]].effect.INFINITE_REPETITION) 
-                            { 
-                                if(var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) 
-                                { 
-                                    var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION--; 
-                                } 
-                                else
-                                {
-                                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 0;
-                                }
-                            }
-                        }
+                        var->p_colors[led].next_params = var->p_colors[led].save_params;
                     }
+                    var->p_output[led] = var->p_colors[led].next_params;
                 }
+                is_updated = true;
+                p_effect->effect.CHANGEMENT_EFFECT = 0;
+                p_effect->effect.COUNTER = 0;
+                p_effect->effect.MAX_INDICE = 0;
+                p_effect->effect.EFFECT_IN_PROGRESS = 0;
             }
-            else if(var->leds[i[var->spi_module]].effect.RESTORE_PREVIOUS_PARAMS)
+        }
+    }
+    else if((p_effect->effect.NUMBER_OF_REPETITION > 0) || (p_effect->effect.INFINITE_REPETITION > 0))
+    {
+        if(!p_effect->effect.EFFECT_IN_PROGRESS)
+        {
+            for(led = from ; led <= to ; led++)
             {
-                var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].save_params;
+                var->p_output[led] = (p_effect->effect.TYPE_OF_EFFECT == WS2812B_EFFECT_SAWTOOTH_INV) ? var->p_colors[led].next_params : var->p_colors[led].previous_params;
             }
-            break;
-        case WS2812B_EFFECT_SAWTOOTH_INV:
-            if(((var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) || (var->leds[i[var->spi_module]].effect.INFINITE_REPETITION > 0)) > 0)
+            is_updated = true;
+            p_effect->effect.MAX_INDICE = ((p_effect->effect.TYPE_OF_EFFECT == WS2812B_EFFECT_TRIANGLE) || (p_effect->effect.TYPE_OF_EFFECT == WS2812B_EFFECT_GAUSSIAN)) ? 200 : 100;
+            eWS2812BStartSteps(p_effect, tick);
+        }
+        else if((steps = eWS2812BGetElapsedSteps(p_effect, tick)) > 0)
+        {
+            cpt = p_effect->effect.COUNTER + steps;
+            max = p_effect->effect.MAX_INDICE;
+            if(cpt <= max)
             {
-                if(!var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS)
+                p_effect->effect.COUNTER = cpt;
+                switch(p_effect->effect.TYPE_OF_EFFECT)
                 {
-                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 1;
-                    var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].next_params;
-                    var->leds[i[var->spi_module]].effect.COUNTER = 0;
-                    var->leds[i[var->spi_module]].effect.MAX_INDICE = 100;
-                    __WS2812BExecutionTime2 = __WS2812BExecutionTime/var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                    __WS2812BTick = mGetTick();
-                    __WS2812BTickSynchro = 0;
-                }
-                else
-                {
-                    if((mTickCompare(__WS2812BTick) + __WS2812BTickSynchro) >= __WS2812BExecutionTime2)
-                    {
-                        QWORD get_tick = mGetTick();
-                        WORD inc = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) / __WS2812BExecutionTime2;
-                        __WS2812BTickSynchro = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) % __WS2812BExecutionTime2;
-                        __WS2812BTick = get_tick;
-                        WORD cpt = (var->leds[i[var->spi_module]].effect.COUNTER + inc);
-
-                        if(cpt <= var->leds[i[var->spi_module]].effect.MAX_INDICE)
+                    case WS2812B_EFFECT_TRIANGLE:
+                        for(led = from ; led <= to ; led++)
                         {
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt;
-                            var->leds[i[var->spi_module]].output_params = fUtilitiesGetMiddleTsvColor(var->leds[i[var->spi_module]].next_params, var->leds[i[var->spi_module]].previous_params, cpt, var->leds[i[var->spi_module]].effect.MAX_INDICE);
+                            var->p_output[led] = fUtilitiesGetMiddleTsvColor(var->p_colors[led].previous_params, var->p_colors[led].next_params, (cpt <= (max / 2)) ? cpt : (max - cpt), max/2);
                         }
-                        else
+                        is_updated = true;
+                        break;
+                    case WS2812B_EFFECT_SAWTOOTH:
+                        for(led = from ; led <= to ; led++)
                         {
-                            var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt - var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                            if(!var->leds[i[var->spi_module]].effect.INFINITE_REPETITION) 
-                            { 
-                                if(var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) 
-                                { 
-                                    var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION--; 
-                                } 
-                                else
-                                {
-                                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 0;
-                                }
-                            }
+                            var->p_output[led] = fUtilitiesGetMiddleTsvColor(var->p_colors[led].previous_params, var->p_colors[led].next_params, cpt, max);
+                        }
+                        is_updated = true;
+                        break;
+                    case WS2812B_EFFECT_SAWTOOTH_INV:
+                        for(led = from ; led <= to ; led++)
+                        {
+                            var->p_output[led] = fUtilitiesGetMiddleTsvColor(var->p_colors[led].next_params, var->p_colors[led].previous_params, cpt, max);
                         }
+                        is_updated = true;
+                        break;
+                    case WS2812B_EFFECT_GAUSSIAN:
+                    {
+                        double x = (double) (cpt*6.0/max);
+                        uint16_t indice = (uint16_t) (((double) ((max*251.0/100.0)/pow(2.0*M_PI, 0.5))*exp(-0.5*pow((double) (x-3.0), 2.0))));
+                        for(led = from ; led <= to ; led++)
+                        {
+                            var->p_output[led] = fUtilitiesGetMiddleTsvColor(var->p_colors[led].previous_params, var->p_colors[led].next_params, indice, max);
+                        }
+                        is_updated = true;
+                        break;
                     }
                 }
             }
-            else if(var->leds[i[var->spi_module]].effect.RESTORE_PREVIOUS_PARAMS)
-            {
-                var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].save_params;
-            }
-            break;
-        case WS2812B_EFFECT_GAUSSIAN:
-            if(((var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) || (var->leds[i[var->spi_module]].effect.INFINITE_REPETITION > 0)) > 0)
+            else
             {
-                if(!var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS)
+                for(led = from ; led <= to ; led++)
                 {
-                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 1;
-                    var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                    var->leds[i[var->spi_module]].effect.COUNTER = 0;
-                    var->leds[i[var->spi_module]].effect.MAX_INDICE = 200;
-                    __WS2812BExecutionTime2 = __WS2812BExecutionTime/var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                    __WS2812BTick = mGetTick();
-                    __WS2812BTickSynchro = 0;
+                    var->p_output[led] = var->p_colors[led].previous_params;
                 }
-                else
-                {
-                    if((mTickCompare(__WS2812BTick) + __WS2812BTickSynchro) >= __WS2812BExecutionTime2)
-                    {                        
-                        QWORD get_tick = mGetTick();
-                        WORD inc = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) / __WS2812BExecutionTime2;
-                        __WS2812BTickSynchro = ((get_tick - __WS2812BTick) + __WS2812BTickSynchro) % __WS2812BExecutionTime2;
-                        __WS2812BTick = get_tick;
-                        WORD cpt = (var->leds[i[var->spi_module]].effect.COUNTER + inc);
-                        double x = (double) (cpt*6.0/var->leds[i[var->spi_module]].effect.MAX_INDICE);
-                        double retValue = (double) ((var->leds[i[var->spi_module]].effect.MAX_INDICE*251.0/100.0)/pow(2.0*M_PI, 0.5))*exp(-0.5*pow((double) (x-3.0), 2.0));
-                        
-                        
-                        if(cpt <= var->leds[i[var->spi_module]].effect.MAX_INDICE)
-                        {
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt;
-                            var->leds[i[var->spi_module]].output_params = fUtilitiesGetMiddleTsvColor(var->leds[i[var->spi_module]].previous_params, var->leds[i[var->spi_module]].next_params, retValue, var->leds[i[var->spi_module]].effect.MAX_INDICE);
-                        }
-                        else
-                        {
-                            var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].previous_params;
-                            var->leds[i[var->spi_module]].effect.COUNTER = cpt - var->leds[i[var->spi_module]].effect.MAX_INDICE;
-                            if(!var->leds[i[var->spi_module]].effect.INFINITE_REPETITION) 
-                            { 
-                                if(var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) 
-                                { 
-                                    var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION--; 
-                                } 
-                                else
-                                {
-                                    var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 0;
-                                }
-                            }
-                        }
+                is_updated = true;
+                p_effect->effect.COUNTER = cpt - max;
+                if(!p_effect->effect.INFINITE_REPETITION) 
+                { 
+                    if(p_effect->effect.NUMBER_OF_REPETITION > 0) 
+                    { 
+                        p_effect->effect.NUMBER_OF_REPETITION--; 
+                    } 
+                    else
+                    {
+                        p_effect->effect.EFFECT_IN_PROGRESS = 0;
                     }
                 }
             }
-            else if(var->leds[i[var->spi_module]].effect.RESTORE_PREVIOUS_PARAMS)
+        }
+    }
+    else
+    {
+        if(p_effect->effect.RESTORE_PREVIOUS_PARAMS)
+        {
+            for(led = from ; led <= to ; led++)
             {
-                var->leds[i[var->spi_module]].output_params = var->leds[i[var->spi_module]].save_params;
+                var->p_output[led] = var->p_colors[led].save_params;
             }
-            break;
+            is_updated = true;
+        }
+        p_effect->effect.IS_IDLE = 1;
     }
+    return is_updated;
+}
+
+/*******************************************************************************
+  Function:
+    static bool eWS2812BIsSegmentValid(const WS2812B_PARAMS *var, uint16_t segmentIndice);
 
-    RGB_COLOR rgbColor = fUtilitiesTSVtoRGB(var->leds[i[var->spi_module]].output_params);
+  Description:
+    This routine checks that a segment exists, is not empty and ends in the
+    LED array (with WS2812B_DEF_SEGMENT_EFFECTS the effect of the segment is
+    p_effects[segmentIndice]: one by segment).
 
-    rgbColor.red *= 2.55;
-    rgbColor.green *= 2.55;
-    rgbColor.blue *= 2.55;
-    // GREEN
-    var->buffer.p[0+i[var->spi_module]*9] = 0x92 | ((rgbColor.green & 0x80) >> 1) | ((rgbColor.green & 0x40) >> 3) | ((rgbColor.green & 0x20) >> 5);
-    var->buffer.p[1+i[var->spi_module]*9] = 0x49 | ((rgbColor.green & 0x10) << 1) | ((rgbColor.green & 0x08) >> 1);
-    var->buffer.p[2+i[var->spi_module]*9] = 0x24 | ((rgbColor.green & 0x04) << 5) | ((rgbColor.green & 0x02) << 3) | ((rgbColor.green & 0x01) << 1);                 
-    // RED
-    var->buffer.p[3+i[var->spi_module]*9] = 0x92 | ((rgbColor.red & 0x80) >> 1) | ((rgbColor.red & 0x40) >> 3) | ((rgbColor.red & 0x20) >> 5);
-    var->buffer.p[4+i[var->spi_module]*9] = 0x49 | ((rgbColor.red & 0x10) << 1) | ((rgbColor.red & 0x08) >> 1);
-    var->buffer.p[5+i[var->spi_module]*9] = 0x24 | ((rgbColor.red & 0x04) << 5) | ((rgbColor.red & 0x02) << 3) | ((rgbColor.red & 0x01) << 1);
-    // BLUE
-    var->buffer.p[6+i[var->spi_module]*9] = 0x92 | ((rgbColor.blue & 0x80) >> 1) | ((rgbColor.blue & 0x40) >> 3) | ((rgbColor.blue & 0x20) >> 5);
-    var->buffer.p[7+i[var->spi_module]*9] = 0x49 | ((rgbColor.blue & 0x10) << 1) | ((rgbColor.blue & 0x08) >> 1);
-    var->buffer.p[8+i[var->spi_module]*9] = 0x24 | ((rgbColor.blue & 0x04) << 5) | ((rgbColor.blue & 0x02) << 3) | ((rgbColor.blue & 0x01) << 1);
+  Parameters:
+    *var            - The variable assign to the WS2812B LED array.
+    segmentIndice   - The indice of the segment.
 
-    if(++i[var->spi_module] >= var->segments.p[var->segments.size-1])
+  Return:
+    true if the segment can be used.
+  *****************************************************************************/
+static bool eWS2812BIsSegmentValid(const WS2812B_PARAMS *var, uint16_t segmentIndice)
+{
+    if (((uint32_t) segmentIndice + 1) >= var->segments.size)
     {
-        i[var->spi_module] = 0;
+        return false;
     }
-            
-    if(mTickCompare(var->tickRefresh) >= periodRefresh)
-    { 
-        if(!SPIWriteAndStoreByteArray(var->spi_module, var->chip_select, (void*)var->buffer.p, NULL, var->segments.p[var->segments.size-1]*9))
+    return (var->segments.p[segmentIndice] < var->segments.p[segmentIndice+1]) && (var->segments.p[segmentIndice+1] <= (var->buffer.size / WS2812B_BYTES_PER_LED));
+}
+
+/*******************************************************************************
+  Function:
+    static uint16_t eWS2812BGetNumberOfLeds(const WS2812B_PARAMS *var);
+
+  Description:
+    This routine returns the number of LEDs sent in a frame: the end of the
+    last segment, limited to the size of the LED array.
+
+  Parameters:
+    *var            - The variable assign to the WS2812B LED array.
+
+  Return:
+    The number of LEDs (0 if there is no segment).
+  *****************************************************************************/
+static uint16_t eWS2812BGetNumberOfLeds(const WS2812B_PARAMS *var)
+{
+    uint16_t number_of_leds;
+
+    if (var->segments.size == 0)
+    {
+        return 0;
+    }
+    number_of_leds = var->segments.p[var->segments.size-1];
+    return (number_of_leds > (var->buffer.size / WS2812B_BYTES_PER_LED)) ? (var->buffer.size / WS2812B_BYTES_PER_LED) : number_of_leds;
+}
+
+/*******************************************************************************
+  Function:
+    static void eWS2812BSetDirty(WS2812B_PARAMS *var, uint16_t from, uint16_t to);
+
+  Description:
+    This routine adds a range of LEDs (absolute indices) to the LEDs which 
+    have to be encoded in the next frame.
+
+  Parameters:
+    *var            - The variable assign to the WS2812B LED array.
+    from            - The first LED modified.
+    to              - The last LED modified.
+  *****************************************************************************/
+static void eWS2812BSetDirty(WS2812B_PARAMS *var, uint16_t from, uint16_t to)
+{
+    if (from < var->dirty_from)
+    {
+        var->dirty_from = from;
+    }
+    if ((to > var->dirty_to) || (var->dirty_to < var->dirty_from))
+    {
+        var->dirty_to = to;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    static void eWS2812BRenderFrame(WS2812B_PARAMS *var);
+
+  Description:
+    This routine evaluates the effects (which are not idle) for a new frame then
+    encodes the modified LEDs in the back buffer. The tick is read once: all
+    the effects of a frame are evaluated at the same time. The back buffer contains 
+    the frame before the previous one (the buffers are swapped at each frame)
+    so the LEDs modified during the previous frame are encoded too.
+
+  Parameters:
+    *var            - The variable assign to the WS2812B LED array.
+  *****************************************************************************/
+static void eWS2812BRenderFrame(WS2812B_PARAMS *var)
+{
+    uint16_t number_of_leds = eWS2812BGetNumberOfLeds(var);
+    uint16_t segment, led, from, to;
+    uint64_t tick = mGetTick();
+    
+    for (segment = 0 ; (segment + 1) < var->segments.size ; segment++)
+    {
+        if (!eWS2812BIsSegmentValid(var, segment))
+        {
+            continue;
+        }
+        from = var->segments.p[segment];
+        to = var->segments.p[segment+1] - 1;
+        if (var->is_effect_by_segment)
+        {
+            if (!var->p_effects[segment].effect.IS_IDLE && eWS2812BUpdateEffect(var, &var->p_effects[segment], from, to, tick))
+            {
+                eWS2812BSetDirty(var, from, to);
+            }
+        }
+        else
+        {
+            for (led = from ; led <= to ; led++)
+            {
+                if (!var->p_effects[led].effect.IS_IDLE && eWS2812BUpdateEffect(var, &var->p_effects[led], led, led, tick))
+                {
+                    eWS2812BSetDirty(var, led, led);
+                }
+            }
+        }
+    }
+    
+    // Union of the current and previous dirty ranges (empty range: from > to).
+    from = (var->dirty_from < var->dirty_previous_from) ? var->dirty_from : var->dirty_previous_from;
+    if (var->dirty_previous_from > var->dirty_previous_to)
+    {
+        to = var->dirty_to;
+    }
+    else if ((var->dirty_from > var->dirty_to) || (var->dirty_previous_to > var->dirty_to))
+    {
+        to = var->dirty_previous_to;
+    }
+    else
+    {
+        to = var->dirty_to;
+    }
+    if (to >= number_of_leds)
+    {
+        to = number_of_leds - 1;
+    }
+    for (led = from ; led <= to ; led++)
+    {
+        eWS2812BEncodePercent(&var->p_back_buffer[led*WS2812B_BYTES_PER_LED], fUtilitiesTSVtoRGB(var->p_output[led]));
+    }
+    
+    var->dirty_previous_from = var->dirty_from;
+    var->dirty_previous_to = var->dirty_to;
+    var->dirty_from = LAST_LED;
+    var->dirty_to = FIRST_LED;
+}
+
+/*******************************************************************************
+  Function:
+    BYTE eWS2812BFlush(QWORD periodRefresh, WS2812B_PARAMS *var);
+
+  Description:
+    This routine is the deamon for the WS2812B LED.
+    It must be called as more as possible in the main routine. The data is transmit
+    on the SDO pin (using DMA). The CLK, SDI and CS pins are not used.
+    The frames are double buffered: all the effects of a frame are evaluated
+    at once and only the modified LEDs are encoded in the back buffer while 
+    the DMA sends the front buffer. When the DMA transfer is completed and 
+    periodRefresh is elapsed, the buffers are swapped and the new frame is 
+    sent. A frame is never partially updated.
+ 
+  Return:
+    1: no transmission completed.
+    0: a frame has been completely sent on the SPI bus.
+
+  Parameters:
+    periodRefresh   - The period between each transmission on the SPI bus.
+    *var            - The variable assign to the WS2812B LED array.
+  *****************************************************************************/
+uint8_t eWS2812BFlush(uint64_t periodRefresh, WS2812B_PARAMS *var)
+{
+    uint8_t ret = 1;
+    uint8_t *p_buffer;
+    
+    if (!eWS2812BGetNumberOfLeds(var))
+    {
+        return ret;
+    }
+    
+    if (!var->is_chip_select_init)
+    {
+        SPIInitIOAsChipSelect(var->chip_select);
+        var->is_chip_select_init = true;
+    }
+    
+    if (!var->is_frame_ready)
+    {
+        eWS2812BRenderFrame(var);
+        var->is_frame_ready = true;
+    }
+    
+    if (var->is_sending)
+    {
+        if (!SPIWriteAndStoreByteArray(var->spi_module, var->chip_select, (void*)var->buffer.p, NULL, eWS2812BGetNumberOfLeds(var)*WS2812B_BYTES_PER_LED))
         {
-            var->tickRefresh = mGetTick();
+            var->is_sending = false;
             ret = 0;
         }
     }
+    else if (mTickCompare(var->tickRefresh) >= periodRefresh)
+    { 
+        p_buffer = var->buffer.p;
+        var->buffer.p = var->p_back_buffer;
+        var->p_back_buffer = p_buffer;
+        var->is_frame_ready = false;
+        var->is_sending = true;
+        var->tickRefresh = mGetTick();
+        SPIWriteAndStoreByteArray(var->spi_module, var->chip_select, (void*)var->buffer.p, NULL, eWS2812BGetNumberOfLeds(var)*WS2812B_BYTES_PER_LED);
+    }
     return ret;
 }
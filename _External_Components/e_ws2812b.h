@@ -76,6 +76,7 @@ typedef union
         unsigned MAX_INDICE:9;                  // BOTH: indice max pour le changement de couleur
         unsigned TYPE_OF_EFFECT:3;              // BOTH: cf. WS2812B_EFFECTS
         unsigned EFFECT_IN_PROGRESS:1;          // BOTH
+        unsigned IS_IDLE:1;                     // BOTH: nothing to evaluate until the next modification
     };
     
     struct 
@@ -108,16 +109,18 @@ typedef struct
 
 typedef struct
 {
-    TSV_COLOR       output_params;
     TSV_COLOR       previous_params;
     TSV_COLOR       next_params;
-    TSV_COLOR       save_params;            
+    TSV_COLOR       save_params;
+}WS2812B_LED_COLORS;                        // Cold: only read when an effect starts, steps or ends
+
+typedef struct
+{
     __EFFECTbits    effect;
-    DWORD           time_execution;
-    DWORD           time_execution2;
-    DWORD           tick_synchro; 
-    QWORD           tick;
-}WS2812B_LED;
+    uint64_t        time_execution;         // Transition time or period of the effect
+    uint64_t        time_step;              // time_execution / MAX_INDICE
+    uint64_t        tick_next_step;         // Deadline of the next step
+}WS2812B_EFFECT;
 
 typedef struct
 {
@@ -125,34 +128,70 @@ typedef struct
     _IO                 chip_select;
     bool                is_chip_select_init;
     DYNAMIC_TAB_WORD    segments;
-    WS2812B_LED         *leds;
-    DYNAMIC_TAB_BYTE    buffer;
+    TSV_COLOR           *p_output;              // Hot: output color of each LED
+    WS2812B_LED_COLORS  *p_colors;              // Cold: colors of each LED used by the effects
+    WS2812B_EFFECT      *p_effects;             // Effect state: one by LED or one by segment
+    bool                is_effect_by_segment;
+    DYNAMIC_TAB_BYTE    buffer;                 // Front buffer (sent by the DMA)
+    uint8_t             *p_back_buffer;         // Back buffer (frame in preparation)
+    uint16_t            dirty_from;             // LEDs modified during the current frame
+    uint16_t            dirty_to;
+    uint16_t            dirty_previous_from;    // LEDs modified during the previous frame (not yet in the back buffer)
+    uint16_t            dirty_previous_to;
+    bool                is_frame_ready;
+    bool                is_sending;
     uint64_t            tickRefresh;
 }WS2812B_PARAMS;
 
-#define WS2812B_INSTANCE(_spi_module, _io_port, _io_indice, c, d, e, f)          \
+#define WS2812B_INSTANCE(_spi_module, _io_port, _io_indice, c, d, e, f, g, h, i, j)      \
 {                                                   \
 	.spi_module = _spi_module,                      \
 	.chip_select = { _io_port, _io_indice },        \
     .is_chip_select_init = false,                   \
 	.segments = {c, sizeof(c)/sizeof(uint16_t), 0},	\
-	.leds = d,                                      \
-	.buffer = {e, f, 0},                            \
+    .p_output = d,                                  \
+    .p_colors = e,                                  \
+    .p_effects = f,                                 \
+    .is_effect_by_segment = g,                      \
+	.buffer = {h, i, 0},                            \
+    .p_back_buffer = j,                             \
+    .dirty_from = FIRST_LED,                        \
+    .dirty_to = LAST_LED,                           \
+    .dirty_previous_from = FIRST_LED,               \
+    .dirty_previous_to = LAST_LED,                  \
+    .is_frame_ready = false,                        \
+    .is_sending = false,                            \
 	.tickRefresh = 0,                               \
 }
 
+/*
+ * RAM by LED: 4 (output) + 12 (colors) + 32 (effect) + 18 (front & back buffers) = 66 bytes.
+ * Each LED has its own effect (all the functions are available).
+ */
 #define WS2812B_DEF(_name, _spi_module, _cs_pin, _number_total_of_leds, ...)                                \
 static uint16_t _name ## _segment_ram_allocation[] = {0, __VA_ARGS__ };                                     \
 static uint8_t _name ## _buffer_ram_allocation[_number_total_of_leds*9] = {0};                              \
-static WS2812B_LED _name ## _led_ram_allocation[_number_total_of_leds] = {0};                               \
-static WS2812B_PARAMS _name = WS2812B_INSTANCE(_spi_module, _XBR(_cs_pin), _IND(_cs_pin), _name ## _segment_ram_allocation, _name ## _led_ram_allocation, _name ## _buffer_ram_allocation, _number_total_of_leds)	
-
-#define __WS2812BIntensity                  var->leds[i[var->spi_module]].output_params.intensity
-#define __WS2812BTick                       var->leds[i[var->spi_module]].tick
-#define __WS2812BTickSynchro                var->leds[i[var->spi_module]].tick_synchro
-#define __WS2812BExecutionTime              var->leds[i[var->spi_module]].time_execution
-#define __WS2812BExecutionTime2             var->leds[i[var->spi_module]].time_execution2
-#define EndOfEffect()                       __WS2812BIntensity = 0; var->leds[i[var->spi_module]].effect.EFFECT_IN_PROGRESS = 0; if(!var->leds[i[var->spi_module]].effect.INFINITE_REPETITION) { if(var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION > 0) { var->leds[i[var->spi_module]].effect.NUMBER_OF_REPETITION--; } else { var->leds[i[var->spi_module]].effect.COUNTER = 0; } }
+static uint8_t _name ## _back_buffer_ram_allocation[_number_total_of_leds*9] = {0};                         \
+static TSV_COLOR _name ## _output_ram_allocation[_number_total_of_leds] = {0};                              \
+static WS2812B_LED_COLORS _name ## _colors_ram_allocation[_number_total_of_leds] = {0};                     \
+static WS2812B_EFFECT _name ## _effects_ram_allocation[_number_total_of_leds] = {0};                        \
+static WS2812B_PARAMS _name = WS2812B_INSTANCE(_spi_module, _XBR(_cs_pin), _IND(_cs_pin), _name ## _segment_ram_allocation, _name ## _output_ram_allocation, _name ## _colors_ram_allocation, _name ## _effects_ram_allocation, false, _name ## _buffer_ram_allocation, _number_total_of_leds*9, _name ## _back_buffer_ram_allocation)
+
+/*
+ * RAM by LED: 4 (output) + 12 (colors) + 18 (front & back buffers) = 34 bytes and 32 bytes by segment.
+ * The effect (type, repetitions, timing) is shared by all the LEDs of a segment and evaluated
+ * once by frame for the segment (the colors stay by LED). eWS2812BPutSegment() on a part of a 
+ * segment restarts the effect of the whole segment. The animations (eWS2812BAnimation) are
+ * not available.
+ */
+#define WS2812B_DEF_SEGMENT_EFFECTS(_name, _spi_module, _cs_pin, _number_total_of_leds, ...)                \
+static uint16_t _name ## _segment_ram_allocation[] = {0, __VA_ARGS__ };                                     \
+static uint8_t _name ## _buffer_ram_allocation[_number_total_of_leds*9] = {0};                              \
+static uint8_t _name ## _back_buffer_ram_allocation[_number_total_of_leds*9] = {0};                         \
+static TSV_COLOR _name ## _output_ram_allocation[_number_total_of_leds] = {0};                              \
+static WS2812B_LED_COLORS _name ## _colors_ram_allocation[_number_total_of_leds] = {0};                     \
+static WS2812B_EFFECT _name ## _effects_ram_allocation[sizeof(_name ## _segment_ram_allocation)/sizeof(uint16_t) - 1] = {0};         \
+static WS2812B_PARAMS _name = WS2812B_INSTANCE(_spi_module, _XBR(_cs_pin), _IND(_cs_pin), _name ## _segment_ram_allocation, _name ## _output_ram_allocation, _name ## _colors_ram_allocation, _name ## _effects_ram_allocation, true, _name ## _buffer_ram_allocation, _number_total_of_leds*9, _name ## _back_buffer_ram_allocation)
 
 #define eWS2812BIsLedUpdated(segmentIndice, ledIndice, var)         eWS2812BIsSegmentUpdated(segmentIndice, ledIndice, ledIndice, var)
 #define eWS2812BIsAnimationFinished(anim)                           ((anim.number_of_repetition > 0) ? false : true)
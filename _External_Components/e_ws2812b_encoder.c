@@ -0,0 +1,157 @@
+/*********************************************************************
+*	WS2812B bitstream encoder
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+* 
+*   Description:
+*   ------------ 
+*   Each bit of a WS2812B color is sent as 3 SPI bits (0: 100, 1: 110)
+*   at 2.4 MHz so a LED (GRB, 24 bits) needs 9 SPI bytes. The 24 bits
+*   code of a color byte is read in a 256 entries table (1 KB of flash)
+*   instead of being built bit by bit with masks and shifts.
+*********************************************************************/
+
+#include "../PLIB.h"
+
+static const uint32_t ws2812b_code[256] =
+{
+    0x924924, 0x924926, 0x924934, 0x924936, 0x9249a4, 0x9249a6, 0x9249b4, 0x9249b6,
+    0x924d24, 0x924d26, 0x924d34, 0x924d36, 0x924da4, 0x924da6, 0x924db4, 0x924db6,
+    0x926924, 0x926926, 0x926934, 0x926936, 0x9269a4, 0x9269a6, 0x9269b4, 0x9269b6,
+    0x926d24, 0x926d26, 0x926d34, 0x926d36, 0x926da4, 0x926da6, 0x926db4, 0x926db6,
+    0x934924, 0x934926, 0x934934, 0x934936, 0x9349a4, 0x9349a6, 0x9349b4, 0x9349b6,
+    0x934d24, 0x934d26, 0x934d34, 0x934d36, 0x934da4, 0x934da6, 0x934db4, 0x934db6,
+    0x936924, 0x936926, 0x936934, 0x936936, 0x9369a4, 0x9369a6, 0x9369b4, 0x9369b6,
+    0x936d24, 0x936d26, 0x936d34, 0x936d36, 0x936da4, 0x936da6, 0x936db4, 0x936db6,
+    0x9a4924, 0x9a4926, 0x9a4934, 0x9a4936, 0x9a49a4, 0x9a49a6, 0x9a49b4, 0x9a49b6,
+    0x9a4d24, 0x9a4d26, 0x9a4d34, 0x9a4d36, 0x9a4da4, 0x9a4da6, 0x9a4db4, 0x9a4db6,
+    0x9a6924, 0x9a6926, 0x9a6934, 0x9a6936, 0x9a69a4, 0x9a69a6, 0x9a69b4, 0x9a69b6,
+    0x9a6d24, 0x9a6d26, 0x9a6d34, 0x9a6d36, 0x9a6da4, 0x9a6da6, 0x9a6db4, 0x9a6db6,
+    0x9b4924, 0x9b4926, 0x9b4934, 0x9b4936, 0x9b49a4, 0x9b49a6, 0x9b49b4, 0x9b49b6,
+    0x9b4d24, 0x9b4d26, 0x9b4d34, 0x9b4d36, 0x9b4da4, 0x9b4da6, 0x9b4db4, 0x9b4db6,
+    0x9b6924, 0x9b6926, 0x9b6934, 0x9b6936, 0x9b69a4, 0x9b69a6, 0x9b69b4, 0x9b69b6,
+    0x9b6d24, 0x9b6d26, 0x9b6d34, 0x9b6d36, 0x9b6da4, 0x9b6da6, 0x9b6db4, 0x9b6db6,
+    0xd24924, 0xd24926, 0xd24934, 0xd24936, 0xd249a4, 0xd249a6, 0xd249b4, 0xd249b6,
+    0xd24d24, 0xd24d26, 0xd24d34, 0xd24d36, 0xd24da4, 0xd24da6, 0xd24db4, 0xd24db6,
+    0xd26924, 0xd26926, 0xd26934, 0xd26936, 0xd269a4, 0xd269a6, 0xd269b4, 0xd269b6,
+    0xd26d24, 0xd26d26, 0xd26d34, 0xd26d36, 0xd26da4, 0xd26da6, 0xd26db4, 0xd26db6,
+    0xd34924, 0xd34926, 0xd34934, 0xd34936, 0xd349a4, 0xd349a6, 0xd349b4, 0xd349b6,
+    0xd34d24, 0xd34d26, 0xd34d34, 0xd34d36, 0xd34da4, 0xd34da6, 0xd34db4, 0xd34db6,
+    0xd36924, 0xd36926, 0xd36934, 0xd36936, 0xd369a4, 0xd369a6, 0xd369b4, 0xd369b6,
+    0xd36d24, 0xd36d26, 0xd36d34, 0xd36d36, 0xd36da4, 0xd36da6, 0xd36db4, 0xd36db6,
+    0xda4924, 0xda4926, 0xda4934, 0xda4936, 0xda49a4, 0xda49a6, 0xda49b4, 0xda49b6,
+    0xda4d24, 0xda4d26, 0xda4d34, 0xda4d36, 0xda4da4, 0xda4da6, 0xda4db4, 0xda4db6,
+    0xda6924, 0xda6926, 0xda6934, 0xda6936, 0xda69a4, 0xda69a6, 0xda69b4, 0xda69b6,
+    0xda6d24, 0xda6d26, 0xda6d34, 0xda6d36, 0xda6da4, 0xda6da6, 0xda6db4, 0xda6db6,
+    0xdb4924, 0xdb4926, 0xdb4934, 0xdb4936, 0xdb49a4, 0xdb49a6, 0xdb49b4, 0xdb49b6,
+    0xdb4d24, 0xdb4d26, 0xdb4d34, 0xdb4d36, 0xdb4da4, 0xdb4da6, 0xdb4db4, 0xdb4db6,
+    0xdb6924, 0xdb6926, 0xdb6934, 0xdb6936, 0xdb69a4, 0xdb69a6, 0xdb69b4, 0xdb69b6,
+    0xdb6d24, 0xdb6d26, 0xdb6d34, 0xdb6d36, 0xdb6da4, 0xdb6da6, 0xdb6db4, 0xdb6db6
+};
+
+/*******************************************************************************
+ * Function: 
+ *      static inline void eWS2812BEncodeByte(uint8_t *p, uint8_t level)
+ * 
+ * Description:
+ *      This routine writes the 3 SPI bytes of a color level.
+ * 
+ * Parameters:
+ *      *p: The destination (3 bytes).
+ *      level: The color level (0..255).
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static inline void eWS2812BEncodeByte(uint8_t *p, uint8_t level)
+{
+    uint32_t code = ws2812b_code[level];
+    
+    p[0] = (uint8_t) (code >> 16);
+    p[1] = (uint8_t) (code >> 8);
+    p[2] = (uint8_t) (code >> 0);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void eWS2812BEncodeLevel(uint8_t *p, RGB_COLOR level)
+ * 
+ * Description:
+ *      This routine encodes a LED in the SPI bitstream (GRB order).
+ * 
+ * Parameters:
+ *      *p: The destination (WS2812B_BYTES_PER_LED bytes).
+ *      level: The color of the LED (0..255 for each channel).
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+void eWS2812BEncodeLevel(uint8_t *p, RGB_COLOR level)
+{
+    eWS2812BEncodeByte(&p[0], level.green);
+    eWS2812BEncodeByte(&p[3], level.red);
+    eWS2812BEncodeByte(&p[6], level.blue);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void eWS2812BEncodePercent(uint8_t *p, RGB_COLOR percent)
+ * 
+ * Description:
+ *      This routine encodes a LED in the SPI bitstream (GRB order) from a 
+ *      color in percent (as returned by fUtilitiesTSVtoRGB). The scaling 
+ *      to 0..255 is done with integers.
+ * 
+ * Parameters:
+ *      *p: The destination (WS2812B_BYTES_PER_LED bytes).
+ *      percent: The color of the LED (0..100 for each channel).
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+void eWS2812BEncodePercent(uint8_t *p, RGB_COLOR percent)
+{
+    eWS2812BEncodeByte(&p[0], COLOR_PERCENT_TO_LEVEL(percent.green));
+    eWS2812BEncodeByte(&p[3], COLOR_PERCENT_TO_LEVEL(percent.red));
+    eWS2812BEncodeByte(&p[6], COLOR_PERCENT_TO_LEVEL(percent.blue));
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void eWS2812BEncodeArray(uint8_t *p, const RGB_COLOR *p_levels, uint16_t number_of_leds, uint8_t intensity)
+ * 
+ * Description:
+ *      This routine encodes an array of LEDs in one pass. A global intensity
+ *      is applied to all the LEDs (integer scaling, 255: no scaling).
+ * 
+ * Parameters:
+ *      *p: The destination (number_of_leds * WS2812B_BYTES_PER_LED bytes).
+ *      *p_levels: The colors of the LEDs (0..255 for each channel).
+ *      number_of_leds: The number of LEDs to encode.
+ *      intensity: The global intensity (0..255).
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      eWS2812BEncodeArray(buffer, colors, 60, 128);
+ ******************************************************************************/
+void eWS2812BEncodeArray(uint8_t *p, const RGB_COLOR *p_levels, uint16_t number_of_leds, uint8_t intensity)
+{
+    uint16_t scale = (uint16_t) intensity + 1;     // 256: (level * 256) >> 8 = level
+    
+    for ( ; number_of_leds > 0 ; number_of_leds--, p_levels++, p += WS2812B_BYTES_PER_LED)
+    {
+        eWS2812BEncodeByte(&p[0], (uint8_t) ((p_levels->green * scale) >> 8));
+        eWS2812BEncodeByte(&p[3], (uint8_t) ((p_levels->red * scale) >> 8));
+        eWS2812BEncodeByte(&p[6], (uint8_t) ((p_levels->blue * scale) >> 8));
+    }
+}
@@ -0,0 +1,10 @@
+#ifndef __DEF_WS2812B_ENCODER
+#define	__DEF_WS2812B_ENCODER
+
+#define WS2812B_BYTES_PER_LED           9       // 24 bits (GRB) * 3 SPI bits
+
+void eWS2812BEncodeLevel(uint8_t *p, RGB_COLOR level);
+void eWS2812BEncodePercent(uint8_t *p, RGB_COLOR percent);
+void eWS2812BEncodeArray(uint8_t *p, const RGB_COLOR *p_levels, uint16_t number_of_leds, uint8_t intensity);
+
+#endif
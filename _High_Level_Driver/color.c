@@ -0,0 +1,325 @@
+/*********************************************************************
+*	Colour math (TSV / RGB)
+*	Author : Sébastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Description:
+*   ------------
+*   Integer versions of the TSV <-> RGB conversions, the TSV interpolation
+*   and the step counting used by the LED daemons and the WS2812B driver.
+*   The PIC32MX has no FPU: the former float code cost hundreds of cycles
+*   per LED and per tick. Every division here is a 32 bits hardware DIV.
+*   The results are exact (truncated) where the float code could be one
+*   unit below because of its rounding.
+*********************************************************************/
+
+#include "../PLIB.h"
+
+/*
+ * Percent (0..100) to 8 bits level with a gamma of 2.2:
+ * round(255 * (p / 100)^2.2)
+ */
+const uint8_t color_gamma_table[COLOR_PERCENT_MAX + 1] =
+{
+      0,   0,   0,   0,   0,   0,   1,   1,   1,   1,
+      2,   2,   2,   3,   3,   4,   5,   5,   6,   7,
+      7,   8,   9,  10,  11,  12,  13,  14,  15,  17,
+     18,  19,  21,  22,  24,  25,  27,  29,  30,  32,
+     34,  36,  38,  40,  42,  44,  46,  48,  51,  53,
+     55,  58,  60,  63,  66,  68,  71,  74,  77,  80,
+     83,  86,  89,  92,  96,  99, 102, 106, 109, 113,
+    116, 120, 124, 128, 131, 135, 139, 143, 148, 152,
+    156, 160, 165, 169, 174, 178, 183, 188, 192, 197,
+    202, 207, 212, 217, 223, 228, 233, 238, 244, 249,
+    255
+};
+
+/*******************************************************************************
+ * Function:
+ *      RGB_COLOR color_tsv_to_rgb(TSV_COLOR tsv)
+ *
+ * Description:
+ *      This routine converts a TSV colour into a RGB colour (percent).
+ *      The fractional part of the shade is kept in hundredths so the
+ *      intermediate products are computed in 1/10000 and truncated once.
+ *
+ * Parameters:
+ *      tsv: The TSV colour (shade <= 600, saturation & intensity <= 100).
+ *
+ * Return:
+ *      The RGB colour in percent (black if the TSV colour is out of range).
+ ******************************************************************************/
+RGB_COLOR color_tsv_to_rgb(TSV_COLOR tsv)
+{
+    RGB_COLOR ret = {0, 0, 0};
+    uint32_t i = tsv.intensity;
+    uint32_t s = tsv.saturation;
+    uint32_t frac, l, m, n;
+
+    if ((tsv.shade > COLOR_SHADE_MAX) || (s > COLOR_PERCENT_MAX) || (i > COLOR_PERCENT_MAX))
+    {
+        return ret;
+    }
+
+    frac = tsv.shade % COLOR_SHADE_SECTOR;
+    l = i * (100 - s) / 100;
+    m = i * (10000 - frac * s) / 10000;
+    n = i * (10000 - 100 * s + frac * s) / 10000;
+
+    switch ((tsv.shade / COLOR_SHADE_SECTOR) % 6)
+    {
+        case 0:
+            ret.red = i;
+            ret.green = n;
+            ret.blue = l;
+            break;
+        case 1:
+            ret.red = m;
+            ret.green = i;
+            ret.blue = l;
+            break;
+        case 2:
+            ret.red = l;
+            ret.green = i;
+            ret.blue = n;
+            break;
+        case 3:
+            ret.red = l;
+            ret.green = m;
+            ret.blue = i;
+            break;
+        case 4:
+            ret.red = n;
+            ret.green = l;
+            ret.blue = i;
+            break;
+        default:
+            ret.red = i;
+            ret.green = l;
+            ret.blue = m;
+            break;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+ * Function:
+ *      TSV_COLOR color_rgb_to_tsv(RGB_COLOR rgb)
+ *
+ * Description:
+ *      This routine converts a RGB colour (percent) into a TSV colour.
+ *      A negative shade (red sector, blue > green) is wrapped with the
+ *      same +599 offset as the former float code. A grey colour (no
+ *      chroma) gets a shade of 0.
+ *
+ * Parameters:
+ *      rgb: The RGB colour in percent.
+ *
+ * Return:
+ *      The TSV colour.
+ ******************************************************************************/
+TSV_COLOR color_rgb_to_tsv(RGB_COLOR rgb)
+{
+    TSV_COLOR ret = {0, 100, 0};
+    int32_t min, max, delta;
+
+    min = (rgb.red < rgb.green) ? rgb.red : rgb.green;
+    min = (min < rgb.blue) ? min : rgb.blue;
+    max = (rgb.red > rgb.green) ? rgb.red : rgb.green;
+    max = (max > rgb.blue) ? max : rgb.blue;
+    delta = max - min;
+
+    if (max > 0)
+    {
+        if (delta == 0)
+        {
+            ret.shade = 0;
+        }
+        else if (rgb.red >= max)
+        {
+            int32_t num = 100 * ((int32_t) rgb.green - (int32_t) rgb.blue);
+            ret.shade = (num >= 0) ? (num / delta) : ((599 * delta + num) / delta);
+        }
+        else if (rgb.green >= max)
+        {
+            ret.shade = (200 * delta + 100 * ((int32_t) rgb.blue - (int32_t) rgb.red)) / delta;
+        }
+        else
+        {
+            ret.shade = (400 * delta + 100 * ((int32_t) rgb.red - (int32_t) rgb.green)) / delta;
+        }
+        ret.saturation = (delta * 100) / max;
+        ret.intensity = max;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+ * Function:
+ *      uint16_t color_tsv_get_number_of_step(TSV_COLOR color1, TSV_COLOR color2)
+ *
+ * Description:
+ *      This routine returns the number of unit steps needed to go from
+ *      color1 to color2: the largest difference between the shades (by
+ *      the shortest way around the colour wheel), the saturations and the
+ *      intensities.
+ *
+ * Parameters:
+ *      color1: The TSV colour of departure.
+ *      color2: The TSV colour of arrival.
+ *
+ * Return:
+ *      The number of steps (0 if both colours are equal).
+ ******************************************************************************/
+uint16_t color_tsv_get_number_of_step(TSV_COLOR color1, TSV_COLOR color2)
+{
+    uint16_t shade_threshold = (color1.shade > color2.shade) ? (color1.shade - color2.shade) : (color2.shade - color1.shade);
+    uint16_t saturation_threshold = (color1.saturation > color2.saturation) ? (color1.saturation - color2.saturation) : (color2.saturation - color1.saturation);
+    uint16_t intensity_threshold = (color1.intensity > color2.intensity) ? (color1.intensity - color2.intensity) : (color2.intensity - color1.intensity);
+    uint16_t ret;
+
+    if (shade_threshold > (COLOR_SHADE_MAX / 2))
+    {
+        shade_threshold = COLOR_SHADE_MAX - shade_threshold;
+    }
+    ret = shade_threshold;
+    (ret < saturation_threshold) ? (ret = saturation_threshold) : 0;
+    (ret < intensity_threshold) ? (ret = intensity_threshold) : 0;
+    return ret;
+}
+
+/*******************************************************************************
+ * Function:
+ *      TSV_COLOR color_tsv_get_middle(TSV_COLOR color1, TSV_COLOR color2, uint16_t indice, uint16_t number_of_step)
+ *
+ * Description:
+ *      This routine returns the colour at the step 'indice' of a linear
+ *      transition of 'number_of_step' steps from color1 to color2. The
+ *      shade takes the shortest way around the colour wheel.
+ *
+ * Parameters:
+ *      color1: The TSV colour of departure (indice = 0).
+ *      color2: The TSV colour of arrival (indice = number_of_step).
+ *      indice: The current step.
+ *      number_of_step: The total number of steps.
+ *
+ * Return:
+ *      The intermediate TSV colour.
+ ******************************************************************************/
+TSV_COLOR color_tsv_get_middle(TSV_COLOR color1, TSV_COLOR color2, uint16_t indice, uint16_t number_of_step)
+{
+    TSV_COLOR ret;
+    uint32_t shade_threshold;
+    uint32_t shade;
+    bool is_increasing;
+
+    if ((number_of_step == indice) || ((color1.shade == color2.shade) && (color1.saturation == color2.saturation) && (color1.intensity == color2.intensity)))
+    {
+        return color2;
+    }
+
+    if (color1.shade == color2.shade)
+    {
+        ret.shade = color1.shade;
+    }
+    else
+    {
+        if (color1.shade > color2.shade)
+        {
+            shade_threshold = color1.shade - color2.shade;
+            is_increasing = (shade_threshold > (COLOR_SHADE_MAX / 2));
+        }
+        else
+        {
+            shade_threshold = color2.shade - color1.shade;
+            is_increasing = (shade_threshold <= (COLOR_SHADE_MAX / 2));
+        }
+        if (shade_threshold > (COLOR_SHADE_MAX / 2))
+        {
+            shade_threshold = COLOR_SHADE_MAX - shade_threshold;
+        }
+
+        if (is_increasing)
+        {
+            shade = color1.shade + (uint32_t) indice * shade_threshold / number_of_step;
+        }
+        else
+        {
+            shade = COLOR_SHADE_MAX + color1.shade - (uint32_t) indice * shade_threshold / number_of_step;
+        }
+        ret.shade = (shade >= COLOR_SHADE_MAX) ? (shade - COLOR_SHADE_MAX) : shade;
+    }
+
+    if (color1.saturation >= color2.saturation)
+    {
+        ret.saturation = color1.saturation - (uint32_t) indice * (color1.saturation - color2.saturation) / number_of_step;
+    }
+    else
+    {
+        ret.saturation = color1.saturation + (uint32_t) indice * (color2.saturation - color1.saturation) / number_of_step;
+    }
+
+    if (color1.intensity >= color2.intensity)
+    {
+        ret.intensity = color1.intensity - (uint32_t) indice * (color1.intensity - color2.intensity) / number_of_step;
+    }
+    else
+    {
+        ret.intensity = color1.intensity + (uint32_t) indice * (color2.intensity - color1.intensity) / number_of_step;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+ * Function:
+ *      RGB_COLOR color_rgb_to_level(RGB_COLOR rgb)
+ *
+ * Description:
+ *      This routine converts a RGB colour in percent into 8 bits levels
+ *      (linear, 100% = 255).
+ *
+ * Parameters:
+ *      rgb: The RGB colour in percent (0..100).
+ *
+ * Return:
+ *      The RGB colour in levels (0..255).
+ ******************************************************************************/
+RGB_COLOR color_rgb_to_level(RGB_COLOR rgb)
+{
+    RGB_COLOR ret;
+
+    ret.red = COLOR_PERCENT_TO_LEVEL(rgb.red);
+    ret.green = COLOR_PERCENT_TO_LEVEL(rgb.green);
+    ret.blue = COLOR_PERCENT_TO_LEVEL(rgb.blue);
+    return ret;
+}
+
+/*******************************************************************************
+ * Function:
+ *      RGB_COLOR color_rgb_to_level_gamma(RGB_COLOR rgb)
+ *
+ * Description:
+ *      This routine converts a RGB colour in percent into 8 bits levels
+ *      through the gamma table (perceived linear fades). A value above
+ *      100% is saturated.
+ *
+ * Parameters:
+ *      rgb: The RGB colour in percent (0..100).
+ *
+ * Return:
+ *      The RGB colour in levels (0..255).
+ ******************************************************************************/
+RGB_COLOR color_rgb_to_level_gamma(RGB_COLOR rgb)
+{
+    RGB_COLOR ret;
+
+    ret.red = color_gamma_table[(rgb.red > COLOR_PERCENT_MAX) ? COLOR_PERCENT_MAX : rgb.red];
+    ret.green = color_gamma_table[(rgb.green > COLOR_PERCENT_MAX) ? COLOR_PERCENT_MAX : rgb.green];
+    ret.blue = color_gamma_table[(rgb.blue > COLOR_PERCENT_MAX) ? COLOR_PERCENT_MAX : rgb.blue];
+    return ret;
+}
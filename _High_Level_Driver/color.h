@@ -0,0 +1,24 @@
+#ifndef __DEF_COLOR
+#define __DEF_COLOR
+
+/*
+ * Integer colour math (no soft-float on the PIC32MX).
+ * TSV_COLOR: shade 0..600 (6 sectors of 100), saturation 0..100, intensity 0..100.
+ * RGB_COLOR: 0..100 (percent) unless the function says 0..255 (level).
+ */
+#define COLOR_SHADE_SECTOR          100
+#define COLOR_SHADE_MAX             (6 * COLOR_SHADE_SECTOR)
+#define COLOR_PERCENT_MAX           100
+
+#define COLOR_PERCENT_TO_LEVEL(p)   ((uint8_t) (((uint16_t) (p) * 255) / COLOR_PERCENT_MAX))
+
+extern const uint8_t color_gamma_table[COLOR_PERCENT_MAX + 1];
+
+RGB_COLOR   color_tsv_to_rgb(TSV_COLOR tsv);
+TSV_COLOR   color_rgb_to_tsv(RGB_COLOR rgb);
+uint16_t    color_tsv_get_number_of_step(TSV_COLOR color1, TSV_COLOR color2);
+TSV_COLOR   color_tsv_get_middle(TSV_COLOR color1, TSV_COLOR color2, uint16_t indice, uint16_t number_of_step);
+RGB_COLOR   color_rgb_to_level(RGB_COLOR rgb);
+RGB_COLOR   color_rgb_to_level_gamma(RGB_COLOR rgb);
+
+#endif
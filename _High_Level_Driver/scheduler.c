@@ -0,0 +1,421 @@
+/*********************************************************************
+*	Scheduler (hierarchical timer wheel)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+* 
+*   Description:
+*   ------------ 
+*   Daemons are registered as tasks with a period (or a one shot 
+*   deadline). Insert and remove are O(1). scheduler_run() only visits
+*   the wheel slots which are due instead of asking every daemon if its
+*   period is elapsed. Empty parts of the wheel are skipped.
+*   The main loop can then call scheduler_idle() to wait (CPU in IDLE)
+*   until the next interrupt when nothing is due soon.
+*********************************************************************/
+
+#include "../PLIB.h"
+
+// A task parked in the expired list (being executed by scheduler_run) has this level.
+#define SCHEDULER_EXPIRED_LEVEL     SCHEDULER_LEVELS
+
+static scheduler_task_t * scheduler_wheel[SCHEDULER_LEVELS][SCHEDULER_SLOTS] = {{NULL}};
+static uint64_t scheduler_bitmap[SCHEDULER_LEVELS] = {0};
+static scheduler_task_t * scheduler_expired = NULL;
+static uint64_t scheduler_current = 0;              // Next slot (first level unit) to process
+static bool scheduler_is_initialized = false;
+
+static void scheduler_init(void)
+{
+    if (!scheduler_is_initialized)
+    {
+        scheduler_current = (timer_get_tick() >> SCHEDULER_RESOLUTION_SHIFT);
+        scheduler_is_initialized = true;
+    }
+}
+
+static void scheduler_push(scheduler_task_t **p_head, scheduler_task_t *task)
+{
+    task->prev = NULL;
+    task->next = *p_head;
+    if (task->next != NULL)
+    {
+        task->next->prev = task;
+    }
+    *p_head = task;
+    task->is_armed = true;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void scheduler_link(scheduler_task_t *task)
+ * 
+ * Description:
+ *      This routine inserts a task into the wheel (O(1)). The expiry is 
+ *      rounded up to the next slot so a task is never executed before its 
+ *      deadline (at most one slot late). The level is given by the distance
+ *      between the task slot and the current slot.
+ * 
+ * Parameters:
+ *      *task: The pointer of scheduler_task_t (expiry already set).
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void scheduler_link(scheduler_task_t *task)
+{
+    uint64_t slot = (task->expiry + ((1ull << SCHEDULER_RESOLUTION_SHIFT) - 1)) >> SCHEDULER_RESOLUTION_SHIFT;
+    uint64_t delta;
+    uint8_t level = 0;
+    
+    if (slot < scheduler_current)
+    {
+        slot = scheduler_current;
+    }
+    
+    delta = slot - scheduler_current;
+    if (delta >= (1ull << (SCHEDULER_SLOT_BITS * SCHEDULER_LEVELS)))
+    {
+        // Too far: park it at the end of the last level. It is re-inserted when cascaded.
+        slot = scheduler_current + (1ull << (SCHEDULER_SLOT_BITS * SCHEDULER_LEVELS)) - 1;
+        level = SCHEDULER_LEVELS - 1;
+    }
+    else
+    {
+        while (delta >= (1ull << (SCHEDULER_SLOT_BITS * (level + 1))))
+        {
+            level++;
+        }
+    }
+    
+    task->level = level;
+    task->slot = (uint8_t) ((slot >> (SCHEDULER_SLOT_BITS * level)) & SCHEDULER_SLOT_MASK);
+    scheduler_push(&scheduler_wheel[level][task->slot], task);
+    scheduler_bitmap[level] |= (1ull << task->slot);
+}
+
+static void scheduler_unlink(scheduler_task_t *task)
+{
+    if (task->prev != NULL)
+    {
+        task->prev->next = task->next;
+    }
+    else if (task->level == SCHEDULER_EXPIRED_LEVEL)
+    {
+        scheduler_expired = task->next;
+    }
+    else
+    {
+        scheduler_wheel[task->level][task->slot] = task->next;
+        if (task->next == NULL)
+        {
+            scheduler_bitmap[task->level] &= ~(1ull << task->slot);
+        }
+    }
+    
+    if (task->next != NULL)
+    {
+        task->next->prev = task->prev;
+    }
+    
+    task->next = NULL;
+    task->prev = NULL;
+    task->is_armed = false;
+}
+
+static void scheduler_cascade(uint8_t level, uint8_t slot)
+{
+    scheduler_task_t * task = scheduler_wheel[level][slot];
+    scheduler_task_t * next;
+    
+    scheduler_wheel[level][slot] = NULL;
+    scheduler_bitmap[level] &= ~(1ull << slot);
+    
+    while (task != NULL)
+    {
+        next = task->next;
+        scheduler_link(task);
+        task = next;
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void scheduler_task_start(scheduler_task_t *task, uint64_t delay)
+ * 
+ * Description:
+ *      This routine registers (or re-arms) a task. It is executed 'delay' ticks
+ *      after now then every 'period' ticks (task->period) if the period is not
+ *      null.
+ * 
+ * Parameters:
+ *      *task: The pointer of scheduler_task_t.
+ *      delay: The delay (in ticks) before the first execution.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      See. scheduler_run()
+ ******************************************************************************/
+void scheduler_task_start(scheduler_task_t *task, uint64_t delay)
+{
+    scheduler_task_start_at(task, timer_get_tick() + delay);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void scheduler_task_start_at(scheduler_task_t *task, uint64_t deadline)
+ * 
+ * Description:
+ *      This routine registers (or re-arms) a task for an absolute deadline 
+ *      (tick value, see. timer_get_tick()).
+ * 
+ * Parameters:
+ *      *task: The pointer of scheduler_task_t.
+ *      deadline: The absolute tick of the first execution.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+void scheduler_task_start_at(scheduler_task_t *task, uint64_t deadline)
+{
+    scheduler_init();
+    if (task->is_armed)
+    {
+        scheduler_unlink(task);
+    }
+    task->expiry = deadline;
+    scheduler_link(task);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void scheduler_task_stop(scheduler_task_t *task)
+ * 
+ * Description:
+ *      This routine removes a task from the scheduler (O(1)). It can be called
+ *      from a task handler (even for the calling task itself).
+ * 
+ * Parameters:
+ *      *task: The pointer of scheduler_task_t.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+void scheduler_task_stop(scheduler_task_t *task)
+{
+    if (task->is_armed)
+    {
+        scheduler_unlink(task);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint32_t scheduler_run(void)
+ * 
+ * Description:
+ *      This routine must be placed in the while main loop. It advances the 
+ *      wheel up to the current tick and executes the tasks which are due. 
+ *      A periodic task is re-armed one period after its previous deadline 
+ *      (no drift). If it is late by more than one period, the missed 
+ *      executions are skipped.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      The number of executed tasks.
+ * 
+ * Example:
+ *      static void _led_task(void *p_context) { ... }
+ *      SCHEDULER_TASK_DEF(led_task, _led_task, NULL, TICK_100MS);
+ *      scheduler_task_start(&led_task, TICK_0);
+ *      while (1)
+ *      {
+ *          scheduler_run();
+ *          scheduler_idle();
+ *      }
+ ******************************************************************************/
+uint32_t scheduler_run(void)
+{
+    uint64_t now;
+    uint64_t target;
+    uint64_t current;
+    uint64_t next;
+    uint32_t executed = 0;
+    uint8_t level;
+    uint8_t slot;
+    scheduler_task_t * task;
+    
+    scheduler_init();
+    now = timer_get_tick();
+    target = (now >> SCHEDULER_RESOLUTION_SHIFT);
+    
+    while (scheduler_current <= target)
+    {
+        current = scheduler_current;
+        
+        // Cascade the upper levels each time the lower level wraps.
+        for (level = 1 ; level < SCHEDULER_LEVELS ; level++)
+        {
+            if (current & ((1ull << (SCHEDULER_SLOT_BITS * level)) - 1))
+            {
+                break;
+            }
+            scheduler_cascade(level, (uint8_t) ((current >> (SCHEDULER_SLOT_BITS * level)) & SCHEDULER_SLOT_MASK));
+        }
+        
+        // Move the due tasks into the expired list then execute them.
+        slot = (uint8_t) (current & SCHEDULER_SLOT_MASK);
+        scheduler_current = current + 1;
+        while ((task = scheduler_wheel[0][slot]) != NULL)
+        {
+            scheduler_unlink(task);
+            task->level = SCHEDULER_EXPIRED_LEVEL;
+            scheduler_push(&scheduler_expired, task);
+        }
+        
+        while ((task = scheduler_expired) != NULL)
+        {
+            scheduler_unlink(task);
+            if (task->period > 0)
+            {
+                task->expiry += task->period;
+                if (task->expiry <= now)
+                {
+                    task->expiry = now + task->period;
+                }
+                scheduler_link(task);
+            }
+            executed++;
+            (*task->handler)(task->p_context);
+        }
+        
+        // Skip the slots which can not contain any task.
+        for (level = 0 ; (level < SCHEDULER_LEVELS) && (scheduler_bitmap[level] == 0) ; level++);
+        if (level == SCHEDULER_LEVELS)
+        {
+            scheduler_current = target + 1;
+        }
+        else if (level > 0)
+        {
+            next = ((current >> (SCHEDULER_SLOT_BITS * level)) + 1) << (SCHEDULER_SLOT_BITS * level);
+            scheduler_current = (next < (target + 1)) ? next : (target + 1);
+        }
+    }
+    
+    return executed;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint64_t scheduler_get_next_expiry(void)
+ * 
+ * Description:
+ *      This routine returns a lower bound of the next deadline (tick value).
+ *      It is exact at the slot resolution for the first level and it is the
+ *      beginning of the first used slot for the upper levels.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      The tick of the next deadline or 0xFFFFFFFFFFFFFFFF if no task is armed.
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+uint64_t scheduler_get_next_expiry(void)
+{
+    uint64_t next = 0xFFFFFFFFFFFFFFFFull;
+    uint64_t rotated;
+    uint64_t slot;
+    uint8_t index;
+    uint8_t level;
+    
+    for (level = 0 ; level < SCHEDULER_LEVELS ; level++)
+    {
+        if (scheduler_bitmap[level] != 0)
+        {
+            index = (uint8_t) ((scheduler_current >> (SCHEDULER_SLOT_BITS * level)) & SCHEDULER_SLOT_MASK);
+            rotated = (index > 0) ? ((scheduler_bitmap[level] >> index) | (scheduler_bitmap[level] << (SCHEDULER_SLOTS - index))) : scheduler_bitmap[level];
+            slot = ((scheduler_current >> (SCHEDULER_SLOT_BITS * level)) + __builtin_ctzll(rotated)) << (SCHEDULER_SLOT_BITS * level);
+            if (slot < scheduler_current)
+            {
+                slot = scheduler_current;
+            }
+            if (slot < next)
+            {
+                next = slot;
+            }
+        }
+    }
+    
+    return (next == 0xFFFFFFFFFFFFFFFFull) ? next : (next << SCHEDULER_RESOLUTION_SHIFT);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint64_t scheduler_get_idle_ticks(void)
+ * 
+ * Description:
+ *      This routine returns the number of ticks before the next deadline.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      The number of ticks (0 if a task is due, 0xFFFFFFFFFFFFFFFF if no task).
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+uint64_t scheduler_get_idle_ticks(void)
+{
+    uint64_t next = scheduler_get_next_expiry();
+    uint64_t now = timer_get_tick();
+    
+    if (next == 0xFFFFFFFFFFFFFFFFull)
+    {
+        return next;
+    }
+    return (next > now) ? (next - now) : 0;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void scheduler_idle(void)
+ * 
+ * Description:
+ *      This routine puts the CPU in IDLE mode (WAIT instruction) if the next
+ *      deadline is further than SCHEDULER_IDLE_MIN_TICKS. The CPU is woken up
+ *      by the next enabled interrupt, so the application must keep at least 
+ *      one periodic interrupt enabled (e.g. TIMER1 with a handler calling 
+ *      timer_get_tick() which clears the overflow flag). Otherwise do not 
+ *      call this function.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      See. scheduler_run()
+ ******************************************************************************/
+void scheduler_idle(void)
+{
+    if (scheduler_get_idle_ticks() >= SCHEDULER_IDLE_MIN_TICKS)
+    {
+        _wait();
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef __DEF_SCHEDULER
+#define __DEF_SCHEDULER
+
+/*
+ * Hierarchical timer wheel: SCHEDULER_LEVELS levels of SCHEDULER_SLOTS slots.
+ * One slot of the first level is (1 << SCHEDULER_RESOLUTION_SHIFT) ticks 
+ * (102.4 us @ TICK_1US = 10). Level n covers 64^(n+1) slots of the first 
+ * level (6.5 ms, 419 ms, 26.8 s, 28.6 min). A task with a longer delay is
+ * parked in the last level and re-inserted when its slot is cascaded.
+ */
+#define SCHEDULER_RESOLUTION_SHIFT      10
+#define SCHEDULER_SLOT_BITS             6
+#define SCHEDULER_SLOTS                 (1 << SCHEDULER_SLOT_BITS)
+#define SCHEDULER_SLOT_MASK             (SCHEDULER_SLOTS - 1)
+#define SCHEDULER_LEVELS                4
+#define SCHEDULER_IDLE_MIN_TICKS        TICK_500US
+
+typedef void (*scheduler_handler_t)(void *p_context);
+
+typedef struct scheduler_task_s
+{
+    scheduler_handler_t         handler;
+    void                        *p_context;
+    uint64_t                    period;         // 0: one shot task (deadline)
+    uint64_t                    expiry;         // Absolute tick of the next execution
+    bool                        is_armed;
+    uint8_t                     level;          // Wheel position (private)
+    uint8_t                     slot;           // Wheel position (private)
+    struct scheduler_task_s     *next;
+    struct scheduler_task_s     *prev;
+} scheduler_task_t;
+
+#define SCHEDULER_TASK_INSTANCE(_handler, _p_context, _period)  \
+{                                                               \
+    .handler = _handler,                                        \
+    .p_context = _p_context,                                    \
+    .period = _period,                                          \
+    .expiry = 0,                                                \
+    .is_armed = false,                                          \
+    .level = 0,                                                 \
+    .slot = 0,                                                  \
+    .next = NULL,                                               \
+    .prev = NULL                                                \
+}
+#define SCHEDULER_TASK_DEF(_name, _handler, _p_context, _period)  \
+static scheduler_task_t _name = SCHEDULER_TASK_INSTANCE(_handler, _p_context, _period)
+
+void        scheduler_task_start(scheduler_task_t *task, uint64_t delay);
+void        scheduler_task_start_at(scheduler_task_t *task, uint64_t deadline);
+void        scheduler_task_stop(scheduler_task_t *task);
+uint32_t    scheduler_run(void);
+uint64_t    scheduler_get_next_expiry(void);
+uint64_t    scheduler_get_idle_ticks(void);
+void        scheduler_idle(void);
+
+#define scheduler_task_is_armed(task)       ((task)->is_armed)
+
+#endif
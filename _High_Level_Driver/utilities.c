@@ -8,6 +8,14 @@
 *               18/09/2015      - Remove function "cycle" and add function TiAdvance.
 *                               - Implementation of multiple string functions.
 *               26/09/2017      - Bug fixe for fUtilitiesLed when tUp or tDown = 0
+*               17/10/2026      - fu_bus_management_task: priority / deadline arbitration 
+*                                 with ready bitmask and per-device statistics.
+*                               - TSV / RGB functions are wrappers of the integer colour 
+*                                 math (color.c).
+*                               - AVERAGE_VAR: uint16_t window with exact integer sums,
+*                                 min / max / variance, decimation and IIR filter.
+*                               - fu_ntc: lookup table with integer interpolation
+*                                 (built once) instead of log() at each sample.
 *********************************************************************/
 
 #include "../PLIB.h"
@@ -430,42 +438,7 @@ void fUtilitiesLedTsv(LED_TSV_CONFIG *config)
   *****************************************************************************/
 TSV_COLOR fUtilitiesRGBtoTSV(RGB_COLOR rgbColor)
 {
-    TSV_COLOR ret;
-    float min, max, delta, tShade;
-    
-    min = (rgbColor.red < rgbColor.green) ? rgbColor.red : rgbColor.green;
-    min = (min < rgbColor.blue) ? min : rgbColor.blue;
-    max = (rgbColor.red > rgbColor.green) ? rgbColor.red : rgbColor.green;
-    max = (max > rgbColor.blue) ? max : rgbColor.blue;
-    delta = max - min;
-    
-    if(max > 0.0)
-    {
-        if(rgbColor.red >= max)
-        {
-            tShade = (100.0 * ((rgbColor.green - rgbColor.blue) / delta));
-        }
-        else if(rgbColor.green >= max)
-        {
-            tShade = (100.0 * (2.0 + ((rgbColor.blue - rgbColor.red) / delta)));
-        }
-        else
-        {
-            tShade = (100.0 * (4.0 + ((rgbColor.red - rgbColor.green) / delta)));
-        }
-        
-        ret.shade = (tShade >= 0.0 ? ((WORD) tShade) : ((WORD) (tShade + 599.0)));
-        ret.saturation = (WORD) ((delta / max) * 100.0);
-        ret.intensity = (BYTE) max;
-    }
-    else
-    {
-        ret.shade = 0;
-        ret.saturation = 100;
-        ret.intensity = 0;
-    }
-    
-    return ret;
+    return color_rgb_to_tsv(rgbColor);
 }
 
 /*******************************************************************************
@@ -483,155 +456,17 @@ TSV_COLOR fUtilitiesRGBtoTSV(RGB_COLOR rgbColor)
   *****************************************************************************/
 RGB_COLOR fUtilitiesTSVtoRGB(TSV_COLOR tsvColor)
 {
-    RGB_COLOR ret;
-    BYTE tempShade = ((tsvColor.shade / 100) % 6);
-    float f = (float) ((float)(tsvColor.shade / 100.0) - (float)tempShade);
-    int l = tsvColor.intensity * (100 - tsvColor.saturation) / 100;
-    int m = tsvColor.intensity * (100 - (f * tsvColor.saturation)) / 100;
-    int n = tsvColor.intensity * (100 - tsvColor.saturation + (f * tsvColor.saturation)) / 100;
-
-    if((tsvColor.shade > 600) || (tsvColor.saturation > 100) || (tsvColor.intensity > 100))
-    {
-        ret.red = 0;
-        ret.green = 0;
-        ret.blue = 0;
-    }
-    else
-    {
-        switch (tempShade)
-        {
-            case 0:
-                ret.red = tsvColor.intensity;
-                ret.green = n;
-                ret.blue = l;
-                break;
-            case 1:
-                ret.red = m;
-                ret.green = tsvColor.intensity;
-                ret.blue = l;
-                break;
-            case 2:
-                ret.red = l;
-                ret.green = tsvColor.intensity;
-                ret.blue = n;
-                break;
-            case 3:
-                ret.red = l;
-                ret.green = m;
-                ret.blue = tsvColor.intensity;
-                break;
-            case 4:
-                ret.red = n;
-                ret.green = l;
-                ret.blue = tsvColor.intensity;
-                break;
-            case 5:
-                ret.red = tsvColor.intensity;
-                ret.green = l;
-                ret.blue = m;
-                break;
-        }
-    }
-    
-    return ret;
+    return color_tsv_to_rgb(tsvColor);
 }
 
 WORD fUtilitiesGetNumberOfStep(TSV_COLOR color1, TSV_COLOR color2)
 {
-    WORD ret = 0;
-    WORD shade_threshold = abs((int) (color1.shade - color2.shade));
-    WORD saturation_threshold = abs((int) (color1.saturation - color2.saturation));
-    WORD intensity_threshold = abs((int) (color1.intensity - color2.intensity));
-    (shade_threshold > 300)?(shade_threshold = (600-saturation_threshold)):0;
-    ret = shade_threshold;
-    (ret < saturation_threshold)?(ret = saturation_threshold):0;
-    (ret < intensity_threshold)?(ret = intensity_threshold):0;
-    return ret;
+    return color_tsv_get_number_of_step(color1, color2);
 }
 
 TSV_COLOR fUtilitiesGetMiddleTsvColor(TSV_COLOR color1, TSV_COLOR color2, WORD indice, WORD thresholdToFrom)
 {
-    TSV_COLOR ret;
-    
-    if((thresholdToFrom != indice) && ((color1.shade != color2.shade) || (color1.saturation != color2.saturation) || (color1.intensity != color2.intensity)))
-    {
-        float temp = 0.0;
-        WORD shade_threshold = 0;
-        BOOL sens = 0;      // --
-        
-        if(color1.shade > color2.shade)
-        {
-            shade_threshold = color1.shade - color2.shade;
-            if(shade_threshold > 300)
-            {
-                shade_threshold = 600 - shade_threshold;
-                sens = 1;   // ++
-            }
-        }
-        else if(color1.shade < color2.shade)
-        {
-            shade_threshold = color2.shade - color1.shade;
-            if(shade_threshold > 300)
-            {
-                shade_threshold = 600 - shade_threshold;
-            }
-            else
-            {
-                sens = 1;
-            }
-        }
-        else
-        {
-            ret.shade = color1.shade;
-        }
-
-        if(color1.shade != color2.shade)
-        {
-            if(sens)
-            {
-                temp = (float) (color1.shade + indice*shade_threshold/thresholdToFrom);    
-                if(temp >= 600.0)
-                {
-                    temp -= 600.0;
-                }
-            }
-            else
-            {
-                temp = (float) (600.0 + color1.shade - indice*shade_threshold/thresholdToFrom);    
-                if(temp >= 600.0)
-                {
-                    temp -= 600.0;
-                }
-            }
-            ret.shade = (WORD) temp;
-        }
-
-        if(color1.saturation >= color2.saturation)
-        {
-            temp = (float) (color1.saturation - indice*(color1.saturation - color2.saturation)/thresholdToFrom);
-        }
-        else
-        {
-            temp = (float) (color1.saturation + indice*(color2.saturation - color1.saturation)/thresholdToFrom);
-        }
-        ret.saturation = (BYTE) temp;
-        
-        if(color1.intensity >= color2.intensity)
-        {
-            temp = (float) (color1.intensity - indice*(color1.intensity - color2.intensity)/thresholdToFrom);
-        }
-        else
-        {
-            temp = (float) (color1.intensity + indice*(color2.intensity - color1.intensity)/thresholdToFrom);
-        }
-        ret.intensity = (BYTE) temp;
-    }
-    else
-    {
-        ret = color2;
-    }
-    
-    return ret;
+    return color_tsv_get_middle(color1, color2, indice, thresholdToFrom);
 }
 
 /*******************************************************************************
@@ -837,17 +672,94 @@ void fUtilitiesSlider(LED_SLIDER_CONFIG *config)
 
 /*******************************************************************************
  * Function: 
- *      void fu_adc_average(AVERAGE_VAR *var)
+ *      static bool fu_average_add_sample(AVERAGE_VAR *var, uint16_t sample)
  * 
  * Description:
- *      This routine is used to get the average of an ADC acquisition.
+ *      This routine adds a sample to the IIR filter (the first sample seeds
+ *      the filter) and to the decimation.
+ *      When the decimation gives a sample, it replaces the oldest sample of
+ *      the window and the sums, min & max are updated (the average is not).
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ *      sample: The new sample.
+ * 
+ * Return:
+ *      true: if the window has been updated.
+ *      false: if the sample is kept by the decimation.
+ ******************************************************************************/
+static bool fu_average_add_sample(AVERAGE_VAR *var, uint16_t sample)
+{
+    AVERAGE_FILTER *p_filter = var->p_filter;
+    uint16_t old;
+    
+    if (p_filter != NULL)
+    {
+        if (p_filter->iir_shift > 0)
+        {
+            if (!p_filter->is_iir_seeded)
+            {
+                p_filter->iir = (int32_t) sample << 8;
+                p_filter->is_iir_seeded = true;
+            }
+            else
+            {
+                p_filter->iir += (((int32_t) sample << 8) - p_filter->iir) >> p_filter->iir_shift;
+            }
+        }
+        
+        if (p_filter->decimation_shift > 0)
+        {
+            p_filter->decimation_sum += sample;
+            if (++p_filter->decimation_count < (1 << p_filter->decimation_shift))
+            {
+                return false;
+            }
+            sample = (uint16_t) (p_filter->decimation_sum >> p_filter->decimation_shift);
+            p_filter->decimation_sum = 0;
+            p_filter->decimation_count = 0;
+        }
+    }
+    
+    old = var->buffer.p[var->index_buffer];
+    var->buffer.p[var->index_buffer] = sample;
+    var->sum_of_buffer += (uint32_t) sample - old;
+    var->sum_of_squares += (uint32_t) sample * sample;
+    var->sum_of_squares -= (uint32_t) old * old;
+    if (var->is_min_max_valid)
+    {
+        if ((old == var->min) || (old == var->max))
+        {
+            var->is_min_max_valid = false;
+        }
+        else
+        {
+            (sample < var->min) ? (var->min = sample) : 0;
+            (sample > var->max) ? (var->max = sample) : 0;
+        }
+    }
+    if (++var->index_buffer >= var->buffer.size)
+    {
+        var->index_buffer = 0;
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool fu_adc_average(AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine is used to get the average of an ADC acquisition. One
+ *      sample is read (adc10_read) every 'period'.
  * 
  * Parameters:
  *      *var: The pointer of AVERAGE_VAR.
  * 
  * Return:
  *      true: if new acquisition and new average calculated.
- *      false: if no new acquisition.
+ *      false: if no new acquisition (or the sample is kept by the decimation,
+ *      or the sampler has not stored a scan yet).
  * 
  * Example:
  *      See. _EXAMPLE_NTC()
@@ -856,27 +768,273 @@ bool fu_adc_average(AVERAGE_VAR *var)
 {    
     if(mTickCompare(var->tick) >= var->period)
     {
-        var->tick = mGetTick();
-        var->sum_of_buffer -= var->buffer.p[var->index_buffer];
-        var->buffer.p[var->index_buffer] = (float) adc10_read(var->adc_module);
-        var->sum_of_buffer += var->buffer.p[var->index_buffer];
-        var->average = var->sum_of_buffer / var->buffer.size;
-        if (++var->index_buffer >= var->buffer.size)
+        uint16_t sample = adc10_read(var->adc_module);
+        
+        if (sample == ADC10_NO_SAMPLE)
         {
-            var->index_buffer = 0;
+            return 0;
         }
-        return 1;
+        var->tick = mGetTick();
+        return (fu_average_add_samples(var, &sample, 1) > 0);
     }
     return 0;
 }
 
+/*******************************************************************************
+ * Function: 
+ *      bool fu_adc_average_batch(AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine is used to get the average of an ADC channel acquired by
+ *      the sampler (adc10_sampler_init): all the samples received since the
+ *      previous call are added ('period' is not used). The channel must be
+ *      read by only one AVERAGE_VAR.
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ * 
+ * Return:
+ *      true: if new average calculated.
+ *      false: if no new sample.
+ * 
+ * Example:
+ *      AVERAGE_FILTER_DEF(avg_1, AN3, 32, 0, 4, 0);    // 16 samples per window sample
+ *      ...
+ *      adc10_sampler_init(AN3, ADC10_VDD_VSS, 10, IRQ_PRIORITY_LEVEL_4);
+ *      ...
+ *      if (fu_adc_average_batch(&avg_1)) ...
+ ******************************************************************************/
+bool fu_adc_average_batch(AVERAGE_VAR *var)
+{
+    uint16_t samples[32];
+    uint16_t number_of_samples;
+    uint16_t ret = 0;
+    
+    while ((number_of_samples = adc10_get_samples(var->adc_module, samples, 32)) > 0)
+    {
+        ret += fu_average_add_samples(var, samples, number_of_samples);
+    }
+    return (ret > 0);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint16_t fu_average_add_samples(AVERAGE_VAR *var, const uint16_t *p_samples, uint16_t number_of_samples)
+ * 
+ * Description:
+ *      This routine adds a batch of samples (ADC buffer) to the AVERAGE_VAR.
+ *      The average is calculated once at the end of the batch.
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ *      *p_samples: The samples.
+ *      number_of_samples: The number of samples.
+ * 
+ * Return:
+ *      The number of samples added to the window (after decimation).
+ ******************************************************************************/
+uint16_t fu_average_add_samples(AVERAGE_VAR *var, const uint16_t *p_samples, uint16_t number_of_samples)
+{
+    uint16_t i;
+    uint16_t ret = 0;
+    
+    for (i = 0 ; i < number_of_samples ; i++)
+    {
+        ret += fu_average_add_sample(var, p_samples[i]);
+    }
+    if (ret > 0)
+    {
+        var->average = (float) var->sum_of_buffer / var->buffer.size;
+    }
+    return ret;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void fu_average_search_min_max(AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine searches the min & max of the window again when one of
+ *      them has left the window.
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void fu_average_search_min_max(AVERAGE_VAR *var)
+{
+    uint16_t i;
+    
+    if (!var->is_min_max_valid)
+    {
+        var->min = var->buffer.p[0];
+        var->max = var->buffer.p[0];
+        for (i = 1 ; i < var->buffer.size ; i++)
+        {
+            (var->buffer.p[i] < var->min) ? (var->min = var->buffer.p[i]) : 0;
+            (var->buffer.p[i] > var->max) ? (var->max = var->buffer.p[i]) : 0;
+        }
+        var->is_min_max_valid = true;
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint16_t fu_average_get_min(AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine returns the minimum sample of the window.
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ * 
+ * Return:
+ *      The minimum.
+ ******************************************************************************/
+uint16_t fu_average_get_min(AVERAGE_VAR *var)
+{
+    fu_average_search_min_max(var);
+    return var->min;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint16_t fu_average_get_max(AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine returns the maximum sample of the window.
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ * 
+ * Return:
+ *      The maximum.
+ ******************************************************************************/
+uint16_t fu_average_get_max(AVERAGE_VAR *var)
+{
+    fu_average_search_min_max(var);
+    return var->max;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      float fu_average_get_variance(const AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine returns the variance of the window (population variance,
+ *      (N.sum(x^2) - sum(x)^2) / N^2 calculated with integers).
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ * 
+ * Return:
+ *      The variance.
+ ******************************************************************************/
+float fu_average_get_variance(const AVERAGE_VAR *var)
+{
+    uint64_t n = var->buffer.size;
+    uint64_t num = n * var->sum_of_squares - (uint64_t) var->sum_of_buffer * var->sum_of_buffer;
+    
+    return (float) num / (float) (n * n);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      float fu_average_get_iir(const AVERAGE_VAR *var)
+ * 
+ * Description:
+ *      This routine returns the output of the IIR filter (iir_shift > 0).
+ * 
+ * Parameters:
+ *      *var: The pointer of AVERAGE_VAR.
+ * 
+ * Return:
+ *      The filtered value (0 without filter).
+ ******************************************************************************/
+float fu_average_get_iir(const AVERAGE_VAR *var)
+{
+    return (var->p_filter == NULL) ? 0.0f : (float) var->p_filter->iir / 256.0f;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void fu_ntc_build_table(NTC_VAR *var)
+ * 
+ * Description:
+ *      This routine builds the table of the NTC: the ADC code (x64) of each
+ *      temperature point (beta equation & divider). It is called once.
+ * 
+ * Parameters:
+ *      *var: The pointer of NTC_VAR.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void fu_ntc_build_table(NTC_VAR *var)
+{
+    uint8_t i;
+    double r, code;
+    
+    for (i = 0 ; i < NTC_TABLE_SIZE ; i++)
+    {
+        r = var->ntc_params.r0 * exp(var->ntc_params.b * ((1.0 / (NTC_TABLE_T_MIN + i * NTC_TABLE_STEP + 273.15)) - (1.0 / (var->ntc_params.t0 + 273.15))));
+        code = 1024.0 * 64.0 * r / (r + var->ntc_params.r_pull) + 0.5;
+        var->table[i] = (code > 65535.0) ? 65535 : (uint16_t) code;
+    }
+    var->is_table_built = true;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      int32_t fu_ntc_code_to_centi(NTC_VAR *var, uint16_t code_x64)
+ * 
+ * Description:
+ *      This routine converts an ADC code into a temperature: binary search
+ *      of the segment in the table then linear interpolation (integers).
+ *      Out of NTC_TABLE_T_MIN..NTC_TABLE_T_MAX the first / last segment is
+ *      extended.
+ * 
+ * Parameters:
+ *      *var: The pointer of NTC_VAR.
+ *      code_x64: The ADC code x 64 (0..65535).
+ * 
+ * Return:
+ *      The temperature in 0.01 C.
+ ******************************************************************************/
+int32_t fu_ntc_code_to_centi(NTC_VAR *var, uint16_t code_x64)
+{
+    uint8_t lo = 0, hi = NTC_TABLE_SIZE - 1, mid;
+    int32_t delta;
+    
+    if (!var->is_table_built)
+    {
+        fu_ntc_build_table(var);
+    }
+    
+    while ((hi - lo) > 1)
+    {
+        mid = (lo + hi) >> 1;
+        (var->table[mid] > code_x64) ? (lo = mid) : (hi = mid);
+    }
+    
+    delta = (int32_t) var->table[lo] - var->table[lo + 1];
+    if (delta <= 0)
+    {
+        return (NTC_TABLE_T_MIN + lo * NTC_TABLE_STEP) * 100;
+    }
+    return (NTC_TABLE_T_MIN + lo * NTC_TABLE_STEP) * 100 + (((int32_t) var->table[lo] - code_x64) * (NTC_TABLE_STEP * 100)) / delta;
+}
+
 /*******************************************************************************
  * Function: 
  *      bool fu_ntc(NTC_VAR *var)
  * 
  * Description:
  *      This routine is used to get the temperature of a NTC over an ADC.
- *      It uses the AVERAGE function for the acquisitions.
+ *      It uses the AVERAGE function for the acquisitions and the table of
+ *      the NTC (cf. fu_ntc_code_to_centi) for the conversion.
  * 
  * Parameters:
  *      *var: The pointer of NTC_VAR.
@@ -893,7 +1051,10 @@ bool fu_ntc(NTC_VAR *var)
     bool ret = fu_adc_average(&var->average);
     if (ret)
     {
-        var->temperature = (float) ((1.0/((1.0/(var->ntc_params.t0+273.15)) + ((1.0/var->ntc_params.b) * log(((float)(10000.0/((1024/(var->average.sum_of_buffer/var->average.buffer.size)) - 1.0)))/var->ntc_params.r0 )))) - 273.15); // C
+        uint32_t code_x64 = (var->average.sum_of_buffer << 6) / var->average.buffer.size;
+        
+        var->temperature_centi = fu_ntc_code_to_centi(var, (code_x64 > 65535) ? 65535 : code_x64);
+        var->temperature = (float) var->temperature_centi / 100.0f;
     }
     return ret;
 }
@@ -904,8 +1065,15 @@ bool fu_ntc(NTC_VAR *var)
  * 
  * Description:
  *      This routine is used to manage a multitude of devices on a same serial
- *      bus (SPI, UART, I2C). It gives hand to the device which have the greater 
- *      "last execution time" compare to its periodic time.
+ *      bus (SPI, UART, I2C). A device is "ready" when its waiting_period is
+ *      elapsed since its last release. Among the ready devices, the bus is
+ *      given to the one with the highest priority and, for a same priority,
+ *      to the one with the earliest deadline (ready time + max_latency).
+ *      Ready devices are kept in a bitmask: the devices are only scanned 
+ *      when the bus is released or when the next known ready time is 
+ *      reached, so a call while a device is running costs O(1).
+ *      The wait time, hold time and missed deadlines of each device are 
+ *      updated in its .stats structure.
  *      This function is mandatory when you are using an external peripheral 
  *      (which use itself a serial BUS).
  * 
@@ -920,32 +1088,150 @@ bool fu_ntc(NTC_VAR *var)
  ******************************************************************************/
 void fu_bus_management_task(BUS_MANAGEMENT_VAR *var)
 {    
+    BUS_MANAGEMENT_PARAMS *p;
+    uint64_t now;
+    uint64_t ready_tick;
+    uint64_t deadline;
+    uint64_t best_deadline = 0;
+    uint32_t candidates;
     uint8_t i, j;
-    uint64_t greater_time = 0, diff_time = 0;
-   
-    for(i = 0, j = 255 ; i < var->number_of_params ; i++)
+    
+    if (var->owner != BUS_MANAGEMENT_NO_OWNER)
     {
-        if(var->params[i]->is_running)
+        p = var->params[var->owner];
+        if (p->is_running)
         {
             return;
         }
-        else 
+        // The device released the bus (its .tick has been set at the release).
+        p->stats.hold_time_last = (p->tick > p->tick_grant) ? (p->tick - p->tick_grant) : 0;
+        p->stats.hold_time_sum += p->stats.hold_time_last;
+        if (p->stats.hold_time_last > p->stats.hold_time_max)
+        {
+            p->stats.hold_time_max = p->stats.hold_time_last;
+        }
+        var->owner = BUS_MANAGEMENT_NO_OWNER;
+        var->tick_next_ready = 0;
+    }
+    
+    now = mGetTick();
+    if (now >= var->tick_next_ready)
+    {
+        var->tick_next_ready = 0xFFFFFFFFFFFFFFFFull;
+        for (i = 0 ; i < var->number_of_params ; i++)
         {
-            diff_time = mTickCompare(var->params[i]->tick);
-            if(diff_time >= var->params[i]->waiting_period)
+            p = var->params[i];
+            if (!GET_BIT(var->ready_mask, i))
             {
-                if ((diff_time - var->params[i]->waiting_period) >= greater_time)
+                if ((now - p->tick) >= p->waiting_period)
+                {
+                    var->ready_mask |= (1ul << i);
+                }
+                else if ((p->tick + p->waiting_period) < var->tick_next_ready)
                 {
-                    j = i;
-                    greater_time = diff_time - var->params[i]->waiting_period;
+                    var->tick_next_ready = p->tick + p->waiting_period;
                 }
             }
         }
     }
-    if (j != 255)
+    
+    if (var->ready_mask == 0)
     {
-        var->params[j]->is_running = true;
+        return;
     }
+    
+    // Highest priority first then earliest deadline first.
+    candidates = var->ready_mask;
+    j = __builtin_ctz(candidates);
+    candidates &= ~(1ul << j);
+    while (candidates)
+    {
+        i = __builtin_ctz(candidates);
+        candidates &= ~(1ul << i);
+        if (var->params[i]->priority < var->params[j]->priority)
+        {
+            continue;
+        }
+        deadline = var->params[i]->tick + var->params[i]->waiting_period + var->params[i]->max_latency;
+        best_deadline = var->params[j]->tick + var->params[j]->waiting_period + var->params[j]->max_latency;
+        if ((var->params[i]->priority > var->params[j]->priority) || (deadline < best_deadline))
+        {
+            j = i;
+        }
+    }
+    
+    p = var->params[j];
+    ready_tick = p->tick + p->waiting_period;
+    if (ready_tick < p->tick)
+    {
+        // Never granted yet (.tick = -1): no wait time to account.
+        ready_tick = now;
+    }
+    var->ready_mask &= ~(1ul << j);
+    var->owner = j;
+    p->tick_grant = now;
+    p->is_running = true;
+    
+    p->stats.number_of_grants++;
+    p->stats.wait_time_last = (now > ready_tick) ? (now - ready_tick) : 0;
+    p->stats.wait_time_sum += p->stats.wait_time_last;
+    if (p->stats.wait_time_last > p->stats.wait_time_max)
+    {
+        p->stats.wait_time_max = p->stats.wait_time_last;
+    }
+    if ((p->max_latency > 0) && (p->stats.wait_time_last > p->max_latency))
+    {
+        p->stats.missed_deadlines++;
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void fu_bus_management_set_priority(BUS_MANAGEMENT_PARAMS *params, BUS_PRIORITY priority, uint64_t max_latency)
+ * 
+ * Description:
+ *      This routine sets the arbitration parameters of a device. The default
+ *      values are BUS_PRIORITY_NORMAL and no latency guarantee.
+ * 
+ * Parameters:
+ *      *params: The pointer of the device BUS_MANAGEMENT_PARAMS.
+ *      priority: The BUS_PRIORITY of the device.
+ *      max_latency: The maximum time (ticks) the device should wait for the 
+ *                  bus once ready (0 for no guarantee). A grant later than
+ *                  that is counted in stats.missed_deadlines.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      fu_bus_management_set_priority(&e_mcp23s17.spi_params.bus_management_params, BUS_PRIORITY_HIGH, TICK_2MS);
+ ******************************************************************************/
+void fu_bus_management_set_priority(BUS_MANAGEMENT_PARAMS *params, BUS_PRIORITY priority, uint64_t max_latency)
+{
+    params->priority = priority;
+    params->max_latency = max_latency;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void fu_bus_management_reset_stats(BUS_MANAGEMENT_PARAMS *params)
+ * 
+ * Description:
+ *      This routine clears the statistics (wait time, hold time, missed 
+ *      deadlines) of a device.
+ * 
+ * Parameters:
+ *      *params: The pointer of the device BUS_MANAGEMENT_PARAMS.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+void fu_bus_management_reset_stats(BUS_MANAGEMENT_PARAMS *params)
+{
+    memset(&params->stats, 0, sizeof(BUS_MANAGEMENT_STATS));
 }
 
 /*******************************************************************************
@@ -146,78 +146,197 @@ typedef struct
 
 // ---------------------------------------------------
 // ******** STRUCTURE FOR THE AVERAGE ROUTINE ********
+// The window (buffer) holds the last samples (after decimation) on 16 bits
+// and all the statistics of the window are exact integers (no float
+// rounding drift).
+// Optional filters (AVERAGE_FILTER, only allocated by AVERAGE_FILTER_DEF):
+// Decimation (CIC, integrate and dump): 2^decimation_shift samples are
+// summed then divided to give one sample of the window (0: disabled).
+// IIR: exponential filter of the samples, iir += (sample - iir) / 2^iir_shift
+// (Q8 fixed point, 0: disabled), seeded with the first sample.
+// Both shifts are lower than AVERAGE_FILTER_SHIFT_MAX (checked at compile
+// time: the decimation counts on 16 bits).
+#define AVERAGE_FILTER_SHIFT_MAX    16
+
+typedef struct
+{
+    uint8_t decimation_shift;
+    uint8_t iir_shift;
+    uint16_t decimation_count;
+    uint32_t decimation_sum;
+    int32_t iir;
+    bool is_iir_seeded;             // false: iir is loaded with the next sample
+} AVERAGE_FILTER;
+
 typedef struct
 {
     uint16_t adc_module;
-    DYNAMIC_TAB_FLOAT buffer;
-    float average;
-    float sum_of_buffer;
+    DYNAMIC_TAB_WORD buffer;
+    float average;                  // sum_of_buffer / buffer.size
+    uint32_t sum_of_buffer;
+    uint64_t sum_of_squares;
     uint16_t index_buffer;
+    uint16_t min;
+    uint16_t max;
+    bool is_min_max_valid;          // false: min / max left the window (searched again when read)
+    AVERAGE_FILTER *p_filter;       // NULL: no decimation and no IIR
     uint64_t period;
     uint64_t tick;
 } AVERAGE_VAR;
 
-#define AVERAGE_INSTANCE(_adc_module, _buffer, _period)         \
+// A shift out of range gives a negative array size (compilation error).
+#define AVERAGE_FILTER_CHECK_SHIFT(_shift)                      \
+    (sizeof(char[((_shift) < AVERAGE_FILTER_SHIFT_MAX) ? 1 : -1]) * 0 + (_shift))
+
+#define AVERAGE_FILTER_PARAMS_INSTANCE(_decimation_shift, _iir_shift)   \
+{                                                               \
+    .decimation_shift = AVERAGE_FILTER_CHECK_SHIFT(_decimation_shift),  \
+    .iir_shift = AVERAGE_FILTER_CHECK_SHIFT(_iir_shift),        \
+    .decimation_count = 0,                                      \
+    .decimation_sum = 0,                                        \
+    .iir = 0,                                                   \
+    .is_iir_seeded = false,                                     \
+}
+#define AVERAGE_FILTER_INSTANCE(_adc_module, _buffer, _period, _p_filter)   \
 {                                                               \
     .adc_module = _adc_module,                                  \
-    .buffer = { _buffer, sizeof(_buffer)/sizeof(float), 0 },    \
+    .buffer = { _buffer, sizeof(_buffer)/sizeof(uint16_t), 0 }, \
     .average = 0.0,                                             \
-    .sum_of_buffer = 0.0,                                       \
+    .sum_of_buffer = 0,                                         \
+    .sum_of_squares = 0,                                        \
     .index_buffer = 0,                                          \
+    .min = 0,                                                   \
+    .max = 0,                                                   \
+    .is_min_max_valid = true,                                   \
+    .p_filter = _p_filter,                                      \
     .period = _period,                                          \
     .tick = 0,                                                  \
 }
+#define AVERAGE_INSTANCE(_adc_module, _buffer, _period)         \
+    AVERAGE_FILTER_INSTANCE(_adc_module, _buffer, _period, NULL)
 #define AVERAGE_DEF(_name, _adc_module, _number_of_acquisition, _period)        \
-static float _name ## _buffer_ram_allocation[_number_of_acquisition] = {0.0};   \
+static uint16_t _name ## _buffer_ram_allocation[_number_of_acquisition] = {0};  \
 static AVERAGE_VAR _name = AVERAGE_INSTANCE(_adc_module, _name ## _buffer_ram_allocation, _period)
+#define AVERAGE_FILTER_DEF(_name, _adc_module, _number_of_acquisition, _period, _decimation_shift, _iir_shift)   \
+static uint16_t _name ## _buffer_ram_allocation[_number_of_acquisition] = {0};  \
+static AVERAGE_FILTER _name ## _filter_ram_allocation = AVERAGE_FILTER_PARAMS_INSTANCE(_decimation_shift, _iir_shift);  \
+static AVERAGE_VAR _name = AVERAGE_FILTER_INSTANCE(_adc_module, _name ## _buffer_ram_allocation, _period, &_name ## _filter_ram_allocation)
 
 // ---------------------------------------------------
 // ********** STRUCTURE FOR THE NTC ROUTINE **********
+// Divider: Vref -- r_pull -- ADC input -- NTC -- GND (ADC 10 bits)
+// The ADC code to temperature conversion is a piecewise-linear table built
+// once (first conversion) with a point every NTC_TABLE_STEP degrees from
+// NTC_TABLE_T_MIN to NTC_TABLE_T_MAX (error < 0.2 C with a 10k / B3380 NTC).
+#ifndef NTC_TABLE_T_MIN
+#define NTC_TABLE_T_MIN             (-40)
+#endif
+#ifndef NTC_TABLE_T_MAX
+#define NTC_TABLE_T_MAX             (200)
+#endif
+#ifndef NTC_TABLE_STEP
+#define NTC_TABLE_STEP              (5)
+#endif
+#define NTC_TABLE_SIZE              (((NTC_TABLE_T_MAX - NTC_TABLE_T_MIN) / NTC_TABLE_STEP) + 1)
+#define NTC_PULL_RESISTOR_DEFAULT   (10000)
+
 typedef struct
 {
     uint8_t     t0;
     uint16_t    r0;
     uint16_t    b;
+    uint32_t    r_pull;
 } NTC_PARAMS;
 
 typedef struct
 {
     AVERAGE_VAR average;
     NTC_PARAMS  ntc_params;
-    float       temperature;
+    float       temperature;            // C
+    int32_t     temperature_centi;      // 0.01 C
+    bool        is_table_built;
+    uint16_t    table[NTC_TABLE_SIZE];  // ADC code (x64) of each temperature point (decreasing)
 } NTC_VAR;
 
 #define NTC_INSTANCE(_adc_module, _buffer, _t0, _r0, _b)            \
 {                                                                   \
     .average = AVERAGE_INSTANCE(_adc_module, _buffer, TICK_10MS),   \
-    .ntc_params = { _t0, _r0, _b },                                 \
+    .ntc_params = { _t0, _r0, _b, NTC_PULL_RESISTOR_DEFAULT },      \
     .temperature = 0.0,                                             \
+    .temperature_centi = 0,                                         \
+    .is_table_built = false,                                        \
 }
 #define NTC_DEF(_name, _adc_module, _t0, _r0, _b)                   \
-static float _name ## _buffer_ram_allocation[20] = {0.0};           \
+static uint16_t _name ## _buffer_ram_allocation[20] = {0};          \
 static NTC_VAR _name = NTC_INSTANCE(_adc_module, _name ## _buffer_ram_allocation, _t0, _r0, _b)
 
 // ---------------------------------------------------
 // ***** STRUCTURE FOR THE DEAMON PARENT ROUTINE *****
+typedef enum
+{
+    BUS_PRIORITY_LOW = 0,
+    BUS_PRIORITY_NORMAL,
+    BUS_PRIORITY_HIGH,
+    BUS_PRIORITY_CRITICAL
+} BUS_PRIORITY;
+
+typedef struct
+{
+    uint32_t                number_of_grants;
+    uint32_t                missed_deadlines;   // Granted later than waiting_period + max_latency
+    uint64_t                wait_time_last;     // Time between "ready" and "granted"
+    uint64_t                wait_time_max;
+    uint64_t                wait_time_sum;
+    uint64_t                hold_time_last;     // Time between "granted" and "released"
+    uint64_t                hold_time_max;
+    uint64_t                hold_time_sum;
+} BUS_MANAGEMENT_STATS;
+
 typedef struct
 {
     bool                    is_running;
     uint64_t                waiting_period;
     uint64_t                tick;
+    BUS_PRIORITY            priority;
+    uint64_t                max_latency;        // 0: no latency guarantee
+    uint64_t                tick_grant;
+    BUS_MANAGEMENT_STATS    stats;
 } BUS_MANAGEMENT_PARAMS;
 
+#define BUS_MANAGEMENT_PARAMS_INSTANCE(_periodic_time)  \
+{                                                       \
+    .is_running = false,                                \
+    .waiting_period = _periodic_time,                   \
+    .tick = -1,                                         \
+    .priority = BUS_PRIORITY_NORMAL,                    \
+    .max_latency = 0,                                   \
+    .tick_grant = 0,                                    \
+    .stats = {0}                                        \
+}
+
+#define BUS_MANAGEMENT_MAX_PARAMS       32      // Size of the uint32_t ready_mask (checked by BUS_MANAGEMENT_DEF)
+#define BUS_MANAGEMENT_NO_OWNER         0xff
+
 typedef struct
 {
-    uint8_t                 number_of_params;
+    uint8_t                 number_of_params;   // BUS_MANAGEMENT_MAX_PARAMS max.
+    uint8_t                 owner;              // Index of the device which has the bus
+    uint32_t                ready_mask;         // Bit n set: params[n] is waiting for the bus
+    uint64_t                tick_next_ready;    // Next time a device becomes ready
     BUS_MANAGEMENT_PARAMS   *params[];
 } BUS_MANAGEMENT_VAR;
 
 #define BUS_MANAGEMENT_INSTANCE(...)                    \
 {                                                       \
     .number_of_params = COUNT_ARGUMENTS(__VA_ARGS__),   \
+    .owner = BUS_MANAGEMENT_NO_OWNER,                   \
+    .ready_mask = 0,                                    \
+    .tick_next_ready = 0,                               \
     .params = { __VA_ARGS__ },                          \
 }
+// Compilation error (negative array size) if more than BUS_MANAGEMENT_MAX_PARAMS devices are given.
 #define BUS_MANAGEMENT_DEF(_name, ...)  \
+typedef char _name##_too_many_params[(COUNT_ARGUMENTS(__VA_ARGS__) <= BUS_MANAGEMENT_MAX_PARAMS) ? 1 : -1] __attribute__((unused)); \
 static BUS_MANAGEMENT_VAR _name = BUS_MANAGEMENT_INSTANCE(__VA_ARGS__)
 
 // ------------------------------------------------------
@@ -242,10 +361,10 @@ typedef struct
     .speed = 0,                                                                 \
 }
 #define ACQUISITIONS_DEF(_name)                                     \
-static float _name ## _buffer_ntc_ram_allocation[20] = {0.0};       \
-static float _name ## _buffer_current_ram_allocation[10] = {0.0};   \
-static float _name ## _buffer_voltage_ram_allocation[10] = {0.0};   \
-static float _name ## _buffer_an15_ram_allocation[1] = {0.0};   \
+static uint16_t _name ## _buffer_ntc_ram_allocation[20] = {0};      \
+static uint16_t _name ## _buffer_current_ram_allocation[10] = {0};  \
+static uint16_t _name ## _buffer_voltage_ram_allocation[10] = {0};  \
+static uint16_t _name ## _buffer_an15_ram_allocation[1] = {0};  \
 static ACQUISITIONS_VAR _name = ACQUISITIONS_INSTANCE(_name ## _buffer_ntc_ram_allocation, _name ## _buffer_current_ram_allocation, _name ## _buffer_voltage_ram_allocation, _name ## _buffer_an15_ram_allocation)
 
 // ----------------------------------------------------
@@ -265,9 +384,18 @@ void        fu_encoder(ENCODER_VAR *config);
 bool        fu_turn_indicator(bool enable, uint32_t time_on, uint32_t time_off);
 
 bool        fu_adc_average(AVERAGE_VAR *var);
+bool        fu_adc_average_batch(AVERAGE_VAR *var);
+uint16_t    fu_average_add_samples(AVERAGE_VAR *var, const uint16_t *p_samples, uint16_t number_of_samples);
+uint16_t    fu_average_get_min(AVERAGE_VAR *var);
+uint16_t    fu_average_get_max(AVERAGE_VAR *var);
+float       fu_average_get_variance(const AVERAGE_VAR *var);
+float       fu_average_get_iir(const AVERAGE_VAR *var);
 bool        fu_ntc(NTC_VAR *var);
+int32_t     fu_ntc_code_to_centi(NTC_VAR *var, uint16_t code_x64);
 
 void        fu_bus_management_task(BUS_MANAGEMENT_VAR *dp);
+void        fu_bus_management_set_priority(BUS_MANAGEMENT_PARAMS *params, BUS_PRIORITY priority, uint64_t max_latency);
+void        fu_bus_management_reset_stats(BUS_MANAGEMENT_PARAMS *params);
 uint16_t    fu_crc_16_ibm(uint8_t *buffer, uint16_t length);
 
 uint32_t    fu_get_integer_value(float v);
@@ -0,0 +1,781 @@
+/*********************************************************************
+*	Host simulation - benchmarks
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Cost by call of the hot functions of the library (measures: bench.h).
+*   The state is prepared in trap mode before each call (end of the
+*   previous transfer, time of the next period, registers read by the call
+*   with a side effect...) and is not measured.
+*
+*   Usage: plib_bench [--quick]
+*********************************************************************/
+
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "bench_eth.h"
+#include "../tests/sim_reference.h"
+
+WS2812B_DEF(bench_leds_60, SPI1, __PA0, 60, 20, 40, 60);
+WS2812B_DEF(bench_leds_300, SPI1, __PA0, 300, 100, 200, 300);
+WS2812B_DEF(bench_leds_1000, SPI1, __PA0, 1000, 300, 600, 1000);
+CAN_FRAMES_DEF(bench_can_frames, 64);
+
+#define BENCH_MAX_TASKS     1000
+static scheduler_task_t bench_tasks[BENCH_MAX_TASKS];
+static uint64_t bench_polled_ticks[BENCH_MAX_TASKS];
+static uint32_t bench_number_of_tasks = 0;
+static uint32_t bench_executed_tasks = 0;
+
+/*******************************************************************************
+ * eWS2812BFlush: rendering of a frame in the back buffer (effects + encoding
+ * of the modified LEDs) while the previous one is sent, for 60, 300 and
+ * 1000 LEDs (3 segments):
+ * - animated: an effect on all the LEDs (all the LEDs encoded each frame),
+ * - static: no modification (nothing to evaluate or encode).
+ * The frame rate is the one reached with periodRefresh = 0 (SPI at 2.4 MHz).
+ ******************************************************************************/
+static WS2812B_PARAMS *bench_p_leds;
+
+static void bench_ws2812b_call(void)
+{
+    eWS2812BFlush(0, bench_p_leds);
+}
+
+static void bench_ws2812b_frames(uint32_t iterations, const char *scenario)
+{
+    BENCH_STATS stats = {0};
+    char text[64];
+    uint64_t start;
+    uint32_t i, frames = 0;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        // End of the previous frame then start of the next one (swap): the
+        // measured call renders the following frame in the back buffer.
+        while (eWS2812BFlush(0, bench_p_leds))
+        {
+            sim_advance(SIM_US(100));
+        }
+        eWS2812BFlush(0, bench_p_leds);
+        bench_call(&stats, (i & 1), bench_ws2812b_call);
+    }
+    
+    start = sim_now();
+    while (frames < 10)
+    {
+        if (!eWS2812BFlush(0, bench_p_leds))
+        {
+            frames++;
+        }
+        sim_advance(SIM_US(20));
+    }
+    snprintf(text, sizeof(text), "%u LEDs, %s, %.0f frames/s", (unsigned) eWS2812BGetNumberOfTotalLed((*bench_p_leds)), scenario, 10.0 * SIM_CLOCK_FREQ / (sim_now() - start));
+    bench_report("eWS2812BFlush", text, &stats);
+}
+
+static void bench_ws2812b(WS2812B_PARAMS *p_leds, uint32_t iterations)
+{
+    sim_test_init(SIM_MODE_TRAP);
+    SPIInit(SPI1, 2400000, SPI_CONF_MSTEN | SPI_CONF_SMP_MIDDLE | SPI_CONF_CKE_ON | SPI_CONF_MODE8 | SPI_CONF_ON);
+    spi_queue_init(SPI1, IRQ_PRIORITY_DISABLED);
+    bench_p_leds = p_leds;
+    
+    eWS2812BPutSegment(0, FIRST_LED, LAST_LED, LED_ALL, COLOR_BLUE, COLOR_BLUE, WS2812B_EFFECT_TRIANGLE, WS2812B_REPETITION_INFINITE, TICK_100MS, p_leds);
+    eWS2812BPutSegment(1, FIRST_LED, LAST_LED, LED_1_2, COLOR_RED, COLOR_GREEN, WS2812B_EFFECT_GAUSSIAN, WS2812B_REPETITION_INFINITE, TICK_100MS, p_leds);
+    eWS2812BPutSegment(2, FIRST_LED, LAST_LED, LED_ALL, COLOR_WHITE, COLOR_WHITE, WS2812B_EFFECT_SAWTOOTH, WS2812B_REPETITION_INFINITE, TICK_100MS, p_leds);
+    bench_ws2812b_frames(iterations, "animated");
+    
+    eWS2812BPutSegment(0, FIRST_LED, LAST_LED, LED_ALL, COLOR_BLUE, COLOR_BLUE, WS2812B_EFFECT_NONE, 0, TICK_0, p_leds);
+    eWS2812BPutSegment(1, FIRST_LED, LAST_LED, LED_ALL, COLOR_RED, COLOR_GREEN, WS2812B_EFFECT_NONE, 0, TICK_0, p_leds);
+    eWS2812BPutSegment(2, FIRST_LED, LAST_LED, LED_ALL, COLOR_WHITE, COLOR_WHITE, WS2812B_EFFECT_NONE, 0, TICK_0, p_leds);
+    bench_ws2812b_frames(iterations, "static");
+}
+
+/*******************************************************************************
+ * eWS2812BEncodeArray: encoding of 1000 LEDs (levels) compared to the
+ * encoder of the release 1.20 (percents scaled by '*= 2.55' then masks and
+ * shifts). The throughput is given in LEDs by second of the host (the
+ * host has a FPU: the cost of '*= 2.55' on the PIC32MX is not visible).
+ ******************************************************************************/
+#define BENCH_ENCODER_LEDS  1000
+static RGB_COLOR bench_encoder_colors[BENCH_ENCODER_LEDS];
+static uint8_t bench_encoder_buffer[BENCH_ENCODER_LEDS * WS2812B_BYTES_PER_LED];
+
+static void bench_encoder_call(void)
+{
+    eWS2812BEncodeArray(bench_encoder_buffer, bench_encoder_colors, BENCH_ENCODER_LEDS, 255);
+}
+
+static void bench_encoder_reference_call(void)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < BENCH_ENCODER_LEDS ; i++)
+    {
+        reference_ws2812b_encode_percent(&bench_encoder_buffer[i * WS2812B_BYTES_PER_LED], bench_encoder_colors[i]);
+    }
+}
+
+static void bench_encoder_run(const char *name, void (*call)(void), uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    struct timespec start, end;
+    char text[64];
+    double seconds;
+    uint32_t i;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        bench_call(&stats, true, call);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0 ; i < iterations ; i++)
+    {
+        (*call)();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    snprintf(text, sizeof(text), "%u LEDs, %.1f M LEDs/s", BENCH_ENCODER_LEDS, (double) BENCH_ENCODER_LEDS * iterations / seconds / 1e6);
+    bench_report(name, text, &stats);
+}
+
+static void bench_encoder(uint32_t iterations)
+{
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    for (i = 0 ; i < BENCH_ENCODER_LEDS ; i++)
+    {
+        bench_encoder_colors[i] = (RGB_COLOR) {.red = i % 101, .green = (i * 7) % 101, .blue = (i * 13) % 101};
+    }
+    bench_encoder_run("encoder", bench_encoder_call, iterations);
+    bench_encoder_run("encoder (1.20)", bench_encoder_reference_call, iterations);
+}
+
+/*******************************************************************************
+ * color.c: TSV -> RGB, RGB -> TSV and step of a transition on 1000 colours,
+ * compared to the float code of utilities.c. The cost is given by
+ * conversion (host cycles). The host has a FPU: on the PIC32MX each float
+ * operation of the reference is a call to the soft float library. The
+ * references are called out of line like the functions of the library.
+ ******************************************************************************/
+#define BENCH_COLORS        1000
+static TSV_COLOR bench_tsv_colors[BENCH_COLORS];
+static RGB_COLOR bench_rgb_colors[BENCH_COLORS];
+static volatile uint32_t bench_color_sink;
+
+static __attribute__((noinline)) RGB_COLOR bench_reference_tsv_to_rgb(TSV_COLOR tsv)
+{
+    return reference_tsv_to_rgb(tsv);
+}
+
+static __attribute__((noinline)) TSV_COLOR bench_reference_rgb_to_tsv(RGB_COLOR rgb)
+{
+    return reference_rgb_to_tsv(rgb);
+}
+
+static __attribute__((noinline)) TSV_COLOR bench_reference_get_middle(TSV_COLOR color1, TSV_COLOR color2, uint16_t indice, uint16_t number_of_step)
+{
+    return reference_get_middle(color1, color2, indice, number_of_step);
+}
+
+static void bench_tsv_to_rgb_call(void)
+{
+    uint32_t i, sum = 0;
+
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        sum += color_tsv_to_rgb(bench_tsv_colors[i]).green;
+    }
+    bench_color_sink = sum;
+}
+
+static void bench_tsv_to_rgb_reference_call(void)
+{
+    uint32_t i, sum = 0;
+
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        sum += bench_reference_tsv_to_rgb(bench_tsv_colors[i]).green;
+    }
+    bench_color_sink = sum;
+}
+
+static void bench_rgb_to_tsv_call(void)
+{
+    uint32_t i, sum = 0;
+
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        sum += color_rgb_to_tsv(bench_rgb_colors[i]).shade;
+    }
+    bench_color_sink = sum;
+}
+
+static void bench_rgb_to_tsv_reference_call(void)
+{
+    uint32_t i, sum = 0;
+
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        sum += bench_reference_rgb_to_tsv(bench_rgb_colors[i]).shade;
+    }
+    bench_color_sink = sum;
+}
+
+static void bench_middle_call(void)
+{
+    uint32_t i, sum = 0;
+
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        sum += color_tsv_get_middle(bench_tsv_colors[i], bench_tsv_colors[BENCH_COLORS - 1 - i], i % 100, 100).shade;
+    }
+    bench_color_sink = sum;
+}
+
+static void bench_middle_reference_call(void)
+{
+    uint32_t i, sum = 0;
+
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        sum += bench_reference_get_middle(bench_tsv_colors[i], bench_tsv_colors[BENCH_COLORS - 1 - i], i % 100, 100).shade;
+    }
+    bench_color_sink = sum;
+}
+
+static void bench_color_run(const char *name, void (*call)(void), uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    char text[64];
+    uint32_t i;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        bench_call(&stats, true, call);
+    }
+    snprintf(text, sizeof(text), "%u colours, %.1f host cyc / conversion", BENCH_COLORS, (double) stats.host_cycles / stats.flat_calls / BENCH_COLORS);
+    bench_report(name, text, &stats);
+}
+
+static void bench_color(uint32_t iterations)
+{
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    for (i = 0 ; i < BENCH_COLORS ; i++)
+    {
+        bench_tsv_colors[i] = (TSV_COLOR) {.shade = (i * 37) % 601, .saturation = (i * 7) % 101, .intensity = (i * 13) % 101};
+        bench_rgb_colors[i] = (RGB_COLOR) {.red = i % 101, .green = (i * 7) % 101, .blue = (i * 13) % 101};
+    }
+    bench_color_run("tsv_to_rgb", bench_tsv_to_rgb_call, iterations);
+    bench_color_run("tsv_to_rgb (fl)", bench_tsv_to_rgb_reference_call, iterations);
+    bench_color_run("rgb_to_tsv", bench_rgb_to_tsv_call, iterations);
+    bench_color_run("rgb_to_tsv (fl)", bench_rgb_to_tsv_reference_call, iterations);
+    bench_color_run("tsv_get_middle", bench_middle_call, iterations);
+    bench_color_run("get_middle (fl)", bench_middle_reference_call, iterations);
+}
+
+/*******************************************************************************
+ * scheduler_run: 10 / 100 / 1000 daemons (periods 1..100 ms), main loop
+ * every 100 us, compared to the polling of each daemon with mTickCompare.
+ ******************************************************************************/
+static uint64_t bench_task_period(uint32_t i)
+{
+    return TICK_1MS * (1 + ((i * 37) % 100));
+}
+
+static void bench_task(void *p_context)
+{
+    bench_executed_tasks++;
+}
+
+static void bench_scheduler_call(void)
+{
+    scheduler_run();
+}
+
+static void bench_polling_call(void)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < bench_number_of_tasks ; i++)
+    {
+        if (mTickCompare(bench_polled_ticks[i]) >= bench_task_period(i))
+        {
+            bench_polled_ticks[i] = mGetTick();
+            bench_task(NULL);
+        }
+    }
+}
+
+static void bench_scheduler(uint32_t number_of_tasks, uint32_t iterations)
+{
+    BENCH_STATS wheel = {0}, polling = {0};
+    char scenario[64];
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    bench_number_of_tasks = number_of_tasks;
+    for (i = 0 ; i < number_of_tasks ; i++)
+    {
+        bench_tasks[i] = (scheduler_task_t) SCHEDULER_TASK_INSTANCE(bench_task, NULL, bench_task_period(i));
+        scheduler_task_start(&bench_tasks[i], bench_task_period(i));
+        bench_polled_ticks[i] = mGetTick();
+    }
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        sim_advance(SIM_US(100));
+        // A trap costs some us on the host: 20 calls are enough in trap mode.
+        bench_call(&wheel, (i & 1) || (i >= 40), bench_scheduler_call);
+        bench_call(&polling, (i & 1) || (i >= 40), bench_polling_call);
+    }
+    for (i = 0 ; i < number_of_tasks ; i++)
+    {
+        scheduler_task_stop(&bench_tasks[i]);
+    }
+
+    snprintf(scenario, sizeof(scenario), "%u tasks, timer wheel", number_of_tasks);
+    bench_report("scheduler_run", scenario, &wheel);
+    snprintf(scenario, sizeof(scenario), "%u tasks, mTickCompare polling", number_of_tasks);
+    bench_report("polling", scenario, &polling);
+}
+
+/*******************************************************************************
+ * CANTaskTx: 64 periodic frames (1..10 ms), called every millisecond.
+ ******************************************************************************/
+static void bench_can_call(void)
+{
+    CANTaskTx(CAN1, &bench_can_frames);
+}
+
+static void bench_can(uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    CANInit(CAN1, 1000000);
+    for (i = 0 ; i < 64 ; i++)
+    {
+        CANAddFrame(&bench_can_frames, 0x100 + i, CAN_ID_STANDARD, 8, TICK_1MS * (1 + (i % 10)));
+    }
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        bench_call(&stats, (i & 1), bench_can_call);
+    }
+    bench_report("CANTaskTx", "64 frames, 1..10 ms periods", &stats);
+}
+
+/*******************************************************************************
+ * TCPTick: all the sockets listening.
+ ******************************************************************************/
+static void bench_tcp_call(void)
+{
+    TCPTick();
+}
+
+static void bench_tcp(uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    ETH_StackInit((BYTE *) "", (BYTE *) "", FALSE);
+    for (i = 0 ; i < MAX_TCP_SOCKETS ; i++)
+    {
+        TCPOpen(0, TCP_OPEN_SERVER, 8000 + i);
+    }
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        bench_call(&stats, (i & 1), bench_tcp_call);
+    }
+    bench_report("TCPTick", "MAX_TCP_SOCKETS servers listening", &stats);
+}
+
+/*******************************************************************************
+ * TCP throughput: bulk transfer from a server socket (TX FIFO of 200 / 536 /
+ * 1600 bytes) to a remote node that acknowledges each segment one round
+ * trip (1 ms) later with a 65535 bytes window. The application fills the
+ * FIFO and calls TCPFlush every 100 us, the stack task runs after it.
+ ******************************************************************************/
+#define BENCH_TCP_PORT          9000
+#define BENCH_TCP_RTT           SIM_MS(1)
+#define BENCH_TCP_MAX_IN_FLIGHT 64
+
+static TCP_SOCKET bench_tcp_socket;
+
+static void bench_tcp_flush_call(void)
+{
+    TCPFlush(bench_tcp_socket);
+}
+
+// Next TCP segment sent: its sequence number, data length and flags (FALSE:
+// no more segment).
+static BOOL bench_tcp_get_segment(DWORD *p_seq, WORD *p_length, BYTE *p_flags)
+{
+    uint8_t frame[1536];
+
+    while (sim_eth_get_tx(frame, sizeof(frame)) > 0)
+    {
+        if ((frame[12] == 0x08) && (frame[13] == 0x00) && (frame[23] == IP_PROTOCOLE_TCP))
+        {
+            *p_seq = ((DWORD) frame[38] << 24) | (frame[39] << 16) | (frame[40] << 8) | frame[41];
+            *p_length = ((frame[16] << 8) | frame[17]) - 20 - ((frame[46] >> 4) * 4);
+            *p_flags = frame[47];
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void bench_tcp_throughput(WORD wTxSize, uint32_t duration_ms)
+{
+    static BYTE data[1600];
+    BENCH_STATS stats = {0};
+    struct
+    {
+        uint64_t    time;
+        DWORD       ack;
+    } in_flight[BENCH_TCP_MAX_IN_FLIGHT];
+    uint32_t head = 0, count = 0;
+    DWORD seq = 0, first_seq, acked = 0;
+    WORD length;
+    BYTE flags = 0;
+    uint64_t start;
+    char text[64];
+
+    sim_test_init(SIM_MODE_TRAP);
+    bench_eth_init();
+    bench_tcp_socket = TCPOpenEx(0, TCP_OPEN_SERVER, BENCH_TCP_PORT, wTxSize, 100);
+
+    // Handshake (remote ISN: 1000)
+    bench_eth_build_tcp(BENCH_TCP_PORT, 1000, 0, SYN, 0xFFFF);
+    sim_eth_inject(bench_eth_frame, bench_eth_frame_size);
+    ETH_StackTask();
+    sim_advance(SIM_US(100));
+    while (bench_tcp_get_segment(&seq, &length, &flags) && (flags != (SYN | ACK)));
+    first_seq = seq + 1;
+    bench_eth_build_tcp(BENCH_TCP_PORT, 1001, first_seq, ACK, 0xFFFF);
+    sim_eth_inject(bench_eth_frame, bench_eth_frame_size);
+    ETH_StackTask();
+    SIM_CHECK(TCPIsConnected(bench_tcp_socket));
+
+    start = sim_now();
+    while (sim_now() - start < SIM_MS(duration_ms))
+    {
+        TCPPutArray(bench_tcp_socket, data, TCPIsPutReady(bench_tcp_socket));
+        bench_call(&stats, true, bench_tcp_flush_call);
+        ETH_StackTask();
+        sim_advance(SIM_US(100));
+
+        while (bench_tcp_get_segment(&seq, &length, &flags))
+        {
+            if ((length > 0) && (count < BENCH_TCP_MAX_IN_FLIGHT))
+            {
+                in_flight[(head + count) % BENCH_TCP_MAX_IN_FLIGHT].time = sim_now() + BENCH_TCP_RTT;
+                in_flight[(head + count) % BENCH_TCP_MAX_IN_FLIGHT].ack = seq + length;
+                count++;
+            }
+        }
+        while ((count > 0) && (in_flight[head].time <= sim_now()))
+        {
+            if (in_flight[head].ack - first_seq > acked)
+            {
+                acked = in_flight[head].ack - first_seq;
+            }
+            bench_eth_build_tcp(BENCH_TCP_PORT, 1001, in_flight[head].ack, ACK, 0xFFFF);
+            sim_eth_inject(bench_eth_frame, bench_eth_frame_size);
+            head = (head + 1) % BENCH_TCP_MAX_IN_FLIGHT;
+            count--;
+        }
+    }
+    TCPClose(bench_tcp_socket);
+
+    snprintf(text, sizeof(text), "TX FIFO %u bytes, RTT 1 ms: %.0f kB/s", (unsigned) wTxSize, (double) acked * SIM_CLOCK_FREQ / (sim_now() - start) / 1000.0);
+    bench_report("TCPFlush", text, &stats);
+}
+
+/*******************************************************************************
+ * AVERAGE_VAR: cost by sample of a batch of 64 samples (window of 32) without
+ * filter, with the decimation (x4) and the IIR, and of the former float
+ * window (one sample and one average by call).
+ ******************************************************************************/
+#define BENCH_AVERAGE_BATCH     64
+AVERAGE_DEF(bench_average_window, AN3, 32, 0);
+AVERAGE_FILTER_DEF(bench_average_filters, AN3, 32, 0, 2, 4);
+static float bench_average_reference_buffer[32];
+static REFERENCE_AVERAGE_VAR bench_average_reference = {bench_average_reference_buffer, 32, 0, 0.0f, 0.0f};
+static uint16_t bench_average_samples[BENCH_AVERAGE_BATCH];
+
+static void bench_average_call(void)
+{
+    fu_average_add_samples(&bench_average_window, bench_average_samples, BENCH_AVERAGE_BATCH);
+}
+
+static void bench_average_filters_call(void)
+{
+    fu_average_add_samples(&bench_average_filters, bench_average_samples, BENCH_AVERAGE_BATCH);
+}
+
+static void bench_average_reference_call(void)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < BENCH_AVERAGE_BATCH ; i++)
+    {
+        reference_average_add(&bench_average_reference, bench_average_samples[i]);
+    }
+}
+
+static void bench_average_run(const char *name, const char *scenario, void (*call)(void), uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    char text[64];
+    uint32_t i;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        bench_call(&stats, true, call);
+    }
+    snprintf(text, sizeof(text), "%u samples, %s: %.1f host cyc / sample", BENCH_AVERAGE_BATCH, scenario, (double) stats.host_cycles / stats.flat_calls / BENCH_AVERAGE_BATCH);
+    bench_report(name, text, &stats);
+}
+
+static void bench_average(uint32_t iterations)
+{
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    for (i = 0 ; i < BENCH_AVERAGE_BATCH ; i++)
+    {
+        bench_average_samples[i] = (i * 37) & 0x3ff;
+    }
+    bench_average_run("average_add", "window", bench_average_call, iterations);
+    bench_average_run("average_add", "decimation + IIR", bench_average_filters_call, iterations);
+    bench_average_run("average (fl)", "window", bench_average_reference_call, iterations);
+}
+
+/*******************************************************************************
+ * CalcIPChecksum: a TCP segment of 1460 bytes (MSS), aligned and at an odd
+ * address, compared to the former 16-bit loop (WORD aligned only), and the
+ * sum while copying (SendTCP) compared to a copy then a sum. The throughput
+ * is given in bytes by host cycle.
+ ******************************************************************************/
+#define BENCH_CHECKSUM_SIZE     1460
+static BYTE bench_checksum_data[BENCH_CHECKSUM_SIZE + 4] __attribute__((aligned(4)));
+static BYTE bench_checksum_copy[BENCH_CHECKSUM_SIZE + 4] __attribute__((aligned(4)));
+static volatile WORD bench_checksum_sink;
+
+static void bench_checksum_call(void)
+{
+    bench_checksum_sink = CalcIPChecksum(bench_checksum_data, BENCH_CHECKSUM_SIZE);
+}
+
+static void bench_checksum_odd_call(void)
+{
+    bench_checksum_sink = CalcIPChecksum(&bench_checksum_data[1], BENCH_CHECKSUM_SIZE);
+}
+
+static void bench_checksum_reference_call(void)
+{
+    bench_checksum_sink = reference_calc_ip_checksum(bench_checksum_data, BENCH_CHECKSUM_SIZE);
+}
+
+static void bench_checksum_copy_call(void)
+{
+    bench_checksum_sink = CalcIPChecksumCopy(0, bench_checksum_copy, bench_checksum_data, BENCH_CHECKSUM_SIZE);
+}
+
+static void bench_checksum_copy_reference_call(void)
+{
+    memcpy(bench_checksum_copy, bench_checksum_data, BENCH_CHECKSUM_SIZE);
+    bench_checksum_sink = reference_calc_ip_checksum(bench_checksum_copy, BENCH_CHECKSUM_SIZE);
+}
+
+static void bench_checksum_run(const char *name, const char *scenario, void (*call)(void), uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    char text[64];
+    uint32_t i;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        bench_call(&stats, true, call);
+    }
+    snprintf(text, sizeof(text), "%u bytes, %s: %.2f bytes/cycle", BENCH_CHECKSUM_SIZE, scenario, (double) BENCH_CHECKSUM_SIZE * stats.flat_calls / stats.host_cycles);
+    bench_report(name, text, &stats);
+}
+
+static void bench_checksum(uint32_t iterations)
+{
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    for (i = 0 ; i < sizeof(bench_checksum_data) ; i++)
+    {
+        bench_checksum_data[i] = i * 7;
+    }
+    bench_checksum_run("CalcIPChecksum", "aligned", bench_checksum_call, iterations);
+    bench_checksum_run("CalcIPChecksum", "odd address", bench_checksum_odd_call, iterations);
+    bench_checksum_run("checksum (old)", "aligned", bench_checksum_reference_call, iterations);
+    bench_checksum_run("ChecksumCopy", "aligned", bench_checksum_copy_call, iterations);
+    bench_checksum_run("copy+sum (old)", "aligned", bench_checksum_copy_reference_call, iterations);
+}
+
+/*******************************************************************************
+ * Logger (UART1 at 1 Mbit/s):
+ * - log_frontend: cost of a LOG() call with 0, 3 and LOG_MAX_ARGS arguments
+ *   (ring emptied between the calls) and when the ring is full (dropped),
+ * - log_deamon: formatting of a message and start of the DMA (text), or
+ *   encoding of the ready messages (binary),
+ * - former LOG(): wait for the end of the previous message then format and
+ *   send (log_wait_end_of_transmission + LOG() + log_deamon), only in trap
+ *   mode (the time is frozen in flat mode). The calls of the DMA peripheral
+ *   library are not counted as SFR accesses, the polling of its flag is.
+ ******************************************************************************/
+static uint32_t bench_log_counter = 0;
+
+static void bench_log_0_call(void)
+{
+    LOG_SHORT("bench");
+}
+
+static void bench_log_3_call(void)
+{
+    bench_log_counter++;
+    LOG("bench %d %x %d", bench_log_counter, bench_log_counter, bench_log_counter * 3);
+}
+
+static void bench_log_8_call(void)
+{
+    bench_log_counter++;
+    LOG("bench %d %d %d %d %d %d %d %d", bench_log_counter, 1, 2, 3, 4, 5, 6, 7);
+}
+
+static void bench_log_deamon_call(void)
+{
+    log_deamon();
+}
+
+static void bench_log_synchronous_call(void)
+{
+    log_wait_end_of_transmission();
+    bench_log_3_call();
+    log_deamon();
+}
+
+// Sending of the 'messages' waiting in the ring (less than 1 ms each).
+static void bench_log_drain(uint32_t messages)
+{
+    uint32_t i;
+
+    for (i = 0 ; i <= messages ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        log_deamon();
+    }
+    sim_advance(SIM_MS(1));
+}
+
+static void bench_log_run(const char *scenario, void (*call)(void), uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    uint32_t i;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        bench_call(&stats, (i & 1), call);
+        bench_log_drain(1);
+    }
+    bench_report("log_frontend", scenario, &stats);
+}
+
+static void bench_log_deamon(LOG_MODE_t mode, uint32_t messages, const char *scenario, uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    uint32_t i, j;
+
+    log_set_mode(mode);
+    for (i = 0 ; i < iterations ; i++)
+    {
+        for (j = 0 ; j < messages ; j++)
+        {
+            bench_log_3_call();
+        }
+        bench_call(&stats, (i & 1), bench_log_deamon_call);
+        bench_log_drain(messages);
+    }
+    log_set_mode(LOG_MODE_TEXT);
+    bench_report("log_deamon", scenario, &stats);
+}
+
+static void bench_log(uint32_t iterations)
+{
+    BENCH_STATS stats = {0};
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    log_init(UART1, 1000000);
+
+    bench_log_run("LOG_SHORT() without argument", bench_log_0_call, iterations);
+    bench_log_run("LOG() with 3 arguments", bench_log_3_call, iterations);
+    bench_log_run("LOG() with 8 arguments", bench_log_8_call, iterations);
+
+    for (i = 0 ; i < LOG_RING_SIZE ; i++)
+    {
+        bench_log_3_call();
+    }
+    for (i = 0 ; i < iterations ; i++)
+    {
+        bench_call(&stats, (i & 1), bench_log_3_call);
+    }
+    bench_report("log_frontend", "LOG() with 3 arguments, ring full", &stats);
+    bench_log_drain(LOG_RING_SIZE + 1);     // With the 'log(s) lost' message
+
+    bench_log_deamon(LOG_MODE_TEXT, 1, "text, 1 message formatted", iterations);
+    bench_log_deamon(LOG_MODE_BINARY, 8, "binary, 8 messages encoded", iterations);
+
+    // Few calls: the wait polls the DMA flag (an SFR access by loop)
+    memset(&stats, 0, sizeof(stats));
+    for (i = 0 ; i < 10 ; i++)
+    {
+        bench_call(&stats, false, bench_log_synchronous_call);
+    }
+    bench_log_drain(0);
+    bench_report("former LOG()", "wait + LOG() with 3 arguments + send", &stats);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iterations = ((argc > 1) && (strcmp(argv[1], "--quick") == 0)) ? 100 : 2000;
+
+    bench_header();
+    bench_ws2812b(&bench_leds_60, iterations);
+    bench_ws2812b(&bench_leds_300, iterations);
+    bench_ws2812b(&bench_leds_1000, iterations);
+    bench_encoder(iterations);
+    bench_color(iterations);
+    bench_scheduler(10, iterations * 5);
+    bench_scheduler(100, iterations * 5);
+    bench_scheduler(1000, iterations * 5);
+    bench_can(iterations);
+    bench_tcp(iterations);
+    bench_tcp_throughput(200, iterations / 2);
+    bench_tcp_throughput(536, iterations / 2);
+    bench_tcp_throughput(1600, iterations / 2);
+    bench_average(iterations);
+    bench_checksum(iterations);
+    bench_log(iterations);
+    return 0;
+}
@@ -0,0 +1,69 @@
+/*********************************************************************
+*	Host simulation - benchmark measures
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Shared by the benchmark executables (bench.c, bench_demux.c). The
+*   calls are alternately done:
+*   - in flat mode: host cycles (rdtsc) of the algorithm alone,
+*   - in trap mode: number of SFR accesses and simulated time (SYSCLK
+*     cycles spent on the accesses and the waits of the peripherals).
+*********************************************************************/
+
+#ifndef __HOST_SIM_BENCH_H
+#define __HOST_SIM_BENCH_H
+
+#include "../tests/sim_test.h"
+
+typedef struct
+{
+    uint64_t    host_cycles;
+    uint64_t    sim_cycles;
+    uint64_t    accesses;
+    uint32_t    flat_calls;
+    uint32_t    trap_calls;
+} BENCH_STATS;
+
+static void bench_call(BENCH_STATS *p_stats, bool is_flat, void (*call)(void))
+{
+    uint64_t start, accesses;
+
+    if (is_flat)
+    {
+        timer_get_tick();       // No pending TMR1 overflow: the time is frozen in flat mode
+        sim_set_mode(SIM_MODE_FLAT);
+        start = sim_test_rdtsc();
+        (*call)();
+        p_stats->host_cycles += sim_test_rdtsc() - start;
+        sim_set_mode(SIM_MODE_TRAP);
+        p_stats->flat_calls++;
+    }
+    else
+    {
+        start = sim_now();
+        accesses = sim_get_access_count();
+        (*call)();
+        p_stats->sim_cycles += sim_now() - start;
+        p_stats->accesses += sim_get_access_count() - accesses;
+        p_stats->trap_calls++;
+    }
+}
+
+static void bench_report(const char *name, const char *scenario, const BENCH_STATS *p_stats)
+{
+    printf("%-16s %12.1f %12.1f %12.1f   %s\n",
+            name,
+            (double) p_stats->host_cycles / (p_stats->flat_calls ? p_stats->flat_calls : 1),
+            (double) p_stats->accesses / (p_stats->trap_calls ? p_stats->trap_calls : 1),
+            (double) p_stats->sim_cycles / (p_stats->trap_calls ? p_stats->trap_calls : 1),
+            scenario);
+}
+
+static void bench_header(void)
+{
+    printf("%-16s %12s %12s %12s\n", "function", "host cyc", "SFR acc", "sim cyc");
+}
+
+#endif
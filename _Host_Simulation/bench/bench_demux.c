@@ -0,0 +1,101 @@
+/*********************************************************************
+*	Host simulation - benchmark of the TCP / UDP demultiplexing
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Built once by number of sockets (MAX_TCP_SOCKETS = MAX_UDP_SOCKETS =
+*   3 / 32 / 128, cf. CMakeLists.txt). All the sockets are opened as
+*   servers and a frame for the last one is injected before each call of
+*   ETH_StackTask:
+*   - UDP: datagram for the last opened port,
+*   - TCP: RST for the last listening port (ignored once demultiplexed).
+*   The cost of a frame is the one of ETH_StackTask with the frame minus
+*   the one of ETH_StackTask without frame (periodic tasks).
+*
+*   Usage: bench_demux_<sockets> [--quick]
+*********************************************************************/
+
+#include <string.h>
+#include "bench.h"
+#include "bench_eth.h"
+
+#define BENCH_UDP_PORT      7000
+#define BENCH_TCP_PORT      8000
+
+/*******************************************************************************
+ * ETH_StackTask
+ ******************************************************************************/
+static void bench_task_call(void)
+{
+    ETH_StackTask();
+}
+
+static void bench_task(const char *scenario, bool has_frame, uint32_t iterations, BENCH_STATS *p_stats)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < iterations ; i++)
+    {
+        UDPDiscard();
+        sim_advance(SIM_US(100));
+        if (has_frame)
+        {
+            sim_eth_inject(bench_eth_frame, bench_eth_frame_size);
+        }
+        bench_call(p_stats, (i & 1), bench_task_call);
+    }
+    bench_report("ETH_StackTask", scenario, p_stats);
+}
+
+static void bench_frame_report(const char *protocol, const BENCH_STATS *p_frame, const BENCH_STATS *p_idle)
+{
+    char text[96];
+
+    snprintf(text, sizeof(text), "%s: %.1f host cyc / %.1f sim cyc by frame (%u buckets)",
+            protocol,
+            (double) p_frame->host_cycles / p_frame->flat_calls - (double) p_idle->host_cycles / p_idle->flat_calls,
+            (double) p_frame->sim_cycles / p_frame->trap_calls - (double) p_idle->sim_cycles / p_idle->trap_calls,
+            (strcmp(protocol, "UDP") == 0) ? (unsigned) UDP_PORT_TABLE_SIZE : (unsigned) TCP_HASH_TABLE_SIZE);
+    bench_report("demux", text, p_frame);
+}
+
+static void bench_demux(uint32_t iterations)
+{
+    BENCH_STATS idle = {0}, udp = {0}, tcp = {0};
+    char scenario[64];
+    uint32_t i;
+
+    sim_test_init(SIM_MODE_TRAP);
+    bench_eth_init();
+    for (i = 0 ; i < MAX_UDP_SOCKETS ; i++)
+    {
+        UDPOpenEx(0, UDP_OPEN_SERVER, BENCH_UDP_PORT + i, 0);
+    }
+    for (i = 0 ; i < MAX_TCP_SOCKETS ; i++)
+    {
+        TCPOpen(0, TCP_OPEN_SERVER, BENCH_TCP_PORT + i);
+    }
+
+    snprintf(scenario, sizeof(scenario), "%u UDP + %u TCP sockets, no frame", (unsigned) MAX_UDP_SOCKETS, (unsigned) MAX_TCP_SOCKETS);
+    bench_task(scenario, false, iterations, &idle);
+    bench_eth_build_udp(BENCH_UDP_PORT + MAX_UDP_SOCKETS - 1);
+    snprintf(scenario, sizeof(scenario), "UDP datagram for the socket %u", (unsigned) MAX_UDP_SOCKETS);
+    bench_task(scenario, true, iterations, &udp);
+    bench_eth_build_tcp(BENCH_TCP_PORT + MAX_TCP_SOCKETS - 1, 1, 0, RST, 0x1000);
+    snprintf(scenario, sizeof(scenario), "TCP RST for the socket %u", (unsigned) MAX_TCP_SOCKETS);
+    bench_task(scenario, true, iterations, &tcp);
+
+    bench_frame_report("UDP", &udp, &idle);
+    bench_frame_report("TCP", &tcp, &idle);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t iterations = ((argc > 1) && (strcmp(argv[1], "--quick") == 0)) ? 100 : 2000;
+
+    bench_header();
+    bench_demux(iterations);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*********************************************************************
+*	Host simulation - Ethernet frames of the benchmarks
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Frames of a remote node (192.168.1.20, port 49152) for the stack
+*   (192.168.1.10), injected with sim_eth_inject(bench_eth_frame,
+*   bench_eth_frame_size).
+*********************************************************************/
+
+#ifndef __HOST_SIM_BENCH_ETH_H
+#define __HOST_SIM_BENCH_ETH_H
+
+#define BENCH_ETH_PEER_PORT     49152
+
+static const uint8_t bench_eth_my_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const uint8_t bench_eth_peer_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x20};
+static const uint8_t bench_eth_my_ip[4] = {192, 168, 1, 10};
+static const uint8_t bench_eth_peer_ip[4] = {192, 168, 1, 20};
+
+static uint8_t bench_eth_frame[128];
+static size_t bench_eth_frame_size;
+
+static uint16_t bench_eth_checksum(uint32_t sum, const uint8_t *p, size_t size)
+{
+    size_t i;
+
+    for (i = 0 ; i < size ; i += 2)
+    {
+        sum += (p[i] << 8) | ((i + 1 < size) ? p[i + 1] : 0);
+    }
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return (uint16_t) ~sum;
+}
+
+// Ethernet + IP headers of a 'size' bytes IP payload. Returns the payload.
+static uint8_t* bench_eth_put_headers(uint8_t protocol, size_t size)
+{
+    uint8_t *p = bench_eth_frame;
+    uint16_t checksum;
+
+    memset(bench_eth_frame, 0, sizeof(bench_eth_frame));
+    memcpy(&p[0], bench_eth_my_mac, 6);
+    memcpy(&p[6], bench_eth_peer_mac, 6);
+    p[12] = 0x08; p[13] = 0x00;
+    p[14] = 0x45;
+    p[16] = (20 + size) >> 8; p[17] = (20 + size) & 0xff;
+    p[22] = 64;
+    p[23] = protocol;
+    memcpy(&p[26], bench_eth_peer_ip, 4);
+    memcpy(&p[30], bench_eth_my_ip, 4);
+    checksum = bench_eth_checksum(0, &p[14], 20);
+    p[24] = checksum >> 8; p[25] = checksum & 0xff;
+    bench_eth_frame_size = (14 + 20 + size < 60) ? 60 : 14 + 20 + size;
+    return &p[14 + 20];
+}
+
+// Sum of the pseudo header (not complemented, not folded).
+static uint32_t bench_eth_pseudo_header_sum(uint8_t protocol, size_t size)
+{
+    return ((bench_eth_peer_ip[0] << 8) | bench_eth_peer_ip[1]) + ((bench_eth_peer_ip[2] << 8) | bench_eth_peer_ip[3])
+            + ((bench_eth_my_ip[0] << 8) | bench_eth_my_ip[1]) + ((bench_eth_my_ip[2] << 8) | bench_eth_my_ip[3])
+            + protocol + size;
+}
+
+// UDP datagram of 8 bytes for 'port'.
+static void bench_eth_build_udp(uint16_t port)
+{
+    uint8_t *p = bench_eth_put_headers(IP_PROTOCOLE_UDP, 8 + 8);
+    uint16_t checksum;
+
+    p[0] = BENCH_ETH_PEER_PORT >> 8; p[1] = BENCH_ETH_PEER_PORT & 0xff;
+    p[2] = port >> 8; p[3] = port & 0xff;
+    p[4] = 0; p[5] = 8 + 8;
+    memcpy(&p[8], "demuxing", 8);
+    checksum = bench_eth_checksum(bench_eth_pseudo_header_sum(IP_PROTOCOLE_UDP, 8 + 8), p, 8 + 8);
+    p[6] = checksum >> 8; p[7] = checksum & 0xff;
+}
+
+// TCP segment without data for 'port'.
+static void bench_eth_build_tcp(uint16_t port, uint32_t seq, uint32_t ack, uint8_t flags, uint16_t window)
+{
+    uint8_t *p = bench_eth_put_headers(IP_PROTOCOLE_TCP, 20);
+    uint16_t checksum;
+
+    p[0] = BENCH_ETH_PEER_PORT >> 8; p[1] = BENCH_ETH_PEER_PORT & 0xff;
+    p[2] = port >> 8; p[3] = port & 0xff;
+    p[4] = seq >> 24; p[5] = seq >> 16; p[6] = seq >> 8; p[7] = seq;
+    p[8] = ack >> 24; p[9] = ack >> 16; p[10] = ack >> 8; p[11] = ack;
+    p[12] = 5 << 4;
+    p[13] = flags;
+    p[14] = window >> 8; p[15] = window & 0xff;
+    checksum = bench_eth_checksum(bench_eth_pseudo_header_sum(IP_PROTOCOLE_TCP, 20), p, 20);
+    p[16] = checksum >> 8; p[17] = checksum & 0xff;
+}
+
+// Stack started with the link up.
+static void bench_eth_init(void)
+{
+    uint8_t frame[1536];
+    uint32_t i;
+
+    ETH_StackInit((BYTE*) "02:00:00:00:00:01", (BYTE*) "192.168.1.10", FALSE);
+    for (i = 0 ; i < 10 ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        mGetTick();
+        ETH_StackTask();
+    }
+    while (sim_eth_get_tx(frame, sizeof(frame)));
+}
+
+#endif
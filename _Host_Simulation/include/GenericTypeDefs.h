@@ -0,0 +1,98 @@
+/*********************************************************************
+*	Host simulation - GenericTypeDefs.h
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Subset of the Microchip generic types used by PLIB.
+*********************************************************************/
+
+#ifndef __DEF_HOST_GENERIC_TYPE_DEFS
+#define __DEF_HOST_GENERIC_TYPE_DEFS
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum _BOOL { FALSE = 0, TRUE } BOOL;
+
+#define PUBLIC
+#define PROTECTED
+#define PRIVATE     static
+
+typedef unsigned char       BYTE;
+typedef unsigned short int  WORD;
+typedef uint32_t            DWORD;
+typedef unsigned long long  QWORD;
+typedef signed char         CHAR;
+typedef signed short int    SHORT;
+typedef int32_t             LONG;
+typedef signed long long    LONGLONG;
+
+typedef signed int          INT;
+typedef signed char         INT8;
+typedef signed short int    INT16;
+typedef int32_t             INT32;
+typedef signed long long    INT64;
+
+typedef unsigned int        UINT;
+typedef unsigned char       UINT8;
+typedef unsigned short int  UINT16;
+typedef unsigned int        UINT32;
+typedef unsigned long long  UINT64;
+
+typedef union
+{
+    BYTE Val;
+    struct
+    {
+        unsigned char b0:1;
+        unsigned char b1:1;
+        unsigned char b2:1;
+        unsigned char b3:1;
+        unsigned char b4:1;
+        unsigned char b5:1;
+        unsigned char b6:1;
+        unsigned char b7:1;
+    } bits;
+} BYTE_VAL;
+
+typedef union
+{
+    WORD Val;
+    BYTE v[2];
+    struct
+    {
+        BYTE LB;
+        BYTE HB;
+    } byte;
+} WORD_VAL;
+
+typedef union
+{
+    DWORD Val;
+    WORD w[2];
+    BYTE v[4];
+    struct
+    {
+        WORD LW;
+        WORD HW;
+    } word;
+    struct
+    {
+        BYTE LB;
+        BYTE HB;
+        BYTE UB;
+        BYTE MB;
+    } byte;
+} DWORD_VAL;
+
+typedef union
+{
+    QWORD Val;
+    DWORD d[2];
+    WORD w[4];
+    BYTE v[8];
+} QWORD_VAL;
+
+#endif
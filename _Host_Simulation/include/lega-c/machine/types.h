@@ -0,0 +1,15 @@
+/*********************************************************************
+*	Host simulation - <lega-c/machine/types.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_MACHINE_TYPES_H
+#define __HOST_SIM_MACHINE_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#endif
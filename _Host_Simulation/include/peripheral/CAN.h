@@ -0,0 +1,194 @@
+/*********************************************************************
+*	Host simulation - <peripheral/CAN.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_PLIB_CAN_H
+#define __HOST_SIM_PLIB_CAN_H
+
+#include <xc.h>
+#include <GenericTypeDefs.h>
+
+typedef enum
+{
+    CAN1 = 0,
+    CAN2,
+    CAN_NUMBER_OF_MODULES
+} CAN_MODULE;
+
+typedef enum
+{
+    CAN_CHANNEL0 = 0, CAN_CHANNEL1, CAN_CHANNEL2, CAN_CHANNEL3,
+    CAN_CHANNEL4, CAN_CHANNEL5, CAN_CHANNEL6, CAN_CHANNEL7,
+    CAN_CHANNEL8, CAN_CHANNEL9, CAN_CHANNEL10, CAN_CHANNEL11,
+    CAN_CHANNEL12, CAN_CHANNEL13, CAN_CHANNEL14, CAN_CHANNEL15,
+    CAN_CHANNEL16, CAN_CHANNEL17, CAN_CHANNEL18, CAN_CHANNEL19,
+    CAN_CHANNEL20, CAN_CHANNEL21, CAN_CHANNEL22, CAN_CHANNEL23,
+    CAN_CHANNEL24, CAN_CHANNEL25, CAN_CHANNEL26, CAN_CHANNEL27,
+    CAN_CHANNEL28, CAN_CHANNEL29, CAN_CHANNEL30, CAN_CHANNEL31,
+    CAN_ALL_CHANNELS
+} CAN_CHANNEL;
+
+typedef enum
+{
+    CAN_FILTER0 = 0, CAN_FILTER1, CAN_FILTER2, CAN_FILTER3,
+    CAN_FILTER4, CAN_FILTER5, CAN_FILTER6, CAN_FILTER7,
+    CAN_FILTER8, CAN_FILTER9, CAN_FILTER10, CAN_FILTER11,
+    CAN_FILTER12, CAN_FILTER13, CAN_FILTER14, CAN_FILTER15,
+    CAN_FILTER16, CAN_FILTER17, CAN_FILTER18, CAN_FILTER19,
+    CAN_FILTER20, CAN_FILTER21, CAN_FILTER22, CAN_FILTER23,
+    CAN_FILTER24, CAN_FILTER25, CAN_FILTER26, CAN_FILTER27,
+    CAN_FILTER28, CAN_FILTER29, CAN_FILTER30, CAN_FILTER31
+} CAN_FILTER;
+
+typedef enum
+{
+    CAN_FILTER_MASK0 = 0,
+    CAN_FILTER_MASK1,
+    CAN_FILTER_MASK2,
+    CAN_FILTER_MASK3
+} CAN_FILTER_MASK;
+
+typedef enum
+{
+    CAN_NORMAL_OPERATION = 0,
+    CAN_DISABLE,
+    CAN_LOOPBACK,
+    CAN_LISTEN_ONLY,
+    CAN_CONFIGURATION,
+    CAN_LISTEN_ALL_MESSAGES = 7
+} CAN_OP_MODE;
+
+typedef enum
+{
+    CAN_TX_RTR_DISABLED = 0,
+    CAN_TX_RTR_ENABLED
+} CAN_TX_RTR;
+
+typedef enum
+{
+    CAN_LOWEST_PRIORITY = 0,
+    CAN_LOW_MEDIUM_PRIORITY,
+    CAN_HIGH_MEDIUM_PRIORITY,
+    CAN_HIGHEST_PRIORITY
+} CAN_TXCHANNEL_PRIORITY;
+
+typedef enum
+{
+    CAN_RX_FULL_RECEIVE = 0,
+    CAN_RX_DATA_ONLY
+} CAN_RX_DATA_MODE;
+
+typedef enum
+{
+    CAN_RX_CHANNEL_NOT_EMPTY =      0x0001,
+    CAN_RX_CHANNEL_HALF_FULL =      0x0002,
+    CAN_RX_CHANNEL_FULL =           0x0004,
+    CAN_RX_CHANNEL_OVERFLOW =       0x0008,
+    CAN_TX_CHANNEL_EMPTY =          0x0100,
+    CAN_TX_CHANNEL_HALF_EMPTY =     0x0200,
+    CAN_TX_CHANNEL_NOT_FULL =       0x0400,
+    CAN_RX_CHANNEL_ANY_EVENT =      0x000F,
+    CAN_TX_CHANNEL_ANY_EVENT =      0x0700
+} CAN_CHANNEL_EVENT;
+
+typedef enum
+{
+    CAN_TX_EVENT =                  0x0001,
+    CAN_RX_EVENT =                  0x0002,
+    CAN_TIMESTAMP_TIMER_OVERFLOW_EVENT = 0x0004,
+    CAN_OPERATION_MODE_CHANGE_EVENT = 0x0008,
+    CAN_RX_OVERFLOW_EVENT =         0x0800,
+    CAN_SYSTEM_ERROR_EVENT =        0x1000,
+    CAN_BUS_ERROR_EVENT =           0x2000,
+    CAN_BUS_ACTIVITY_WAKEUP_EVENT = 0x4000,
+    CAN_INVALID_RX_MESSAGE_EVENT =  0x8000
+} CAN_MODULE_EVENT;
+
+typedef enum
+{
+    CAN_BIT_1TQ = 0,
+    CAN_BIT_2TQ,
+    CAN_BIT_3TQ,
+    CAN_BIT_4TQ,
+    CAN_BIT_5TQ,
+    CAN_BIT_6TQ,
+    CAN_BIT_7TQ,
+    CAN_BIT_8TQ
+} CAN_BIT_TQ;
+
+typedef struct
+{
+    CAN_BIT_TQ phaseSeg2Tq;
+    CAN_BIT_TQ phaseSeg1Tq;
+    CAN_BIT_TQ propagationSegTq;
+    BOOL phaseSeg2TimeSelect;
+    BOOL sample3Time;
+    CAN_BIT_TQ syncJumpWidth;
+} CAN_BIT_CONFIG;
+
+typedef struct
+{
+    unsigned SID:11;
+    unsigned FILHIT:5;
+    unsigned CMSGTS:16;
+} CAN_RX_MSG_SID;
+
+typedef struct
+{
+    unsigned SID:11;
+    unsigned :21;
+} CAN_TX_MSG_SID;
+
+typedef struct
+{
+    unsigned DLC:4;
+    unsigned RB0:1;
+    unsigned :3;
+    unsigned RB1:1;
+    unsigned RTR:1;
+    unsigned EID:18;
+    unsigned IDE:1;
+    unsigned SRR:1;
+    unsigned :2;
+} CAN_MSG_EID;
+
+typedef union
+{
+    struct
+    {
+        CAN_RX_MSG_SID msgSID;
+        CAN_MSG_EID msgEID;
+        BYTE data[8];
+    };
+    UINT32 messageWord[4];
+} CANRxMessageBuffer;
+
+typedef union
+{
+    struct
+    {
+        CAN_TX_MSG_SID msgSID;
+        CAN_MSG_EID msgEID;
+        BYTE data[8];
+    };
+    UINT32 messageWord[4];
+} CANTxMessageBuffer;
+
+void CANSetOperatingMode(CAN_MODULE module, CAN_OP_MODE opmode);
+CAN_OP_MODE CANGetOperatingMode(CAN_MODULE module);
+void CANSetSpeed(CAN_MODULE module, const CAN_BIT_CONFIG *canBitConfig, UINT32 sysClock, UINT32 canBusSpeed);
+void CANConfigureChannelForTx(CAN_MODULE module, CAN_CHANNEL channel, UINT channelSize, CAN_TX_RTR rtren, CAN_TXCHANNEL_PRIORITY priority);
+void CANConfigureChannelForRx(CAN_MODULE module, CAN_CHANNEL channel, UINT channelSize, CAN_RX_DATA_MODE dataOnly);
+void CANEnableModuleEvent(CAN_MODULE module, CAN_MODULE_EVENT flags, BOOL enable);
+void CANEnableChannelEvent(CAN_MODULE module, CAN_CHANNEL channel, CAN_CHANNEL_EVENT flags, BOOL enable);
+CAN_CHANNEL_EVENT CANGetChannelEvent(CAN_MODULE module, CAN_CHANNEL channel);
+CANTxMessageBuffer * CANGetTxMessageBuffer(CAN_MODULE module, CAN_CHANNEL channel);
+CANRxMessageBuffer * CANGetRxMessage(CAN_MODULE module, CAN_CHANNEL channel);
+void CANUpdateChannel(CAN_MODULE module, CAN_CHANNEL channel);
+void CANFlushTxChannel(CAN_MODULE module, CAN_CHANNEL channel);
+
+#endif
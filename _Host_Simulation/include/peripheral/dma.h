@@ -0,0 +1,109 @@
+/*********************************************************************
+*	Host simulation - <peripheral/dma.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_PLIB_DMA_H
+#define __HOST_SIM_PLIB_DMA_H
+
+#include <xc.h>
+
+typedef enum
+{
+    DMA_CHANNEL0 = 0,
+    DMA_CHANNEL1,
+    DMA_CHANNEL2,
+    DMA_CHANNEL3,
+    DMA_CHANNEL4,
+    DMA_CHANNEL5,
+    DMA_CHANNEL6,
+    DMA_CHANNEL7,
+    DMA_CHANNELS
+} DmaChannel;
+
+typedef enum
+{
+    DMA_CHN_PRI0 = 0,
+    DMA_CHN_PRI1,
+    DMA_CHN_PRI2,
+    DMA_CHN_PRI3
+} DmaChannelPri;
+
+typedef enum
+{
+    DMA_OPEN_DEFAULT =      0,
+    DMA_OPEN_AUTO =         0x00000010,
+    DMA_OPEN_CHAIN_LOW =    0x00000120,
+    DMA_OPEN_CHAIN_HI =     0x00000020,
+    DMA_OPEN_DET_EN =       0x00000040,
+    DMA_OPEN_ENABLE =       0x00000080,
+    DMA_OPEN_MATCH =        0x80000000
+} DmaOpenFlags;
+
+typedef enum
+{
+    DMA_CTL_AUTO_ENABLE =   0x00000010,
+    DMA_CTL_CHAIN_ENABLE =  0x00000020,
+    DMA_CTL_DET_EN =        0x00000040,
+    DMA_CTL_CHN_ENABLE =    0x00000080
+} DmaChnCtrlFlags;
+
+typedef enum
+{
+    DMA_EV_ERR =            0x01,
+    DMA_EV_ABORT =          0x02,
+    DMA_EV_CELL_DONE =      0x04,
+    DMA_EV_BLOCK_DONE =     0x08,
+    DMA_EV_DST_HALF =       0x10,
+    DMA_EV_DST_FULL =       0x20,
+    DMA_EV_SRC_HALF =       0x40,
+    DMA_EV_SRC_FULL =       0x80,
+    DMA_EV_ALL_EVNTS =      0xFF
+} DmaEvFlags;
+
+typedef enum
+{
+    DMA_EV_MATCH_EN =       0x00000008,
+    DMA_EV_START_IRQ_EN =   0x00000010,
+    DMA_EV_ABORT_IRQ_EN =   0x00000020
+} DmaEvCtrlFlags;
+
+#define DMA_EV_START_IRQ(irq)       (DMA_EV_START_IRQ_EN | (((irq) & 0xFF) << 8))
+#define DMA_EV_ABORT_IRQ(irq)       (DMA_EV_ABORT_IRQ_EN | (((irq) & 0xFF) << 16))
+
+typedef enum
+{
+    DMA_WAIT_NOT = 0,
+    DMA_WAIT_CELL,
+    DMA_WAIT_BLOCK
+} DmaWaitMode;
+
+typedef enum
+{
+    DMA_TXFER_OK = 0,
+    DMA_TXFER_ADD_ERR = -1,
+    DMA_TXFER_SIZE_ERR = -2,
+    DMA_TXFER_TMO = -3,
+    DMA_TXFER_ABORT = -4,
+    DMA_TXFER_BC_ERR = -5
+} DmaTxferRes;
+
+void DmaChnOpen(DmaChannel chn, DmaChannelPri chPri, DmaOpenFlags oFlags);
+void DmaChnEnable(DmaChannel chn);
+void DmaChnDisable(DmaChannel chn);
+void DmaChnSetControlFlags(DmaChannel chn, DmaChnCtrlFlags dmaChnCtrlFlags);
+void DmaChnClrControlFlags(DmaChannel chn, DmaChnCtrlFlags dmaChnCtrlFlags);
+void DmaChnSetEventControl(DmaChannel chn, unsigned int dmaEvCtrl);
+void DmaChnSetEvEnableFlags(DmaChannel chn, DmaEvFlags eFlags);
+void DmaChnClrEvEnableFlags(DmaChannel chn, DmaEvFlags eFlags);
+void DmaChnClrEvFlags(DmaChannel chn, DmaEvFlags eFlags);
+DmaEvFlags DmaChnGetEvFlags(DmaChannel chn);
+DmaTxferRes DmaChnSetTxfer(DmaChannel chn, const void *vSrcAdd, void *vDstAdd, int srcSize, int dstSize, int cellSize);
+DmaTxferRes DmaChnStartTxfer(DmaChannel chn, DmaWaitMode wMode, unsigned long retries);
+void DmaChnForceTxfer(DmaChannel chn);
+void DmaChnAbortTxfer(DmaChannel chn);
+
+#endif
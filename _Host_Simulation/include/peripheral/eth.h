@@ -0,0 +1,156 @@
+/*********************************************************************
+*	Host simulation - <peripheral/eth.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_PLIB_ETH_H
+#define __HOST_SIM_PLIB_ETH_H
+
+#include <xc.h>
+#include <stddef.h>
+
+typedef enum
+{
+    ETH_RES_OK = 0,
+    ETH_RES_PACKET_QUEUED = 1,
+    ETH_RES_NO_PACKET = 2,
+    ETH_RES_RX_PKT_PART_ERR = -1,
+    ETH_RES_USPACE_ERR = -2,
+    ETH_RES_DCPT_ERR = -3,
+    ETH_RES_NO_DESCRIPTORS = -4,
+    ETH_RES_BUSY = -5,
+    ETH_RES_NOT_READY_ERR = -6,
+    ETH_RES_CPBL_ERR = -7,
+    ETH_RES_DTCT_ERR = -8,
+    ETH_RES_CFG_ERR = -9,
+    ETH_RES_NEGOTIATION_INACTIVE = -10,
+    ETH_RES_NEGOTIATION_ACTIVE = -11,
+    ETH_RES_NEGOTIATION_NOT_STARTED = -12,
+    ETH_RES_NEGOTIATION_UNABLE = -13
+} eEthRes;
+
+typedef enum
+{
+    ETH_OPEN_AUTO =             0x00000001,
+    ETH_OPEN_FDUPLEX =          0x00000002,
+    ETH_OPEN_HDUPLEX =          0x00000004,
+    ETH_OPEN_100 =              0x00000008,
+    ETH_OPEN_10 =               0x00000010,
+    ETH_OPEN_HUGE_PKTS =        0x00000020,
+    ETH_OPEN_MAC_LOOPBACK =     0x00000040,
+    ETH_OPEN_PHY_LOOPBACK =     0x00000080,
+    ETH_OPEN_MDIX_AUTO =        0x00000100,
+    ETH_OPEN_MDIX_NORM =        0x00000000,
+    ETH_OPEN_MDIX_SWAP =        0x00000200,
+    ETH_OPEN_MII =              0x00000400,
+    ETH_OPEN_RMII =             0x00000800
+} eEthOpenFlags;
+
+typedef enum
+{
+    ETH_LINK_ST_DOWN =          0x0000,
+    ETH_LINK_ST_UP =            0x0001,
+    ETH_LINK_ST_LP_NEG_UNABLE = 0x0002,
+    ETH_LINK_ST_REMOTE_FAULT =  0x0004,
+    ETH_LINK_ST_PDF =           0x0008,
+    ETH_LINK_ST_LP_PAUSE =      0x0010,
+    ETH_LINK_ST_LP_ASM_DIR =    0x0020,
+    ETH_LINK_ST_NEG_TMO =       0x1000,
+    ETH_LINK_ST_NEG_FATAL_ERR = 0x2000
+} eEthLinkStat;
+
+typedef enum
+{
+    ETH_MAC_PAUSE_TYPE_NONE =   0x0,
+    ETH_MAC_PAUSE_TYPE_PAUSE =  0x1,
+    ETH_MAC_PAUSE_TYPE_ASM_DIR = 0x2,
+    ETH_MAC_PAUSE_TYPE_EN_TX =  0x4,
+    ETH_MAC_PAUSE_TYPE_EN_RX =  0x8,
+    ETH_MAC_PAUSE_CPBL_MASK =   0x3
+} eEthMacPauseType;
+
+typedef enum
+{
+    ETH_DCPT_TYPE_RX =          0x1,
+    ETH_DCPT_TYPE_TX =          0x2,
+    ETH_DCPT_TYPE_ALL =         0x3
+} eEthDcptType;
+
+typedef enum
+{
+    ETH_BUFF_FLAG_RX_STICKY =   0x1,
+    ETH_BUFF_FLAG_RX_UNACK =    0x2
+} eEthBuffFlags;
+
+typedef enum
+{
+    ETH_FILT_HTBL_ACCEPT =      0x0800,
+    ETH_FILT_MAGICP_ACCEPT =    0x0400,
+    ETH_FILT_PMATCH_ACCEPT =    0x0200,
+    ETH_FILT_CRC_ERR_ACCEPT =   0x0100,
+    ETH_FILT_RUNT_ACCEPT =      0x0080,
+    ETH_FILT_ME_UCAST_ACCEPT =  0x0040,
+    ETH_FILT_NOTME_UCAST_ACCEPT = 0x0020,
+    ETH_FILT_MCAST_ACCEPT =     0x0002,
+    ETH_FILT_BCAST_ACCEPT =     0x0001,
+    ETH_FILT_CRC_ERR_REJECT =   0x10000,
+    ETH_FILT_RUNT_REJECT =      0x20000,
+    ETH_FILT_ALL_FILTERS =      0x30FE3
+} eEthRxFilters;
+
+typedef union
+{
+    struct
+    {
+        unsigned rxBytes:16;
+        unsigned pktChecksum:16;
+        unsigned :1;
+        unsigned runtPkt:1;
+        unsigned notMeUcast:1;
+        unsigned htMatch:1;
+        unsigned magicMatch:1;
+        unsigned pmMatch:1;
+        unsigned uMatch:1;
+        unsigned bMatch:1;
+        unsigned mMatch:1;
+        unsigned rxPktIgnored:1;
+        unsigned crcError:1;
+        unsigned lenError:1;
+        unsigned lenRange:1;
+        unsigned rxOk:1;
+        unsigned mcast:1;
+        unsigned bcast:1;
+        unsigned dribble:1;
+        unsigned ctrlFrame:1;
+        unsigned pauseFrame:1;
+        unsigned unknownOp:1;
+        unsigned vlan:1;
+        unsigned :9;
+    };
+    unsigned long long w;
+} sEthRxPktStat;
+
+typedef void (*pEthPktAckF)(void *pPktBuff, int buffIx, void *fParam);
+typedef void *(*pEthBuffAlloc)(size_t nitems, size_t size, void *param);
+
+void EthInit(void);
+void EthMACOpen(eEthOpenFlags oFlags, eEthMacPauseType pauseType);
+void EthRxFiltersClr(eEthRxFilters rxFilters);
+void EthRxFiltersSet(eEthRxFilters rxFilters);
+int EthDescriptorsPoolAdd(int nDescriptors, eEthDcptType dType, pEthBuffAlloc fAlloc, void *fParam);
+eEthRes EthRxSetBufferSize(int rxBuffSize);
+eEthRes EthRxBuffersAppend(void *ppBuff[], int nBuffs, eEthBuffFlags rxFlags);
+eEthRes EthRxGetBuffer(void **ppBuff, const sEthRxPktStat **pRxStat);
+eEthRes EthRxAcknowledgeBuffer(const void *pBuff, pEthPktAckF ackFnc, void *fParam);
+int EthDescriptorsGetRxUnack(void);
+eEthRes EthTxSendBuffer(const void *pBuff, unsigned short nBytes);
+eEthRes EthTxAcknowledgeBuffer(const void *pBuff, pEthPktAckF ackFnc, void *fParam);
+void EthMIIMConfig(unsigned int hostClock, unsigned int miimClock);
+void EthMIIMReadStart(unsigned int rIx, unsigned int phyAdd);
+void EthMIIMWriteStart(unsigned int rIx, unsigned int phyAdd, unsigned short wData);
+unsigned short EthMIIMReadResult(void);
+
+#endif
@@ -0,0 +1,18 @@
+/*********************************************************************
+*	Host simulation - <peripheral/spi.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_PLIB_SPI_H
+#define __HOST_SIM_PLIB_SPI_H
+
+#include <xc.h>
+
+#define SPI_CON_MODE32              (1 << _SPI1CON_MODE32_POSITION)
+#define SPI_CON_MODE16              (1 << _SPI1CON_MODE16_POSITION)
+#define SPI_CON_MODE8               (0)
+
+#endif
@@ -0,0 +1,16 @@
+/*********************************************************************
+*	Host simulation - <peripheral/system.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_PLIB_SYSTEM_H
+#define __HOST_SIM_PLIB_SYSTEM_H
+
+#include <xc.h>
+
+void SoftReset(void);                   // Aborts the simulation
+
+#endif
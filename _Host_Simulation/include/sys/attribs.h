@@ -0,0 +1,17 @@
+/*********************************************************************
+*	Host simulation - <sys/attribs.h>
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#ifndef __HOST_SIM_ATTRIBS_H
+#define __HOST_SIM_ATTRIBS_H
+
+// The handlers are plain functions on the host, they are attached to their
+// interrupt source with sim_irq_attach() (see sim.h).
+#define __ISR(vector, ...)          __attribute__((used))
+#define __ISR_AT_VECTOR(vector, ...) __attribute__((used))
+
+#endif
@@ -0,0 +1,3144 @@
+/*********************************************************************
+*	Host simulation - <xc.h> replacement
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Maps the PIC32MX795F512L special function registers used by the
+*   library onto the simulated SFR space (see sim.h). Every register
+*   keeps its device address, so the CLR / SET / INV offsets and the
+*   xxx_BASE_ADDRESS tables of the drivers work unchanged.
+*********************************************************************/
+
+#ifndef __HOST_SIM_XC_H
+#define __HOST_SIM_XC_H
+
+#include <stdint.h>
+#include <stdlib.h>                 // xc32 declares them implicitly: an implicit int would
+#include <string.h>                 // truncate the pointers on the host
+#include <sys/attribs.h>
+
+#define __PIC32MX__                 1
+#define __32MX795F512L__            1
+
+#define SIM_SFR_BASE                0xBF800000UL
+#define SIM_SFR_SIZE                0x00100000UL
+
+extern volatile uint32_t sim_sfr[SIM_SFR_SIZE / 4];
+
+#define SIM_SFR(a)                  (sim_sfr[((a) - SIM_SFR_BASE) >> 2])
+#define SIM_SFR_ADDRESS(a)          ((unsigned long) &SIM_SFR(a))
+
+// Registers with their CLR (+4), SET (+8) and INV (+C) companions.
+#define SIM_REG(a)                  SIM_SFR(a)
+
+/*******************************************************************************
+ * Builtins / CP0
+ ******************************************************************************/
+unsigned int sim_disable_interrupts(void);
+unsigned int sim_enable_interrupts(void);
+unsigned int sim_core_timer_read(void);
+void sim_nop(void);
+void sim_wait(void);
+
+#define __builtin_disable_interrupts()      sim_disable_interrupts()
+#define __builtin_enable_interrupts()       sim_enable_interrupts()
+#define _CP0_GET_COUNT()                    sim_core_timer_read()
+#define Nop()                               sim_nop()
+#define _wait()                             sim_wait()
+
+#define KVA_TO_PA(v)                ((unsigned long)(v))
+#define PA_TO_KVA0(pa)              ((void *)(pa))
+#define PA_TO_KVA1(pa)              ((void *)(pa))
+#define KVA0_TO_KVA1(v)             (v)
+#define KVA1_TO_KVA0(v)             (v)
+
+
+/*******************************************************************************
+ * Device features
+ ******************************************************************************/
+#define _TMR1                                
+#define _TMR2                                
+#define _TMR3                                
+#define _TMR4                                
+#define _TMR5                                
+#define _OCMP1                               
+#define _OCMP2                               
+#define _OCMP3                               
+#define _OCMP4                               
+#define _OCMP5                               
+#define _I2C1                                
+#define _I2C2                                
+#define _I2C3                                
+#define _I2C4                                
+#define _I2C5                                
+#define _SPI1                                
+#define _SPI2                                
+#define _SPI3                                
+#define _SPI4                                
+#define _UART1                               
+#define _UART2                               
+#define _UART3                               
+#define _UART4                               
+#define _UART5                               
+#define _UART6                               
+#define _ADC10                               
+#define _DMAC                                
+#define _CAN1                                
+#define _CAN2                                
+#define _ETH                                 
+#define _PORTA                               
+#define _PORTB                               
+#define _PORTC                               
+#define _PORTD                               
+#define _PORTE                               
+#define _PORTF                               
+#define _PORTG                               
+
+/*******************************************************************************
+ * Timers
+ ******************************************************************************/
+#define _TMR1_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF800600UL)
+#define T1CON                        SIM_SFR(0xBF800600UL)
+#define T1CONCLR                     SIM_SFR(0xBF800604UL)
+#define T1CONSET                     SIM_SFR(0xBF800608UL)
+#define T1CONINV                     SIM_SFR(0xBF80060CUL)
+#define TMR1                         SIM_SFR(0xBF800610UL)
+#define TMR1CLR                      SIM_SFR(0xBF800614UL)
+#define TMR1SET                      SIM_SFR(0xBF800618UL)
+#define TMR1INV                      SIM_SFR(0xBF80061CUL)
+#define PR1                          SIM_SFR(0xBF800620UL)
+#define PR1CLR                       SIM_SFR(0xBF800624UL)
+#define PR1SET                       SIM_SFR(0xBF800628UL)
+#define PR1INV                       SIM_SFR(0xBF80062CUL)
+#define _TMR2_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF800800UL)
+#define T2CON                        SIM_SFR(0xBF800800UL)
+#define T2CONCLR                     SIM_SFR(0xBF800804UL)
+#define T2CONSET                     SIM_SFR(0xBF800808UL)
+#define T2CONINV                     SIM_SFR(0xBF80080CUL)
+#define TMR2                         SIM_SFR(0xBF800810UL)
+#define TMR2CLR                      SIM_SFR(0xBF800814UL)
+#define TMR2SET                      SIM_SFR(0xBF800818UL)
+#define TMR2INV                      SIM_SFR(0xBF80081CUL)
+#define PR2                          SIM_SFR(0xBF800820UL)
+#define PR2CLR                       SIM_SFR(0xBF800824UL)
+#define PR2SET                       SIM_SFR(0xBF800828UL)
+#define PR2INV                       SIM_SFR(0xBF80082CUL)
+#define _TMR3_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF800A00UL)
+#define T3CON                        SIM_SFR(0xBF800A00UL)
+#define T3CONCLR                     SIM_SFR(0xBF800A04UL)
+#define T3CONSET                     SIM_SFR(0xBF800A08UL)
+#define T3CONINV                     SIM_SFR(0xBF800A0CUL)
+#define TMR3                         SIM_SFR(0xBF800A10UL)
+#define TMR3CLR                      SIM_SFR(0xBF800A14UL)
+#define TMR3SET                      SIM_SFR(0xBF800A18UL)
+#define TMR3INV                      SIM_SFR(0xBF800A1CUL)
+#define PR3                          SIM_SFR(0xBF800A20UL)
+#define PR3CLR                       SIM_SFR(0xBF800A24UL)
+#define PR3SET                       SIM_SFR(0xBF800A28UL)
+#define PR3INV                       SIM_SFR(0xBF800A2CUL)
+#define _TMR4_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF800C00UL)
+#define T4CON                        SIM_SFR(0xBF800C00UL)
+#define T4CONCLR                     SIM_SFR(0xBF800C04UL)
+#define T4CONSET                     SIM_SFR(0xBF800C08UL)
+#define T4CONINV                     SIM_SFR(0xBF800C0CUL)
+#define TMR4                         SIM_SFR(0xBF800C10UL)
+#define TMR4CLR                      SIM_SFR(0xBF800C14UL)
+#define TMR4SET                      SIM_SFR(0xBF800C18UL)
+#define TMR4INV                      SIM_SFR(0xBF800C1CUL)
+#define PR4                          SIM_SFR(0xBF800C20UL)
+#define PR4CLR                       SIM_SFR(0xBF800C24UL)
+#define PR4SET                       SIM_SFR(0xBF800C28UL)
+#define PR4INV                       SIM_SFR(0xBF800C2CUL)
+#define _TMR5_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF800E00UL)
+#define T5CON                        SIM_SFR(0xBF800E00UL)
+#define T5CONCLR                     SIM_SFR(0xBF800E04UL)
+#define T5CONSET                     SIM_SFR(0xBF800E08UL)
+#define T5CONINV                     SIM_SFR(0xBF800E0CUL)
+#define TMR5                         SIM_SFR(0xBF800E10UL)
+#define TMR5CLR                      SIM_SFR(0xBF800E14UL)
+#define TMR5SET                      SIM_SFR(0xBF800E18UL)
+#define TMR5INV                      SIM_SFR(0xBF800E1CUL)
+#define PR5                          SIM_SFR(0xBF800E20UL)
+#define PR5CLR                       SIM_SFR(0xBF800E24UL)
+#define PR5SET                       SIM_SFR(0xBF800E28UL)
+#define PR5INV                       SIM_SFR(0xBF800E2CUL)
+#define _T1CON_TCS_POSITION                  0x00000001
+#define _T1CON_TCS_MASK                      0x00000002
+#define _T1CON_TCS_LENGTH                    0x00000001
+#define _T1CON_TCKPS_POSITION                0x00000004
+#define _T1CON_TCKPS_MASK                    0x00000030
+#define _T1CON_TCKPS_LENGTH                  0x00000002
+#define _T1CON_TGATE_POSITION                0x00000007
+#define _T1CON_TGATE_MASK                    0x00000080
+#define _T1CON_TGATE_LENGTH                  0x00000001
+#define _T1CON_SIDL_POSITION                 0x0000000D
+#define _T1CON_SIDL_MASK                     0x00002000
+#define _T1CON_SIDL_LENGTH                   0x00000001
+#define _T1CON_ON_POSITION                   0x0000000F
+#define _T1CON_ON_MASK                       0x00008000
+#define _T1CON_ON_LENGTH                     0x00000001
+#define _T1CON_TSYNC_POSITION                0x00000002
+#define _T1CON_TSYNC_MASK                    0x00000004
+#define _T1CON_TSYNC_LENGTH                  0x00000001
+#define _T1CON_TWIP_POSITION                 0x0000000B
+#define _T1CON_TWIP_MASK                     0x00000800
+#define _T1CON_TWIP_LENGTH                   0x00000001
+#define _T1CON_TWDIS_POSITION                0x0000000C
+#define _T1CON_TWDIS_MASK                    0x00001000
+#define _T1CON_TWDIS_LENGTH                  0x00000001
+#define _T2CON_TCS_POSITION                  0x00000001
+#define _T2CON_TCS_MASK                      0x00000002
+#define _T2CON_TCS_LENGTH                    0x00000001
+#define _T2CON_TCKPS_POSITION                0x00000004
+#define _T2CON_TCKPS_MASK                    0x00000070
+#define _T2CON_TCKPS_LENGTH                  0x00000003
+#define _T2CON_TGATE_POSITION                0x00000007
+#define _T2CON_TGATE_MASK                    0x00000080
+#define _T2CON_TGATE_LENGTH                  0x00000001
+#define _T2CON_SIDL_POSITION                 0x0000000D
+#define _T2CON_SIDL_MASK                     0x00002000
+#define _T2CON_SIDL_LENGTH                   0x00000001
+#define _T2CON_ON_POSITION                   0x0000000F
+#define _T2CON_ON_MASK                       0x00008000
+#define _T2CON_ON_LENGTH                     0x00000001
+#define _T2CON_T32_POSITION                  0x00000003
+#define _T2CON_T32_MASK                      0x00000008
+#define _T2CON_T32_LENGTH                    0x00000001
+#define _T3CON_TCS_POSITION                  0x00000001
+#define _T3CON_TCS_MASK                      0x00000002
+#define _T3CON_TCS_LENGTH                    0x00000001
+#define _T3CON_TCKPS_POSITION                0x00000004
+#define _T3CON_TCKPS_MASK                    0x00000070
+#define _T3CON_TCKPS_LENGTH                  0x00000003
+#define _T3CON_TGATE_POSITION                0x00000007
+#define _T3CON_TGATE_MASK                    0x00000080
+#define _T3CON_TGATE_LENGTH                  0x00000001
+#define _T3CON_SIDL_POSITION                 0x0000000D
+#define _T3CON_SIDL_MASK                     0x00002000
+#define _T3CON_SIDL_LENGTH                   0x00000001
+#define _T3CON_ON_POSITION                   0x0000000F
+#define _T3CON_ON_MASK                       0x00008000
+#define _T3CON_ON_LENGTH                     0x00000001
+#define _T3CON_T32_POSITION                  0x00000003
+#define _T3CON_T32_MASK                      0x00000008
+#define _T3CON_T32_LENGTH                    0x00000001
+#define _T4CON_TCS_POSITION                  0x00000001
+#define _T4CON_TCS_MASK                      0x00000002
+#define _T4CON_TCS_LENGTH                    0x00000001
+#define _T4CON_TCKPS_POSITION                0x00000004
+#define _T4CON_TCKPS_MASK                    0x00000070
+#define _T4CON_TCKPS_LENGTH                  0x00000003
+#define _T4CON_TGATE_POSITION                0x00000007
+#define _T4CON_TGATE_MASK                    0x00000080
+#define _T4CON_TGATE_LENGTH                  0x00000001
+#define _T4CON_SIDL_POSITION                 0x0000000D
+#define _T4CON_SIDL_MASK                     0x00002000
+#define _T4CON_SIDL_LENGTH                   0x00000001
+#define _T4CON_ON_POSITION                   0x0000000F
+#define _T4CON_ON_MASK                       0x00008000
+#define _T4CON_ON_LENGTH                     0x00000001
+#define _T4CON_T32_POSITION                  0x00000003
+#define _T4CON_T32_MASK                      0x00000008
+#define _T4CON_T32_LENGTH                    0x00000001
+#define _T5CON_TCS_POSITION                  0x00000001
+#define _T5CON_TCS_MASK                      0x00000002
+#define _T5CON_TCS_LENGTH                    0x00000001
+#define _T5CON_TCKPS_POSITION                0x00000004
+#define _T5CON_TCKPS_MASK                    0x00000070
+#define _T5CON_TCKPS_LENGTH                  0x00000003
+#define _T5CON_TGATE_POSITION                0x00000007
+#define _T5CON_TGATE_MASK                    0x00000080
+#define _T5CON_TGATE_LENGTH                  0x00000001
+#define _T5CON_SIDL_POSITION                 0x0000000D
+#define _T5CON_SIDL_MASK                     0x00002000
+#define _T5CON_SIDL_LENGTH                   0x00000001
+#define _T5CON_ON_POSITION                   0x0000000F
+#define _T5CON_ON_MASK                       0x00008000
+#define _T5CON_ON_LENGTH                     0x00000001
+#define _T5CON_T32_POSITION                  0x00000003
+#define _T5CON_T32_MASK                      0x00000008
+#define _T5CON_T32_LENGTH                    0x00000001
+
+typedef union
+{
+    struct
+    {
+        unsigned :1;
+        unsigned TCS:1;
+        unsigned TSYNC:1;
+        unsigned T32:1;
+        unsigned TCKPS:3;
+        unsigned TGATE:1;
+        unsigned :5;
+        unsigned SIDL:1;
+        unsigned :1;
+        unsigned ON:1;
+    };
+    uint32_t w;
+} __TxCONbits_t;
+
+#define T1CONbits                   (*(volatile __TxCONbits_t *) &T1CON)
+#define T2CONbits                   (*(volatile __TxCONbits_t *) &T2CON)
+#define T3CONbits                   (*(volatile __TxCONbits_t *) &T3CON)
+#define T4CONbits                   (*(volatile __TxCONbits_t *) &T4CON)
+#define T5CONbits                   (*(volatile __TxCONbits_t *) &T5CON)
+
+/*******************************************************************************
+ * Output compare
+ ******************************************************************************/
+#define _OCMP1_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF803000UL)
+#define OC1CON                       SIM_SFR(0xBF803000UL)
+#define OC1CONCLR                    SIM_SFR(0xBF803004UL)
+#define OC1CONSET                    SIM_SFR(0xBF803008UL)
+#define OC1CONINV                    SIM_SFR(0xBF80300CUL)
+#define OC1R                         SIM_SFR(0xBF803010UL)
+#define OC1RCLR                      SIM_SFR(0xBF803014UL)
+#define OC1RSET                      SIM_SFR(0xBF803018UL)
+#define OC1RINV                      SIM_SFR(0xBF80301CUL)
+#define OC1RS                        SIM_SFR(0xBF803020UL)
+#define OC1RSCLR                     SIM_SFR(0xBF803024UL)
+#define OC1RSSET                     SIM_SFR(0xBF803028UL)
+#define OC1RSINV                     SIM_SFR(0xBF80302CUL)
+#define _OCMP2_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF803200UL)
+#define OC2CON                       SIM_SFR(0xBF803200UL)
+#define OC2CONCLR                    SIM_SFR(0xBF803204UL)
+#define OC2CONSET                    SIM_SFR(0xBF803208UL)
+#define OC2CONINV                    SIM_SFR(0xBF80320CUL)
+#define OC2R                         SIM_SFR(0xBF803210UL)
+#define OC2RCLR                      SIM_SFR(0xBF803214UL)
+#define OC2RSET                      SIM_SFR(0xBF803218UL)
+#define OC2RINV                      SIM_SFR(0xBF80321CUL)
+#define OC2RS                        SIM_SFR(0xBF803220UL)
+#define OC2RSCLR                     SIM_SFR(0xBF803224UL)
+#define OC2RSSET                     SIM_SFR(0xBF803228UL)
+#define OC2RSINV                     SIM_SFR(0xBF80322CUL)
+#define _OCMP3_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF803400UL)
+#define OC3CON                       SIM_SFR(0xBF803400UL)
+#define OC3CONCLR                    SIM_SFR(0xBF803404UL)
+#define OC3CONSET                    SIM_SFR(0xBF803408UL)
+#define OC3CONINV                    SIM_SFR(0xBF80340CUL)
+#define OC3R                         SIM_SFR(0xBF803410UL)
+#define OC3RCLR                      SIM_SFR(0xBF803414UL)
+#define OC3RSET                      SIM_SFR(0xBF803418UL)
+#define OC3RINV                      SIM_SFR(0xBF80341CUL)
+#define OC3RS                        SIM_SFR(0xBF803420UL)
+#define OC3RSCLR                     SIM_SFR(0xBF803424UL)
+#define OC3RSSET                     SIM_SFR(0xBF803428UL)
+#define OC3RSINV                     SIM_SFR(0xBF80342CUL)
+#define _OCMP4_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF803600UL)
+#define OC4CON                       SIM_SFR(0xBF803600UL)
+#define OC4CONCLR                    SIM_SFR(0xBF803604UL)
+#define OC4CONSET                    SIM_SFR(0xBF803608UL)
+#define OC4CONINV                    SIM_SFR(0xBF80360CUL)
+#define OC4R                         SIM_SFR(0xBF803610UL)
+#define OC4RCLR                      SIM_SFR(0xBF803614UL)
+#define OC4RSET                      SIM_SFR(0xBF803618UL)
+#define OC4RINV                      SIM_SFR(0xBF80361CUL)
+#define OC4RS                        SIM_SFR(0xBF803620UL)
+#define OC4RSCLR                     SIM_SFR(0xBF803624UL)
+#define OC4RSSET                     SIM_SFR(0xBF803628UL)
+#define OC4RSINV                     SIM_SFR(0xBF80362CUL)
+#define _OCMP5_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF803800UL)
+#define OC5CON                       SIM_SFR(0xBF803800UL)
+#define OC5CONCLR                    SIM_SFR(0xBF803804UL)
+#define OC5CONSET                    SIM_SFR(0xBF803808UL)
+#define OC5CONINV                    SIM_SFR(0xBF80380CUL)
+#define OC5R                         SIM_SFR(0xBF803810UL)
+#define OC5RCLR                      SIM_SFR(0xBF803814UL)
+#define OC5RSET                      SIM_SFR(0xBF803818UL)
+#define OC5RINV                      SIM_SFR(0xBF80381CUL)
+#define OC5RS                        SIM_SFR(0xBF803820UL)
+#define OC5RSCLR                     SIM_SFR(0xBF803824UL)
+#define OC5RSSET                     SIM_SFR(0xBF803828UL)
+#define OC5RSINV                     SIM_SFR(0xBF80382CUL)
+#define _OC1CON_OCM_POSITION                 0x00000000
+#define _OC1CON_OCM_MASK                     0x00000007
+#define _OC1CON_OCM_LENGTH                   0x00000003
+#define _OC1CON_OCTSEL_POSITION              0x00000003
+#define _OC1CON_OCTSEL_MASK                  0x00000008
+#define _OC1CON_OCTSEL_LENGTH                0x00000001
+#define _OC1CON_OCFLT_POSITION               0x00000004
+#define _OC1CON_OCFLT_MASK                   0x00000010
+#define _OC1CON_OCFLT_LENGTH                 0x00000001
+#define _OC1CON_OC32_POSITION                0x00000005
+#define _OC1CON_OC32_MASK                    0x00000020
+#define _OC1CON_OC32_LENGTH                  0x00000001
+#define _OC1CON_SIDL_POSITION                0x0000000D
+#define _OC1CON_SIDL_MASK                    0x00002000
+#define _OC1CON_SIDL_LENGTH                  0x00000001
+#define _OC1CON_ON_POSITION                  0x0000000F
+#define _OC1CON_ON_MASK                      0x00008000
+#define _OC1CON_ON_LENGTH                    0x00000001
+
+/*******************************************************************************
+ * I2C
+ ******************************************************************************/
+#define _I2C1_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805300UL)
+#define I2C1CON                      SIM_SFR(0xBF805300UL)
+#define I2C1CONCLR                   SIM_SFR(0xBF805304UL)
+#define I2C1CONSET                   SIM_SFR(0xBF805308UL)
+#define I2C1CONINV                   SIM_SFR(0xBF80530CUL)
+#define I2C1STAT                     SIM_SFR(0xBF805310UL)
+#define I2C1STATCLR                  SIM_SFR(0xBF805314UL)
+#define I2C1STATSET                  SIM_SFR(0xBF805318UL)
+#define I2C1STATINV                  SIM_SFR(0xBF80531CUL)
+#define I2C1ADD                      SIM_SFR(0xBF805320UL)
+#define I2C1ADDCLR                   SIM_SFR(0xBF805324UL)
+#define I2C1ADDSET                   SIM_SFR(0xBF805328UL)
+#define I2C1ADDINV                   SIM_SFR(0xBF80532CUL)
+#define I2C1MSK                      SIM_SFR(0xBF805330UL)
+#define I2C1MSKCLR                   SIM_SFR(0xBF805334UL)
+#define I2C1MSKSET                   SIM_SFR(0xBF805338UL)
+#define I2C1MSKINV                   SIM_SFR(0xBF80533CUL)
+#define I2C1BRG                      SIM_SFR(0xBF805340UL)
+#define I2C1BRGCLR                   SIM_SFR(0xBF805344UL)
+#define I2C1BRGSET                   SIM_SFR(0xBF805348UL)
+#define I2C1BRGINV                   SIM_SFR(0xBF80534CUL)
+#define I2C1TRN                      SIM_SFR(0xBF805350UL)
+#define I2C1TRNCLR                   SIM_SFR(0xBF805354UL)
+#define I2C1TRNSET                   SIM_SFR(0xBF805358UL)
+#define I2C1TRNINV                   SIM_SFR(0xBF80535CUL)
+#define I2C1RCV                      SIM_SFR(0xBF805360UL)
+#define _I2C2_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805400UL)
+#define I2C2CON                      SIM_SFR(0xBF805400UL)
+#define I2C2CONCLR                   SIM_SFR(0xBF805404UL)
+#define I2C2CONSET                   SIM_SFR(0xBF805408UL)
+#define I2C2CONINV                   SIM_SFR(0xBF80540CUL)
+#define I2C2STAT                     SIM_SFR(0xBF805410UL)
+#define I2C2STATCLR                  SIM_SFR(0xBF805414UL)
+#define I2C2STATSET                  SIM_SFR(0xBF805418UL)
+#define I2C2STATINV                  SIM_SFR(0xBF80541CUL)
+#define I2C2ADD                      SIM_SFR(0xBF805420UL)
+#define I2C2ADDCLR                   SIM_SFR(0xBF805424UL)
+#define I2C2ADDSET                   SIM_SFR(0xBF805428UL)
+#define I2C2ADDINV                   SIM_SFR(0xBF80542CUL)
+#define I2C2MSK                      SIM_SFR(0xBF805430UL)
+#define I2C2MSKCLR                   SIM_SFR(0xBF805434UL)
+#define I2C2MSKSET                   SIM_SFR(0xBF805438UL)
+#define I2C2MSKINV                   SIM_SFR(0xBF80543CUL)
+#define I2C2BRG                      SIM_SFR(0xBF805440UL)
+#define I2C2BRGCLR                   SIM_SFR(0xBF805444UL)
+#define I2C2BRGSET                   SIM_SFR(0xBF805448UL)
+#define I2C2BRGINV                   SIM_SFR(0xBF80544CUL)
+#define I2C2TRN                      SIM_SFR(0xBF805450UL)
+#define I2C2TRNCLR                   SIM_SFR(0xBF805454UL)
+#define I2C2TRNSET                   SIM_SFR(0xBF805458UL)
+#define I2C2TRNINV                   SIM_SFR(0xBF80545CUL)
+#define I2C2RCV                      SIM_SFR(0xBF805460UL)
+#define _I2C3_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805000UL)
+#define I2C3CON                      SIM_SFR(0xBF805000UL)
+#define I2C3CONCLR                   SIM_SFR(0xBF805004UL)
+#define I2C3CONSET                   SIM_SFR(0xBF805008UL)
+#define I2C3CONINV                   SIM_SFR(0xBF80500CUL)
+#define I2C3STAT                     SIM_SFR(0xBF805010UL)
+#define I2C3STATCLR                  SIM_SFR(0xBF805014UL)
+#define I2C3STATSET                  SIM_SFR(0xBF805018UL)
+#define I2C3STATINV                  SIM_SFR(0xBF80501CUL)
+#define I2C3ADD                      SIM_SFR(0xBF805020UL)
+#define I2C3ADDCLR                   SIM_SFR(0xBF805024UL)
+#define I2C3ADDSET                   SIM_SFR(0xBF805028UL)
+#define I2C3ADDINV                   SIM_SFR(0xBF80502CUL)
+#define I2C3MSK                      SIM_SFR(0xBF805030UL)
+#define I2C3MSKCLR                   SIM_SFR(0xBF805034UL)
+#define I2C3MSKSET                   SIM_SFR(0xBF805038UL)
+#define I2C3MSKINV                   SIM_SFR(0xBF80503CUL)
+#define I2C3BRG                      SIM_SFR(0xBF805040UL)
+#define I2C3BRGCLR                   SIM_SFR(0xBF805044UL)
+#define I2C3BRGSET                   SIM_SFR(0xBF805048UL)
+#define I2C3BRGINV                   SIM_SFR(0xBF80504CUL)
+#define I2C3TRN                      SIM_SFR(0xBF805050UL)
+#define I2C3TRNCLR                   SIM_SFR(0xBF805054UL)
+#define I2C3TRNSET                   SIM_SFR(0xBF805058UL)
+#define I2C3TRNINV                   SIM_SFR(0xBF80505CUL)
+#define I2C3RCV                      SIM_SFR(0xBF805060UL)
+#define _I2C4_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805100UL)
+#define I2C4CON                      SIM_SFR(0xBF805100UL)
+#define I2C4CONCLR                   SIM_SFR(0xBF805104UL)
+#define I2C4CONSET                   SIM_SFR(0xBF805108UL)
+#define I2C4CONINV                   SIM_SFR(0xBF80510CUL)
+#define I2C4STAT                     SIM_SFR(0xBF805110UL)
+#define I2C4STATCLR                  SIM_SFR(0xBF805114UL)
+#define I2C4STATSET                  SIM_SFR(0xBF805118UL)
+#define I2C4STATINV                  SIM_SFR(0xBF80511CUL)
+#define I2C4ADD                      SIM_SFR(0xBF805120UL)
+#define I2C4ADDCLR                   SIM_SFR(0xBF805124UL)
+#define I2C4ADDSET                   SIM_SFR(0xBF805128UL)
+#define I2C4ADDINV                   SIM_SFR(0xBF80512CUL)
+#define I2C4MSK                      SIM_SFR(0xBF805130UL)
+#define I2C4MSKCLR                   SIM_SFR(0xBF805134UL)
+#define I2C4MSKSET                   SIM_SFR(0xBF805138UL)
+#define I2C4MSKINV                   SIM_SFR(0xBF80513CUL)
+#define I2C4BRG                      SIM_SFR(0xBF805140UL)
+#define I2C4BRGCLR                   SIM_SFR(0xBF805144UL)
+#define I2C4BRGSET                   SIM_SFR(0xBF805148UL)
+#define I2C4BRGINV                   SIM_SFR(0xBF80514CUL)
+#define I2C4TRN                      SIM_SFR(0xBF805150UL)
+#define I2C4TRNCLR                   SIM_SFR(0xBF805154UL)
+#define I2C4TRNSET                   SIM_SFR(0xBF805158UL)
+#define I2C4TRNINV                   SIM_SFR(0xBF80515CUL)
+#define I2C4RCV                      SIM_SFR(0xBF805160UL)
+#define _I2C5_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805200UL)
+#define I2C5CON                      SIM_SFR(0xBF805200UL)
+#define I2C5CONCLR                   SIM_SFR(0xBF805204UL)
+#define I2C5CONSET                   SIM_SFR(0xBF805208UL)
+#define I2C5CONINV                   SIM_SFR(0xBF80520CUL)
+#define I2C5STAT                     SIM_SFR(0xBF805210UL)
+#define I2C5STATCLR                  SIM_SFR(0xBF805214UL)
+#define I2C5STATSET                  SIM_SFR(0xBF805218UL)
+#define I2C5STATINV                  SIM_SFR(0xBF80521CUL)
+#define I2C5ADD                      SIM_SFR(0xBF805220UL)
+#define I2C5ADDCLR                   SIM_SFR(0xBF805224UL)
+#define I2C5ADDSET                   SIM_SFR(0xBF805228UL)
+#define I2C5ADDINV                   SIM_SFR(0xBF80522CUL)
+#define I2C5MSK                      SIM_SFR(0xBF805230UL)
+#define I2C5MSKCLR                   SIM_SFR(0xBF805234UL)
+#define I2C5MSKSET                   SIM_SFR(0xBF805238UL)
+#define I2C5MSKINV                   SIM_SFR(0xBF80523CUL)
+#define I2C5BRG                      SIM_SFR(0xBF805240UL)
+#define I2C5BRGCLR                   SIM_SFR(0xBF805244UL)
+#define I2C5BRGSET                   SIM_SFR(0xBF805248UL)
+#define I2C5BRGINV                   SIM_SFR(0xBF80524CUL)
+#define I2C5TRN                      SIM_SFR(0xBF805250UL)
+#define I2C5TRNCLR                   SIM_SFR(0xBF805254UL)
+#define I2C5TRNSET                   SIM_SFR(0xBF805258UL)
+#define I2C5TRNINV                   SIM_SFR(0xBF80525CUL)
+#define I2C5RCV                      SIM_SFR(0xBF805260UL)
+#define _I2C1CON_SEN_POSITION                0x00000000
+#define _I2C1CON_SEN_MASK                    0x00000001
+#define _I2C1CON_SEN_LENGTH                  0x00000001
+#define _I2C1CON_RSEN_POSITION               0x00000001
+#define _I2C1CON_RSEN_MASK                   0x00000002
+#define _I2C1CON_RSEN_LENGTH                 0x00000001
+#define _I2C1CON_PEN_POSITION                0x00000002
+#define _I2C1CON_PEN_MASK                    0x00000004
+#define _I2C1CON_PEN_LENGTH                  0x00000001
+#define _I2C1CON_RCEN_POSITION               0x00000003
+#define _I2C1CON_RCEN_MASK                   0x00000008
+#define _I2C1CON_RCEN_LENGTH                 0x00000001
+#define _I2C1CON_ACKEN_POSITION              0x00000004
+#define _I2C1CON_ACKEN_MASK                  0x00000010
+#define _I2C1CON_ACKEN_LENGTH                0x00000001
+#define _I2C1CON_ACKDT_POSITION              0x00000005
+#define _I2C1CON_ACKDT_MASK                  0x00000020
+#define _I2C1CON_ACKDT_LENGTH                0x00000001
+#define _I2C1CON_STREN_POSITION              0x00000006
+#define _I2C1CON_STREN_MASK                  0x00000040
+#define _I2C1CON_STREN_LENGTH                0x00000001
+#define _I2C1CON_GCEN_POSITION               0x00000007
+#define _I2C1CON_GCEN_MASK                   0x00000080
+#define _I2C1CON_GCEN_LENGTH                 0x00000001
+#define _I2C1CON_SMEN_POSITION               0x00000008
+#define _I2C1CON_SMEN_MASK                   0x00000100
+#define _I2C1CON_SMEN_LENGTH                 0x00000001
+#define _I2C1CON_DISSLW_POSITION             0x00000009
+#define _I2C1CON_DISSLW_MASK                 0x00000200
+#define _I2C1CON_DISSLW_LENGTH               0x00000001
+#define _I2C1CON_A10M_POSITION               0x0000000A
+#define _I2C1CON_A10M_MASK                   0x00000400
+#define _I2C1CON_A10M_LENGTH                 0x00000001
+#define _I2C1CON_STRICT_POSITION             0x0000000B
+#define _I2C1CON_STRICT_MASK                 0x00000800
+#define _I2C1CON_STRICT_LENGTH               0x00000001
+#define _I2C1CON_SCLREL_POSITION             0x0000000C
+#define _I2C1CON_SCLREL_MASK                 0x00001000
+#define _I2C1CON_SCLREL_LENGTH               0x00000001
+#define _I2C1CON_SIDL_POSITION               0x0000000D
+#define _I2C1CON_SIDL_MASK                   0x00002000
+#define _I2C1CON_SIDL_LENGTH                 0x00000001
+#define _I2C1CON_ON_POSITION                 0x0000000F
+#define _I2C1CON_ON_MASK                     0x00008000
+#define _I2C1CON_ON_LENGTH                   0x00000001
+#define _I2C1STAT_TBF_POSITION               0x00000000
+#define _I2C1STAT_TBF_MASK                   0x00000001
+#define _I2C1STAT_TBF_LENGTH                 0x00000001
+#define _I2C1STAT_RBF_POSITION               0x00000001
+#define _I2C1STAT_RBF_MASK                   0x00000002
+#define _I2C1STAT_RBF_LENGTH                 0x00000001
+#define _I2C1STAT_R_W_POSITION               0x00000002
+#define _I2C1STAT_R_W_MASK                   0x00000004
+#define _I2C1STAT_R_W_LENGTH                 0x00000001
+#define _I2C1STAT_S_POSITION                 0x00000003
+#define _I2C1STAT_S_MASK                     0x00000008
+#define _I2C1STAT_S_LENGTH                   0x00000001
+#define _I2C1STAT_P_POSITION                 0x00000004
+#define _I2C1STAT_P_MASK                     0x00000010
+#define _I2C1STAT_P_LENGTH                   0x00000001
+#define _I2C1STAT_D_A_POSITION               0x00000005
+#define _I2C1STAT_D_A_MASK                   0x00000020
+#define _I2C1STAT_D_A_LENGTH                 0x00000001
+#define _I2C1STAT_I2COV_POSITION             0x00000006
+#define _I2C1STAT_I2COV_MASK                 0x00000040
+#define _I2C1STAT_I2COV_LENGTH               0x00000001
+#define _I2C1STAT_IWCOL_POSITION             0x00000007
+#define _I2C1STAT_IWCOL_MASK                 0x00000080
+#define _I2C1STAT_IWCOL_LENGTH               0x00000001
+#define _I2C1STAT_ADD10_POSITION             0x00000008
+#define _I2C1STAT_ADD10_MASK                 0x00000100
+#define _I2C1STAT_ADD10_LENGTH               0x00000001
+#define _I2C1STAT_GCSTAT_POSITION            0x00000009
+#define _I2C1STAT_GCSTAT_MASK                0x00000200
+#define _I2C1STAT_GCSTAT_LENGTH              0x00000001
+#define _I2C1STAT_BCL_POSITION               0x0000000A
+#define _I2C1STAT_BCL_MASK                   0x00000400
+#define _I2C1STAT_BCL_LENGTH                 0x00000001
+#define _I2C1STAT_TRSTAT_POSITION            0x0000000E
+#define _I2C1STAT_TRSTAT_MASK                0x00004000
+#define _I2C1STAT_TRSTAT_LENGTH              0x00000001
+#define _I2C1STAT_ACKSTAT_POSITION           0x0000000F
+#define _I2C1STAT_ACKSTAT_MASK               0x00008000
+#define _I2C1STAT_ACKSTAT_LENGTH             0x00000001
+
+/*******************************************************************************
+ * SPI
+ ******************************************************************************/
+#define _SPI1_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805E00UL)
+#define SPI1CON                      SIM_SFR(0xBF805E00UL)
+#define SPI1CONCLR                   SIM_SFR(0xBF805E04UL)
+#define SPI1CONSET                   SIM_SFR(0xBF805E08UL)
+#define SPI1CONINV                   SIM_SFR(0xBF805E0CUL)
+#define SPI1STAT                     SIM_SFR(0xBF805E10UL)
+#define SPI1STATCLR                  SIM_SFR(0xBF805E14UL)
+#define SPI1STATSET                  SIM_SFR(0xBF805E18UL)
+#define SPI1STATINV                  SIM_SFR(0xBF805E1CUL)
+#define SPI1BUF                      SIM_SFR(0xBF805E20UL)
+#define SPI1BRG                      SIM_SFR(0xBF805E30UL)
+#define SPI1BRGCLR                   SIM_SFR(0xBF805E34UL)
+#define SPI1BRGSET                   SIM_SFR(0xBF805E38UL)
+#define SPI1BRGINV                   SIM_SFR(0xBF805E3CUL)
+#define SPI1CON2                     SIM_SFR(0xBF805E40UL)
+#define SPI1CON2CLR                  SIM_SFR(0xBF805E44UL)
+#define SPI1CON2SET                  SIM_SFR(0xBF805E48UL)
+#define SPI1CON2INV                  SIM_SFR(0xBF805E4CUL)
+#define _SPI2_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805A00UL)
+#define SPI2CON                      SIM_SFR(0xBF805A00UL)
+#define SPI2CONCLR                   SIM_SFR(0xBF805A04UL)
+#define SPI2CONSET                   SIM_SFR(0xBF805A08UL)
+#define SPI2CONINV                   SIM_SFR(0xBF805A0CUL)
+#define SPI2STAT                     SIM_SFR(0xBF805A10UL)
+#define SPI2STATCLR                  SIM_SFR(0xBF805A14UL)
+#define SPI2STATSET                  SIM_SFR(0xBF805A18UL)
+#define SPI2STATINV                  SIM_SFR(0xBF805A1CUL)
+#define SPI2BUF                      SIM_SFR(0xBF805A20UL)
+#define SPI2BRG                      SIM_SFR(0xBF805A30UL)
+#define SPI2BRGCLR                   SIM_SFR(0xBF805A34UL)
+#define SPI2BRGSET                   SIM_SFR(0xBF805A38UL)
+#define SPI2BRGINV                   SIM_SFR(0xBF805A3CUL)
+#define SPI2CON2                     SIM_SFR(0xBF805A40UL)
+#define SPI2CON2CLR                  SIM_SFR(0xBF805A44UL)
+#define SPI2CON2SET                  SIM_SFR(0xBF805A48UL)
+#define SPI2CON2INV                  SIM_SFR(0xBF805A4CUL)
+#define _SPI3_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805800UL)
+#define SPI3CON                      SIM_SFR(0xBF805800UL)
+#define SPI3CONCLR                   SIM_SFR(0xBF805804UL)
+#define SPI3CONSET                   SIM_SFR(0xBF805808UL)
+#define SPI3CONINV                   SIM_SFR(0xBF80580CUL)
+#define SPI3STAT                     SIM_SFR(0xBF805810UL)
+#define SPI3STATCLR                  SIM_SFR(0xBF805814UL)
+#define SPI3STATSET                  SIM_SFR(0xBF805818UL)
+#define SPI3STATINV                  SIM_SFR(0xBF80581CUL)
+#define SPI3BUF                      SIM_SFR(0xBF805820UL)
+#define SPI3BRG                      SIM_SFR(0xBF805830UL)
+#define SPI3BRGCLR                   SIM_SFR(0xBF805834UL)
+#define SPI3BRGSET                   SIM_SFR(0xBF805838UL)
+#define SPI3BRGINV                   SIM_SFR(0xBF80583CUL)
+#define SPI3CON2                     SIM_SFR(0xBF805840UL)
+#define SPI3CON2CLR                  SIM_SFR(0xBF805844UL)
+#define SPI3CON2SET                  SIM_SFR(0xBF805848UL)
+#define SPI3CON2INV                  SIM_SFR(0xBF80584CUL)
+#define _SPI4_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF805C00UL)
+#define SPI4CON                      SIM_SFR(0xBF805C00UL)
+#define SPI4CONCLR                   SIM_SFR(0xBF805C04UL)
+#define SPI4CONSET                   SIM_SFR(0xBF805C08UL)
+#define SPI4CONINV                   SIM_SFR(0xBF805C0CUL)
+#define SPI4STAT                     SIM_SFR(0xBF805C10UL)
+#define SPI4STATCLR                  SIM_SFR(0xBF805C14UL)
+#define SPI4STATSET                  SIM_SFR(0xBF805C18UL)
+#define SPI4STATINV                  SIM_SFR(0xBF805C1CUL)
+#define SPI4BUF                      SIM_SFR(0xBF805C20UL)
+#define SPI4BRG                      SIM_SFR(0xBF805C30UL)
+#define SPI4BRGCLR                   SIM_SFR(0xBF805C34UL)
+#define SPI4BRGSET                   SIM_SFR(0xBF805C38UL)
+#define SPI4BRGINV                   SIM_SFR(0xBF805C3CUL)
+#define SPI4CON2                     SIM_SFR(0xBF805C40UL)
+#define SPI4CON2CLR                  SIM_SFR(0xBF805C44UL)
+#define SPI4CON2SET                  SIM_SFR(0xBF805C48UL)
+#define SPI4CON2INV                  SIM_SFR(0xBF805C4CUL)
+#define _SPI1CON_SRXISEL_POSITION            0x00000000
+#define _SPI1CON_SRXISEL_MASK                0x00000003
+#define _SPI1CON_SRXISEL_LENGTH              0x00000002
+#define _SPI1CON_STXISEL_POSITION            0x00000002
+#define _SPI1CON_STXISEL_MASK                0x0000000C
+#define _SPI1CON_STXISEL_LENGTH              0x00000002
+#define _SPI1CON_DISSDI_POSITION             0x00000004
+#define _SPI1CON_DISSDI_MASK                 0x00000010
+#define _SPI1CON_DISSDI_LENGTH               0x00000001
+#define _SPI1CON_MSTEN_POSITION              0x00000005
+#define _SPI1CON_MSTEN_MASK                  0x00000020
+#define _SPI1CON_MSTEN_LENGTH                0x00000001
+#define _SPI1CON_CKP_POSITION                0x00000006
+#define _SPI1CON_CKP_MASK                    0x00000040
+#define _SPI1CON_CKP_LENGTH                  0x00000001
+#define _SPI1CON_SSEN_POSITION               0x00000007
+#define _SPI1CON_SSEN_MASK                   0x00000080
+#define _SPI1CON_SSEN_LENGTH                 0x00000001
+#define _SPI1CON_CKE_POSITION                0x00000008
+#define _SPI1CON_CKE_MASK                    0x00000100
+#define _SPI1CON_CKE_LENGTH                  0x00000001
+#define _SPI1CON_SMP_POSITION                0x00000009
+#define _SPI1CON_SMP_MASK                    0x00000200
+#define _SPI1CON_SMP_LENGTH                  0x00000001
+#define _SPI1CON_MODE16_POSITION             0x0000000A
+#define _SPI1CON_MODE16_MASK                 0x00000400
+#define _SPI1CON_MODE16_LENGTH               0x00000001
+#define _SPI1CON_MODE32_POSITION             0x0000000B
+#define _SPI1CON_MODE32_MASK                 0x00000800
+#define _SPI1CON_MODE32_LENGTH               0x00000001
+#define _SPI1CON_DISSDO_POSITION             0x0000000C
+#define _SPI1CON_DISSDO_MASK                 0x00001000
+#define _SPI1CON_DISSDO_LENGTH               0x00000001
+#define _SPI1CON_SIDL_POSITION               0x0000000D
+#define _SPI1CON_SIDL_MASK                   0x00002000
+#define _SPI1CON_SIDL_LENGTH                 0x00000001
+#define _SPI1CON_ON_POSITION                 0x0000000F
+#define _SPI1CON_ON_MASK                     0x00008000
+#define _SPI1CON_ON_LENGTH                   0x00000001
+#define _SPI1CON_ENHBUF_POSITION             0x00000010
+#define _SPI1CON_ENHBUF_MASK                 0x00010000
+#define _SPI1CON_ENHBUF_LENGTH               0x00000001
+#define _SPI1CON_SPIFE_POSITION              0x00000011
+#define _SPI1CON_SPIFE_MASK                  0x00020000
+#define _SPI1CON_SPIFE_LENGTH                0x00000001
+#define _SPI1CON_MCLKSEL_POSITION            0x00000017
+#define _SPI1CON_MCLKSEL_MASK                0x00800000
+#define _SPI1CON_MCLKSEL_LENGTH              0x00000001
+#define _SPI1CON_FRMCNT_POSITION             0x00000018
+#define _SPI1CON_FRMCNT_MASK                 0x07000000
+#define _SPI1CON_FRMCNT_LENGTH               0x00000003
+#define _SPI1CON_FRMSYPW_POSITION            0x0000001B
+#define _SPI1CON_FRMSYPW_MASK                0x08000000
+#define _SPI1CON_FRMSYPW_LENGTH              0x00000001
+#define _SPI1CON_MSSEN_POSITION              0x0000001C
+#define _SPI1CON_MSSEN_MASK                  0x10000000
+#define _SPI1CON_MSSEN_LENGTH                0x00000001
+#define _SPI1CON_FRMPOL_POSITION             0x0000001D
+#define _SPI1CON_FRMPOL_MASK                 0x20000000
+#define _SPI1CON_FRMPOL_LENGTH               0x00000001
+#define _SPI1CON_FRMSYNC_POSITION            0x0000001E
+#define _SPI1CON_FRMSYNC_MASK                0x40000000
+#define _SPI1CON_FRMSYNC_LENGTH              0x00000001
+#define _SPI1CON_FRMEN_POSITION              0x0000001F
+#define _SPI1CON_FRMEN_MASK                  0x80000000
+#define _SPI1CON_FRMEN_LENGTH                0x00000001
+#define _SPI2CON_SRXISEL_POSITION            0x00000000
+#define _SPI2CON_SRXISEL_MASK                0x00000003
+#define _SPI2CON_SRXISEL_LENGTH              0x00000002
+#define _SPI2CON_STXISEL_POSITION            0x00000002
+#define _SPI2CON_STXISEL_MASK                0x0000000C
+#define _SPI2CON_STXISEL_LENGTH              0x00000002
+#define _SPI2CON_DISSDI_POSITION             0x00000004
+#define _SPI2CON_DISSDI_MASK                 0x00000010
+#define _SPI2CON_DISSDI_LENGTH               0x00000001
+#define _SPI2CON_MSTEN_POSITION              0x00000005
+#define _SPI2CON_MSTEN_MASK                  0x00000020
+#define _SPI2CON_MSTEN_LENGTH                0x00000001
+#define _SPI2CON_CKP_POSITION                0x00000006
+#define _SPI2CON_CKP_MASK                    0x00000040
+#define _SPI2CON_CKP_LENGTH                  0x00000001
+#define _SPI2CON_SSEN_POSITION               0x00000007
+#define _SPI2CON_SSEN_MASK                   0x00000080
+#define _SPI2CON_SSEN_LENGTH                 0x00000001
+#define _SPI2CON_CKE_POSITION                0x00000008
+#define _SPI2CON_CKE_MASK                    0x00000100
+#define _SPI2CON_CKE_LENGTH                  0x00000001
+#define _SPI2CON_SMP_POSITION                0x00000009
+#define _SPI2CON_SMP_MASK                    0x00000200
+#define _SPI2CON_SMP_LENGTH                  0x00000001
+#define _SPI2CON_MODE16_POSITION             0x0000000A
+#define _SPI2CON_MODE16_MASK                 0x00000400
+#define _SPI2CON_MODE16_LENGTH               0x00000001
+#define _SPI2CON_MODE32_POSITION             0x0000000B
+#define _SPI2CON_MODE32_MASK                 0x00000800
+#define _SPI2CON_MODE32_LENGTH               0x00000001
+#define _SPI2CON_DISSDO_POSITION             0x0000000C
+#define _SPI2CON_DISSDO_MASK                 0x00001000
+#define _SPI2CON_DISSDO_LENGTH               0x00000001
+#define _SPI2CON_SIDL_POSITION               0x0000000D
+#define _SPI2CON_SIDL_MASK                   0x00002000
+#define _SPI2CON_SIDL_LENGTH                 0x00000001
+#define _SPI2CON_ON_POSITION                 0x0000000F
+#define _SPI2CON_ON_MASK                     0x00008000
+#define _SPI2CON_ON_LENGTH                   0x00000001
+#define _SPI2CON_ENHBUF_POSITION             0x00000010
+#define _SPI2CON_ENHBUF_MASK                 0x00010000
+#define _SPI2CON_ENHBUF_LENGTH               0x00000001
+#define _SPI2CON_SPIFE_POSITION              0x00000011
+#define _SPI2CON_SPIFE_MASK                  0x00020000
+#define _SPI2CON_SPIFE_LENGTH                0x00000001
+#define _SPI2CON_MCLKSEL_POSITION            0x00000017
+#define _SPI2CON_MCLKSEL_MASK                0x00800000
+#define _SPI2CON_MCLKSEL_LENGTH              0x00000001
+#define _SPI2CON_FRMCNT_POSITION             0x00000018
+#define _SPI2CON_FRMCNT_MASK                 0x07000000
+#define _SPI2CON_FRMCNT_LENGTH               0x00000003
+#define _SPI2CON_FRMSYPW_POSITION            0x0000001B
+#define _SPI2CON_FRMSYPW_MASK                0x08000000
+#define _SPI2CON_FRMSYPW_LENGTH              0x00000001
+#define _SPI2CON_MSSEN_POSITION              0x0000001C
+#define _SPI2CON_MSSEN_MASK                  0x10000000
+#define _SPI2CON_MSSEN_LENGTH                0x00000001
+#define _SPI2CON_FRMPOL_POSITION             0x0000001D
+#define _SPI2CON_FRMPOL_MASK                 0x20000000
+#define _SPI2CON_FRMPOL_LENGTH               0x00000001
+#define _SPI2CON_FRMSYNC_POSITION            0x0000001E
+#define _SPI2CON_FRMSYNC_MASK                0x40000000
+#define _SPI2CON_FRMSYNC_LENGTH              0x00000001
+#define _SPI2CON_FRMEN_POSITION              0x0000001F
+#define _SPI2CON_FRMEN_MASK                  0x80000000
+#define _SPI2CON_FRMEN_LENGTH                0x00000001
+#define _SPI3CON_SRXISEL_POSITION            0x00000000
+#define _SPI3CON_SRXISEL_MASK                0x00000003
+#define _SPI3CON_SRXISEL_LENGTH              0x00000002
+#define _SPI3CON_STXISEL_POSITION            0x00000002
+#define _SPI3CON_STXISEL_MASK                0x0000000C
+#define _SPI3CON_STXISEL_LENGTH              0x00000002
+#define _SPI3CON_DISSDI_POSITION             0x00000004
+#define _SPI3CON_DISSDI_MASK                 0x00000010
+#define _SPI3CON_DISSDI_LENGTH               0x00000001
+#define _SPI3CON_MSTEN_POSITION              0x00000005
+#define _SPI3CON_MSTEN_MASK                  0x00000020
+#define _SPI3CON_MSTEN_LENGTH                0x00000001
+#define _SPI3CON_CKP_POSITION                0x00000006
+#define _SPI3CON_CKP_MASK                    0x00000040
+#define _SPI3CON_CKP_LENGTH                  0x00000001
+#define _SPI3CON_SSEN_POSITION               0x00000007
+#define _SPI3CON_SSEN_MASK                   0x00000080
+#define _SPI3CON_SSEN_LENGTH                 0x00000001
+#define _SPI3CON_CKE_POSITION                0x00000008
+#define _SPI3CON_CKE_MASK                    0x00000100
+#define _SPI3CON_CKE_LENGTH                  0x00000001
+#define _SPI3CON_SMP_POSITION                0x00000009
+#define _SPI3CON_SMP_MASK                    0x00000200
+#define _SPI3CON_SMP_LENGTH                  0x00000001
+#define _SPI3CON_MODE16_POSITION             0x0000000A
+#define _SPI3CON_MODE16_MASK                 0x00000400
+#define _SPI3CON_MODE16_LENGTH               0x00000001
+#define _SPI3CON_MODE32_POSITION             0x0000000B
+#define _SPI3CON_MODE32_MASK                 0x00000800
+#define _SPI3CON_MODE32_LENGTH               0x00000001
+#define _SPI3CON_DISSDO_POSITION             0x0000000C
+#define _SPI3CON_DISSDO_MASK                 0x00001000
+#define _SPI3CON_DISSDO_LENGTH               0x00000001
+#define _SPI3CON_SIDL_POSITION               0x0000000D
+#define _SPI3CON_SIDL_MASK                   0x00002000
+#define _SPI3CON_SIDL_LENGTH                 0x00000001
+#define _SPI3CON_ON_POSITION                 0x0000000F
+#define _SPI3CON_ON_MASK                     0x00008000
+#define _SPI3CON_ON_LENGTH                   0x00000001
+#define _SPI3CON_ENHBUF_POSITION             0x00000010
+#define _SPI3CON_ENHBUF_MASK                 0x00010000
+#define _SPI3CON_ENHBUF_LENGTH               0x00000001
+#define _SPI3CON_SPIFE_POSITION              0x00000011
+#define _SPI3CON_SPIFE_MASK                  0x00020000
+#define _SPI3CON_SPIFE_LENGTH                0x00000001
+#define _SPI3CON_MCLKSEL_POSITION            0x00000017
+#define _SPI3CON_MCLKSEL_MASK                0x00800000
+#define _SPI3CON_MCLKSEL_LENGTH              0x00000001
+#define _SPI3CON_FRMCNT_POSITION             0x00000018
+#define _SPI3CON_FRMCNT_MASK                 0x07000000
+#define _SPI3CON_FRMCNT_LENGTH               0x00000003
+#define _SPI3CON_FRMSYPW_POSITION            0x0000001B
+#define _SPI3CON_FRMSYPW_MASK                0x08000000
+#define _SPI3CON_FRMSYPW_LENGTH              0x00000001
+#define _SPI3CON_MSSEN_POSITION              0x0000001C
+#define _SPI3CON_MSSEN_MASK                  0x10000000
+#define _SPI3CON_MSSEN_LENGTH                0x00000001
+#define _SPI3CON_FRMPOL_POSITION             0x0000001D
+#define _SPI3CON_FRMPOL_MASK                 0x20000000
+#define _SPI3CON_FRMPOL_LENGTH               0x00000001
+#define _SPI3CON_FRMSYNC_POSITION            0x0000001E
+#define _SPI3CON_FRMSYNC_MASK                0x40000000
+#define _SPI3CON_FRMSYNC_LENGTH              0x00000001
+#define _SPI3CON_FRMEN_POSITION              0x0000001F
+#define _SPI3CON_FRMEN_MASK                  0x80000000
+#define _SPI3CON_FRMEN_LENGTH                0x00000001
+#define _SPI4CON_SRXISEL_POSITION            0x00000000
+#define _SPI4CON_SRXISEL_MASK                0x00000003
+#define _SPI4CON_SRXISEL_LENGTH              0x00000002
+#define _SPI4CON_STXISEL_POSITION            0x00000002
+#define _SPI4CON_STXISEL_MASK                0x0000000C
+#define _SPI4CON_STXISEL_LENGTH              0x00000002
+#define _SPI4CON_DISSDI_POSITION             0x00000004
+#define _SPI4CON_DISSDI_MASK                 0x00000010
+#define _SPI4CON_DISSDI_LENGTH               0x00000001
+#define _SPI4CON_MSTEN_POSITION              0x00000005
+#define _SPI4CON_MSTEN_MASK                  0x00000020
+#define _SPI4CON_MSTEN_LENGTH                0x00000001
+#define _SPI4CON_CKP_POSITION                0x00000006
+#define _SPI4CON_CKP_MASK                    0x00000040
+#define _SPI4CON_CKP_LENGTH                  0x00000001
+#define _SPI4CON_SSEN_POSITION               0x00000007
+#define _SPI4CON_SSEN_MASK                   0x00000080
+#define _SPI4CON_SSEN_LENGTH                 0x00000001
+#define _SPI4CON_CKE_POSITION                0x00000008
+#define _SPI4CON_CKE_MASK                    0x00000100
+#define _SPI4CON_CKE_LENGTH                  0x00000001
+#define _SPI4CON_SMP_POSITION                0x00000009
+#define _SPI4CON_SMP_MASK                    0x00000200
+#define _SPI4CON_SMP_LENGTH                  0x00000001
+#define _SPI4CON_MODE16_POSITION             0x0000000A
+#define _SPI4CON_MODE16_MASK                 0x00000400
+#define _SPI4CON_MODE16_LENGTH               0x00000001
+#define _SPI4CON_MODE32_POSITION             0x0000000B
+#define _SPI4CON_MODE32_MASK                 0x00000800
+#define _SPI4CON_MODE32_LENGTH               0x00000001
+#define _SPI4CON_DISSDO_POSITION             0x0000000C
+#define _SPI4CON_DISSDO_MASK                 0x00001000
+#define _SPI4CON_DISSDO_LENGTH               0x00000001
+#define _SPI4CON_SIDL_POSITION               0x0000000D
+#define _SPI4CON_SIDL_MASK                   0x00002000
+#define _SPI4CON_SIDL_LENGTH                 0x00000001
+#define _SPI4CON_ON_POSITION                 0x0000000F
+#define _SPI4CON_ON_MASK                     0x00008000
+#define _SPI4CON_ON_LENGTH                   0x00000001
+#define _SPI4CON_ENHBUF_POSITION             0x00000010
+#define _SPI4CON_ENHBUF_MASK                 0x00010000
+#define _SPI4CON_ENHBUF_LENGTH               0x00000001
+#define _SPI4CON_SPIFE_POSITION              0x00000011
+#define _SPI4CON_SPIFE_MASK                  0x00020000
+#define _SPI4CON_SPIFE_LENGTH                0x00000001
+#define _SPI4CON_MCLKSEL_POSITION            0x00000017
+#define _SPI4CON_MCLKSEL_MASK                0x00800000
+#define _SPI4CON_MCLKSEL_LENGTH              0x00000001
+#define _SPI4CON_FRMCNT_POSITION             0x00000018
+#define _SPI4CON_FRMCNT_MASK                 0x07000000
+#define _SPI4CON_FRMCNT_LENGTH               0x00000003
+#define _SPI4CON_FRMSYPW_POSITION            0x0000001B
+#define _SPI4CON_FRMSYPW_MASK                0x08000000
+#define _SPI4CON_FRMSYPW_LENGTH              0x00000001
+#define _SPI4CON_MSSEN_POSITION              0x0000001C
+#define _SPI4CON_MSSEN_MASK                  0x10000000
+#define _SPI4CON_MSSEN_LENGTH                0x00000001
+#define _SPI4CON_FRMPOL_POSITION             0x0000001D
+#define _SPI4CON_FRMPOL_MASK                 0x20000000
+#define _SPI4CON_FRMPOL_LENGTH               0x00000001
+#define _SPI4CON_FRMSYNC_POSITION            0x0000001E
+#define _SPI4CON_FRMSYNC_MASK                0x40000000
+#define _SPI4CON_FRMSYNC_LENGTH              0x00000001
+#define _SPI4CON_FRMEN_POSITION              0x0000001F
+#define _SPI4CON_FRMEN_MASK                  0x80000000
+#define _SPI4CON_FRMEN_LENGTH                0x00000001
+#define _SPI1STAT_SPIRBF_POSITION            0x00000000
+#define _SPI1STAT_SPIRBF_MASK                0x00000001
+#define _SPI1STAT_SPIRBF_LENGTH              0x00000001
+#define _SPI1STAT_SPITBF_POSITION            0x00000001
+#define _SPI1STAT_SPITBF_MASK                0x00000002
+#define _SPI1STAT_SPITBF_LENGTH              0x00000001
+#define _SPI1STAT_SPITBE_POSITION            0x00000003
+#define _SPI1STAT_SPITBE_MASK                0x00000008
+#define _SPI1STAT_SPITBE_LENGTH              0x00000001
+#define _SPI1STAT_SPIRBE_POSITION            0x00000005
+#define _SPI1STAT_SPIRBE_MASK                0x00000020
+#define _SPI1STAT_SPIRBE_LENGTH              0x00000001
+#define _SPI1STAT_SPIROV_POSITION            0x00000006
+#define _SPI1STAT_SPIROV_MASK                0x00000040
+#define _SPI1STAT_SPIROV_LENGTH              0x00000001
+#define _SPI1STAT_SRMT_POSITION              0x00000007
+#define _SPI1STAT_SRMT_MASK                  0x00000080
+#define _SPI1STAT_SRMT_LENGTH                0x00000001
+#define _SPI1STAT_SPITUR_POSITION            0x00000008
+#define _SPI1STAT_SPITUR_MASK                0x00000100
+#define _SPI1STAT_SPITUR_LENGTH              0x00000001
+#define _SPI1STAT_SPIBUSY_POSITION           0x0000000B
+#define _SPI1STAT_SPIBUSY_MASK               0x00000800
+#define _SPI1STAT_SPIBUSY_LENGTH             0x00000001
+#define _SPI1STAT_TXBUFELM_POSITION          0x00000010
+#define _SPI1STAT_TXBUFELM_MASK              0x001F0000
+#define _SPI1STAT_TXBUFELM_LENGTH            0x00000005
+#define _SPI1STAT_RXBUFELM_POSITION          0x00000018
+#define _SPI1STAT_RXBUFELM_MASK              0x1F000000
+#define _SPI1STAT_RXBUFELM_LENGTH            0x00000005
+
+/*******************************************************************************
+ * UART
+ ******************************************************************************/
+#define _UART1_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF806000UL)
+#define U1MODE                       SIM_SFR(0xBF806000UL)
+#define U1MODECLR                    SIM_SFR(0xBF806004UL)
+#define U1MODESET                    SIM_SFR(0xBF806008UL)
+#define U1MODEINV                    SIM_SFR(0xBF80600CUL)
+#define U1STA                        SIM_SFR(0xBF806010UL)
+#define U1STACLR                     SIM_SFR(0xBF806014UL)
+#define U1STASET                     SIM_SFR(0xBF806018UL)
+#define U1STAINV                     SIM_SFR(0xBF80601CUL)
+#define U1TXREG                      SIM_SFR(0xBF806020UL)
+#define U1RXREG                      SIM_SFR(0xBF806030UL)
+#define U1BRG                        SIM_SFR(0xBF806040UL)
+#define U1BRGCLR                     SIM_SFR(0xBF806044UL)
+#define U1BRGSET                     SIM_SFR(0xBF806048UL)
+#define U1BRGINV                     SIM_SFR(0xBF80604CUL)
+#define _UART2_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF806800UL)
+#define U2MODE                       SIM_SFR(0xBF806800UL)
+#define U2MODECLR                    SIM_SFR(0xBF806804UL)
+#define U2MODESET                    SIM_SFR(0xBF806808UL)
+#define U2MODEINV                    SIM_SFR(0xBF80680CUL)
+#define U2STA                        SIM_SFR(0xBF806810UL)
+#define U2STACLR                     SIM_SFR(0xBF806814UL)
+#define U2STASET                     SIM_SFR(0xBF806818UL)
+#define U2STAINV                     SIM_SFR(0xBF80681CUL)
+#define U2TXREG                      SIM_SFR(0xBF806820UL)
+#define U2RXREG                      SIM_SFR(0xBF806830UL)
+#define U2BRG                        SIM_SFR(0xBF806840UL)
+#define U2BRGCLR                     SIM_SFR(0xBF806844UL)
+#define U2BRGSET                     SIM_SFR(0xBF806848UL)
+#define U2BRGINV                     SIM_SFR(0xBF80684CUL)
+#define _UART3_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF806400UL)
+#define U3MODE                       SIM_SFR(0xBF806400UL)
+#define U3MODECLR                    SIM_SFR(0xBF806404UL)
+#define U3MODESET                    SIM_SFR(0xBF806408UL)
+#define U3MODEINV                    SIM_SFR(0xBF80640CUL)
+#define U3STA                        SIM_SFR(0xBF806410UL)
+#define U3STACLR                     SIM_SFR(0xBF806414UL)
+#define U3STASET                     SIM_SFR(0xBF806418UL)
+#define U3STAINV                     SIM_SFR(0xBF80641CUL)
+#define U3TXREG                      SIM_SFR(0xBF806420UL)
+#define U3RXREG                      SIM_SFR(0xBF806430UL)
+#define U3BRG                        SIM_SFR(0xBF806440UL)
+#define U3BRGCLR                     SIM_SFR(0xBF806444UL)
+#define U3BRGSET                     SIM_SFR(0xBF806448UL)
+#define U3BRGINV                     SIM_SFR(0xBF80644CUL)
+#define _UART4_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF806200UL)
+#define U4MODE                       SIM_SFR(0xBF806200UL)
+#define U4MODECLR                    SIM_SFR(0xBF806204UL)
+#define U4MODESET                    SIM_SFR(0xBF806208UL)
+#define U4MODEINV                    SIM_SFR(0xBF80620CUL)
+#define U4STA                        SIM_SFR(0xBF806210UL)
+#define U4STACLR                     SIM_SFR(0xBF806214UL)
+#define U4STASET                     SIM_SFR(0xBF806218UL)
+#define U4STAINV                     SIM_SFR(0xBF80621CUL)
+#define U4TXREG                      SIM_SFR(0xBF806220UL)
+#define U4RXREG                      SIM_SFR(0xBF806230UL)
+#define U4BRG                        SIM_SFR(0xBF806240UL)
+#define U4BRGCLR                     SIM_SFR(0xBF806244UL)
+#define U4BRGSET                     SIM_SFR(0xBF806248UL)
+#define U4BRGINV                     SIM_SFR(0xBF80624CUL)
+#define _UART5_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF806A00UL)
+#define U5MODE                       SIM_SFR(0xBF806A00UL)
+#define U5MODECLR                    SIM_SFR(0xBF806A04UL)
+#define U5MODESET                    SIM_SFR(0xBF806A08UL)
+#define U5MODEINV                    SIM_SFR(0xBF806A0CUL)
+#define U5STA                        SIM_SFR(0xBF806A10UL)
+#define U5STACLR                     SIM_SFR(0xBF806A14UL)
+#define U5STASET                     SIM_SFR(0xBF806A18UL)
+#define U5STAINV                     SIM_SFR(0xBF806A1CUL)
+#define U5TXREG                      SIM_SFR(0xBF806A20UL)
+#define U5RXREG                      SIM_SFR(0xBF806A30UL)
+#define U5BRG                        SIM_SFR(0xBF806A40UL)
+#define U5BRGCLR                     SIM_SFR(0xBF806A44UL)
+#define U5BRGSET                     SIM_SFR(0xBF806A48UL)
+#define U5BRGINV                     SIM_SFR(0xBF806A4CUL)
+#define _UART6_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF806600UL)
+#define U6MODE                       SIM_SFR(0xBF806600UL)
+#define U6MODECLR                    SIM_SFR(0xBF806604UL)
+#define U6MODESET                    SIM_SFR(0xBF806608UL)
+#define U6MODEINV                    SIM_SFR(0xBF80660CUL)
+#define U6STA                        SIM_SFR(0xBF806610UL)
+#define U6STACLR                     SIM_SFR(0xBF806614UL)
+#define U6STASET                     SIM_SFR(0xBF806618UL)
+#define U6STAINV                     SIM_SFR(0xBF80661CUL)
+#define U6TXREG                      SIM_SFR(0xBF806620UL)
+#define U6RXREG                      SIM_SFR(0xBF806630UL)
+#define U6BRG                        SIM_SFR(0xBF806640UL)
+#define U6BRGCLR                     SIM_SFR(0xBF806644UL)
+#define U6BRGSET                     SIM_SFR(0xBF806648UL)
+#define U6BRGINV                     SIM_SFR(0xBF80664CUL)
+
+typedef union
+{
+    struct
+    {
+        unsigned URXDA:1;
+        unsigned OERR:1;
+        unsigned FERR:1;
+        unsigned PERR:1;
+        unsigned RIDLE:1;
+        unsigned ADDEN:1;
+        unsigned URXISEL:2;
+        unsigned TRMT:1;
+        unsigned UTXBF:1;
+        unsigned UTXEN:1;
+        unsigned UTXBRK:1;
+        unsigned URXEN:1;
+        unsigned UTXINV:1;
+        unsigned UTXISEL:2;
+        unsigned ADDR:8;
+        unsigned ADM_EN:1;
+    };
+    uint32_t w;
+} __UxSTAbits_t;
+
+#define U1STAbits                    (*(volatile __UxSTAbits_t *) &U1STA)
+#define U2STAbits                    (*(volatile __UxSTAbits_t *) &U2STA)
+#define U3STAbits                    (*(volatile __UxSTAbits_t *) &U3STA)
+#define U4STAbits                    (*(volatile __UxSTAbits_t *) &U4STA)
+#define U5STAbits                    (*(volatile __UxSTAbits_t *) &U5STA)
+#define U6STAbits                    (*(volatile __UxSTAbits_t *) &U6STA)
+#define _U1MODE_STSEL_POSITION               0x00000000
+#define _U1MODE_STSEL_MASK                   0x00000001
+#define _U1MODE_STSEL_LENGTH                 0x00000001
+#define _U1MODE_PDSEL_POSITION               0x00000001
+#define _U1MODE_PDSEL_MASK                   0x00000006
+#define _U1MODE_PDSEL_LENGTH                 0x00000002
+#define _U1MODE_BRGH_POSITION                0x00000003
+#define _U1MODE_BRGH_MASK                    0x00000008
+#define _U1MODE_BRGH_LENGTH                  0x00000001
+#define _U1MODE_RXINV_POSITION               0x00000004
+#define _U1MODE_RXINV_MASK                   0x00000010
+#define _U1MODE_RXINV_LENGTH                 0x00000001
+#define _U1MODE_ABAUD_POSITION               0x00000005
+#define _U1MODE_ABAUD_MASK                   0x00000020
+#define _U1MODE_ABAUD_LENGTH                 0x00000001
+#define _U1MODE_LPBACK_POSITION              0x00000006
+#define _U1MODE_LPBACK_MASK                  0x00000040
+#define _U1MODE_LPBACK_LENGTH                0x00000001
+#define _U1MODE_WAKE_POSITION                0x00000007
+#define _U1MODE_WAKE_MASK                    0x00000080
+#define _U1MODE_WAKE_LENGTH                  0x00000001
+#define _U1MODE_UEN_POSITION                 0x00000008
+#define _U1MODE_UEN_MASK                     0x00000300
+#define _U1MODE_UEN_LENGTH                   0x00000002
+#define _U1MODE_RTSMD_POSITION               0x0000000B
+#define _U1MODE_RTSMD_MASK                   0x00000800
+#define _U1MODE_RTSMD_LENGTH                 0x00000001
+#define _U1MODE_IREN_POSITION                0x0000000C
+#define _U1MODE_IREN_MASK                    0x00001000
+#define _U1MODE_IREN_LENGTH                  0x00000001
+#define _U1MODE_SIDL_POSITION                0x0000000D
+#define _U1MODE_SIDL_MASK                    0x00002000
+#define _U1MODE_SIDL_LENGTH                  0x00000001
+#define _U1MODE_ON_POSITION                  0x0000000F
+#define _U1MODE_ON_MASK                      0x00008000
+#define _U1MODE_ON_LENGTH                    0x00000001
+#define _U1STA_URXDA_POSITION                0x00000000
+#define _U1STA_URXDA_MASK                    0x00000001
+#define _U1STA_URXDA_LENGTH                  0x00000001
+#define _U1STA_OERR_POSITION                 0x00000001
+#define _U1STA_OERR_MASK                     0x00000002
+#define _U1STA_OERR_LENGTH                   0x00000001
+#define _U1STA_FERR_POSITION                 0x00000002
+#define _U1STA_FERR_MASK                     0x00000004
+#define _U1STA_FERR_LENGTH                   0x00000001
+#define _U1STA_PERR_POSITION                 0x00000003
+#define _U1STA_PERR_MASK                     0x00000008
+#define _U1STA_PERR_LENGTH                   0x00000001
+#define _U1STA_RIDLE_POSITION                0x00000004
+#define _U1STA_RIDLE_MASK                    0x00000010
+#define _U1STA_RIDLE_LENGTH                  0x00000001
+#define _U1STA_ADDEN_POSITION                0x00000005
+#define _U1STA_ADDEN_MASK                    0x00000020
+#define _U1STA_ADDEN_LENGTH                  0x00000001
+#define _U1STA_URXISEL_POSITION              0x00000006
+#define _U1STA_URXISEL_MASK                  0x000000C0
+#define _U1STA_URXISEL_LENGTH                0x00000002
+#define _U1STA_TRMT_POSITION                 0x00000008
+#define _U1STA_TRMT_MASK                     0x00000100
+#define _U1STA_TRMT_LENGTH                   0x00000001
+#define _U1STA_UTXBF_POSITION                0x00000009
+#define _U1STA_UTXBF_MASK                    0x00000200
+#define _U1STA_UTXBF_LENGTH                  0x00000001
+#define _U1STA_UTXEN_POSITION                0x0000000A
+#define _U1STA_UTXEN_MASK                    0x00000400
+#define _U1STA_UTXEN_LENGTH                  0x00000001
+#define _U1STA_UTXBRK_POSITION               0x0000000B
+#define _U1STA_UTXBRK_MASK                   0x00000800
+#define _U1STA_UTXBRK_LENGTH                 0x00000001
+#define _U1STA_URXEN_POSITION                0x0000000C
+#define _U1STA_URXEN_MASK                    0x00001000
+#define _U1STA_URXEN_LENGTH                  0x00000001
+#define _U1STA_UTXINV_POSITION               0x0000000D
+#define _U1STA_UTXINV_MASK                   0x00002000
+#define _U1STA_UTXINV_LENGTH                 0x00000001
+#define _U1STA_UTXISEL_POSITION              0x0000000E
+#define _U1STA_UTXISEL_MASK                  0x0000C000
+#define _U1STA_UTXISEL_LENGTH                0x00000002
+#define _U1STA_ADDR_POSITION                 0x00000010
+#define _U1STA_ADDR_MASK                     0x00FF0000
+#define _U1STA_ADDR_LENGTH                   0x00000008
+#define _U1STA_ADM_EN_POSITION               0x00000018
+#define _U1STA_ADM_EN_MASK                   0x01000000
+#define _U1STA_ADM_EN_LENGTH                 0x00000001
+
+/*******************************************************************************
+ * ADC
+ ******************************************************************************/
+#define AD1CON1                      SIM_SFR(0xBF809000UL)
+#define AD1CON1CLR                   SIM_SFR(0xBF809004UL)
+#define AD1CON1SET                   SIM_SFR(0xBF809008UL)
+#define AD1CON1INV                   SIM_SFR(0xBF80900CUL)
+#define AD1CON2                      SIM_SFR(0xBF809010UL)
+#define AD1CON2CLR                   SIM_SFR(0xBF809014UL)
+#define AD1CON2SET                   SIM_SFR(0xBF809018UL)
+#define AD1CON2INV                   SIM_SFR(0xBF80901CUL)
+#define AD1CON3                      SIM_SFR(0xBF809020UL)
+#define AD1CON3CLR                   SIM_SFR(0xBF809024UL)
+#define AD1CON3SET                   SIM_SFR(0xBF809028UL)
+#define AD1CON3INV                   SIM_SFR(0xBF80902CUL)
+#define AD1CHS                       SIM_SFR(0xBF809040UL)
+#define AD1CHSCLR                    SIM_SFR(0xBF809044UL)
+#define AD1CHSSET                    SIM_SFR(0xBF809048UL)
+#define AD1CHSINV                    SIM_SFR(0xBF80904CUL)
+#define AD1CSSL                      SIM_SFR(0xBF809050UL)
+#define AD1CSSLCLR                   SIM_SFR(0xBF809054UL)
+#define AD1CSSLSET                   SIM_SFR(0xBF809058UL)
+#define AD1CSSLINV                   SIM_SFR(0xBF80905CUL)
+#define AD1PCFG                      SIM_SFR(0xBF809060UL)
+#define AD1PCFGCLR                   SIM_SFR(0xBF809064UL)
+#define AD1PCFGSET                   SIM_SFR(0xBF809068UL)
+#define AD1PCFGINV                   SIM_SFR(0xBF80906CUL)
+#define ADC1BUF0                     SIM_SFR(0xBF809070UL)
+#define ADC1BUF1                     SIM_SFR(0xBF809080UL)
+#define ADC1BUF2                     SIM_SFR(0xBF809090UL)
+#define ADC1BUF3                     SIM_SFR(0xBF8090A0UL)
+#define ADC1BUF4                     SIM_SFR(0xBF8090B0UL)
+#define ADC1BUF5                     SIM_SFR(0xBF8090C0UL)
+#define ADC1BUF6                     SIM_SFR(0xBF8090D0UL)
+#define ADC1BUF7                     SIM_SFR(0xBF8090E0UL)
+#define ADC1BUF8                     SIM_SFR(0xBF8090F0UL)
+#define ADC1BUF9                     SIM_SFR(0xBF809100UL)
+#define ADC1BUFA                     SIM_SFR(0xBF809110UL)
+#define ADC1BUFB                     SIM_SFR(0xBF809120UL)
+#define ADC1BUFC                     SIM_SFR(0xBF809130UL)
+#define ADC1BUFD                     SIM_SFR(0xBF809140UL)
+#define ADC1BUFE                     SIM_SFR(0xBF809150UL)
+#define ADC1BUFF                     SIM_SFR(0xBF809160UL)
+#define _AD1CON1_DONE_POSITION               0x00000000
+#define _AD1CON1_DONE_MASK                   0x00000001
+#define _AD1CON1_DONE_LENGTH                 0x00000001
+#define _AD1CON1_SAMP_POSITION               0x00000001
+#define _AD1CON1_SAMP_MASK                   0x00000002
+#define _AD1CON1_SAMP_LENGTH                 0x00000001
+#define _AD1CON1_ASAM_POSITION               0x00000002
+#define _AD1CON1_ASAM_MASK                   0x00000004
+#define _AD1CON1_ASAM_LENGTH                 0x00000001
+#define _AD1CON1_CLRASAM_POSITION            0x00000004
+#define _AD1CON1_CLRASAM_MASK                0x00000010
+#define _AD1CON1_CLRASAM_LENGTH              0x00000001
+#define _AD1CON1_SSRC_POSITION               0x00000005
+#define _AD1CON1_SSRC_MASK                   0x000000E0
+#define _AD1CON1_SSRC_LENGTH                 0x00000003
+#define _AD1CON1_FORM_POSITION               0x00000008
+#define _AD1CON1_FORM_MASK                   0x00000700
+#define _AD1CON1_FORM_LENGTH                 0x00000003
+#define _AD1CON1_SIDL_POSITION               0x0000000D
+#define _AD1CON1_SIDL_MASK                   0x00002000
+#define _AD1CON1_SIDL_LENGTH                 0x00000001
+#define _AD1CON1_ON_POSITION                 0x0000000F
+#define _AD1CON1_ON_MASK                     0x00008000
+#define _AD1CON1_ON_LENGTH                   0x00000001
+#define _AD1CON1_ADON_POSITION               0x0000000F
+#define _AD1CON1_ADON_MASK                   0x00008000
+#define _AD1CON1_ADON_LENGTH                 0x00000001
+#define _AD1CON2_ALTS_POSITION               0x00000000
+#define _AD1CON2_ALTS_MASK                   0x00000001
+#define _AD1CON2_ALTS_LENGTH                 0x00000001
+#define _AD1CON2_BUFM_POSITION               0x00000001
+#define _AD1CON2_BUFM_MASK                   0x00000002
+#define _AD1CON2_BUFM_LENGTH                 0x00000001
+#define _AD1CON2_SMPI_POSITION               0x00000002
+#define _AD1CON2_SMPI_MASK                   0x0000003C
+#define _AD1CON2_SMPI_LENGTH                 0x00000004
+#define _AD1CON2_BUFS_POSITION               0x00000007
+#define _AD1CON2_BUFS_MASK                   0x00000080
+#define _AD1CON2_BUFS_LENGTH                 0x00000001
+#define _AD1CON2_CSCNA_POSITION              0x0000000A
+#define _AD1CON2_CSCNA_MASK                  0x00000400
+#define _AD1CON2_CSCNA_LENGTH                0x00000001
+#define _AD1CON2_OFFCAL_POSITION             0x0000000C
+#define _AD1CON2_OFFCAL_MASK                 0x00001000
+#define _AD1CON2_OFFCAL_LENGTH               0x00000001
+#define _AD1CON2_VCFG_POSITION               0x0000000D
+#define _AD1CON2_VCFG_MASK                   0x0000E000
+#define _AD1CON2_VCFG_LENGTH                 0x00000003
+#define _AD1CON3_ADCS_POSITION               0x00000000
+#define _AD1CON3_ADCS_MASK                   0x000000FF
+#define _AD1CON3_ADCS_LENGTH                 0x00000008
+#define _AD1CON3_SAMC_POSITION               0x00000008
+#define _AD1CON3_SAMC_MASK                   0x00001F00
+#define _AD1CON3_SAMC_LENGTH                 0x00000005
+#define _AD1CON3_ADRC_POSITION               0x0000000F
+#define _AD1CON3_ADRC_MASK                   0x00008000
+#define _AD1CON3_ADRC_LENGTH                 0x00000001
+
+/*******************************************************************************
+ * Interrupt controller
+ ******************************************************************************/
+#define INTCON                       SIM_SFR(0xBF881000UL)
+#define INTCONCLR                    SIM_SFR(0xBF881004UL)
+#define INTCONSET                    SIM_SFR(0xBF881008UL)
+#define INTCONINV                    SIM_SFR(0xBF88100CUL)
+#define INTSTAT                      SIM_SFR(0xBF881010UL)
+#define IFS0                         SIM_SFR(0xBF881030UL)
+#define IFS0CLR                      SIM_SFR(0xBF881034UL)
+#define IFS0SET                      SIM_SFR(0xBF881038UL)
+#define IFS0INV                      SIM_SFR(0xBF88103CUL)
+#define IFS1                         SIM_SFR(0xBF881040UL)
+#define IFS1CLR                      SIM_SFR(0xBF881044UL)
+#define IFS1SET                      SIM_SFR(0xBF881048UL)
+#define IFS1INV                      SIM_SFR(0xBF88104CUL)
+#define IFS2                         SIM_SFR(0xBF881050UL)
+#define IFS2CLR                      SIM_SFR(0xBF881054UL)
+#define IFS2SET                      SIM_SFR(0xBF881058UL)
+#define IFS2INV                      SIM_SFR(0xBF88105CUL)
+#define IEC0                         SIM_SFR(0xBF881060UL)
+#define IEC0CLR                      SIM_SFR(0xBF881064UL)
+#define IEC0SET                      SIM_SFR(0xBF881068UL)
+#define IEC0INV                      SIM_SFR(0xBF88106CUL)
+#define IEC1                         SIM_SFR(0xBF881070UL)
+#define IEC1CLR                      SIM_SFR(0xBF881074UL)
+#define IEC1SET                      SIM_SFR(0xBF881078UL)
+#define IEC1INV                      SIM_SFR(0xBF88107CUL)
+#define IEC2                         SIM_SFR(0xBF881080UL)
+#define IEC2CLR                      SIM_SFR(0xBF881084UL)
+#define IEC2SET                      SIM_SFR(0xBF881088UL)
+#define IEC2INV                      SIM_SFR(0xBF88108CUL)
+#define IPC0                         SIM_SFR(0xBF881090UL)
+#define IPC0CLR                      SIM_SFR(0xBF881094UL)
+#define IPC0SET                      SIM_SFR(0xBF881098UL)
+#define IPC0INV                      SIM_SFR(0xBF88109CUL)
+#define IPC1                         SIM_SFR(0xBF8810A0UL)
+#define IPC1CLR                      SIM_SFR(0xBF8810A4UL)
+#define IPC1SET                      SIM_SFR(0xBF8810A8UL)
+#define IPC1INV                      SIM_SFR(0xBF8810ACUL)
+#define IPC2                         SIM_SFR(0xBF8810B0UL)
+#define IPC2CLR                      SIM_SFR(0xBF8810B4UL)
+#define IPC2SET                      SIM_SFR(0xBF8810B8UL)
+#define IPC2INV                      SIM_SFR(0xBF8810BCUL)
+#define IPC3                         SIM_SFR(0xBF8810C0UL)
+#define IPC3CLR                      SIM_SFR(0xBF8810C4UL)
+#define IPC3SET                      SIM_SFR(0xBF8810C8UL)
+#define IPC3INV                      SIM_SFR(0xBF8810CCUL)
+#define IPC4                         SIM_SFR(0xBF8810D0UL)
+#define IPC4CLR                      SIM_SFR(0xBF8810D4UL)
+#define IPC4SET                      SIM_SFR(0xBF8810D8UL)
+#define IPC4INV                      SIM_SFR(0xBF8810DCUL)
+#define IPC5                         SIM_SFR(0xBF8810E0UL)
+#define IPC5CLR                      SIM_SFR(0xBF8810E4UL)
+#define IPC5SET                      SIM_SFR(0xBF8810E8UL)
+#define IPC5INV                      SIM_SFR(0xBF8810ECUL)
+#define IPC6                         SIM_SFR(0xBF8810F0UL)
+#define IPC6CLR                      SIM_SFR(0xBF8810F4UL)
+#define IPC6SET                      SIM_SFR(0xBF8810F8UL)
+#define IPC6INV                      SIM_SFR(0xBF8810FCUL)
+#define IPC7                         SIM_SFR(0xBF881100UL)
+#define IPC7CLR                      SIM_SFR(0xBF881104UL)
+#define IPC7SET                      SIM_SFR(0xBF881108UL)
+#define IPC7INV                      SIM_SFR(0xBF88110CUL)
+#define IPC8                         SIM_SFR(0xBF881110UL)
+#define IPC8CLR                      SIM_SFR(0xBF881114UL)
+#define IPC8SET                      SIM_SFR(0xBF881118UL)
+#define IPC8INV                      SIM_SFR(0xBF88111CUL)
+#define IPC9                         SIM_SFR(0xBF881120UL)
+#define IPC9CLR                      SIM_SFR(0xBF881124UL)
+#define IPC9SET                      SIM_SFR(0xBF881128UL)
+#define IPC9INV                      SIM_SFR(0xBF88112CUL)
+#define IPC10                        SIM_SFR(0xBF881130UL)
+#define IPC10CLR                     SIM_SFR(0xBF881134UL)
+#define IPC10SET                     SIM_SFR(0xBF881138UL)
+#define IPC10INV                     SIM_SFR(0xBF88113CUL)
+#define IPC11                        SIM_SFR(0xBF881140UL)
+#define IPC11CLR                     SIM_SFR(0xBF881144UL)
+#define IPC11SET                     SIM_SFR(0xBF881148UL)
+#define IPC11INV                     SIM_SFR(0xBF88114CUL)
+#define IPC12                        SIM_SFR(0xBF881150UL)
+#define IPC12CLR                     SIM_SFR(0xBF881154UL)
+#define IPC12SET                     SIM_SFR(0xBF881158UL)
+#define IPC12INV                     SIM_SFR(0xBF88115CUL)
+
+#define _IFS0_CTIF_MASK                      0x00000001
+#define _IFS0_CTIF_POSITION                  0x00000000
+#define _IEC0_CTIE_MASK                      0x00000001
+#define _IFS0_CS0IF_MASK                     0x00000002
+#define _IFS0_CS0IF_POSITION                 0x00000001
+#define _IEC0_CS0IE_MASK                     0x00000002
+#define _IFS0_CS1IF_MASK                     0x00000004
+#define _IFS0_CS1IF_POSITION                 0x00000002
+#define _IEC0_CS1IE_MASK                     0x00000004
+#define _IFS0_INT0IF_MASK                    0x00000008
+#define _IFS0_INT0IF_POSITION                0x00000003
+#define _IEC0_INT0IE_MASK                    0x00000008
+#define _IFS0_T1IF_MASK                      0x00000010
+#define _IFS0_T1IF_POSITION                  0x00000004
+#define _IEC0_T1IE_MASK                      0x00000010
+#define _IFS0_IC1IF_MASK                     0x00000020
+#define _IFS0_IC1IF_POSITION                 0x00000005
+#define _IEC0_IC1IE_MASK                     0x00000020
+#define _IFS0_OC1IF_MASK                     0x00000040
+#define _IFS0_OC1IF_POSITION                 0x00000006
+#define _IEC0_OC1IE_MASK                     0x00000040
+#define _IFS0_INT1IF_MASK                    0x00000080
+#define _IFS0_INT1IF_POSITION                0x00000007
+#define _IEC0_INT1IE_MASK                    0x00000080
+#define _IFS0_T2IF_MASK                      0x00000100
+#define _IFS0_T2IF_POSITION                  0x00000008
+#define _IEC0_T2IE_MASK                      0x00000100
+#define _IFS0_IC2IF_MASK                     0x00000200
+#define _IFS0_IC2IF_POSITION                 0x00000009
+#define _IEC0_IC2IE_MASK                     0x00000200
+#define _IFS0_OC2IF_MASK                     0x00000400
+#define _IFS0_OC2IF_POSITION                 0x0000000A
+#define _IEC0_OC2IE_MASK                     0x00000400
+#define _IFS0_INT2IF_MASK                    0x00000800
+#define _IFS0_INT2IF_POSITION                0x0000000B
+#define _IEC0_INT2IE_MASK                    0x00000800
+#define _IFS0_T3IF_MASK                      0x00001000
+#define _IFS0_T3IF_POSITION                  0x0000000C
+#define _IEC0_T3IE_MASK                      0x00001000
+#define _IFS0_IC3IF_MASK                     0x00002000
+#define _IFS0_IC3IF_POSITION                 0x0000000D
+#define _IEC0_IC3IE_MASK                     0x00002000
+#define _IFS0_OC3IF_MASK                     0x00004000
+#define _IFS0_OC3IF_POSITION                 0x0000000E
+#define _IEC0_OC3IE_MASK                     0x00004000
+#define _IFS0_INT3IF_MASK                    0x00008000
+#define _IFS0_INT3IF_POSITION                0x0000000F
+#define _IEC0_INT3IE_MASK                    0x00008000
+#define _IFS0_T4IF_MASK                      0x00010000
+#define _IFS0_T4IF_POSITION                  0x00000010
+#define _IEC0_T4IE_MASK                      0x00010000
+#define _IFS0_IC4IF_MASK                     0x00020000
+#define _IFS0_IC4IF_POSITION                 0x00000011
+#define _IEC0_IC4IE_MASK                     0x00020000
+#define _IFS0_OC4IF_MASK                     0x00040000
+#define _IFS0_OC4IF_POSITION                 0x00000012
+#define _IEC0_OC4IE_MASK                     0x00040000
+#define _IFS0_INT4IF_MASK                    0x00080000
+#define _IFS0_INT4IF_POSITION                0x00000013
+#define _IEC0_INT4IE_MASK                    0x00080000
+#define _IFS0_T5IF_MASK                      0x00100000
+#define _IFS0_T5IF_POSITION                  0x00000014
+#define _IEC0_T5IE_MASK                      0x00100000
+#define _IFS0_IC5IF_MASK                     0x00200000
+#define _IFS0_IC5IF_POSITION                 0x00000015
+#define _IEC0_IC5IE_MASK                     0x00200000
+#define _IFS0_OC5IF_MASK                     0x00400000
+#define _IFS0_OC5IF_POSITION                 0x00000016
+#define _IEC0_OC5IE_MASK                     0x00400000
+#define _IFS0_SPI1EIF_MASK                   0x00800000
+#define _IFS0_SPI1EIF_POSITION               0x00000017
+#define _IEC0_SPI1EIE_MASK                   0x00800000
+#define _IFS0_SPI1RXIF_MASK                  0x01000000
+#define _IFS0_SPI1RXIF_POSITION              0x00000018
+#define _IEC0_SPI1RXIE_MASK                  0x01000000
+#define _IFS0_SPI1TXIF_MASK                  0x02000000
+#define _IFS0_SPI1TXIF_POSITION              0x00000019
+#define _IEC0_SPI1TXIE_MASK                  0x02000000
+#define _IFS0_U1EIF_MASK                     0x04000000
+#define _IFS0_U1EIF_POSITION                 0x0000001A
+#define _IEC0_U1EIE_MASK                     0x04000000
+#define _IFS0_SPI3EIF_MASK                   0x04000000
+#define _IFS0_SPI3EIF_POSITION               0x0000001A
+#define _IEC0_SPI3EIE_MASK                   0x04000000
+#define _IFS0_I2C3BIF_MASK                   0x04000000
+#define _IFS0_I2C3BIF_POSITION               0x0000001A
+#define _IEC0_I2C3BIE_MASK                   0x04000000
+#define _IFS0_U1RXIF_MASK                    0x08000000
+#define _IFS0_U1RXIF_POSITION                0x0000001B
+#define _IEC0_U1RXIE_MASK                    0x08000000
+#define _IFS0_SPI3RXIF_MASK                  0x08000000
+#define _IFS0_SPI3RXIF_POSITION              0x0000001B
+#define _IEC0_SPI3RXIE_MASK                  0x08000000
+#define _IFS0_I2C3SIF_MASK                   0x08000000
+#define _IFS0_I2C3SIF_POSITION               0x0000001B
+#define _IEC0_I2C3SIE_MASK                   0x08000000
+#define _IFS0_U1TXIF_MASK                    0x10000000
+#define _IFS0_U1TXIF_POSITION                0x0000001C
+#define _IEC0_U1TXIE_MASK                    0x10000000
+#define _IFS0_SPI3TXIF_MASK                  0x10000000
+#define _IFS0_SPI3TXIF_POSITION              0x0000001C
+#define _IEC0_SPI3TXIE_MASK                  0x10000000
+#define _IFS0_I2C3MIF_MASK                   0x10000000
+#define _IFS0_I2C3MIF_POSITION               0x0000001C
+#define _IEC0_I2C3MIE_MASK                   0x10000000
+#define _IFS0_I2C1BIF_MASK                   0x20000000
+#define _IFS0_I2C1BIF_POSITION               0x0000001D
+#define _IEC0_I2C1BIE_MASK                   0x20000000
+#define _IFS0_I2C1SIF_MASK                   0x40000000
+#define _IFS0_I2C1SIF_POSITION               0x0000001E
+#define _IEC0_I2C1SIE_MASK                   0x40000000
+#define _IFS0_I2C1MIF_MASK                   0x80000000
+#define _IFS0_I2C1MIF_POSITION               0x0000001F
+#define _IEC0_I2C1MIE_MASK                   0x80000000
+#define _IFS1_CNIF_MASK                      0x00000001
+#define _IFS1_CNIF_POSITION                  0x00000000
+#define _IEC1_CNIE_MASK                      0x00000001
+#define _IFS1_AD1IF_MASK                     0x00000002
+#define _IFS1_AD1IF_POSITION                 0x00000001
+#define _IEC1_AD1IE_MASK                     0x00000002
+#define _IFS1_PMPIF_MASK                     0x00000004
+#define _IFS1_PMPIF_POSITION                 0x00000002
+#define _IEC1_PMPIE_MASK                     0x00000004
+#define _IFS1_CMP1IF_MASK                    0x00000008
+#define _IFS1_CMP1IF_POSITION                0x00000003
+#define _IEC1_CMP1IE_MASK                    0x00000008
+#define _IFS1_CMP2IF_MASK                    0x00000010
+#define _IFS1_CMP2IF_POSITION                0x00000004
+#define _IEC1_CMP2IE_MASK                    0x00000010
+#define _IFS1_U3EIF_MASK                     0x00000020
+#define _IFS1_U3EIF_POSITION                 0x00000005
+#define _IEC1_U3EIE_MASK                     0x00000020
+#define _IFS1_SPI2EIF_MASK                   0x00000020
+#define _IFS1_SPI2EIF_POSITION               0x00000005
+#define _IEC1_SPI2EIE_MASK                   0x00000020
+#define _IFS1_I2C4BIF_MASK                   0x00000020
+#define _IFS1_I2C4BIF_POSITION               0x00000005
+#define _IEC1_I2C4BIE_MASK                   0x00000020
+#define _IFS1_U3RXIF_MASK                    0x00000040
+#define _IFS1_U3RXIF_POSITION                0x00000006
+#define _IEC1_U3RXIE_MASK                    0x00000040
+#define _IFS1_SPI2RXIF_MASK                  0x00000040
+#define _IFS1_SPI2RXIF_POSITION              0x00000006
+#define _IEC1_SPI2RXIE_MASK                  0x00000040
+#define _IFS1_I2C4SIF_MASK                   0x00000040
+#define _IFS1_I2C4SIF_POSITION               0x00000006
+#define _IEC1_I2C4SIE_MASK                   0x00000040
+#define _IFS1_U3TXIF_MASK                    0x00000080
+#define _IFS1_U3TXIF_POSITION                0x00000007
+#define _IEC1_U3TXIE_MASK                    0x00000080
+#define _IFS1_SPI2TXIF_MASK                  0x00000080
+#define _IFS1_SPI2TXIF_POSITION              0x00000007
+#define _IEC1_SPI2TXIE_MASK                  0x00000080
+#define _IFS1_I2C4MIF_MASK                   0x00000080
+#define _IFS1_I2C4MIF_POSITION               0x00000007
+#define _IEC1_I2C4MIE_MASK                   0x00000080
+#define _IFS1_U2EIF_MASK                     0x00000100
+#define _IFS1_U2EIF_POSITION                 0x00000008
+#define _IEC1_U2EIE_MASK                     0x00000100
+#define _IFS1_SPI4EIF_MASK                   0x00000100
+#define _IFS1_SPI4EIF_POSITION               0x00000008
+#define _IEC1_SPI4EIE_MASK                   0x00000100
+#define _IFS1_I2C5BIF_MASK                   0x00000100
+#define _IFS1_I2C5BIF_POSITION               0x00000008
+#define _IEC1_I2C5BIE_MASK                   0x00000100
+#define _IFS1_U2RXIF_MASK                    0x00000200
+#define _IFS1_U2RXIF_POSITION                0x00000009
+#define _IEC1_U2RXIE_MASK                    0x00000200
+#define _IFS1_SPI4RXIF_MASK                  0x00000200
+#define _IFS1_SPI4RXIF_POSITION              0x00000009
+#define _IEC1_SPI4RXIE_MASK                  0x00000200
+#define _IFS1_I2C5SIF_MASK                   0x00000200
+#define _IFS1_I2C5SIF_POSITION               0x00000009
+#define _IEC1_I2C5SIE_MASK                   0x00000200
+#define _IFS1_U2TXIF_MASK                    0x00000400
+#define _IFS1_U2TXIF_POSITION                0x0000000A
+#define _IEC1_U2TXIE_MASK                    0x00000400
+#define _IFS1_SPI4TXIF_MASK                  0x00000400
+#define _IFS1_SPI4TXIF_POSITION              0x0000000A
+#define _IEC1_SPI4TXIE_MASK                  0x00000400
+#define _IFS1_I2C5MIF_MASK                   0x00000400
+#define _IFS1_I2C5MIF_POSITION               0x0000000A
+#define _IEC1_I2C5MIE_MASK                   0x00000400
+#define _IFS1_I2C2BIF_MASK                   0x00000800
+#define _IFS1_I2C2BIF_POSITION               0x0000000B
+#define _IEC1_I2C2BIE_MASK                   0x00000800
+#define _IFS1_I2C2SIF_MASK                   0x00001000
+#define _IFS1_I2C2SIF_POSITION               0x0000000C
+#define _IEC1_I2C2SIE_MASK                   0x00001000
+#define _IFS1_I2C2MIF_MASK                   0x00002000
+#define _IFS1_I2C2MIF_POSITION               0x0000000D
+#define _IEC1_I2C2MIE_MASK                   0x00002000
+#define _IFS1_FSCMIF_MASK                    0x00004000
+#define _IFS1_FSCMIF_POSITION                0x0000000E
+#define _IEC1_FSCMIE_MASK                    0x00004000
+#define _IFS1_RTCCIF_MASK                    0x00008000
+#define _IFS1_RTCCIF_POSITION                0x0000000F
+#define _IEC1_RTCCIE_MASK                    0x00008000
+#define _IFS1_DMA0IF_MASK                    0x00010000
+#define _IFS1_DMA0IF_POSITION                0x00000010
+#define _IEC1_DMA0IE_MASK                    0x00010000
+#define _IFS1_DMA1IF_MASK                    0x00020000
+#define _IFS1_DMA1IF_POSITION                0x00000011
+#define _IEC1_DMA1IE_MASK                    0x00020000
+#define _IFS1_DMA2IF_MASK                    0x00040000
+#define _IFS1_DMA2IF_POSITION                0x00000012
+#define _IEC1_DMA2IE_MASK                    0x00040000
+#define _IFS1_DMA3IF_MASK                    0x00080000
+#define _IFS1_DMA3IF_POSITION                0x00000013
+#define _IEC1_DMA3IE_MASK                    0x00080000
+#define _IFS1_DMA4IF_MASK                    0x00100000
+#define _IFS1_DMA4IF_POSITION                0x00000014
+#define _IEC1_DMA4IE_MASK                    0x00100000
+#define _IFS1_DMA5IF_MASK                    0x00200000
+#define _IFS1_DMA5IF_POSITION                0x00000015
+#define _IEC1_DMA5IE_MASK                    0x00200000
+#define _IFS1_DMA6IF_MASK                    0x00400000
+#define _IFS1_DMA6IF_POSITION                0x00000016
+#define _IEC1_DMA6IE_MASK                    0x00400000
+#define _IFS1_DMA7IF_MASK                    0x00800000
+#define _IFS1_DMA7IF_POSITION                0x00000017
+#define _IEC1_DMA7IE_MASK                    0x00800000
+#define _IFS1_FCEIF_MASK                     0x01000000
+#define _IFS1_FCEIF_POSITION                 0x00000018
+#define _IEC1_FCEIE_MASK                     0x01000000
+#define _IFS1_USBIF_MASK                     0x02000000
+#define _IFS1_USBIF_POSITION                 0x00000019
+#define _IEC1_USBIE_MASK                     0x02000000
+#define _IFS1_CAN1IF_MASK                    0x04000000
+#define _IFS1_CAN1IF_POSITION                0x0000001A
+#define _IEC1_CAN1IE_MASK                    0x04000000
+#define _IFS1_CAN2IF_MASK                    0x08000000
+#define _IFS1_CAN2IF_POSITION                0x0000001B
+#define _IEC1_CAN2IE_MASK                    0x08000000
+#define _IFS1_ETHIF_MASK                     0x10000000
+#define _IFS1_ETHIF_POSITION                 0x0000001C
+#define _IEC1_ETHIE_MASK                     0x10000000
+#define _IFS1_IC1EIF_MASK                    0x20000000
+#define _IFS1_IC1EIF_POSITION                0x0000001D
+#define _IEC1_IC1EIE_MASK                    0x20000000
+#define _IFS1_IC2EIF_MASK                    0x40000000
+#define _IFS1_IC2EIF_POSITION                0x0000001E
+#define _IEC1_IC2EIE_MASK                    0x40000000
+#define _IFS1_IC3EIF_MASK                    0x80000000
+#define _IFS1_IC3EIF_POSITION                0x0000001F
+#define _IEC1_IC3EIE_MASK                    0x80000000
+#define _IFS2_IC4EIF_MASK                    0x00000001
+#define _IFS2_IC4EIF_POSITION                0x00000000
+#define _IEC2_IC4EIE_MASK                    0x00000001
+#define _IFS2_IC5EIF_MASK                    0x00000002
+#define _IFS2_IC5EIF_POSITION                0x00000001
+#define _IEC2_IC5EIE_MASK                    0x00000002
+#define _IFS2_PMPEIF_MASK                    0x00000004
+#define _IFS2_PMPEIF_POSITION                0x00000002
+#define _IEC2_PMPEIE_MASK                    0x00000004
+#define _IFS2_U4EIF_MASK                     0x00000008
+#define _IFS2_U4EIF_POSITION                 0x00000003
+#define _IEC2_U4EIE_MASK                     0x00000008
+#define _IFS2_U4RXIF_MASK                    0x00000010
+#define _IFS2_U4RXIF_POSITION                0x00000004
+#define _IEC2_U4RXIE_MASK                    0x00000010
+#define _IFS2_U4TXIF_MASK                    0x00000020
+#define _IFS2_U4TXIF_POSITION                0x00000005
+#define _IEC2_U4TXIE_MASK                    0x00000020
+#define _IFS2_U6EIF_MASK                     0x00000040
+#define _IFS2_U6EIF_POSITION                 0x00000006
+#define _IEC2_U6EIE_MASK                     0x00000040
+#define _IFS2_U6RXIF_MASK                    0x00000080
+#define _IFS2_U6RXIF_POSITION                0x00000007
+#define _IEC2_U6RXIE_MASK                    0x00000080
+#define _IFS2_U6TXIF_MASK                    0x00000100
+#define _IFS2_U6TXIF_POSITION                0x00000008
+#define _IEC2_U6TXIE_MASK                    0x00000100
+#define _IFS2_U5EIF_MASK                     0x00000200
+#define _IFS2_U5EIF_POSITION                 0x00000009
+#define _IEC2_U5EIE_MASK                     0x00000200
+#define _IFS2_U5RXIF_MASK                    0x00000400
+#define _IFS2_U5RXIF_POSITION                0x0000000A
+#define _IEC2_U5RXIE_MASK                    0x00000400
+#define _IFS2_U5TXIF_MASK                    0x00000800
+#define _IFS2_U5TXIF_POSITION                0x0000000B
+#define _IEC2_U5TXIE_MASK                    0x00000800
+
+#define _IPC0_CTIS_POSITION                  0x00000000
+#define _IPC0_CTIS_MASK                      0x00000003
+#define _IPC0_CTIP_POSITION                  0x00000002
+#define _IPC0_CTIP_MASK                      0x0000001C
+#define _CORE_TIMER_VECTOR                   0
+#define _IPC0_CS0IS_POSITION                 0x00000008
+#define _IPC0_CS0IS_MASK                     0x00000300
+#define _IPC0_CS0IP_POSITION                 0x0000000A
+#define _IPC0_CS0IP_MASK                     0x00001C00
+#define _CORE_SOFTWARE_0_VECTOR              1
+#define _IPC0_CS1IS_POSITION                 0x00000010
+#define _IPC0_CS1IS_MASK                     0x00030000
+#define _IPC0_CS1IP_POSITION                 0x00000012
+#define _IPC0_CS1IP_MASK                     0x001C0000
+#define _CORE_SOFTWARE_1_VECTOR              2
+#define _IPC0_INT0IS_POSITION                0x00000018
+#define _IPC0_INT0IS_MASK                    0x03000000
+#define _IPC0_INT0IP_POSITION                0x0000001A
+#define _IPC0_INT0IP_MASK                    0x1C000000
+#define _EXTERNAL_0_VECTOR                   3
+#define _IPC1_T1IS_POSITION                  0x00000000
+#define _IPC1_T1IS_MASK                      0x00000003
+#define _IPC1_T1IP_POSITION                  0x00000002
+#define _IPC1_T1IP_MASK                      0x0000001C
+#define _TIMER_1_VECTOR                      4
+#define _IPC1_IC1IS_POSITION                 0x00000008
+#define _IPC1_IC1IS_MASK                     0x00000300
+#define _IPC1_IC1IP_POSITION                 0x0000000A
+#define _IPC1_IC1IP_MASK                     0x00001C00
+#define _INPUT_CAPTURE_1_VECTOR              5
+#define _IPC1_OC1IS_POSITION                 0x00000010
+#define _IPC1_OC1IS_MASK                     0x00030000
+#define _IPC1_OC1IP_POSITION                 0x00000012
+#define _IPC1_OC1IP_MASK                     0x001C0000
+#define _OUTPUT_COMPARE_1_VECTOR             6
+#define _IPC1_INT1IS_POSITION                0x00000018
+#define _IPC1_INT1IS_MASK                    0x03000000
+#define _IPC1_INT1IP_POSITION                0x0000001A
+#define _IPC1_INT1IP_MASK                    0x1C000000
+#define _EXTERNAL_1_VECTOR                   7
+#define _IPC2_T2IS_POSITION                  0x00000000
+#define _IPC2_T2IS_MASK                      0x00000003
+#define _IPC2_T2IP_POSITION                  0x00000002
+#define _IPC2_T2IP_MASK                      0x0000001C
+#define _TIMER_2_VECTOR                      8
+#define _IPC2_IC2IS_POSITION                 0x00000008
+#define _IPC2_IC2IS_MASK                     0x00000300
+#define _IPC2_IC2IP_POSITION                 0x0000000A
+#define _IPC2_IC2IP_MASK                     0x00001C00
+#define _INPUT_CAPTURE_2_VECTOR              9
+#define _IPC2_OC2IS_POSITION                 0x00000010
+#define _IPC2_OC2IS_MASK                     0x00030000
+#define _IPC2_OC2IP_POSITION                 0x00000012
+#define _IPC2_OC2IP_MASK                     0x001C0000
+#define _OUTPUT_COMPARE_2_VECTOR             10
+#define _IPC2_INT2IS_POSITION                0x00000018
+#define _IPC2_INT2IS_MASK                    0x03000000
+#define _IPC2_INT2IP_POSITION                0x0000001A
+#define _IPC2_INT2IP_MASK                    0x1C000000
+#define _EXTERNAL_2_VECTOR                   11
+#define _IPC3_T3IS_POSITION                  0x00000000
+#define _IPC3_T3IS_MASK                      0x00000003
+#define _IPC3_T3IP_POSITION                  0x00000002
+#define _IPC3_T3IP_MASK                      0x0000001C
+#define _TIMER_3_VECTOR                      12
+#define _IPC3_IC3IS_POSITION                 0x00000008
+#define _IPC3_IC3IS_MASK                     0x00000300
+#define _IPC3_IC3IP_POSITION                 0x0000000A
+#define _IPC3_IC3IP_MASK                     0x00001C00
+#define _INPUT_CAPTURE_3_VECTOR              13
+#define _IPC3_OC3IS_POSITION                 0x00000010
+#define _IPC3_OC3IS_MASK                     0x00030000
+#define _IPC3_OC3IP_POSITION                 0x00000012
+#define _IPC3_OC3IP_MASK                     0x001C0000
+#define _OUTPUT_COMPARE_3_VECTOR             14
+#define _IPC3_INT3IS_POSITION                0x00000018
+#define _IPC3_INT3IS_MASK                    0x03000000
+#define _IPC3_INT3IP_POSITION                0x0000001A
+#define _IPC3_INT3IP_MASK                    0x1C000000
+#define _EXTERNAL_3_VECTOR                   15
+#define _IPC4_T4IS_POSITION                  0x00000000
+#define _IPC4_T4IS_MASK                      0x00000003
+#define _IPC4_T4IP_POSITION                  0x00000002
+#define _IPC4_T4IP_MASK                      0x0000001C
+#define _TIMER_4_VECTOR                      16
+#define _IPC4_IC4IS_POSITION                 0x00000008
+#define _IPC4_IC4IS_MASK                     0x00000300
+#define _IPC4_IC4IP_POSITION                 0x0000000A
+#define _IPC4_IC4IP_MASK                     0x00001C00
+#define _INPUT_CAPTURE_4_VECTOR              17
+#define _IPC4_OC4IS_POSITION                 0x00000010
+#define _IPC4_OC4IS_MASK                     0x00030000
+#define _IPC4_OC4IP_POSITION                 0x00000012
+#define _IPC4_OC4IP_MASK                     0x001C0000
+#define _OUTPUT_COMPARE_4_VECTOR             18
+#define _IPC4_INT4IS_POSITION                0x00000018
+#define _IPC4_INT4IS_MASK                    0x03000000
+#define _IPC4_INT4IP_POSITION                0x0000001A
+#define _IPC4_INT4IP_MASK                    0x1C000000
+#define _EXTERNAL_4_VECTOR                   19
+#define _IPC5_T5IS_POSITION                  0x00000000
+#define _IPC5_T5IS_MASK                      0x00000003
+#define _IPC5_T5IP_POSITION                  0x00000002
+#define _IPC5_T5IP_MASK                      0x0000001C
+#define _TIMER_5_VECTOR                      20
+#define _IPC5_IC5IS_POSITION                 0x00000008
+#define _IPC5_IC5IS_MASK                     0x00000300
+#define _IPC5_IC5IP_POSITION                 0x0000000A
+#define _IPC5_IC5IP_MASK                     0x00001C00
+#define _INPUT_CAPTURE_5_VECTOR              21
+#define _IPC5_OC5IS_POSITION                 0x00000010
+#define _IPC5_OC5IS_MASK                     0x00030000
+#define _IPC5_OC5IP_POSITION                 0x00000012
+#define _IPC5_OC5IP_MASK                     0x001C0000
+#define _OUTPUT_COMPARE_5_VECTOR             22
+#define _IPC5_SPI1IS_POSITION                0x00000018
+#define _IPC5_SPI1IS_MASK                    0x03000000
+#define _IPC5_SPI1IP_POSITION                0x0000001A
+#define _IPC5_SPI1IP_MASK                    0x1C000000
+#define _SPI_1_VECTOR                        23
+#define _IPC6_U1IS_POSITION                  0x00000000
+#define _IPC6_U1IS_MASK                      0x00000003
+#define _IPC6_U1IP_POSITION                  0x00000002
+#define _IPC6_U1IP_MASK                      0x0000001C
+#define _IPC6_SPI3IS_POSITION                0x00000000
+#define _IPC6_SPI3IS_MASK                    0x00000003
+#define _IPC6_SPI3IP_POSITION                0x00000002
+#define _IPC6_SPI3IP_MASK                    0x0000001C
+#define _IPC6_I2C3IS_POSITION                0x00000000
+#define _IPC6_I2C3IS_MASK                    0x00000003
+#define _IPC6_I2C3IP_POSITION                0x00000002
+#define _IPC6_I2C3IP_MASK                    0x0000001C
+#define _UART_1_VECTOR                       24
+#define _SPI_3_VECTOR                        24
+#define _I2C_3_VECTOR                        24
+#define _IPC6_I2C1IS_POSITION                0x00000008
+#define _IPC6_I2C1IS_MASK                    0x00000300
+#define _IPC6_I2C1IP_POSITION                0x0000000A
+#define _IPC6_I2C1IP_MASK                    0x00001C00
+#define _I2C_1_VECTOR                        25
+#define _IPC6_CNIS_POSITION                  0x00000010
+#define _IPC6_CNIS_MASK                      0x00030000
+#define _IPC6_CNIP_POSITION                  0x00000012
+#define _IPC6_CNIP_MASK                      0x001C0000
+#define _CHANGE_NOTICE_VECTOR                26
+#define _IPC6_AD1IS_POSITION                 0x00000018
+#define _IPC6_AD1IS_MASK                     0x03000000
+#define _IPC6_AD1IP_POSITION                 0x0000001A
+#define _IPC6_AD1IP_MASK                     0x1C000000
+#define _ADC_VECTOR                          27
+#define _IPC7_PMPIS_POSITION                 0x00000000
+#define _IPC7_PMPIS_MASK                     0x00000003
+#define _IPC7_PMPIP_POSITION                 0x00000002
+#define _IPC7_PMPIP_MASK                     0x0000001C
+#define _PMP_VECTOR                          28
+#define _IPC7_CMP1IS_POSITION                0x00000008
+#define _IPC7_CMP1IS_MASK                    0x00000300
+#define _IPC7_CMP1IP_POSITION                0x0000000A
+#define _IPC7_CMP1IP_MASK                    0x00001C00
+#define _COMPARATOR_1_VECTOR                 29
+#define _IPC7_CMP2IS_POSITION                0x00000010
+#define _IPC7_CMP2IS_MASK                    0x00030000
+#define _IPC7_CMP2IP_POSITION                0x00000012
+#define _IPC7_CMP2IP_MASK                    0x001C0000
+#define _COMPARATOR_2_VECTOR                 30
+#define _IPC7_U3IS_POSITION                  0x00000018
+#define _IPC7_U3IS_MASK                      0x03000000
+#define _IPC7_U3IP_POSITION                  0x0000001A
+#define _IPC7_U3IP_MASK                      0x1C000000
+#define _IPC7_SPI2IS_POSITION                0x00000018
+#define _IPC7_SPI2IS_MASK                    0x03000000
+#define _IPC7_SPI2IP_POSITION                0x0000001A
+#define _IPC7_SPI2IP_MASK                    0x1C000000
+#define _IPC7_I2C4IS_POSITION                0x00000018
+#define _IPC7_I2C4IS_MASK                    0x03000000
+#define _IPC7_I2C4IP_POSITION                0x0000001A
+#define _IPC7_I2C4IP_MASK                    0x1C000000
+#define _UART_3_VECTOR                       31
+#define _SPI_2_VECTOR                        31
+#define _I2C_4_VECTOR                        31
+#define _IPC8_U2IS_POSITION                  0x00000000
+#define _IPC8_U2IS_MASK                      0x00000003
+#define _IPC8_U2IP_POSITION                  0x00000002
+#define _IPC8_U2IP_MASK                      0x0000001C
+#define _IPC8_SPI4IS_POSITION                0x00000000
+#define _IPC8_SPI4IS_MASK                    0x00000003
+#define _IPC8_SPI4IP_POSITION                0x00000002
+#define _IPC8_SPI4IP_MASK                    0x0000001C
+#define _IPC8_I2C5IS_POSITION                0x00000000
+#define _IPC8_I2C5IS_MASK                    0x00000003
+#define _IPC8_I2C5IP_POSITION                0x00000002
+#define _IPC8_I2C5IP_MASK                    0x0000001C
+#define _UART_2_VECTOR                       32
+#define _SPI_4_VECTOR                        32
+#define _I2C_5_VECTOR                        32
+#define _IPC8_I2C2IS_POSITION                0x00000008
+#define _IPC8_I2C2IS_MASK                    0x00000300
+#define _IPC8_I2C2IP_POSITION                0x0000000A
+#define _IPC8_I2C2IP_MASK                    0x00001C00
+#define _I2C_2_VECTOR                        33
+#define _IPC8_FSCMIS_POSITION                0x00000010
+#define _IPC8_FSCMIS_MASK                    0x00030000
+#define _IPC8_FSCMIP_POSITION                0x00000012
+#define _IPC8_FSCMIP_MASK                    0x001C0000
+#define _FAIL_SAFE_MONITOR_VECTOR            34
+#define _IPC8_RTCCIS_POSITION                0x00000018
+#define _IPC8_RTCCIS_MASK                    0x03000000
+#define _IPC8_RTCCIP_POSITION                0x0000001A
+#define _IPC8_RTCCIP_MASK                    0x1C000000
+#define _RTCC_VECTOR                         35
+#define _IPC9_DMA0IS_POSITION                0x00000000
+#define _IPC9_DMA0IS_MASK                    0x00000003
+#define _IPC9_DMA0IP_POSITION                0x00000002
+#define _IPC9_DMA0IP_MASK                    0x0000001C
+#define _DMA_0_VECTOR                        36
+#define _IPC9_DMA1IS_POSITION                0x00000008
+#define _IPC9_DMA1IS_MASK                    0x00000300
+#define _IPC9_DMA1IP_POSITION                0x0000000A
+#define _IPC9_DMA1IP_MASK                    0x00001C00
+#define _DMA_1_VECTOR                        37
+#define _IPC9_DMA2IS_POSITION                0x00000010
+#define _IPC9_DMA2IS_MASK                    0x00030000
+#define _IPC9_DMA2IP_POSITION                0x00000012
+#define _IPC9_DMA2IP_MASK                    0x001C0000
+#define _DMA_2_VECTOR                        38
+#define _IPC9_DMA3IS_POSITION                0x00000018
+#define _IPC9_DMA3IS_MASK                    0x03000000
+#define _IPC9_DMA3IP_POSITION                0x0000001A
+#define _IPC9_DMA3IP_MASK                    0x1C000000
+#define _DMA_3_VECTOR                        39
+#define _IPC10_DMA4IS_POSITION               0x00000000
+#define _IPC10_DMA4IS_MASK                   0x00000003
+#define _IPC10_DMA4IP_POSITION               0x00000002
+#define _IPC10_DMA4IP_MASK                   0x0000001C
+#define _DMA_4_VECTOR                        40
+#define _IPC10_DMA5IS_POSITION               0x00000008
+#define _IPC10_DMA5IS_MASK                   0x00000300
+#define _IPC10_DMA5IP_POSITION               0x0000000A
+#define _IPC10_DMA5IP_MASK                   0x00001C00
+#define _DMA_5_VECTOR                        41
+#define _IPC10_DMA6IS_POSITION               0x00000010
+#define _IPC10_DMA6IS_MASK                   0x00030000
+#define _IPC10_DMA6IP_POSITION               0x00000012
+#define _IPC10_DMA6IP_MASK                   0x001C0000
+#define _DMA_6_VECTOR                        42
+#define _IPC10_DMA7IS_POSITION               0x00000018
+#define _IPC10_DMA7IS_MASK                   0x03000000
+#define _IPC10_DMA7IP_POSITION               0x0000001A
+#define _IPC10_DMA7IP_MASK                   0x1C000000
+#define _DMA_7_VECTOR                        43
+#define _IPC11_FCEIS_POSITION                0x00000000
+#define _IPC11_FCEIS_MASK                    0x00000003
+#define _IPC11_FCEIP_POSITION                0x00000002
+#define _IPC11_FCEIP_MASK                    0x0000001C
+#define _FCE_VECTOR                          44
+#define _IPC11_USBIS_POSITION                0x00000008
+#define _IPC11_USBIS_MASK                    0x00000300
+#define _IPC11_USBIP_POSITION                0x0000000A
+#define _IPC11_USBIP_MASK                    0x00001C00
+#define _USB_1_VECTOR                        45
+#define _IPC11_CAN1IS_POSITION               0x00000010
+#define _IPC11_CAN1IS_MASK                   0x00030000
+#define _IPC11_CAN1IP_POSITION               0x00000012
+#define _IPC11_CAN1IP_MASK                   0x001C0000
+#define _CAN_1_VECTOR                        46
+#define _IPC11_CAN2IS_POSITION               0x00000018
+#define _IPC11_CAN2IS_MASK                   0x03000000
+#define _IPC11_CAN2IP_POSITION               0x0000001A
+#define _IPC11_CAN2IP_MASK                   0x1C000000
+#define _CAN_2_VECTOR                        47
+#define _IPC12_ETHIS_POSITION                0x00000000
+#define _IPC12_ETHIS_MASK                    0x00000003
+#define _IPC12_ETHIP_POSITION                0x00000002
+#define _IPC12_ETHIP_MASK                    0x0000001C
+#define _ETH_VECTOR                          48
+#define _IPC12_U4IS_POSITION                 0x00000008
+#define _IPC12_U4IS_MASK                     0x00000300
+#define _IPC12_U4IP_POSITION                 0x0000000A
+#define _IPC12_U4IP_MASK                     0x00001C00
+#define _UART_4_VECTOR                       49
+#define _IPC12_U6IS_POSITION                 0x00000010
+#define _IPC12_U6IS_MASK                     0x00030000
+#define _IPC12_U6IP_POSITION                 0x00000012
+#define _IPC12_U6IP_MASK                     0x001C0000
+#define _UART_6_VECTOR                       50
+#define _IPC12_U5IS_POSITION                 0x00000018
+#define _IPC12_U5IS_MASK                     0x03000000
+#define _IPC12_U5IP_POSITION                 0x0000001A
+#define _IPC12_U5IP_MASK                     0x1C000000
+#define _UART_5_VECTOR                       51
+
+#define _SPI1_ERR_IRQ                        23
+#define _SPI1_RX_IRQ                         24
+#define _SPI1_TX_IRQ                         25
+#define _SPI2_ERR_IRQ                        37
+#define _SPI2_RX_IRQ                         38
+#define _SPI2_TX_IRQ                         39
+#define _SPI3_ERR_IRQ                        26
+#define _SPI3_RX_IRQ                         27
+#define _SPI3_TX_IRQ                         28
+#define _SPI4_ERR_IRQ                        40
+#define _SPI4_RX_IRQ                         41
+#define _SPI4_TX_IRQ                         42
+#define _UART1_ERR_IRQ                       26
+#define _UART1_RX_IRQ                        27
+#define _UART1_TX_IRQ                        28
+#define _UART2_ERR_IRQ                       40
+#define _UART2_RX_IRQ                        41
+#define _UART2_TX_IRQ                        42
+#define _UART3_ERR_IRQ                       37
+#define _UART3_RX_IRQ                        38
+#define _UART3_TX_IRQ                        39
+#define _UART4_ERR_IRQ                       67
+#define _UART4_RX_IRQ                        68
+#define _UART4_TX_IRQ                        69
+#define _UART5_ERR_IRQ                       73
+#define _UART5_RX_IRQ                        74
+#define _UART5_TX_IRQ                        75
+#define _UART6_ERR_IRQ                       70
+#define _UART6_RX_IRQ                        71
+#define _UART6_TX_IRQ                        72
+#define _I2C1_BUS_IRQ                        29
+#define _I2C1_SLAVE_IRQ                      30
+#define _I2C1_MASTER_IRQ                     31
+#define _I2C2_BUS_IRQ                        43
+#define _I2C2_SLAVE_IRQ                      44
+#define _I2C2_MASTER_IRQ                     45
+#define _I2C3_BUS_IRQ                        26
+#define _I2C3_SLAVE_IRQ                      27
+#define _I2C3_MASTER_IRQ                     28
+#define _I2C4_BUS_IRQ                        37
+#define _I2C4_SLAVE_IRQ                      38
+#define _I2C4_MASTER_IRQ                     39
+#define _I2C5_BUS_IRQ                        40
+#define _I2C5_SLAVE_IRQ                      41
+#define _I2C5_MASTER_IRQ                     42
+#define _TIMER_1_IRQ                         4
+#define _TIMER_2_IRQ                         8
+#define _TIMER_3_IRQ                         12
+#define _TIMER_4_IRQ                         16
+#define _TIMER_5_IRQ                         20
+#define _DMA0_IRQ                            48
+#define _DMA1_IRQ                            49
+#define _DMA2_IRQ                            50
+#define _DMA3_IRQ                            51
+#define _DMA4_IRQ                            52
+#define _DMA5_IRQ                            53
+#define _DMA6_IRQ                            54
+#define _DMA7_IRQ                            55
+#define _ADC_IRQ                             33
+#define _CAN1_IRQ                            58
+#define _CAN2_IRQ                            59
+#define _ETH_IRQ                             60
+#define _CORE_TIMER_IRQ                      0
+
+/*******************************************************************************
+ * DMA
+ ******************************************************************************/
+#define DMACON                       SIM_SFR(0xBF883000UL)
+#define DMACONCLR                    SIM_SFR(0xBF883004UL)
+#define DMACONSET                    SIM_SFR(0xBF883008UL)
+#define DMACONINV                    SIM_SFR(0xBF88300CUL)
+#define DMASTAT                      SIM_SFR(0xBF883010UL)
+#define DMASTATCLR                   SIM_SFR(0xBF883014UL)
+#define DMASTATSET                   SIM_SFR(0xBF883018UL)
+#define DMASTATINV                   SIM_SFR(0xBF88301CUL)
+#define DMAADDR                      SIM_SFR(0xBF883020UL)
+#define DMAADDRCLR                   SIM_SFR(0xBF883024UL)
+#define DMAADDRSET                   SIM_SFR(0xBF883028UL)
+#define DMAADDRINV                   SIM_SFR(0xBF88302CUL)
+#define _DMAC0_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF883060UL)
+#define DCH0CON                      SIM_SFR(0xBF883060UL)
+#define DCH0CONCLR                   SIM_SFR(0xBF883064UL)
+#define DCH0CONSET                   SIM_SFR(0xBF883068UL)
+#define DCH0CONINV                   SIM_SFR(0xBF88306CUL)
+#define DCH0ECON                     SIM_SFR(0xBF883070UL)
+#define DCH0ECONCLR                  SIM_SFR(0xBF883074UL)
+#define DCH0ECONSET                  SIM_SFR(0xBF883078UL)
+#define DCH0ECONINV                  SIM_SFR(0xBF88307CUL)
+#define DCH0INT                      SIM_SFR(0xBF883080UL)
+#define DCH0INTCLR                   SIM_SFR(0xBF883084UL)
+#define DCH0INTSET                   SIM_SFR(0xBF883088UL)
+#define DCH0INTINV                   SIM_SFR(0xBF88308CUL)
+#define DCH0SSA                      SIM_SFR(0xBF883090UL)
+#define DCH0SSACLR                   SIM_SFR(0xBF883094UL)
+#define DCH0SSASET                   SIM_SFR(0xBF883098UL)
+#define DCH0SSAINV                   SIM_SFR(0xBF88309CUL)
+#define DCH0DSA                      SIM_SFR(0xBF8830A0UL)
+#define DCH0DSACLR                   SIM_SFR(0xBF8830A4UL)
+#define DCH0DSASET                   SIM_SFR(0xBF8830A8UL)
+#define DCH0DSAINV                   SIM_SFR(0xBF8830ACUL)
+#define DCH0SSIZ                     SIM_SFR(0xBF8830B0UL)
+#define DCH0SSIZCLR                  SIM_SFR(0xBF8830B4UL)
+#define DCH0SSIZSET                  SIM_SFR(0xBF8830B8UL)
+#define DCH0SSIZINV                  SIM_SFR(0xBF8830BCUL)
+#define DCH0DSIZ                     SIM_SFR(0xBF8830C0UL)
+#define DCH0DSIZCLR                  SIM_SFR(0xBF8830C4UL)
+#define DCH0DSIZSET                  SIM_SFR(0xBF8830C8UL)
+#define DCH0DSIZINV                  SIM_SFR(0xBF8830CCUL)
+#define DCH0SPTR                     SIM_SFR(0xBF8830D0UL)
+#define DCH0SPTRCLR                  SIM_SFR(0xBF8830D4UL)
+#define DCH0SPTRSET                  SIM_SFR(0xBF8830D8UL)
+#define DCH0SPTRINV                  SIM_SFR(0xBF8830DCUL)
+#define DCH0DPTR                     SIM_SFR(0xBF8830E0UL)
+#define DCH0DPTRCLR                  SIM_SFR(0xBF8830E4UL)
+#define DCH0DPTRSET                  SIM_SFR(0xBF8830E8UL)
+#define DCH0DPTRINV                  SIM_SFR(0xBF8830ECUL)
+#define DCH0CSIZ                     SIM_SFR(0xBF8830F0UL)
+#define DCH0CSIZCLR                  SIM_SFR(0xBF8830F4UL)
+#define DCH0CSIZSET                  SIM_SFR(0xBF8830F8UL)
+#define DCH0CSIZINV                  SIM_SFR(0xBF8830FCUL)
+#define DCH0CPTR                     SIM_SFR(0xBF883100UL)
+#define DCH0CPTRCLR                  SIM_SFR(0xBF883104UL)
+#define DCH0CPTRSET                  SIM_SFR(0xBF883108UL)
+#define DCH0CPTRINV                  SIM_SFR(0xBF88310CUL)
+#define DCH0DAT                      SIM_SFR(0xBF883110UL)
+#define DCH0DATCLR                   SIM_SFR(0xBF883114UL)
+#define DCH0DATSET                   SIM_SFR(0xBF883118UL)
+#define DCH0DATINV                   SIM_SFR(0xBF88311CUL)
+#define _DMAC1_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF883120UL)
+#define DCH1CON                      SIM_SFR(0xBF883120UL)
+#define DCH1CONCLR                   SIM_SFR(0xBF883124UL)
+#define DCH1CONSET                   SIM_SFR(0xBF883128UL)
+#define DCH1CONINV                   SIM_SFR(0xBF88312CUL)
+#define DCH1ECON                     SIM_SFR(0xBF883130UL)
+#define DCH1ECONCLR                  SIM_SFR(0xBF883134UL)
+#define DCH1ECONSET                  SIM_SFR(0xBF883138UL)
+#define DCH1ECONINV                  SIM_SFR(0xBF88313CUL)
+#define DCH1INT                      SIM_SFR(0xBF883140UL)
+#define DCH1INTCLR                   SIM_SFR(0xBF883144UL)
+#define DCH1INTSET                   SIM_SFR(0xBF883148UL)
+#define DCH1INTINV                   SIM_SFR(0xBF88314CUL)
+#define DCH1SSA                      SIM_SFR(0xBF883150UL)
+#define DCH1SSACLR                   SIM_SFR(0xBF883154UL)
+#define DCH1SSASET                   SIM_SFR(0xBF883158UL)
+#define DCH1SSAINV                   SIM_SFR(0xBF88315CUL)
+#define DCH1DSA                      SIM_SFR(0xBF883160UL)
+#define DCH1DSACLR                   SIM_SFR(0xBF883164UL)
+#define DCH1DSASET                   SIM_SFR(0xBF883168UL)
+#define DCH1DSAINV                   SIM_SFR(0xBF88316CUL)
+#define DCH1SSIZ                     SIM_SFR(0xBF883170UL)
+#define DCH1SSIZCLR                  SIM_SFR(0xBF883174UL)
+#define DCH1SSIZSET                  SIM_SFR(0xBF883178UL)
+#define DCH1SSIZINV                  SIM_SFR(0xBF88317CUL)
+#define DCH1DSIZ                     SIM_SFR(0xBF883180UL)
+#define DCH1DSIZCLR                  SIM_SFR(0xBF883184UL)
+#define DCH1DSIZSET                  SIM_SFR(0xBF883188UL)
+#define DCH1DSIZINV                  SIM_SFR(0xBF88318CUL)
+#define DCH1SPTR                     SIM_SFR(0xBF883190UL)
+#define DCH1SPTRCLR                  SIM_SFR(0xBF883194UL)
+#define DCH1SPTRSET                  SIM_SFR(0xBF883198UL)
+#define DCH1SPTRINV                  SIM_SFR(0xBF88319CUL)
+#define DCH1DPTR                     SIM_SFR(0xBF8831A0UL)
+#define DCH1DPTRCLR                  SIM_SFR(0xBF8831A4UL)
+#define DCH1DPTRSET                  SIM_SFR(0xBF8831A8UL)
+#define DCH1DPTRINV                  SIM_SFR(0xBF8831ACUL)
+#define DCH1CSIZ                     SIM_SFR(0xBF8831B0UL)
+#define DCH1CSIZCLR                  SIM_SFR(0xBF8831B4UL)
+#define DCH1CSIZSET                  SIM_SFR(0xBF8831B8UL)
+#define DCH1CSIZINV                  SIM_SFR(0xBF8831BCUL)
+#define DCH1CPTR                     SIM_SFR(0xBF8831C0UL)
+#define DCH1CPTRCLR                  SIM_SFR(0xBF8831C4UL)
+#define DCH1CPTRSET                  SIM_SFR(0xBF8831C8UL)
+#define DCH1CPTRINV                  SIM_SFR(0xBF8831CCUL)
+#define DCH1DAT                      SIM_SFR(0xBF8831D0UL)
+#define DCH1DATCLR                   SIM_SFR(0xBF8831D4UL)
+#define DCH1DATSET                   SIM_SFR(0xBF8831D8UL)
+#define DCH1DATINV                   SIM_SFR(0xBF8831DCUL)
+#define _DMAC2_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF8831E0UL)
+#define DCH2CON                      SIM_SFR(0xBF8831E0UL)
+#define DCH2CONCLR                   SIM_SFR(0xBF8831E4UL)
+#define DCH2CONSET                   SIM_SFR(0xBF8831E8UL)
+#define DCH2CONINV                   SIM_SFR(0xBF8831ECUL)
+#define DCH2ECON                     SIM_SFR(0xBF8831F0UL)
+#define DCH2ECONCLR                  SIM_SFR(0xBF8831F4UL)
+#define DCH2ECONSET                  SIM_SFR(0xBF8831F8UL)
+#define DCH2ECONINV                  SIM_SFR(0xBF8831FCUL)
+#define DCH2INT                      SIM_SFR(0xBF883200UL)
+#define DCH2INTCLR                   SIM_SFR(0xBF883204UL)
+#define DCH2INTSET                   SIM_SFR(0xBF883208UL)
+#define DCH2INTINV                   SIM_SFR(0xBF88320CUL)
+#define DCH2SSA                      SIM_SFR(0xBF883210UL)
+#define DCH2SSACLR                   SIM_SFR(0xBF883214UL)
+#define DCH2SSASET                   SIM_SFR(0xBF883218UL)
+#define DCH2SSAINV                   SIM_SFR(0xBF88321CUL)
+#define DCH2DSA                      SIM_SFR(0xBF883220UL)
+#define DCH2DSACLR                   SIM_SFR(0xBF883224UL)
+#define DCH2DSASET                   SIM_SFR(0xBF883228UL)
+#define DCH2DSAINV                   SIM_SFR(0xBF88322CUL)
+#define DCH2SSIZ                     SIM_SFR(0xBF883230UL)
+#define DCH2SSIZCLR                  SIM_SFR(0xBF883234UL)
+#define DCH2SSIZSET                  SIM_SFR(0xBF883238UL)
+#define DCH2SSIZINV                  SIM_SFR(0xBF88323CUL)
+#define DCH2DSIZ                     SIM_SFR(0xBF883240UL)
+#define DCH2DSIZCLR                  SIM_SFR(0xBF883244UL)
+#define DCH2DSIZSET                  SIM_SFR(0xBF883248UL)
+#define DCH2DSIZINV                  SIM_SFR(0xBF88324CUL)
+#define DCH2SPTR                     SIM_SFR(0xBF883250UL)
+#define DCH2SPTRCLR                  SIM_SFR(0xBF883254UL)
+#define DCH2SPTRSET                  SIM_SFR(0xBF883258UL)
+#define DCH2SPTRINV                  SIM_SFR(0xBF88325CUL)
+#define DCH2DPTR                     SIM_SFR(0xBF883260UL)
+#define DCH2DPTRCLR                  SIM_SFR(0xBF883264UL)
+#define DCH2DPTRSET                  SIM_SFR(0xBF883268UL)
+#define DCH2DPTRINV                  SIM_SFR(0xBF88326CUL)
+#define DCH2CSIZ                     SIM_SFR(0xBF883270UL)
+#define DCH2CSIZCLR                  SIM_SFR(0xBF883274UL)
+#define DCH2CSIZSET                  SIM_SFR(0xBF883278UL)
+#define DCH2CSIZINV                  SIM_SFR(0xBF88327CUL)
+#define DCH2CPTR                     SIM_SFR(0xBF883280UL)
+#define DCH2CPTRCLR                  SIM_SFR(0xBF883284UL)
+#define DCH2CPTRSET                  SIM_SFR(0xBF883288UL)
+#define DCH2CPTRINV                  SIM_SFR(0xBF88328CUL)
+#define DCH2DAT                      SIM_SFR(0xBF883290UL)
+#define DCH2DATCLR                   SIM_SFR(0xBF883294UL)
+#define DCH2DATSET                   SIM_SFR(0xBF883298UL)
+#define DCH2DATINV                   SIM_SFR(0xBF88329CUL)
+#define _DMAC3_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF8832A0UL)
+#define DCH3CON                      SIM_SFR(0xBF8832A0UL)
+#define DCH3CONCLR                   SIM_SFR(0xBF8832A4UL)
+#define DCH3CONSET                   SIM_SFR(0xBF8832A8UL)
+#define DCH3CONINV                   SIM_SFR(0xBF8832ACUL)
+#define DCH3ECON                     SIM_SFR(0xBF8832B0UL)
+#define DCH3ECONCLR                  SIM_SFR(0xBF8832B4UL)
+#define DCH3ECONSET                  SIM_SFR(0xBF8832B8UL)
+#define DCH3ECONINV                  SIM_SFR(0xBF8832BCUL)
+#define DCH3INT                      SIM_SFR(0xBF8832C0UL)
+#define DCH3INTCLR                   SIM_SFR(0xBF8832C4UL)
+#define DCH3INTSET                   SIM_SFR(0xBF8832C8UL)
+#define DCH3INTINV                   SIM_SFR(0xBF8832CCUL)
+#define DCH3SSA                      SIM_SFR(0xBF8832D0UL)
+#define DCH3SSACLR                   SIM_SFR(0xBF8832D4UL)
+#define DCH3SSASET                   SIM_SFR(0xBF8832D8UL)
+#define DCH3SSAINV                   SIM_SFR(0xBF8832DCUL)
+#define DCH3DSA                      SIM_SFR(0xBF8832E0UL)
+#define DCH3DSACLR                   SIM_SFR(0xBF8832E4UL)
+#define DCH3DSASET                   SIM_SFR(0xBF8832E8UL)
+#define DCH3DSAINV                   SIM_SFR(0xBF8832ECUL)
+#define DCH3SSIZ                     SIM_SFR(0xBF8832F0UL)
+#define DCH3SSIZCLR                  SIM_SFR(0xBF8832F4UL)
+#define DCH3SSIZSET                  SIM_SFR(0xBF8832F8UL)
+#define DCH3SSIZINV                  SIM_SFR(0xBF8832FCUL)
+#define DCH3DSIZ                     SIM_SFR(0xBF883300UL)
+#define DCH3DSIZCLR                  SIM_SFR(0xBF883304UL)
+#define DCH3DSIZSET                  SIM_SFR(0xBF883308UL)
+#define DCH3DSIZINV                  SIM_SFR(0xBF88330CUL)
+#define DCH3SPTR                     SIM_SFR(0xBF883310UL)
+#define DCH3SPTRCLR                  SIM_SFR(0xBF883314UL)
+#define DCH3SPTRSET                  SIM_SFR(0xBF883318UL)
+#define DCH3SPTRINV                  SIM_SFR(0xBF88331CUL)
+#define DCH3DPTR                     SIM_SFR(0xBF883320UL)
+#define DCH3DPTRCLR                  SIM_SFR(0xBF883324UL)
+#define DCH3DPTRSET                  SIM_SFR(0xBF883328UL)
+#define DCH3DPTRINV                  SIM_SFR(0xBF88332CUL)
+#define DCH3CSIZ                     SIM_SFR(0xBF883330UL)
+#define DCH3CSIZCLR                  SIM_SFR(0xBF883334UL)
+#define DCH3CSIZSET                  SIM_SFR(0xBF883338UL)
+#define DCH3CSIZINV                  SIM_SFR(0xBF88333CUL)
+#define DCH3CPTR                     SIM_SFR(0xBF883340UL)
+#define DCH3CPTRCLR                  SIM_SFR(0xBF883344UL)
+#define DCH3CPTRSET                  SIM_SFR(0xBF883348UL)
+#define DCH3CPTRINV                  SIM_SFR(0xBF88334CUL)
+#define DCH3DAT                      SIM_SFR(0xBF883350UL)
+#define DCH3DATCLR                   SIM_SFR(0xBF883354UL)
+#define DCH3DATSET                   SIM_SFR(0xBF883358UL)
+#define DCH3DATINV                   SIM_SFR(0xBF88335CUL)
+#define _DMAC4_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF883360UL)
+#define DCH4CON                      SIM_SFR(0xBF883360UL)
+#define DCH4CONCLR                   SIM_SFR(0xBF883364UL)
+#define DCH4CONSET                   SIM_SFR(0xBF883368UL)
+#define DCH4CONINV                   SIM_SFR(0xBF88336CUL)
+#define DCH4ECON                     SIM_SFR(0xBF883370UL)
+#define DCH4ECONCLR                  SIM_SFR(0xBF883374UL)
+#define DCH4ECONSET                  SIM_SFR(0xBF883378UL)
+#define DCH4ECONINV                  SIM_SFR(0xBF88337CUL)
+#define DCH4INT                      SIM_SFR(0xBF883380UL)
+#define DCH4INTCLR                   SIM_SFR(0xBF883384UL)
+#define DCH4INTSET                   SIM_SFR(0xBF883388UL)
+#define DCH4INTINV                   SIM_SFR(0xBF88338CUL)
+#define DCH4SSA                      SIM_SFR(0xBF883390UL)
+#define DCH4SSACLR                   SIM_SFR(0xBF883394UL)
+#define DCH4SSASET                   SIM_SFR(0xBF883398UL)
+#define DCH4SSAINV                   SIM_SFR(0xBF88339CUL)
+#define DCH4DSA                      SIM_SFR(0xBF8833A0UL)
+#define DCH4DSACLR                   SIM_SFR(0xBF8833A4UL)
+#define DCH4DSASET                   SIM_SFR(0xBF8833A8UL)
+#define DCH4DSAINV                   SIM_SFR(0xBF8833ACUL)
+#define DCH4SSIZ                     SIM_SFR(0xBF8833B0UL)
+#define DCH4SSIZCLR                  SIM_SFR(0xBF8833B4UL)
+#define DCH4SSIZSET                  SIM_SFR(0xBF8833B8UL)
+#define DCH4SSIZINV                  SIM_SFR(0xBF8833BCUL)
+#define DCH4DSIZ                     SIM_SFR(0xBF8833C0UL)
+#define DCH4DSIZCLR                  SIM_SFR(0xBF8833C4UL)
+#define DCH4DSIZSET                  SIM_SFR(0xBF8833C8UL)
+#define DCH4DSIZINV                  SIM_SFR(0xBF8833CCUL)
+#define DCH4SPTR                     SIM_SFR(0xBF8833D0UL)
+#define DCH4SPTRCLR                  SIM_SFR(0xBF8833D4UL)
+#define DCH4SPTRSET                  SIM_SFR(0xBF8833D8UL)
+#define DCH4SPTRINV                  SIM_SFR(0xBF8833DCUL)
+#define DCH4DPTR                     SIM_SFR(0xBF8833E0UL)
+#define DCH4DPTRCLR                  SIM_SFR(0xBF8833E4UL)
+#define DCH4DPTRSET                  SIM_SFR(0xBF8833E8UL)
+#define DCH4DPTRINV                  SIM_SFR(0xBF8833ECUL)
+#define DCH4CSIZ                     SIM_SFR(0xBF8833F0UL)
+#define DCH4CSIZCLR                  SIM_SFR(0xBF8833F4UL)
+#define DCH4CSIZSET                  SIM_SFR(0xBF8833F8UL)
+#define DCH4CSIZINV                  SIM_SFR(0xBF8833FCUL)
+#define DCH4CPTR                     SIM_SFR(0xBF883400UL)
+#define DCH4CPTRCLR                  SIM_SFR(0xBF883404UL)
+#define DCH4CPTRSET                  SIM_SFR(0xBF883408UL)
+#define DCH4CPTRINV                  SIM_SFR(0xBF88340CUL)
+#define DCH4DAT                      SIM_SFR(0xBF883410UL)
+#define DCH4DATCLR                   SIM_SFR(0xBF883414UL)
+#define DCH4DATSET                   SIM_SFR(0xBF883418UL)
+#define DCH4DATINV                   SIM_SFR(0xBF88341CUL)
+#define _DMAC5_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF883420UL)
+#define DCH5CON                      SIM_SFR(0xBF883420UL)
+#define DCH5CONCLR                   SIM_SFR(0xBF883424UL)
+#define DCH5CONSET                   SIM_SFR(0xBF883428UL)
+#define DCH5CONINV                   SIM_SFR(0xBF88342CUL)
+#define DCH5ECON                     SIM_SFR(0xBF883430UL)
+#define DCH5ECONCLR                  SIM_SFR(0xBF883434UL)
+#define DCH5ECONSET                  SIM_SFR(0xBF883438UL)
+#define DCH5ECONINV                  SIM_SFR(0xBF88343CUL)
+#define DCH5INT                      SIM_SFR(0xBF883440UL)
+#define DCH5INTCLR                   SIM_SFR(0xBF883444UL)
+#define DCH5INTSET                   SIM_SFR(0xBF883448UL)
+#define DCH5INTINV                   SIM_SFR(0xBF88344CUL)
+#define DCH5SSA                      SIM_SFR(0xBF883450UL)
+#define DCH5SSACLR                   SIM_SFR(0xBF883454UL)
+#define DCH5SSASET                   SIM_SFR(0xBF883458UL)
+#define DCH5SSAINV                   SIM_SFR(0xBF88345CUL)
+#define DCH5DSA                      SIM_SFR(0xBF883460UL)
+#define DCH5DSACLR                   SIM_SFR(0xBF883464UL)
+#define DCH5DSASET                   SIM_SFR(0xBF883468UL)
+#define DCH5DSAINV                   SIM_SFR(0xBF88346CUL)
+#define DCH5SSIZ                     SIM_SFR(0xBF883470UL)
+#define DCH5SSIZCLR                  SIM_SFR(0xBF883474UL)
+#define DCH5SSIZSET                  SIM_SFR(0xBF883478UL)
+#define DCH5SSIZINV                  SIM_SFR(0xBF88347CUL)
+#define DCH5DSIZ                     SIM_SFR(0xBF883480UL)
+#define DCH5DSIZCLR                  SIM_SFR(0xBF883484UL)
+#define DCH5DSIZSET                  SIM_SFR(0xBF883488UL)
+#define DCH5DSIZINV                  SIM_SFR(0xBF88348CUL)
+#define DCH5SPTR                     SIM_SFR(0xBF883490UL)
+#define DCH5SPTRCLR                  SIM_SFR(0xBF883494UL)
+#define DCH5SPTRSET                  SIM_SFR(0xBF883498UL)
+#define DCH5SPTRINV                  SIM_SFR(0xBF88349CUL)
+#define DCH5DPTR                     SIM_SFR(0xBF8834A0UL)
+#define DCH5DPTRCLR                  SIM_SFR(0xBF8834A4UL)
+#define DCH5DPTRSET                  SIM_SFR(0xBF8834A8UL)
+#define DCH5DPTRINV                  SIM_SFR(0xBF8834ACUL)
+#define DCH5CSIZ                     SIM_SFR(0xBF8834B0UL)
+#define DCH5CSIZCLR                  SIM_SFR(0xBF8834B4UL)
+#define DCH5CSIZSET                  SIM_SFR(0xBF8834B8UL)
+#define DCH5CSIZINV                  SIM_SFR(0xBF8834BCUL)
+#define DCH5CPTR                     SIM_SFR(0xBF8834C0UL)
+#define DCH5CPTRCLR                  SIM_SFR(0xBF8834C4UL)
+#define DCH5CPTRSET                  SIM_SFR(0xBF8834C8UL)
+#define DCH5CPTRINV                  SIM_SFR(0xBF8834CCUL)
+#define DCH5DAT                      SIM_SFR(0xBF8834D0UL)
+#define DCH5DATCLR                   SIM_SFR(0xBF8834D4UL)
+#define DCH5DATSET                   SIM_SFR(0xBF8834D8UL)
+#define DCH5DATINV                   SIM_SFR(0xBF8834DCUL)
+#define _DMAC6_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF8834E0UL)
+#define DCH6CON                      SIM_SFR(0xBF8834E0UL)
+#define DCH6CONCLR                   SIM_SFR(0xBF8834E4UL)
+#define DCH6CONSET                   SIM_SFR(0xBF8834E8UL)
+#define DCH6CONINV                   SIM_SFR(0xBF8834ECUL)
+#define DCH6ECON                     SIM_SFR(0xBF8834F0UL)
+#define DCH6ECONCLR                  SIM_SFR(0xBF8834F4UL)
+#define DCH6ECONSET                  SIM_SFR(0xBF8834F8UL)
+#define DCH6ECONINV                  SIM_SFR(0xBF8834FCUL)
+#define DCH6INT                      SIM_SFR(0xBF883500UL)
+#define DCH6INTCLR                   SIM_SFR(0xBF883504UL)
+#define DCH6INTSET                   SIM_SFR(0xBF883508UL)
+#define DCH6INTINV                   SIM_SFR(0xBF88350CUL)
+#define DCH6SSA                      SIM_SFR(0xBF883510UL)
+#define DCH6SSACLR                   SIM_SFR(0xBF883514UL)
+#define DCH6SSASET                   SIM_SFR(0xBF883518UL)
+#define DCH6SSAINV                   SIM_SFR(0xBF88351CUL)
+#define DCH6DSA                      SIM_SFR(0xBF883520UL)
+#define DCH6DSACLR                   SIM_SFR(0xBF883524UL)
+#define DCH6DSASET                   SIM_SFR(0xBF883528UL)
+#define DCH6DSAINV                   SIM_SFR(0xBF88352CUL)
+#define DCH6SSIZ                     SIM_SFR(0xBF883530UL)
+#define DCH6SSIZCLR                  SIM_SFR(0xBF883534UL)
+#define DCH6SSIZSET                  SIM_SFR(0xBF883538UL)
+#define DCH6SSIZINV                  SIM_SFR(0xBF88353CUL)
+#define DCH6DSIZ                     SIM_SFR(0xBF883540UL)
+#define DCH6DSIZCLR                  SIM_SFR(0xBF883544UL)
+#define DCH6DSIZSET                  SIM_SFR(0xBF883548UL)
+#define DCH6DSIZINV                  SIM_SFR(0xBF88354CUL)
+#define DCH6SPTR                     SIM_SFR(0xBF883550UL)
+#define DCH6SPTRCLR                  SIM_SFR(0xBF883554UL)
+#define DCH6SPTRSET                  SIM_SFR(0xBF883558UL)
+#define DCH6SPTRINV                  SIM_SFR(0xBF88355CUL)
+#define DCH6DPTR                     SIM_SFR(0xBF883560UL)
+#define DCH6DPTRCLR                  SIM_SFR(0xBF883564UL)
+#define DCH6DPTRSET                  SIM_SFR(0xBF883568UL)
+#define DCH6DPTRINV                  SIM_SFR(0xBF88356CUL)
+#define DCH6CSIZ                     SIM_SFR(0xBF883570UL)
+#define DCH6CSIZCLR                  SIM_SFR(0xBF883574UL)
+#define DCH6CSIZSET                  SIM_SFR(0xBF883578UL)
+#define DCH6CSIZINV                  SIM_SFR(0xBF88357CUL)
+#define DCH6CPTR                     SIM_SFR(0xBF883580UL)
+#define DCH6CPTRCLR                  SIM_SFR(0xBF883584UL)
+#define DCH6CPTRSET                  SIM_SFR(0xBF883588UL)
+#define DCH6CPTRINV                  SIM_SFR(0xBF88358CUL)
+#define DCH6DAT                      SIM_SFR(0xBF883590UL)
+#define DCH6DATCLR                   SIM_SFR(0xBF883594UL)
+#define DCH6DATSET                   SIM_SFR(0xBF883598UL)
+#define DCH6DATINV                   SIM_SFR(0xBF88359CUL)
+#define _DMAC7_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF8835A0UL)
+#define DCH7CON                      SIM_SFR(0xBF8835A0UL)
+#define DCH7CONCLR                   SIM_SFR(0xBF8835A4UL)
+#define DCH7CONSET                   SIM_SFR(0xBF8835A8UL)
+#define DCH7CONINV                   SIM_SFR(0xBF8835ACUL)
+#define DCH7ECON                     SIM_SFR(0xBF8835B0UL)
+#define DCH7ECONCLR                  SIM_SFR(0xBF8835B4UL)
+#define DCH7ECONSET                  SIM_SFR(0xBF8835B8UL)
+#define DCH7ECONINV                  SIM_SFR(0xBF8835BCUL)
+#define DCH7INT                      SIM_SFR(0xBF8835C0UL)
+#define DCH7INTCLR                   SIM_SFR(0xBF8835C4UL)
+#define DCH7INTSET                   SIM_SFR(0xBF8835C8UL)
+#define DCH7INTINV                   SIM_SFR(0xBF8835CCUL)
+#define DCH7SSA                      SIM_SFR(0xBF8835D0UL)
+#define DCH7SSACLR                   SIM_SFR(0xBF8835D4UL)
+#define DCH7SSASET                   SIM_SFR(0xBF8835D8UL)
+#define DCH7SSAINV                   SIM_SFR(0xBF8835DCUL)
+#define DCH7DSA                      SIM_SFR(0xBF8835E0UL)
+#define DCH7DSACLR                   SIM_SFR(0xBF8835E4UL)
+#define DCH7DSASET                   SIM_SFR(0xBF8835E8UL)
+#define DCH7DSAINV                   SIM_SFR(0xBF8835ECUL)
+#define DCH7SSIZ                     SIM_SFR(0xBF8835F0UL)
+#define DCH7SSIZCLR                  SIM_SFR(0xBF8835F4UL)
+#define DCH7SSIZSET                  SIM_SFR(0xBF8835F8UL)
+#define DCH7SSIZINV                  SIM_SFR(0xBF8835FCUL)
+#define DCH7DSIZ                     SIM_SFR(0xBF883600UL)
+#define DCH7DSIZCLR                  SIM_SFR(0xBF883604UL)
+#define DCH7DSIZSET                  SIM_SFR(0xBF883608UL)
+#define DCH7DSIZINV                  SIM_SFR(0xBF88360CUL)
+#define DCH7SPTR                     SIM_SFR(0xBF883610UL)
+#define DCH7SPTRCLR                  SIM_SFR(0xBF883614UL)
+#define DCH7SPTRSET                  SIM_SFR(0xBF883618UL)
+#define DCH7SPTRINV                  SIM_SFR(0xBF88361CUL)
+#define DCH7DPTR                     SIM_SFR(0xBF883620UL)
+#define DCH7DPTRCLR                  SIM_SFR(0xBF883624UL)
+#define DCH7DPTRSET                  SIM_SFR(0xBF883628UL)
+#define DCH7DPTRINV                  SIM_SFR(0xBF88362CUL)
+#define DCH7CSIZ                     SIM_SFR(0xBF883630UL)
+#define DCH7CSIZCLR                  SIM_SFR(0xBF883634UL)
+#define DCH7CSIZSET                  SIM_SFR(0xBF883638UL)
+#define DCH7CSIZINV                  SIM_SFR(0xBF88363CUL)
+#define DCH7CPTR                     SIM_SFR(0xBF883640UL)
+#define DCH7CPTRCLR                  SIM_SFR(0xBF883644UL)
+#define DCH7CPTRSET                  SIM_SFR(0xBF883648UL)
+#define DCH7CPTRINV                  SIM_SFR(0xBF88364CUL)
+#define DCH7DAT                      SIM_SFR(0xBF883650UL)
+#define DCH7DATCLR                   SIM_SFR(0xBF883654UL)
+#define DCH7DATSET                   SIM_SFR(0xBF883658UL)
+#define DCH7DATINV                   SIM_SFR(0xBF88365CUL)
+
+/*******************************************************************************
+ * Ports
+ ******************************************************************************/
+#define _PORTA_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF886000UL)
+#define TRISA                        SIM_SFR(0xBF886000UL)
+#define TRISACLR                     SIM_SFR(0xBF886004UL)
+#define TRISASET                     SIM_SFR(0xBF886008UL)
+#define TRISAINV                     SIM_SFR(0xBF88600CUL)
+#define PORTA                        SIM_SFR(0xBF886010UL)
+#define PORTACLR                     SIM_SFR(0xBF886014UL)
+#define PORTASET                     SIM_SFR(0xBF886018UL)
+#define PORTAINV                     SIM_SFR(0xBF88601CUL)
+#define LATA                         SIM_SFR(0xBF886020UL)
+#define LATACLR                      SIM_SFR(0xBF886024UL)
+#define LATASET                      SIM_SFR(0xBF886028UL)
+#define LATAINV                      SIM_SFR(0xBF88602CUL)
+#define ODCA                         SIM_SFR(0xBF886030UL)
+#define ODCACLR                      SIM_SFR(0xBF886034UL)
+#define ODCASET                      SIM_SFR(0xBF886038UL)
+#define ODCAINV                      SIM_SFR(0xBF88603CUL)
+#define _PORTB_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF886040UL)
+#define TRISB                        SIM_SFR(0xBF886040UL)
+#define TRISBCLR                     SIM_SFR(0xBF886044UL)
+#define TRISBSET                     SIM_SFR(0xBF886048UL)
+#define TRISBINV                     SIM_SFR(0xBF88604CUL)
+#define PORTB                        SIM_SFR(0xBF886050UL)
+#define PORTBCLR                     SIM_SFR(0xBF886054UL)
+#define PORTBSET                     SIM_SFR(0xBF886058UL)
+#define PORTBINV                     SIM_SFR(0xBF88605CUL)
+#define LATB                         SIM_SFR(0xBF886060UL)
+#define LATBCLR                      SIM_SFR(0xBF886064UL)
+#define LATBSET                      SIM_SFR(0xBF886068UL)
+#define LATBINV                      SIM_SFR(0xBF88606CUL)
+#define ODCB                         SIM_SFR(0xBF886070UL)
+#define ODCBCLR                      SIM_SFR(0xBF886074UL)
+#define ODCBSET                      SIM_SFR(0xBF886078UL)
+#define ODCBINV                      SIM_SFR(0xBF88607CUL)
+#define _PORTC_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF886080UL)
+#define TRISC                        SIM_SFR(0xBF886080UL)
+#define TRISCCLR                     SIM_SFR(0xBF886084UL)
+#define TRISCSET                     SIM_SFR(0xBF886088UL)
+#define TRISCINV                     SIM_SFR(0xBF88608CUL)
+#define PORTC                        SIM_SFR(0xBF886090UL)
+#define PORTCCLR                     SIM_SFR(0xBF886094UL)
+#define PORTCSET                     SIM_SFR(0xBF886098UL)
+#define PORTCINV                     SIM_SFR(0xBF88609CUL)
+#define LATC                         SIM_SFR(0xBF8860A0UL)
+#define LATCCLR                      SIM_SFR(0xBF8860A4UL)
+#define LATCSET                      SIM_SFR(0xBF8860A8UL)
+#define LATCINV                      SIM_SFR(0xBF8860ACUL)
+#define ODCC                         SIM_SFR(0xBF8860B0UL)
+#define ODCCCLR                      SIM_SFR(0xBF8860B4UL)
+#define ODCCSET                      SIM_SFR(0xBF8860B8UL)
+#define ODCCINV                      SIM_SFR(0xBF8860BCUL)
+#define _PORTD_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF8860C0UL)
+#define TRISD                        SIM_SFR(0xBF8860C0UL)
+#define TRISDCLR                     SIM_SFR(0xBF8860C4UL)
+#define TRISDSET                     SIM_SFR(0xBF8860C8UL)
+#define TRISDINV                     SIM_SFR(0xBF8860CCUL)
+#define PORTD                        SIM_SFR(0xBF8860D0UL)
+#define PORTDCLR                     SIM_SFR(0xBF8860D4UL)
+#define PORTDSET                     SIM_SFR(0xBF8860D8UL)
+#define PORTDINV                     SIM_SFR(0xBF8860DCUL)
+#define LATD                         SIM_SFR(0xBF8860E0UL)
+#define LATDCLR                      SIM_SFR(0xBF8860E4UL)
+#define LATDSET                      SIM_SFR(0xBF8860E8UL)
+#define LATDINV                      SIM_SFR(0xBF8860ECUL)
+#define ODCD                         SIM_SFR(0xBF8860F0UL)
+#define ODCDCLR                      SIM_SFR(0xBF8860F4UL)
+#define ODCDSET                      SIM_SFR(0xBF8860F8UL)
+#define ODCDINV                      SIM_SFR(0xBF8860FCUL)
+#define _PORTE_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF886100UL)
+#define TRISE                        SIM_SFR(0xBF886100UL)
+#define TRISECLR                     SIM_SFR(0xBF886104UL)
+#define TRISESET                     SIM_SFR(0xBF886108UL)
+#define TRISEINV                     SIM_SFR(0xBF88610CUL)
+#define PORTE                        SIM_SFR(0xBF886110UL)
+#define PORTECLR                     SIM_SFR(0xBF886114UL)
+#define PORTESET                     SIM_SFR(0xBF886118UL)
+#define PORTEINV                     SIM_SFR(0xBF88611CUL)
+#define LATE                         SIM_SFR(0xBF886120UL)
+#define LATECLR                      SIM_SFR(0xBF886124UL)
+#define LATESET                      SIM_SFR(0xBF886128UL)
+#define LATEINV                      SIM_SFR(0xBF88612CUL)
+#define ODCE                         SIM_SFR(0xBF886130UL)
+#define ODCECLR                      SIM_SFR(0xBF886134UL)
+#define ODCESET                      SIM_SFR(0xBF886138UL)
+#define ODCEINV                      SIM_SFR(0xBF88613CUL)
+#define _PORTF_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF886140UL)
+#define TRISF                        SIM_SFR(0xBF886140UL)
+#define TRISFCLR                     SIM_SFR(0xBF886144UL)
+#define TRISFSET                     SIM_SFR(0xBF886148UL)
+#define TRISFINV                     SIM_SFR(0xBF88614CUL)
+#define PORTF                        SIM_SFR(0xBF886150UL)
+#define PORTFCLR                     SIM_SFR(0xBF886154UL)
+#define PORTFSET                     SIM_SFR(0xBF886158UL)
+#define PORTFINV                     SIM_SFR(0xBF88615CUL)
+#define LATF                         SIM_SFR(0xBF886160UL)
+#define LATFCLR                      SIM_SFR(0xBF886164UL)
+#define LATFSET                      SIM_SFR(0xBF886168UL)
+#define LATFINV                      SIM_SFR(0xBF88616CUL)
+#define ODCF                         SIM_SFR(0xBF886170UL)
+#define ODCFCLR                      SIM_SFR(0xBF886174UL)
+#define ODCFSET                      SIM_SFR(0xBF886178UL)
+#define ODCFINV                      SIM_SFR(0xBF88617CUL)
+#define _PORTG_BASE_ADDRESS                  SIM_SFR_ADDRESS(0xBF886180UL)
+#define TRISG                        SIM_SFR(0xBF886180UL)
+#define TRISGCLR                     SIM_SFR(0xBF886184UL)
+#define TRISGSET                     SIM_SFR(0xBF886188UL)
+#define TRISGINV                     SIM_SFR(0xBF88618CUL)
+#define PORTG                        SIM_SFR(0xBF886190UL)
+#define PORTGCLR                     SIM_SFR(0xBF886194UL)
+#define PORTGSET                     SIM_SFR(0xBF886198UL)
+#define PORTGINV                     SIM_SFR(0xBF88619CUL)
+#define LATG                         SIM_SFR(0xBF8861A0UL)
+#define LATGCLR                      SIM_SFR(0xBF8861A4UL)
+#define LATGSET                      SIM_SFR(0xBF8861A8UL)
+#define LATGINV                      SIM_SFR(0xBF8861ACUL)
+#define ODCG                         SIM_SFR(0xBF8861B0UL)
+#define ODCGCLR                      SIM_SFR(0xBF8861B4UL)
+#define ODCGSET                      SIM_SFR(0xBF8861B8UL)
+#define ODCGINV                      SIM_SFR(0xBF8861BCUL)
+#define CNCON                        SIM_SFR(0xBF8861C0UL)
+#define CNCONCLR                     SIM_SFR(0xBF8861C4UL)
+#define CNCONSET                     SIM_SFR(0xBF8861C8UL)
+#define CNCONINV                     SIM_SFR(0xBF8861CCUL)
+#define CNEN                         SIM_SFR(0xBF8861D0UL)
+#define CNENCLR                      SIM_SFR(0xBF8861D4UL)
+#define CNENSET                      SIM_SFR(0xBF8861D8UL)
+#define CNENINV                      SIM_SFR(0xBF8861DCUL)
+#define CNPUE                        SIM_SFR(0xBF8861E0UL)
+#define CNPUECLR                     SIM_SFR(0xBF8861E4UL)
+#define CNPUESET                     SIM_SFR(0xBF8861E8UL)
+#define CNPUEINV                     SIM_SFR(0xBF8861ECUL)
+typedef union
+{
+    struct
+    {
+        unsigned TRISA0:1;
+        unsigned TRISA1:1;
+        unsigned TRISA2:1;
+        unsigned TRISA3:1;
+        unsigned TRISA4:1;
+        unsigned TRISA5:1;
+        unsigned TRISA6:1;
+        unsigned TRISA7:1;
+        unsigned TRISA8:1;
+        unsigned TRISA9:1;
+        unsigned TRISA10:1;
+        unsigned TRISA11:1;
+        unsigned TRISA12:1;
+        unsigned TRISA13:1;
+        unsigned TRISA14:1;
+        unsigned TRISA15:1;
+    };
+    uint32_t w;
+} __TRISAbits_t;
+#define TRISAbits                    (*(volatile __TRISAbits_t *) &TRISA)
+
+typedef union
+{
+    struct
+    {
+        unsigned RA0:1;
+        unsigned RA1:1;
+        unsigned RA2:1;
+        unsigned RA3:1;
+        unsigned RA4:1;
+        unsigned RA5:1;
+        unsigned RA6:1;
+        unsigned RA7:1;
+        unsigned RA8:1;
+        unsigned RA9:1;
+        unsigned RA10:1;
+        unsigned RA11:1;
+        unsigned RA12:1;
+        unsigned RA13:1;
+        unsigned RA14:1;
+        unsigned RA15:1;
+    };
+    uint32_t w;
+} __PORTAbits_t;
+#define PORTAbits                    (*(volatile __PORTAbits_t *) &PORTA)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATA0:1;
+        unsigned LATA1:1;
+        unsigned LATA2:1;
+        unsigned LATA3:1;
+        unsigned LATA4:1;
+        unsigned LATA5:1;
+        unsigned LATA6:1;
+        unsigned LATA7:1;
+        unsigned LATA8:1;
+        unsigned LATA9:1;
+        unsigned LATA10:1;
+        unsigned LATA11:1;
+        unsigned LATA12:1;
+        unsigned LATA13:1;
+        unsigned LATA14:1;
+        unsigned LATA15:1;
+    };
+    uint32_t w;
+} __LATAbits_t;
+#define LATAbits                     (*(volatile __LATAbits_t *) &LATA)
+
+typedef union
+{
+    struct
+    {
+        unsigned TRISB0:1;
+        unsigned TRISB1:1;
+        unsigned TRISB2:1;
+        unsigned TRISB3:1;
+        unsigned TRISB4:1;
+        unsigned TRISB5:1;
+        unsigned TRISB6:1;
+        unsigned TRISB7:1;
+        unsigned TRISB8:1;
+        unsigned TRISB9:1;
+        unsigned TRISB10:1;
+        unsigned TRISB11:1;
+        unsigned TRISB12:1;
+        unsigned TRISB13:1;
+        unsigned TRISB14:1;
+        unsigned TRISB15:1;
+    };
+    uint32_t w;
+} __TRISBbits_t;
+#define TRISBbits                    (*(volatile __TRISBbits_t *) &TRISB)
+
+typedef union
+{
+    struct
+    {
+        unsigned RB0:1;
+        unsigned RB1:1;
+        unsigned RB2:1;
+        unsigned RB3:1;
+        unsigned RB4:1;
+        unsigned RB5:1;
+        unsigned RB6:1;
+        unsigned RB7:1;
+        unsigned RB8:1;
+        unsigned RB9:1;
+        unsigned RB10:1;
+        unsigned RB11:1;
+        unsigned RB12:1;
+        unsigned RB13:1;
+        unsigned RB14:1;
+        unsigned RB15:1;
+    };
+    uint32_t w;
+} __PORTBbits_t;
+#define PORTBbits                    (*(volatile __PORTBbits_t *) &PORTB)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATB0:1;
+        unsigned LATB1:1;
+        unsigned LATB2:1;
+        unsigned LATB3:1;
+        unsigned LATB4:1;
+        unsigned LATB5:1;
+        unsigned LATB6:1;
+        unsigned LATB7:1;
+        unsigned LATB8:1;
+        unsigned LATB9:1;
+        unsigned LATB10:1;
+        unsigned LATB11:1;
+        unsigned LATB12:1;
+        unsigned LATB13:1;
+        unsigned LATB14:1;
+        unsigned LATB15:1;
+    };
+    uint32_t w;
+} __LATBbits_t;
+#define LATBbits                     (*(volatile __LATBbits_t *) &LATB)
+
+typedef union
+{
+    struct
+    {
+        unsigned TRISC0:1;
+        unsigned TRISC1:1;
+        unsigned TRISC2:1;
+        unsigned TRISC3:1;
+        unsigned TRISC4:1;
+        unsigned TRISC5:1;
+        unsigned TRISC6:1;
+        unsigned TRISC7:1;
+        unsigned TRISC8:1;
+        unsigned TRISC9:1;
+        unsigned TRISC10:1;
+        unsigned TRISC11:1;
+        unsigned TRISC12:1;
+        unsigned TRISC13:1;
+        unsigned TRISC14:1;
+        unsigned TRISC15:1;
+    };
+    uint32_t w;
+} __TRISCbits_t;
+#define TRISCbits                    (*(volatile __TRISCbits_t *) &TRISC)
+
+typedef union
+{
+    struct
+    {
+        unsigned RC0:1;
+        unsigned RC1:1;
+        unsigned RC2:1;
+        unsigned RC3:1;
+        unsigned RC4:1;
+        unsigned RC5:1;
+        unsigned RC6:1;
+        unsigned RC7:1;
+        unsigned RC8:1;
+        unsigned RC9:1;
+        unsigned RC10:1;
+        unsigned RC11:1;
+        unsigned RC12:1;
+        unsigned RC13:1;
+        unsigned RC14:1;
+        unsigned RC15:1;
+    };
+    uint32_t w;
+} __PORTCbits_t;
+#define PORTCbits                    (*(volatile __PORTCbits_t *) &PORTC)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATC0:1;
+        unsigned LATC1:1;
+        unsigned LATC2:1;
+        unsigned LATC3:1;
+        unsigned LATC4:1;
+        unsigned LATC5:1;
+        unsigned LATC6:1;
+        unsigned LATC7:1;
+        unsigned LATC8:1;
+        unsigned LATC9:1;
+        unsigned LATC10:1;
+        unsigned LATC11:1;
+        unsigned LATC12:1;
+        unsigned LATC13:1;
+        unsigned LATC14:1;
+        unsigned LATC15:1;
+    };
+    uint32_t w;
+} __LATCbits_t;
+#define LATCbits                     (*(volatile __LATCbits_t *) &LATC)
+
+typedef union
+{
+    struct
+    {
+        unsigned TRISD0:1;
+        unsigned TRISD1:1;
+        unsigned TRISD2:1;
+        unsigned TRISD3:1;
+        unsigned TRISD4:1;
+        unsigned TRISD5:1;
+        unsigned TRISD6:1;
+        unsigned TRISD7:1;
+        unsigned TRISD8:1;
+        unsigned TRISD9:1;
+        unsigned TRISD10:1;
+        unsigned TRISD11:1;
+        unsigned TRISD12:1;
+        unsigned TRISD13:1;
+        unsigned TRISD14:1;
+        unsigned TRISD15:1;
+    };
+    uint32_t w;
+} __TRISDbits_t;
+#define TRISDbits                    (*(volatile __TRISDbits_t *) &TRISD)
+
+typedef union
+{
+    struct
+    {
+        unsigned RD0:1;
+        unsigned RD1:1;
+        unsigned RD2:1;
+        unsigned RD3:1;
+        unsigned RD4:1;
+        unsigned RD5:1;
+        unsigned RD6:1;
+        unsigned RD7:1;
+        unsigned RD8:1;
+        unsigned RD9:1;
+        unsigned RD10:1;
+        unsigned RD11:1;
+        unsigned RD12:1;
+        unsigned RD13:1;
+        unsigned RD14:1;
+        unsigned RD15:1;
+    };
+    uint32_t w;
+} __PORTDbits_t;
+#define PORTDbits                    (*(volatile __PORTDbits_t *) &PORTD)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATD0:1;
+        unsigned LATD1:1;
+        unsigned LATD2:1;
+        unsigned LATD3:1;
+        unsigned LATD4:1;
+        unsigned LATD5:1;
+        unsigned LATD6:1;
+        unsigned LATD7:1;
+        unsigned LATD8:1;
+        unsigned LATD9:1;
+        unsigned LATD10:1;
+        unsigned LATD11:1;
+        unsigned LATD12:1;
+        unsigned LATD13:1;
+        unsigned LATD14:1;
+        unsigned LATD15:1;
+    };
+    uint32_t w;
+} __LATDbits_t;
+#define LATDbits                     (*(volatile __LATDbits_t *) &LATD)
+
+typedef union
+{
+    struct
+    {
+        unsigned TRISE0:1;
+        unsigned TRISE1:1;
+        unsigned TRISE2:1;
+        unsigned TRISE3:1;
+        unsigned TRISE4:1;
+        unsigned TRISE5:1;
+        unsigned TRISE6:1;
+        unsigned TRISE7:1;
+        unsigned TRISE8:1;
+        unsigned TRISE9:1;
+        unsigned TRISE10:1;
+        unsigned TRISE11:1;
+        unsigned TRISE12:1;
+        unsigned TRISE13:1;
+        unsigned TRISE14:1;
+        unsigned TRISE15:1;
+    };
+    uint32_t w;
+} __TRISEbits_t;
+#define TRISEbits                    (*(volatile __TRISEbits_t *) &TRISE)
+
+typedef union
+{
+    struct
+    {
+        unsigned RE0:1;
+        unsigned RE1:1;
+        unsigned RE2:1;
+        unsigned RE3:1;
+        unsigned RE4:1;
+        unsigned RE5:1;
+        unsigned RE6:1;
+        unsigned RE7:1;
+        unsigned RE8:1;
+        unsigned RE9:1;
+        unsigned RE10:1;
+        unsigned RE11:1;
+        unsigned RE12:1;
+        unsigned RE13:1;
+        unsigned RE14:1;
+        unsigned RE15:1;
+    };
+    uint32_t w;
+} __PORTEbits_t;
+#define PORTEbits                    (*(volatile __PORTEbits_t *) &PORTE)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATE0:1;
+        unsigned LATE1:1;
+        unsigned LATE2:1;
+        unsigned LATE3:1;
+        unsigned LATE4:1;
+        unsigned LATE5:1;
+        unsigned LATE6:1;
+        unsigned LATE7:1;
+        unsigned LATE8:1;
+        unsigned LATE9:1;
+        unsigned LATE10:1;
+        unsigned LATE11:1;
+        unsigned LATE12:1;
+        unsigned LATE13:1;
+        unsigned LATE14:1;
+        unsigned LATE15:1;
+    };
+    uint32_t w;
+} __LATEbits_t;
+#define LATEbits                     (*(volatile __LATEbits_t *) &LATE)
+
+typedef union
+{
+    struct
+    {
+        unsigned TRISF0:1;
+        unsigned TRISF1:1;
+        unsigned TRISF2:1;
+        unsigned TRISF3:1;
+        unsigned TRISF4:1;
+        unsigned TRISF5:1;
+        unsigned TRISF6:1;
+        unsigned TRISF7:1;
+        unsigned TRISF8:1;
+        unsigned TRISF9:1;
+        unsigned TRISF10:1;
+        unsigned TRISF11:1;
+        unsigned TRISF12:1;
+        unsigned TRISF13:1;
+        unsigned TRISF14:1;
+        unsigned TRISF15:1;
+    };
+    uint32_t w;
+} __TRISFbits_t;
+#define TRISFbits                    (*(volatile __TRISFbits_t *) &TRISF)
+
+typedef union
+{
+    struct
+    {
+        unsigned RF0:1;
+        unsigned RF1:1;
+        unsigned RF2:1;
+        unsigned RF3:1;
+        unsigned RF4:1;
+        unsigned RF5:1;
+        unsigned RF6:1;
+        unsigned RF7:1;
+        unsigned RF8:1;
+        unsigned RF9:1;
+        unsigned RF10:1;
+        unsigned RF11:1;
+        unsigned RF12:1;
+        unsigned RF13:1;
+        unsigned RF14:1;
+        unsigned RF15:1;
+    };
+    uint32_t w;
+} __PORTFbits_t;
+#define PORTFbits                    (*(volatile __PORTFbits_t *) &PORTF)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATF0:1;
+        unsigned LATF1:1;
+        unsigned LATF2:1;
+        unsigned LATF3:1;
+        unsigned LATF4:1;
+        unsigned LATF5:1;
+        unsigned LATF6:1;
+        unsigned LATF7:1;
+        unsigned LATF8:1;
+        unsigned LATF9:1;
+        unsigned LATF10:1;
+        unsigned LATF11:1;
+        unsigned LATF12:1;
+        unsigned LATF13:1;
+        unsigned LATF14:1;
+        unsigned LATF15:1;
+    };
+    uint32_t w;
+} __LATFbits_t;
+#define LATFbits                     (*(volatile __LATFbits_t *) &LATF)
+
+typedef union
+{
+    struct
+    {
+        unsigned TRISG0:1;
+        unsigned TRISG1:1;
+        unsigned TRISG2:1;
+        unsigned TRISG3:1;
+        unsigned TRISG4:1;
+        unsigned TRISG5:1;
+        unsigned TRISG6:1;
+        unsigned TRISG7:1;
+        unsigned TRISG8:1;
+        unsigned TRISG9:1;
+        unsigned TRISG10:1;
+        unsigned TRISG11:1;
+        unsigned TRISG12:1;
+        unsigned TRISG13:1;
+        unsigned TRISG14:1;
+        unsigned TRISG15:1;
+    };
+    uint32_t w;
+} __TRISGbits_t;
+#define TRISGbits                    (*(volatile __TRISGbits_t *) &TRISG)
+
+typedef union
+{
+    struct
+    {
+        unsigned RG0:1;
+        unsigned RG1:1;
+        unsigned RG2:1;
+        unsigned RG3:1;
+        unsigned RG4:1;
+        unsigned RG5:1;
+        unsigned RG6:1;
+        unsigned RG7:1;
+        unsigned RG8:1;
+        unsigned RG9:1;
+        unsigned RG10:1;
+        unsigned RG11:1;
+        unsigned RG12:1;
+        unsigned RG13:1;
+        unsigned RG14:1;
+        unsigned RG15:1;
+    };
+    uint32_t w;
+} __PORTGbits_t;
+#define PORTGbits                    (*(volatile __PORTGbits_t *) &PORTG)
+
+typedef union
+{
+    struct
+    {
+        unsigned LATG0:1;
+        unsigned LATG1:1;
+        unsigned LATG2:1;
+        unsigned LATG3:1;
+        unsigned LATG4:1;
+        unsigned LATG5:1;
+        unsigned LATG6:1;
+        unsigned LATG7:1;
+        unsigned LATG8:1;
+        unsigned LATG9:1;
+        unsigned LATG10:1;
+        unsigned LATG11:1;
+        unsigned LATG12:1;
+        unsigned LATG13:1;
+        unsigned LATG14:1;
+        unsigned LATG15:1;
+    };
+    uint32_t w;
+} __LATGbits_t;
+#define LATGbits                     (*(volatile __LATGbits_t *) &LATG)
+
+
+/*******************************************************************************
+ * System
+ ******************************************************************************/
+#define DDPCON                       SIM_SFR(0xBF80F200UL)
+#define DDPCONCLR                    SIM_SFR(0xBF80F204UL)
+#define DDPCONSET                    SIM_SFR(0xBF80F208UL)
+#define DDPCONINV                    SIM_SFR(0xBF80F20CUL)
+
+typedef union
+{
+    struct
+    {
+        unsigned :2;
+        unsigned TROEN:1;
+        unsigned JTAGEN:1;
+    };
+    uint32_t w;
+} __DDPCONbits_t;
+#define DDPCONbits                   (*(volatile __DDPCONbits_t *) &DDPCON)
+
+/*******************************************************************************
+ * Ethernet
+ ******************************************************************************/
+#define ETHCON1                      SIM_SFR(0xBF889000UL)
+#define ETHCON1CLR                   SIM_SFR(0xBF889004UL)
+#define ETHCON1SET                   SIM_SFR(0xBF889008UL)
+#define ETHCON1INV                   SIM_SFR(0xBF88900CUL)
+#define ETHCON2                      SIM_SFR(0xBF889010UL)
+#define ETHCON2CLR                   SIM_SFR(0xBF889014UL)
+#define ETHCON2SET                   SIM_SFR(0xBF889018UL)
+#define ETHCON2INV                   SIM_SFR(0xBF88901CUL)
+#define ETHSTAT                      SIM_SFR(0xBF889050UL)
+#define ETHSTATCLR                   SIM_SFR(0xBF889054UL)
+#define ETHSTATSET                   SIM_SFR(0xBF889058UL)
+#define ETHSTATINV                   SIM_SFR(0xBF88905CUL)
+#define EMAC1SA0                     SIM_SFR(0xBF889300UL)
+#define EMAC1SA0CLR                  SIM_SFR(0xBF889304UL)
+#define EMAC1SA0SET                  SIM_SFR(0xBF889308UL)
+#define EMAC1SA0INV                  SIM_SFR(0xBF88930CUL)
+#define EMAC1SA1                     SIM_SFR(0xBF889310UL)
+#define EMAC1SA1CLR                  SIM_SFR(0xBF889314UL)
+#define EMAC1SA1SET                  SIM_SFR(0xBF889318UL)
+#define EMAC1SA1INV                  SIM_SFR(0xBF88931CUL)
+#define EMAC1SA2                     SIM_SFR(0xBF889320UL)
+#define EMAC1SA2CLR                  SIM_SFR(0xBF889324UL)
+#define EMAC1SA2SET                  SIM_SFR(0xBF889328UL)
+#define EMAC1SA2INV                  SIM_SFR(0xBF88932CUL)
+#define EMACxSA0                             EMAC1SA0
+#define EMACxSA1                             EMAC1SA1
+#define EMACxSA2                             EMAC1SA2
+
+/*******************************************************************************
+ * CAN
+ ******************************************************************************/
+#define _CAN1_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF88B000UL)
+#define _CAN2_BASE_ADDRESS                   SIM_SFR_ADDRESS(0xBF88C000UL)
+#define C1CON                        SIM_SFR(0xBF88B000UL)
+#define C1CONCLR                     SIM_SFR(0xBF88B004UL)
+#define C1CONSET                     SIM_SFR(0xBF88B008UL)
+#define C1CONINV                     SIM_SFR(0xBF88B00CUL)
+#define C2CON                        SIM_SFR(0xBF88C000UL)
+#define C2CONCLR                     SIM_SFR(0xBF88C004UL)
+#define C2CONSET                     SIM_SFR(0xBF88C008UL)
+#define C2CONINV                     SIM_SFR(0xBF88C00CUL)
+
+/*******************************************************************************
+ * Configuration words
+ ******************************************************************************/
+typedef struct
+{
+    unsigned USERID:16;
+    unsigned :8;
+    unsigned FMIIEN:1;
+    unsigned FETHIO:1;
+    unsigned :6;
+} __DEVCFG3bits_t;
+
+extern __DEVCFG3bits_t sim_devcfg3bits;
+#define DEVCFG3bits                 sim_devcfg3bits
+
+#endif
@@ -0,0 +1,117 @@
+/*********************************************************************
+*	Host simulation - register-level model of the PIC32MX795F512L
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The library is built unchanged for the host: <xc.h> maps every SFR
+*   at its device address inside sim_sfr[] and the plib functions used
+*   by the drivers (DMA, CAN, ETH) are implemented by the simulation.
+*
+*   Two modes:
+*   - SIM_MODE_TRAP: sim_sfr[] is protected, every access of the library
+*     traps (SIGSEGV + single step) and runs the peripheral models. The
+*     CLR / SET / INV registers, the flags, the DMA transfers, the timers
+*     ... behave as on the device. The time advances by sim_access_cost
+*     cycles at each access (accesses to the RAM are free).
+*   - SIM_MODE_FLAT: sim_sfr[] is plain memory (no model on the accesses),
+*     used by the benchmarks to measure the host cycles of the algorithms.
+*     The time does not advance by itself and the writes to the CLR / SET /
+*     INV registers are only applied when the trap mode is restored.
+*
+*   The interrupt handlers are plain functions attached to their IRQ_SOURCE
+*   with sim_irq_attach(). They are called when the flag, the enable bit
+*   and the priority (IPC, compared to the current IPL) allow it, between
+*   two accesses of the library, as the CPU would do.
+*********************************************************************/
+
+#ifndef __HOST_SIM_H
+#define __HOST_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum
+{
+    SIM_MODE_TRAP = 0,
+    SIM_MODE_FLAT
+} SIM_MODE;
+
+#define SIM_CLOCK_FREQ              80000000ull     // SYSCLK = PBCLK
+#define SIM_US(x)                   ((uint64_t) (x) * (SIM_CLOCK_FREQ / 1000000ull))
+#define SIM_MS(x)                   ((uint64_t) (x) * (SIM_CLOCK_FREQ / 1000ull))
+
+// Core
+void sim_init(SIM_MODE mode);                       // Reset of the models and of the SFR space
+void sim_set_mode(SIM_MODE mode);                   // The drivers can be initialized in trap mode before a benchmark
+SIM_MODE sim_get_mode(void);
+uint64_t sim_now(void);                             // Simulated time (SYSCLK cycles)
+void sim_advance(uint64_t cycles);                  // Let the time run (models + interrupts)
+void sim_set_access_cost(uint32_t cycles);          // Cycles added by each SFR access (trap mode, 2 after sim_init)
+uint64_t sim_get_access_count(void);                // Number of SFR accesses (trap mode)
+void sim_core_timer_set(uint32_t value);            // Next value of _CP0_GET_COUNT()
+bool sim_interrupts_enabled(void);
+uint32_t sim_get_ipl(void);
+
+// Interrupts (source = IRQ_SOURCE of s08_interrupt_mapping.h, irq = _xxx_IRQ of <xc.h>)
+typedef void (*sim_isr_t)(void);
+void sim_irq_attach(uint32_t source, sim_isr_t isr);
+void sim_irq_detach_all(void);
+void sim_irq_raise(uint32_t irq);                   // Sets the flag, starts the DMA channels waiting for it
+bool sim_irq_flag(uint32_t irq);
+
+// Ports (port = _IO._port: 1 = PORTA ... 7 = PORTG)
+typedef void (*sim_pin_callback_t)(void *p_context, bool level);
+bool sim_port_get_output(uint8_t port, uint8_t indice);
+void sim_port_set_input(uint8_t port, uint8_t indice, bool level);
+void sim_port_watch(uint8_t port, uint8_t indice, sim_pin_callback_t callback, void *p_context);
+
+// SPI (module = SPI_MODULE). The device returns the word received for the word sent.
+typedef uint32_t (*sim_spi_device_t)(void *p_context, uint32_t tx, uint8_t width);
+void sim_spi_attach(uint8_t module, sim_spi_device_t device, void *p_context);
+uint64_t sim_spi_get_word_count(uint8_t module);
+
+// UART (module = UART_MODULE)
+size_t sim_uart_get_tx(uint8_t module, uint8_t *p_buffer, size_t size);  // Bytes sent since the last call
+void sim_uart_inject_rx(uint8_t module, const uint8_t *p_data, size_t size);
+
+// I2C (module = I2C_MODULE), slave with a 7 bits address
+typedef struct
+{
+    void (*start)(void *p_context, bool is_read);   // After the address byte (acknowledged)
+    bool (*write)(void *p_context, uint8_t data);   // true: ACK
+    uint8_t (*read)(void *p_context, bool ack);     // ack: the master acknowledges the previous byte
+    void (*stop)(void *p_context);
+} sim_i2c_slave_t;
+void sim_i2c_attach(uint8_t module, uint8_t address, const sim_i2c_slave_t *p_slave, void *p_context);
+void sim_i2c_force_collision(uint8_t module, uint64_t busy_cycles);       // The next START collides with another master
+uint32_t sim_i2c_get_collision_count(uint8_t module);
+
+// ADC
+void sim_adc_set_input(uint8_t channel, uint16_t value);
+typedef uint16_t (*sim_adc_source_t)(void *p_context, uint8_t channel, uint64_t now);
+void sim_adc_set_source(sim_adc_source_t source, void *p_context);
+uint64_t sim_adc_get_scan_count(void);
+
+// CAN (module = CAN_MODULE)
+typedef struct
+{
+    uint32_t id;
+    bool     ide;
+    uint8_t  dlc;
+    uint8_t  data[8];
+    uint64_t time;
+} sim_can_frame_t;
+bool sim_can_inject(uint8_t module, uint32_t id, bool ide, uint8_t dlc, const uint8_t *p_data);   // false: no filter hit
+size_t sim_can_get_tx(uint8_t module, sim_can_frame_t *p_frames, size_t max);    // Frames sent since the last call
+uint32_t sim_can_get_bit_rate(uint8_t module);
+
+// ETH (MAC + LAN8740 PHY)
+void sim_eth_set_link(bool up);
+bool sim_eth_inject(const uint8_t *p_frame, size_t size);  // false: no free RX buffer
+size_t sim_eth_get_tx(uint8_t *p_frame, size_t size);      // Next frame sent (0: none)
+uint32_t sim_eth_get_tx_pending(void);
+
+#endif
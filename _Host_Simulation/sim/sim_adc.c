@@ -0,0 +1,159 @@
+/*********************************************************************
+*	Host simulation - ADC10 module (scan mode)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   SSRC = TIMER3: each period of TIMER3 converts the next AD1CSSL channel
+*   (in ascending order) in ADC1BUFn, in the half given by BUFS when BUFM
+*   is set (BUFS toggles at each scan). The ADC interrupt flag is set at
+*   the end of the scan (SMPI = number of channels - 1).
+*   SSRC = auto: the whole scan is converted when ADC1BUFx is read.
+*   The value of a channel is given by the source (sim_adc_set_source) or
+*   by sim_adc_set_input().
+*********************************************************************/
+
+#include "sim_internal.h"
+
+#define SIM_ADC_CON1                0xBF809000
+#define SIM_ADC_CON2                0xBF809010
+#define SIM_ADC_CSSL                0xBF809050
+#define SIM_ADC_BUF(n)              (0xBF809070 + 0x10 * (n))
+#define SIM_ADC_NUMBER_OF_CHANNELS  16
+
+#define SIM_ADC_CON1_ON             0x00008000
+#define SIM_ADC_CON1_SSRC_MASK      0x000000E0
+#define SIM_ADC_CON1_SSRC_TMR3      0x00000040
+#define SIM_ADC_CON1_SSRC_AUTO      0x000000E0
+#define SIM_ADC_CON2_BUFM           0x00000002
+#define SIM_ADC_CON2_BUFS           0x00000080
+
+static uint16_t sim_adc_inputs[SIM_ADC_NUMBER_OF_CHANNELS];
+static sim_adc_source_t sim_adc_source = NULL;
+static void *sim_adc_source_context = NULL;
+static uint64_t sim_adc_scan_count = 0;
+static uint32_t sim_adc_slot = 0;       // Next conversion of the scan
+
+// Conversion of the next channel of the scan. Returns true at the end of
+// the scan.
+static bool sim_adc_convert(void)
+{
+    uint32_t cssl = SIM_RW(SIM_ADC_CSSL) & 0x0000ffff;
+    uint32_t first = 0;
+    uint32_t slot = 0;
+    uint8_t channel;
+    uint16_t value;
+
+    if (cssl == 0)
+    {
+        return false;
+    }
+    if ((SIM_RW(SIM_ADC_CON2) & SIM_ADC_CON2_BUFM) && (SIM_RW(SIM_ADC_CON2) & SIM_ADC_CON2_BUFS))
+    {
+        first = 8;
+    }
+    for (channel = 0 ; channel < SIM_ADC_NUMBER_OF_CHANNELS ; channel++)
+    {
+        if ((cssl & (1u << channel)) && (slot++ == sim_adc_slot))
+        {
+            value = (sim_adc_source != NULL) ? (*sim_adc_source)(sim_adc_source_context, channel, sim_now()) : sim_adc_inputs[channel];
+            SIM_RW(SIM_ADC_BUF((first + sim_adc_slot) & 0xf)) = value & 0x03ff;
+            break;
+        }
+    }
+    sim_adc_slot++;
+    if ((cssl >> channel) > 1)
+    {
+        return false;
+    }
+
+    sim_adc_slot = 0;
+    if (SIM_RW(SIM_ADC_CON2) & SIM_ADC_CON2_BUFM)
+    {
+        SIM_RW(SIM_ADC_CON2) ^= SIM_ADC_CON2_BUFS;
+    }
+    sim_adc_scan_count++;
+    return true;
+}
+
+static void sim_adc_scan(void)
+{
+    sim_adc_slot = 0;
+    while ((SIM_RW(SIM_ADC_CSSL) & 0x0000ffff) && !sim_adc_convert());
+}
+
+void sim_adc_on_timer3(void)
+{
+    uint32_t con1 = SIM_RW(SIM_ADC_CON1);
+
+    if ((con1 & SIM_ADC_CON1_ON) && ((con1 & SIM_ADC_CON1_SSRC_MASK) == SIM_ADC_CON1_SSRC_TMR3))
+    {
+        if (sim_adc_convert())
+        {
+            sim_irq_raise(_ADC_IRQ);
+        }
+    }
+}
+
+static void sim_adc_read(uint32_t reg)
+{
+    uint32_t con1 = SIM_RW(SIM_ADC_CON1);
+
+    if ((reg >= SIM_ADC_BUF(0)) && (con1 & SIM_ADC_CON1_ON) && ((con1 & SIM_ADC_CON1_SSRC_MASK) == SIM_ADC_CON1_SSRC_AUTO))
+    {
+        sim_adc_scan();
+    }
+}
+
+static void sim_adc_write(uint32_t reg, uint32_t previous)
+{
+    if (reg == SIM_ADC_CON2)
+    {
+        // BUFS is read only.
+        SIM_RW(reg) = (SIM_RW(reg) & ~SIM_ADC_CON2_BUFS) | (previous & SIM_ADC_CON2_BUFS);
+    }
+    else if ((reg == SIM_ADC_CON1) && !(SIM_RW(reg) & SIM_ADC_CON1_ON))
+    {
+        SIM_RW(SIM_ADC_CON2) &= ~SIM_ADC_CON2_BUFS;
+        sim_adc_slot = 0;
+    }
+}
+
+static void sim_adc_reset(void)
+{
+    memset(sim_adc_inputs, 0, sizeof(sim_adc_inputs));
+    sim_adc_source = NULL;
+    sim_adc_source_context = NULL;
+    sim_adc_scan_count = 0;
+    sim_adc_slot = 0;
+}
+
+static const sim_model_t sim_adc_model =
+{
+    .next_event = NULL,
+    .run = NULL,
+    .reset = sim_adc_reset
+};
+
+void sim_adc_init(void)
+{
+    sim_region_register(SIM_ADC_CON1, SIM_ADC_BUF(16) - SIM_ADC_CON1, sim_adc_read, sim_adc_write);
+    sim_model_register(&sim_adc_model);
+}
+
+void sim_adc_set_input(uint8_t channel, uint16_t value)
+{
+    sim_adc_inputs[channel] = value;
+}
+
+void sim_adc_set_source(sim_adc_source_t source, void *p_context)
+{
+    sim_adc_source = source;
+    sim_adc_source_context = p_context;
+}
+
+uint64_t sim_adc_get_scan_count(void)
+{
+    return sim_adc_scan_count;
+}
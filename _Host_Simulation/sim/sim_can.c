@@ -0,0 +1,591 @@
+/*********************************************************************
+*	Host simulation - CAN modules (plib CANXxx functions + registers)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The message area is the RAM given by CxFIFOBA (16 bytes per message,
+*   the channels follow each other with their FSIZE). The FIFO registers
+*   (UINC, TXREQ, FRESET, CxFIFOINT, CxFSTAT, CxRXOVF, CxFIFOUA, CxFIFOCI)
+*   and the module events (CxINT, CAN interrupt flag) are kept coherent
+*   with the FIFOs at each access.
+*   A transmitted frame lasts (47 + 8 * DLC) bits (67 + 8 * DLC with an
+*   extended ID, no stuffing) and is captured for the tests. In loopback
+*   mode it is received too. The injected frames go through the filters
+*   (CxFLTCON, CxRXF, CxRXM) to their channel.
+*********************************************************************/
+
+#include <peripheral/CAN.h>
+#include "sim_internal.h"
+
+#define SIM_CAN_NUMBER              2
+#define SIM_CAN_CHANNELS            32
+#define SIM_CAN_CON(b)              ((b) + 0x000)
+#define SIM_CAN_CFG(b)              ((b) + 0x010)
+#define SIM_CAN_INT(b)              ((b) + 0x020)
+#define SIM_CAN_VEC(b)              ((b) + 0x030)
+#define SIM_CAN_FSTAT(b)            ((b) + 0x050)
+#define SIM_CAN_RXOVF(b)            ((b) + 0x060)
+#define SIM_CAN_RXM(b, n)           ((b) + 0x080 + 0x10 * (n))
+#define SIM_CAN_FLTCON(b, n)        ((b) + 0x0C0 + 0x10 * (n))
+#define SIM_CAN_RXF(b, n)           ((b) + 0x140 + 0x10 * (n))
+#define SIM_CAN_FIFOBA(b)           ((b) + 0x340)
+#define SIM_CAN_FIFOCON(b, n)       ((b) + 0x350 + 0x40 * (n))
+#define SIM_CAN_FIFOINT(b, n)       ((b) + 0x360 + 0x40 * (n))
+#define SIM_CAN_FIFOUA(b, n)        ((b) + 0x370 + 0x40 * (n))
+#define SIM_CAN_FIFOCI(b, n)        ((b) + 0x380 + 0x40 * (n))
+#define SIM_CAN_SIZE                0xB50
+
+#define SIM_CAN_CON_ON              0x00008000
+#define SIM_CAN_FIFOCON_TXREQ       0x00000008
+#define SIM_CAN_FIFOCON_TXEN        0x00000080
+#define SIM_CAN_FIFOCON_UINC        0x00002000
+#define SIM_CAN_FIFOCON_FRESET      0x00004000
+#define SIM_CAN_FIFOINT_RXOVFLIF    0x00000008
+#define SIM_CAN_INT_TBIF            0x00000001
+#define SIM_CAN_INT_RBIF            0x00000002
+#define SIM_CAN_INT_RBOVIF          0x00000800
+
+#define SIM_CAN_CAPTURE_SIZE        4096
+
+typedef struct
+{
+    uint8_t     head;       // Oldest message (index in the channel)
+    uint8_t     count;
+    bool        is_overflowed;
+} SIM_CAN_FIFO;
+
+typedef struct
+{
+    SIM_CAN_FIFO        fifo[SIM_CAN_CHANNELS];
+    bool                is_transmitting;
+    uint8_t             tx_channel;
+    uint64_t            tx_end;
+    sim_can_frame_t     tx_frame;
+    sim_can_frame_t     capture[SIM_CAN_CAPTURE_SIZE];
+    uint32_t            capture_head;
+    uint32_t            capture_count;
+    uint32_t            bit_rate;
+} SIM_CAN;
+
+static const uint32_t sim_can_base[SIM_CAN_NUMBER] = {0xBF88B000, 0xBF88C000};
+static const uint32_t sim_can_irq[SIM_CAN_NUMBER] = {_CAN1_IRQ, _CAN2_IRQ};
+static SIM_CAN sim_can[SIM_CAN_NUMBER];
+
+static int sim_can_module(uint32_t reg)
+{
+    int i;
+
+    for (i = 0 ; i < SIM_CAN_NUMBER ; i++)
+    {
+        if ((reg >= sim_can_base[i]) && (reg < (sim_can_base[i] + SIM_CAN_SIZE)))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t sim_can_fifo_size(uint8_t i, uint8_t channel)
+{
+    return (uint8_t) (((SIM_RW(SIM_CAN_FIFOCON(sim_can_base[i], channel)) >> 16) & 0x1f) + 1);
+}
+
+static bool sim_can_is_tx(uint8_t i, uint8_t channel)
+{
+    return (SIM_RW(SIM_CAN_FIFOCON(sim_can_base[i], channel)) & SIM_CAN_FIFOCON_TXEN) != 0;
+}
+
+static uint8_t *sim_can_message(uint8_t i, uint8_t channel, uint8_t index)
+{
+    uint32_t offset = 0;
+    uint8_t n;
+
+    for (n = 0 ; n < channel ; n++)
+    {
+        offset += sim_can_fifo_size(i, n);
+    }
+    return (uint8_t *) (uintptr_t) SIM_RW(SIM_CAN_FIFOBA(sim_can_base[i])) + (offset + index) * 16;
+}
+
+static uint32_t sim_can_bit_cycles(uint8_t i)
+{
+    uint32_t cfg = SIM_RW(SIM_CAN_CFG(sim_can_base[i]));
+    uint32_t brp = cfg & 0x3f;
+    uint32_t tq = 1 + (((cfg >> 8) & 0x7) + 1) + (((cfg >> 11) & 0x7) + 1) + (((cfg >> 16) & 0x7) + 1);
+
+    return 2 * (brp + 1) * tq;
+}
+
+// Registers of a channel and of the module from the state of the FIFOs.
+static void sim_can_update(uint8_t i)
+{
+    uint32_t base = sim_can_base[i];
+    uint32_t fstat = 0, rxovf = 0, flags = 0;
+    uint32_t fifoint, size, events;
+    SIM_CAN_FIFO *p;
+    uint8_t channel;
+
+    for (channel = 0 ; channel < SIM_CAN_CHANNELS ; channel++)
+    {
+        p = &sim_can[i].fifo[channel];
+        size = sim_can_fifo_size(i, channel);
+        fifoint = SIM_RW(SIM_CAN_FIFOINT(base, channel)) & 0xffff0000;
+        if (sim_can_is_tx(i, channel))
+        {
+            fifoint |= (p->count == 0) ? 0x00000100 : 0;
+            fifoint |= (p->count <= size / 2) ? 0x00000200 : 0;
+            fifoint |= (p->count < size) ? 0x00000400 : 0;
+            if (fifoint & (fifoint >> 16) & 0x00000700)
+            {
+                flags |= SIM_CAN_INT_TBIF;
+            }
+        }
+        else
+        {
+            fifoint |= (p->count > 0) ? 0x00000001 : 0;
+            fifoint |= (p->count >= size / 2) && (p->count > 0) ? 0x00000002 : 0;
+            fifoint |= (p->count >= size) ? 0x00000004 : 0;
+            fifoint |= p->is_overflowed ? SIM_CAN_FIFOINT_RXOVFLIF : 0;
+            fstat |= (p->count > 0) ? (1u << channel) : 0;
+            rxovf |= p->is_overflowed ? (1u << channel) : 0;
+            if (fifoint & (fifoint >> 16) & 0x0000000f)
+            {
+                flags |= SIM_CAN_INT_RBIF;
+            }
+        }
+        SIM_RW(SIM_CAN_FIFOINT(base, channel)) = fifoint;
+        SIM_RW(SIM_CAN_FIFOCI(base, channel)) = (sim_can_is_tx(i, channel) ? ((p->head + p->count) % size) : p->head) & 0x1f;
+        SIM_RW(SIM_CAN_FIFOUA(base, channel)) = (uint32_t) (uintptr_t) sim_can_message(i, channel, (uint8_t) (sim_can_is_tx(i, channel) ? ((p->head + p->count) % size) : p->head));
+    }
+    SIM_RW(SIM_CAN_FSTAT(base)) = fstat;
+    SIM_RW(SIM_CAN_RXOVF(base)) = rxovf;
+    flags |= (rxovf != 0) ? SIM_CAN_INT_RBOVIF : 0;
+
+    events = (SIM_RW(SIM_CAN_INT(base)) & 0xffff0000) | flags;
+    SIM_RW(SIM_CAN_INT(base)) = events;
+    if (events & (events >> 16) & 0x0000ffff)
+    {
+        sim_irq_raise(sim_can_irq[i]);
+    }
+}
+
+static CAN_OP_MODE sim_can_mode(uint8_t i)
+{
+    return (CAN_OP_MODE) ((SIM_RW(SIM_CAN_CON(sim_can_base[i])) >> 21) & 0x7);
+}
+
+static bool sim_can_receive(uint8_t i, uint32_t id, bool ide, uint8_t dlc, const uint8_t *p_data)
+{
+    uint32_t base = sim_can_base[i];
+    uint32_t sid = ide ? ((id >> 18) & 0x7ff) : (id & 0x7ff);
+    uint32_t eid = ide ? (id & 0x3ffff) : 0;
+    uint32_t fltcon, rxf, rxm;
+    uint32_t words[4];
+    uint8_t filter, channel, size;
+    SIM_CAN_FIFO *p;
+
+    for (filter = 0 ; filter < 32 ; filter++)
+    {
+        fltcon = (SIM_RW(SIM_CAN_FLTCON(base, filter / 4)) >> (8 * (filter % 4))) & 0xff;
+        if (!(fltcon & 0x80))
+        {
+            continue;
+        }
+        rxf = SIM_RW(SIM_CAN_RXF(base, filter));
+        rxm = SIM_RW(SIM_CAN_RXM(base, (fltcon >> 5) & 0x3));
+        if ((((rxf >> 21) ^ sid) & (rxm >> 21) & 0x7ff) != 0)
+        {
+            continue;
+        }
+        if (ide && (((rxf ^ eid) & rxm & 0x3ffff) != 0))
+        {
+            continue;
+        }
+        if ((rxm & 0x00080000) && (((rxf >> 19) & 1) != (ide ? 1u : 0u)))
+        {
+            continue;
+        }
+
+        channel = fltcon & 0x1f;
+        if (sim_can_is_tx(i, channel))
+        {
+            return false;
+        }
+        p = &sim_can[i].fifo[channel];
+        size = sim_can_fifo_size(i, channel);
+        if (p->count >= size)
+        {
+            p->is_overflowed = true;
+        }
+        else
+        {
+            words[0] = sid | ((uint32_t) filter << 11) | ((uint32_t) ((sim_now() / sim_can_bit_cycles(i)) & 0xffff) << 16);
+            words[1] = (dlc & 0xf) | (eid << 10) | ((ide ? 1u : 0u) << 28) | (ide ? (1u << 29) : 0);
+            words[2] = 0;
+            words[3] = 0;
+            memcpy(&words[2], p_data, (dlc > 8) ? 8 : dlc);
+            memcpy(sim_can_message(i, channel, (uint8_t) ((p->head + p->count) % size)), words, 16);
+            p->count++;
+        }
+        SIM_RW(SIM_CAN_VEC(base)) = (SIM_RW(SIM_CAN_VEC(base)) & ~0x1f00) | ((uint32_t) filter << 8);
+        sim_can_update(i);
+        return true;
+    }
+    return false;
+}
+
+// Next message of the channels with TXREQ (highest TXPRI first).
+static void sim_can_tx_start(uint8_t i)
+{
+    SIM_CAN *p = &sim_can[i];
+    uint32_t base = sim_can_base[i];
+    uint32_t con, words[4];
+    int best = -1;
+    uint32_t best_priority = 0;
+    uint8_t channel, size, bits;
+
+    if (p->is_transmitting || (sim_can_mode(i) == CAN_CONFIGURATION) || (sim_can_mode(i) == CAN_DISABLE))
+    {
+        return;
+    }
+    for (channel = 0 ; channel < SIM_CAN_CHANNELS ; channel++)
+    {
+        con = SIM_RW(SIM_CAN_FIFOCON(base, channel));
+        if ((con & SIM_CAN_FIFOCON_TXEN) && (con & SIM_CAN_FIFOCON_TXREQ))
+        {
+            if (p->fifo[channel].count == 0)
+            {
+                SIM_RW(SIM_CAN_FIFOCON(base, channel)) &= ~SIM_CAN_FIFOCON_TXREQ;
+            }
+            else if ((best < 0) || ((con & 0x3) > best_priority))
+            {
+                best = channel;
+                best_priority = con & 0x3;
+            }
+        }
+    }
+    if (best < 0)
+    {
+        return;
+    }
+
+    size = sim_can_fifo_size(i, (uint8_t) best);
+    memcpy(words, sim_can_message(i, (uint8_t) best, p->fifo[best].head), 16);
+    p->tx_frame.ide = ((words[1] >> 28) & 1) != 0;
+    p->tx_frame.id = p->tx_frame.ide ? (((words[0] & 0x7ff) << 18) | ((words[1] >> 10) & 0x3ffff)) : (words[0] & 0x7ff);
+    p->tx_frame.dlc = words[1] & 0xf;
+    memcpy(p->tx_frame.data, &words[2], 8);
+    bits = (uint8_t) ((p->tx_frame.ide ? 67 : 47) + 8 * ((p->tx_frame.dlc > 8) ? 8 : p->tx_frame.dlc));
+    p->tx_channel = (uint8_t) best;
+    p->tx_end = sim_now() + (uint64_t) bits * sim_can_bit_cycles(i);
+    p->is_transmitting = true;
+    (void) size;
+}
+
+static uint64_t sim_can_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_CAN_NUMBER ; i++)
+    {
+        if (sim_can[i].is_transmitting && (sim_can[i].tx_end < next))
+        {
+            next = sim_can[i].tx_end;
+        }
+    }
+    return next;
+}
+
+static void sim_can_run(uint64_t now)
+{
+    SIM_CAN *p;
+    SIM_CAN_FIFO *p_fifo;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_CAN_NUMBER ; i++)
+    {
+        p = &sim_can[i];
+        if (!p->is_transmitting || (p->tx_end > now))
+        {
+            continue;
+        }
+        p->is_transmitting = false;
+        p_fifo = &p->fifo[p->tx_channel];
+        p_fifo->head = (p_fifo->head + 1) % sim_can_fifo_size(i, p->tx_channel);
+        p_fifo->count--;
+
+        p->tx_frame.time = now;
+        p->capture[(p->capture_head + p->capture_count) % SIM_CAN_CAPTURE_SIZE] = p->tx_frame;
+        if (p->capture_count < SIM_CAN_CAPTURE_SIZE)
+        {
+            p->capture_count++;
+        }
+        else
+        {
+            p->capture_head = (p->capture_head + 1) % SIM_CAN_CAPTURE_SIZE;
+        }
+        if (sim_can_mode(i) == CAN_LOOPBACK)
+        {
+            sim_can_receive(i, p->tx_frame.id, p->tx_frame.ide, p->tx_frame.dlc, p->tx_frame.data);
+        }
+        sim_can_tx_start(i);
+        sim_can_update(i);
+    }
+}
+
+static void sim_can_write(uint32_t reg, uint32_t previous)
+{
+    int i = sim_can_module(reg);
+    uint32_t base = sim_can_base[i];
+    uint32_t offset = reg - base;
+    uint8_t channel;
+    SIM_CAN_FIFO *p;
+
+    if (reg == SIM_CAN_CON(base))
+    {
+        // The requested mode is reached immediately.
+        SIM_RW(reg) = (SIM_RW(reg) & ~0x00e00000) | (((SIM_RW(reg) >> 24) & 0x7) << 21);
+    }
+    else if ((offset >= 0x350) && (((offset - 0x350) & 0x30) == 0x00))
+    {
+        channel = (uint8_t) ((offset - 0x350) / 0x40);
+        p = &sim_can[i].fifo[channel];
+        if (SIM_RW(reg) & SIM_CAN_FIFOCON_FRESET)
+        {
+            p->head = 0;
+            p->count = 0;
+            p->is_overflowed = false;
+        }
+        if (SIM_RW(reg) & SIM_CAN_FIFOCON_UINC)
+        {
+            if (sim_can_is_tx(i, channel))
+            {
+                if (p->count < sim_can_fifo_size(i, channel))
+                {
+                    p->count++;
+                }
+            }
+            else if (p->count > 0)
+            {
+                p->head = (p->head + 1) % sim_can_fifo_size(i, channel);
+                p->count--;
+            }
+        }
+        SIM_RW(reg) &= ~(SIM_CAN_FIFOCON_UINC | SIM_CAN_FIFOCON_FRESET);
+        sim_can_tx_start((uint8_t) i);
+        sim_can_update((uint8_t) i);
+    }
+    else if ((offset >= 0x350) && (((offset - 0x350) & 0x30) == 0x10))
+    {
+        channel = (uint8_t) ((offset - 0x350) / 0x40);
+        if (!(SIM_RW(reg) & SIM_CAN_FIFOINT_RXOVFLIF))
+        {
+            sim_can[i].fifo[channel].is_overflowed = false;
+        }
+        sim_can_update((uint8_t) i);
+    }
+    else if ((reg == SIM_CAN_INT(base)) || (reg == SIM_CAN_FIFOBA(base)))
+    {
+        sim_can_update((uint8_t) i);
+    }
+}
+
+static void sim_can_reset(void)
+{
+    memset(sim_can, 0, sizeof(sim_can));
+}
+
+static const sim_model_t sim_can_model =
+{
+    .next_event = sim_can_next_event,
+    .run = sim_can_run,
+    .reset = sim_can_reset
+};
+
+void sim_can_init(void)
+{
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_CAN_NUMBER ; i++)
+    {
+        sim_region_register(sim_can_base[i], SIM_CAN_SIZE, NULL, sim_can_write);
+    }
+    sim_model_register(&sim_can_model);
+}
+
+bool sim_can_inject(uint8_t module, uint32_t id, bool ide, uint8_t dlc, const uint8_t *p_data)
+{
+    CAN_OP_MODE mode = sim_can_mode(module);
+    bool is_received;
+
+    if ((mode != CAN_NORMAL_OPERATION) && (mode != CAN_LISTEN_ONLY) && (mode != CAN_LISTEN_ALL_MESSAGES))
+    {
+        return false;
+    }
+    sim_enter();
+    is_received = sim_can_receive(module, id, ide, dlc, p_data);
+    sim_leave();
+    return is_received;
+}
+
+size_t sim_can_get_tx(uint8_t module, sim_can_frame_t *p_frames, size_t max)
+{
+    SIM_CAN *p = &sim_can[module];
+    size_t n = 0;
+
+    while ((n < max) && (p->capture_count > 0))
+    {
+        p_frames[n++] = p->capture[p->capture_head];
+        p->capture_head = (p->capture_head + 1) % SIM_CAN_CAPTURE_SIZE;
+        p->capture_count--;
+    }
+    return n;
+}
+
+uint32_t sim_can_get_bit_rate(uint8_t module)
+{
+    return (uint32_t) (SIM_CLOCK_FREQ / sim_can_bit_cycles(module));
+}
+
+/*******************************************************************************
+ * plib
+ ******************************************************************************/
+#define SIM_CAN_API_CYCLES          10
+
+void CANSetOperatingMode(CAN_MODULE module, CAN_OP_MODE opmode)
+{
+    uint32_t reg = SIM_CAN_CON(sim_can_base[module]);
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    SIM_RW(reg) = (SIM_RW(reg) & ~0x07e00000) | ((uint32_t) opmode << 24) | ((uint32_t) opmode << 21) | SIM_CAN_CON_ON;
+    sim_can_tx_start(module);
+    sim_leave();
+}
+
+CAN_OP_MODE CANGetOperatingMode(CAN_MODULE module)
+{
+    CAN_OP_MODE mode;
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    mode = sim_can_mode(module);
+    sim_leave();
+    return mode;
+}
+
+void CANSetSpeed(CAN_MODULE module, const CAN_BIT_CONFIG *canBitConfig, UINT32 sysClock, UINT32 canBusSpeed)
+{
+    uint32_t tq = 1 + (canBitConfig->propagationSegTq + 1) + (canBitConfig->phaseSeg1Tq + 1) + (canBitConfig->phaseSeg2Tq + 1);
+    uint32_t brp = (sysClock / (2 * tq * canBusSpeed)) - 1;
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    SIM_RW(SIM_CAN_CFG(sim_can_base[module])) = (brp & 0x3f) | ((canBitConfig->syncJumpWidth & 0x3) << 6) |
+                                                ((canBitConfig->propagationSegTq & 0x7) << 8) | ((canBitConfig->phaseSeg1Tq & 0x7) << 11) |
+                                                ((canBitConfig->sample3Time ? 1u : 0u) << 14) | ((canBitConfig->phaseSeg2TimeSelect ? 1u : 0u) << 15) |
+                                                ((canBitConfig->phaseSeg2Tq & 0x7) << 16);
+    sim_leave();
+}
+
+void CANConfigureChannelForTx(CAN_MODULE module, CAN_CHANNEL channel, UINT channelSize, CAN_TX_RTR rtren, CAN_TXCHANNEL_PRIORITY priority)
+{
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    SIM_RW(SIM_CAN_FIFOCON(sim_can_base[module], channel)) = (((channelSize - 1) & 0x1f) << 16) | SIM_CAN_FIFOCON_TXEN | ((rtren ? 1u : 0u) << 2) | (priority & 0x3);
+    memset(&sim_can[module].fifo[channel], 0, sizeof(SIM_CAN_FIFO));
+    sim_can_update(module);
+    sim_leave();
+}
+
+void CANConfigureChannelForRx(CAN_MODULE module, CAN_CHANNEL channel, UINT channelSize, CAN_RX_DATA_MODE dataOnly)
+{
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    SIM_RW(SIM_CAN_FIFOCON(sim_can_base[module], channel)) = (((channelSize - 1) & 0x1f) << 16) | ((dataOnly == CAN_RX_DATA_ONLY) ? 0x1000 : 0);
+    memset(&sim_can[module].fifo[channel], 0, sizeof(SIM_CAN_FIFO));
+    sim_can_update(module);
+    sim_leave();
+}
+
+void CANEnableModuleEvent(CAN_MODULE module, CAN_MODULE_EVENT flags, BOOL enable)
+{
+    uint32_t reg = SIM_CAN_INT(sim_can_base[module]);
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    SIM_RW(reg) = enable ? (SIM_RW(reg) | ((uint32_t) flags << 16)) : (SIM_RW(reg) & ~((uint32_t) flags << 16));
+    sim_can_update(module);
+    sim_leave();
+}
+
+void CANEnableChannelEvent(CAN_MODULE module, CAN_CHANNEL channel, CAN_CHANNEL_EVENT flags, BOOL enable)
+{
+    uint32_t reg = SIM_CAN_FIFOINT(sim_can_base[module], channel);
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    SIM_RW(reg) = enable ? (SIM_RW(reg) | ((uint32_t) flags << 16)) : (SIM_RW(reg) & ~((uint32_t) flags << 16));
+    sim_can_update(module);
+    sim_leave();
+}
+
+CAN_CHANNEL_EVENT CANGetChannelEvent(CAN_MODULE module, CAN_CHANNEL channel)
+{
+    CAN_CHANNEL_EVENT events;
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    events = (CAN_CHANNEL_EVENT) (SIM_RW(SIM_CAN_FIFOINT(sim_can_base[module], channel)) & 0x0000ffff);
+    sim_leave();
+    return events;
+}
+
+CANTxMessageBuffer * CANGetTxMessageBuffer(CAN_MODULE module, CAN_CHANNEL channel)
+{
+    SIM_CAN_FIFO *p = &sim_can[module].fifo[channel];
+    CANTxMessageBuffer *p_message = NULL;
+    uint8_t size;
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    size = sim_can_fifo_size(module, channel);
+    if (p->count < size)
+    {
+        p_message = (CANTxMessageBuffer *) sim_can_message(module, channel, (uint8_t) ((p->head + p->count) % size));
+    }
+    sim_leave();
+    return p_message;
+}
+
+CANRxMessageBuffer * CANGetRxMessage(CAN_MODULE module, CAN_CHANNEL channel)
+{
+    SIM_CAN_FIFO *p = &sim_can[module].fifo[channel];
+    CANRxMessageBuffer *p_message = NULL;
+
+    sim_enter();
+    sim_account(SIM_CAN_API_CYCLES);
+    if (p->count > 0)
+    {
+        p_message = (CANRxMessageBuffer *) sim_can_message(module, channel, p->head);
+    }
+    sim_leave();
+    return p_message;
+}
+
+void CANUpdateChannel(CAN_MODULE module, CAN_CHANNEL channel)
+{
+    sim_enter();
+    sim_bus_write(SIM_CAN_FIFOCON(sim_can_base[module], channel) + SIM_REG_SET, SIM_CAN_FIFOCON_UINC);
+    sim_leave();
+}
+
+void CANFlushTxChannel(CAN_MODULE module, CAN_CHANNEL channel)
+{
+    sim_enter();
+    sim_bus_write(SIM_CAN_FIFOCON(sim_can_base[module], channel) + SIM_REG_SET, SIM_CAN_FIFOCON_TXREQ);
+    sim_leave();
+}
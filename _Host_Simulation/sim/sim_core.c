@@ -0,0 +1,671 @@
+/*********************************************************************
+*	Host simulation - core (SFR space, time, interrupt controller)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   sim_sfr[] (the SFR space seen by the library) and sim_rw (the view
+*   of the models) are two mappings of a same memory file. In trap mode,
+*   sim_sfr[] is not accessible: each access of the library raises a
+*   SIGSEGV, the handler runs the models, opens the page and sets the
+*   trap flag of the CPU. The SIGTRAP raised after the instruction closes
+*   the page, applies the CLR / SET / INV registers, calls the write hook
+*   of the register and dispatches the interrupts.
+*********************************************************************/
+
+#define _GNU_SOURCE
+#include <signal.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include "sim_internal.h"
+
+volatile uint32_t sim_sfr[SIM_SFR_SIZE / 4] __attribute__((aligned(4096)));
+__DEVCFG3bits_t sim_devcfg3bits = { .FMIIEN = 0, .FETHIO = 0 };    // RMII, alternate I/O
+uint32_t *sim_rw = NULL;
+
+// Same layout as IRQ_REGISTERS (s08_interrupt_mapping.h)
+typedef struct
+{
+    volatile uint32_t   *IFS;
+    volatile uint32_t   *IEC;
+    volatile uint32_t   *IPC;
+    volatile uint32_t   MASK;
+    volatile uint32_t   SUB_PRI_POS;
+    volatile uint32_t   PRI_POS;
+} SIM_IRQ_REGISTERS;
+extern const SIM_IRQ_REGISTERS IrqTab[];
+
+#define SIM_MAX_REGIONS             32
+#define SIM_MAX_MODELS              16
+#define SIM_MAX_ISR                 160
+#define SIM_MAX_DISPATCH            1000000
+#define SIM_PAGE_SIZE               4096
+#define SIM_ACCESS_COST             2
+
+typedef struct
+{
+    uint32_t            first;
+    uint32_t            last;
+    sim_read_hook_t     read;
+    sim_write_hook_t    write;
+} SIM_REGION;
+
+typedef struct
+{
+    uint32_t            source;
+    sim_isr_t           isr;
+} SIM_ISR;
+
+static SIM_MODE sim_mode = SIM_MODE_FLAT;
+static bool sim_is_initialized = false;
+static SIM_REGION sim_regions[SIM_MAX_REGIONS];
+static uint32_t sim_number_of_regions = 0;
+static const sim_model_t *sim_models[SIM_MAX_MODELS];
+static uint32_t sim_number_of_models = 0;
+static SIM_ISR sim_isr[SIM_MAX_ISR];
+static uint32_t sim_number_of_isr = 0;
+
+static uint64_t sim_time = 0;
+static bool sim_is_running_models = false;
+static uint32_t sim_access_cost = SIM_ACCESS_COST;
+static uint64_t sim_access_count = 0;
+static uint32_t sim_core_timer_offset = 0;
+static int sim_depth = 0;
+static bool sim_ie = true;
+static uint32_t sim_ipl = 0;
+
+static struct
+{
+    uint32_t    reg;
+    uint32_t    slot;
+    uint32_t    previous;
+    bool        is_write;
+    void        *p_page;
+} sim_trap;
+
+/*******************************************************************************
+ * Regions and models
+ ******************************************************************************/
+void sim_region_register(uint32_t first, uint32_t size, sim_read_hook_t read, sim_write_hook_t write)
+{
+    if (sim_number_of_regions >= SIM_MAX_REGIONS)
+    {
+        SIM_ABORT("too many regions");
+    }
+    sim_regions[sim_number_of_regions].first = first;
+    sim_regions[sim_number_of_regions].last = first + size - 1;
+    sim_regions[sim_number_of_regions].read = read;
+    sim_regions[sim_number_of_regions].write = write;
+    sim_number_of_regions++;
+}
+
+static const SIM_REGION *sim_region_find(uint32_t reg)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < sim_number_of_regions ; i++)
+    {
+        if ((reg >= sim_regions[i].first) && (reg <= sim_regions[i].last))
+        {
+            return &sim_regions[i];
+        }
+    }
+    return NULL;
+}
+
+void sim_model_register(const sim_model_t *p_model)
+{
+    if (sim_number_of_models >= SIM_MAX_MODELS)
+    {
+        SIM_ABORT("too many models");
+    }
+    sim_models[sim_number_of_models++] = p_model;
+}
+
+/*******************************************************************************
+ * Register accesses
+ ******************************************************************************/
+bool sim_is_sfr(const volatile void *p)
+{
+    return ((uintptr_t) p >= (uintptr_t) sim_sfr) && ((uintptr_t) p < ((uintptr_t) sim_sfr + SIM_SFR_SIZE));
+}
+
+uint32_t sim_sfr_device_address(const volatile void *p)
+{
+    return SIM_SFR_BASE + (uint32_t) ((uintptr_t) p - (uintptr_t) sim_sfr);
+}
+
+static void sim_register_read(uint32_t reg)
+{
+    const SIM_REGION *p_region = sim_region_find(reg);
+
+    if ((p_region != NULL) && (p_region->read != NULL))
+    {
+        (*p_region->read)(reg);
+    }
+}
+
+static void sim_register_written(uint32_t reg, uint32_t kind, uint32_t value, uint32_t previous)
+{
+    const SIM_REGION *p_region = sim_region_find(reg);
+
+    switch (kind)
+    {
+        case SIM_REG_CLR:
+            SIM_RW(reg) = previous & ~value;
+            break;
+        case SIM_REG_SET:
+            SIM_RW(reg) = previous | value;
+            break;
+        case SIM_REG_INV:
+            SIM_RW(reg) = previous ^ value;
+            break;
+        default:
+            SIM_RW(reg) = value;
+            break;
+    }
+    if ((p_region != NULL) && (p_region->write != NULL))
+    {
+        (*p_region->write)(reg, previous);
+    }
+}
+
+uint32_t sim_bus_read(uint32_t address)
+{
+    uint32_t reg = address & ~0x0000000f;
+
+    if ((address & 0x0000000c) == 0)
+    {
+        sim_register_read(reg);
+    }
+    return SIM_RW(address & ~0x00000003);
+}
+
+void sim_bus_write(uint32_t address, uint32_t value)
+{
+    uint32_t reg = address & ~0x0000000f;
+
+    sim_register_written(reg, address & 0x0000000c, value, SIM_RW(reg));
+}
+
+/*******************************************************************************
+ * Trap mode
+ ******************************************************************************/
+static void sim_protect(bool is_protected)
+{
+    if (mprotect((void *) sim_sfr, SIM_SFR_SIZE, is_protected ? PROT_NONE : (PROT_READ | PROT_WRITE)) != 0)
+    {
+        SIM_ABORT("mprotect failed");
+    }
+}
+
+// Only the page of the access is opened for the single step.
+static void sim_protect_page(void *p_page, bool is_protected)
+{
+    if (mprotect(p_page, SIM_PAGE_SIZE, is_protected ? PROT_NONE : (PROT_READ | PROT_WRITE)) != 0)
+    {
+        SIM_ABORT("mprotect failed");
+    }
+}
+
+static void sim_on_sigsegv(int sig, siginfo_t *p_info, void *p_ucontext)
+{
+    ucontext_t *p_context = (ucontext_t *) p_ucontext;
+    uint32_t address;
+
+    if (!sim_is_sfr(p_info->si_addr) || (sim_mode != SIM_MODE_TRAP))
+    {
+        // Not an SFR: let the instruction fault again with the default action.
+        signal(SIGSEGV, SIG_DFL);
+        return;
+    }
+
+    address = sim_sfr_device_address(p_info->si_addr);
+    sim_trap.reg = address & ~0x0000000f;
+    sim_trap.slot = address & ~0x00000003;
+    sim_trap.is_write = (p_context->uc_mcontext.gregs[REG_ERR] & 0x2) != 0;
+
+    sim_access_count++;
+    sim_depth++;
+    sim_account(sim_access_cost);
+    if (!sim_trap.is_write)
+    {
+        if ((address & 0x0000000c) == 0)
+        {
+            sim_register_read(sim_trap.reg);
+        }
+    }
+    else
+    {
+        sim_trap.previous = SIM_RW(sim_trap.reg);
+        if (sim_trap.slot != sim_trap.reg)
+        {
+            SIM_RW(sim_trap.slot) = 0;      // CLR / SET / INV: only the written bits
+        }
+    }
+    sim_depth--;
+
+    sim_trap.p_page = (void *) ((uintptr_t) p_info->si_addr & ~(uintptr_t) (SIM_PAGE_SIZE - 1));
+    sim_protect_page(sim_trap.p_page, false);
+    p_context->uc_mcontext.gregs[REG_EFL] |= 0x100;
+}
+
+static void sim_on_sigtrap(int sig, siginfo_t *p_info, void *p_ucontext)
+{
+    ucontext_t *p_context = (ucontext_t *) p_ucontext;
+    uint32_t value;
+
+    p_context->uc_mcontext.gregs[REG_EFL] &= ~0x100;
+    sim_protect_page(sim_trap.p_page, true);
+
+    if (sim_trap.is_write)
+    {
+        sim_depth++;
+        value = SIM_RW(sim_trap.slot);
+        if (sim_trap.slot != sim_trap.reg)
+        {
+            SIM_RW(sim_trap.slot) = 0;
+        }
+        sim_register_written(sim_trap.reg, sim_trap.slot & 0x0000000c, value, sim_trap.previous);
+        sim_depth--;
+    }
+    sim_irq_dispatch();
+}
+
+static void sim_map(void)
+{
+    struct sigaction action;
+    int fd = memfd_create("sim_sfr", 0);
+
+    if ((fd < 0) || (ftruncate(fd, SIM_SFR_SIZE) != 0))
+    {
+        SIM_ABORT("memfd_create failed");
+    }
+    if (mmap((void *) sim_sfr, SIM_SFR_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != (void *) sim_sfr)
+    {
+        SIM_ABORT("mmap of sim_sfr failed");
+    }
+    sim_rw = (uint32_t *) mmap(NULL, SIM_SFR_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (sim_rw == MAP_FAILED)
+    {
+        SIM_ABORT("mmap of the model view failed");
+    }
+    close(fd);
+
+    memset(&action, 0, sizeof(action));
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+    action.sa_sigaction = sim_on_sigsegv;
+    sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = sim_on_sigtrap;
+    sigaction(SIGTRAP, &action, NULL);
+}
+
+/*******************************************************************************
+ * Life cycle
+ ******************************************************************************/
+void sim_init(SIM_MODE mode)
+{
+    uint32_t i;
+
+    if (!sim_is_initialized)
+    {
+        sim_map();
+        sim_region_register(0xBF881000, 0x160, NULL, NULL);     // Interrupt controller (INTCON ... IPC12)
+        sim_ports_init();
+        sim_timers_init();
+        sim_spi_init();
+        sim_uart_init();
+        sim_i2c_init();
+        sim_adc_init();
+        sim_can_init();
+        sim_eth_init();
+        sim_is_initialized = true;
+    }
+
+    sim_protect(false);
+    sim_mode = SIM_MODE_FLAT;
+    memset(sim_rw, 0, SIM_SFR_SIZE);
+    sim_time = 0;
+    sim_access_count = 0;
+    sim_access_cost = SIM_ACCESS_COST;
+    sim_core_timer_offset = 0;
+    sim_depth = 0;
+    sim_ie = true;
+    sim_ipl = 0;
+    sim_number_of_isr = 0;
+    sim_dma_reset();
+    for (i = 0 ; i < sim_number_of_models ; i++)
+    {
+        if (sim_models[i]->reset != NULL)
+        {
+            (*sim_models[i]->reset)();
+        }
+    }
+    sim_set_mode(mode);
+}
+
+// The CLR / SET / INV registers written in flat mode are applied (and the
+// write hooks called) when the trap mode is restored. The other accesses of
+// the flat mode have no side effect.
+static void sim_replay_flat_writes(void)
+{
+    uint32_t i, reg, kind, value;
+
+    sim_depth++;
+    for (i = 0 ; i < sim_number_of_regions ; i++)
+    {
+        for (reg = sim_regions[i].first & ~0x0000000f ; reg <= sim_regions[i].last ; reg += 0x10)
+        {
+            for (kind = SIM_REG_CLR ; kind <= SIM_REG_INV ; kind += 4)
+            {
+                value = SIM_RW(reg + kind);
+                if (value != 0)
+                {
+                    SIM_RW(reg + kind) = 0;
+                    sim_register_written(reg, kind, value, SIM_RW(reg));
+                }
+            }
+        }
+    }
+    sim_depth--;
+}
+
+void sim_set_mode(SIM_MODE mode)
+{
+    if (sim_is_initialized || (sim_rw != NULL))
+    {
+        sim_protect(mode == SIM_MODE_TRAP);
+        if ((sim_mode == SIM_MODE_FLAT) && (mode == SIM_MODE_TRAP))
+        {
+            sim_mode = mode;
+            sim_replay_flat_writes();
+            sim_irq_dispatch();
+        }
+    }
+    sim_mode = mode;
+}
+
+SIM_MODE sim_get_mode(void)
+{
+    return sim_mode;
+}
+
+/*******************************************************************************
+ * Time
+ ******************************************************************************/
+static uint64_t sim_models_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint64_t t;
+    uint32_t i;
+
+    for (i = 0 ; i < sim_number_of_models ; i++)
+    {
+        if (sim_models[i]->next_event != NULL)
+        {
+            t = (*sim_models[i]->next_event)();
+            if (t < next)
+            {
+                next = t;
+            }
+        }
+    }
+    return next;
+}
+
+static void sim_models_run(void)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < sim_number_of_models ; i++)
+    {
+        if (sim_models[i]->run != NULL)
+        {
+            (*sim_models[i]->run)(sim_time);
+        }
+    }
+}
+
+static void sim_time_to(uint64_t target)
+{
+    uint64_t next;
+    uint32_t guard = 0;
+
+    if (sim_is_running_models)
+    {
+        return;
+    }
+    sim_is_running_models = true;
+    while ((next = sim_models_next_event()) <= target)
+    {
+        if (next > sim_time)
+        {
+            sim_time = next;
+            guard = 0;
+        }
+        else if (++guard > SIM_MAX_DISPATCH)
+        {
+            SIM_ABORT("a model does not consume its event at %llu", (unsigned long long) sim_time);
+        }
+        sim_models_run();
+    }
+    if (target > sim_time)
+    {
+        sim_time = target;
+    }
+    sim_models_run();
+    sim_is_running_models = false;
+}
+
+void sim_account(uint64_t cycles)
+{
+    sim_time_to(sim_time + cycles);
+}
+
+uint64_t sim_now(void)
+{
+    return sim_time;
+}
+
+void sim_advance(uint64_t cycles)
+{
+    uint64_t target = sim_time + cycles;
+    uint64_t next;
+
+    do
+    {
+        next = sim_models_next_event();
+        sim_time_to((next < target) ? next : target);
+        sim_irq_dispatch();
+    }
+    while (sim_time < target);
+}
+
+void sim_set_access_cost(uint32_t cycles)
+{
+    sim_access_cost = cycles;
+}
+
+uint64_t sim_get_access_count(void)
+{
+    return sim_access_count;
+}
+
+void sim_core_timer_set(uint32_t value)
+{
+    sim_core_timer_offset = value - (uint32_t) (sim_time / 2);
+}
+
+void sim_enter(void)
+{
+    sim_depth++;
+}
+
+void sim_leave(void)
+{
+    if (--sim_depth == 0)
+    {
+        sim_irq_dispatch();
+    }
+}
+
+/*******************************************************************************
+ * Interrupt controller
+ ******************************************************************************/
+void sim_irq_attach(uint32_t source, sim_isr_t isr)
+{
+    if (sim_number_of_isr >= SIM_MAX_ISR)
+    {
+        SIM_ABORT("too many interrupt handlers");
+    }
+    sim_isr[sim_number_of_isr].source = source;
+    sim_isr[sim_number_of_isr].isr = isr;
+    sim_number_of_isr++;
+}
+
+void sim_irq_detach_all(void)
+{
+    sim_number_of_isr = 0;
+}
+
+void sim_irq_set_flag(uint32_t irq)
+{
+    SIM_RW(0xBF881030 + (irq >> 5) * 0x10) |= (1u << (irq & 0x1f));
+}
+
+void sim_irq_clr_flag(uint32_t irq)
+{
+    SIM_RW(0xBF881030 + (irq >> 5) * 0x10) &= ~(1u << (irq & 0x1f));
+}
+
+bool sim_irq_flag(uint32_t irq)
+{
+    return (SIM_RW(0xBF881030 + (irq >> 5) * 0x10) >> (irq & 0x1f)) & 1;
+}
+
+void sim_irq_raise(uint32_t irq)
+{
+    sim_irq_set_flag(irq);
+    sim_dma_on_irq(irq);
+}
+
+void sim_irq_dispatch(void)
+{
+    const SIM_IRQ_REGISTERS *p_irq;
+    uint32_t count = 0;
+    uint32_t i, ipc, priority, sub_priority;
+    int best;
+    uint32_t best_priority, best_sub_priority;
+    uint32_t saved_ipl;
+    bool saved_ie;
+
+    if ((sim_depth > 0) || !sim_is_initialized)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        if (!sim_ie)
+        {
+            return;
+        }
+        best = -1;
+        best_priority = sim_ipl;
+        best_sub_priority = 0;
+        for (i = 0 ; i < sim_number_of_isr ; i++)
+        {
+            p_irq = &IrqTab[sim_isr[i].source];
+            if (!(SIM_RW(sim_sfr_device_address(p_irq->IFS)) & SIM_RW(sim_sfr_device_address(p_irq->IEC)) & p_irq->MASK))
+            {
+                continue;
+            }
+            ipc = SIM_RW(sim_sfr_device_address(p_irq->IPC));
+            priority = (ipc >> p_irq->PRI_POS) & 0x7;
+            sub_priority = (ipc >> p_irq->SUB_PRI_POS) & 0x3;
+            if ((priority > best_priority) || ((best >= 0) && (priority == best_priority) && (sub_priority > best_sub_priority)))
+            {
+                best = i;
+                best_priority = priority;
+                best_sub_priority = sub_priority;
+            }
+        }
+        if (best < 0)
+        {
+            return;
+        }
+        if (++count > SIM_MAX_DISPATCH)
+        {
+            SIM_ABORT("the handler of the interrupt source %u does not clear its flag", sim_isr[best].source);
+        }
+
+        saved_ipl = sim_ipl;
+        saved_ie = sim_ie;
+        sim_ipl = best_priority;
+        (*sim_isr[best].isr)();
+        sim_ipl = saved_ipl;
+        sim_ie = saved_ie;
+    }
+}
+
+bool sim_interrupts_enabled(void)
+{
+    return sim_ie;
+}
+
+uint32_t sim_get_ipl(void)
+{
+    return sim_ipl;
+}
+
+/*******************************************************************************
+ * Builtins of xc32 (cf. <xc.h>)
+ ******************************************************************************/
+unsigned int sim_disable_interrupts(void)
+{
+    unsigned int status = (sim_ipl << 10) | (sim_ie ? 1 : 0);
+
+    sim_ie = false;
+    return status;
+}
+
+unsigned int sim_enable_interrupts(void)
+{
+    unsigned int status = (sim_ipl << 10) | (sim_ie ? 1 : 0);
+
+    sim_ie = true;
+    sim_irq_dispatch();
+    return status;
+}
+
+unsigned int sim_core_timer_read(void)
+{
+    uint32_t count;
+
+    sim_account(1);
+    count = (uint32_t) (sim_time / 2) + sim_core_timer_offset;
+    sim_irq_dispatch();
+    return count;
+}
+
+void sim_nop(void)
+{
+    sim_account(1);
+    sim_irq_dispatch();
+}
+
+// WAIT: the CPU sleeps until the next event of a model (at least one cycle).
+void sim_wait(void)
+{
+    uint64_t next = sim_models_next_event();
+
+    sim_advance(((next > sim_time) && (next != UINT64_MAX)) ? (next - sim_time) : 1);
+}
+
+void SoftReset(void)
+{
+    SIM_ABORT("SoftReset()");
+}
@@ -0,0 +1,336 @@
+/*********************************************************************
+*	Host simulation - DMA controller (plib DmaChnXxx functions)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   A cell is transferred on each start event of the channel (or forced
+*   by DmaChnStartTxfer). The source and the destination pointers wrap on
+*   their own size and the block is done when the larger size has been
+*   transferred (or on the pattern 0x00 with DMA_OPEN_MATCH). An SFR
+*   source or destination is accessed once per cell, with the effects of
+*   a library access (FIFO of the SPI / UART ...).
+*********************************************************************/
+
+#include <peripheral/dma.h>
+#include "sim_internal.h"
+
+#define SIM_DMA_CELL_CYCLES         4
+#define SIM_DMA_API_CYCLES          8
+#define SIM_DMA_PENDING_SIZE        64
+
+typedef struct
+{
+    bool            is_open;
+    bool            is_enabled;
+    bool            is_auto_enabled;
+    bool            is_match_enabled;
+    uint8_t         priority;
+    uint32_t        event_control;
+    uint32_t        ev_flags;
+    uint32_t        ev_enable;
+    const uint8_t   *p_src;
+    uint8_t         *p_dst;
+    uint32_t        src_size;
+    uint32_t        dst_size;
+    uint32_t        cell_size;
+    uint32_t        src_ptr;
+    uint32_t        dst_ptr;
+    uint32_t        count;
+} SIM_DMA_CHANNEL;
+
+static SIM_DMA_CHANNEL sim_dma[DMA_CHANNELS];
+static uint32_t sim_dma_pending[SIM_DMA_PENDING_SIZE];
+static uint32_t sim_dma_pending_head = 0;
+static uint32_t sim_dma_pending_tail = 0;
+static bool sim_dma_is_servicing = false;
+
+void sim_dma_reset(void)
+{
+    memset(sim_dma, 0, sizeof(sim_dma));
+    sim_dma_pending_head = 0;
+    sim_dma_pending_tail = 0;
+    sim_dma_is_servicing = false;
+}
+
+static void sim_dma_event(DmaChannel chn, uint32_t flags)
+{
+    sim_dma[chn].ev_flags |= flags;
+    if (sim_dma[chn].ev_enable & flags)
+    {
+        sim_irq_raise(_DMA0_IRQ + chn);
+    }
+}
+
+static void sim_dma_cell(DmaChannel chn)
+{
+    SIM_DMA_CHANNEL *p = &sim_dma[chn];
+    uint32_t block = (p->src_size > p->dst_size) ? p->src_size : p->dst_size;
+    uint32_t value = 0;
+    uint32_t i;
+    bool is_match = false;
+
+    if (!p->is_enabled || (block == 0))
+    {
+        return;
+    }
+
+    if (sim_is_sfr(p->p_src))
+    {
+        value = sim_bus_read(sim_sfr_device_address(p->p_src)) >> (8 * (p->src_ptr & 0x3));
+        p->src_ptr += p->cell_size;
+    }
+    else
+    {
+        for (i = 0 ; i < p->cell_size ; i++)
+        {
+            value |= (uint32_t) p->p_src[p->src_ptr] << (8 * i);
+            p->src_ptr = (p->src_ptr + 1) % p->src_size;
+        }
+    }
+    if (p->src_ptr >= p->src_size)
+    {
+        p->src_ptr = 0;
+    }
+
+    for (i = 0 ; i < p->cell_size ; i++)
+    {
+        if (p->is_match_enabled && (((value >> (8 * i)) & 0xff) == 0x00))
+        {
+            is_match = true;
+        }
+    }
+
+    if (sim_is_sfr(p->p_dst))
+    {
+        sim_bus_write(sim_sfr_device_address(p->p_dst), value);
+        p->dst_ptr += p->cell_size;
+    }
+    else
+    {
+        for (i = 0 ; i < p->cell_size ; i++)
+        {
+            p->p_dst[p->dst_ptr] = (uint8_t) (value >> (8 * i));
+            p->dst_ptr = (p->dst_ptr + 1) % p->dst_size;
+        }
+    }
+    if (p->dst_ptr >= p->dst_size)
+    {
+        p->dst_ptr = 0;
+    }
+
+    sim_account(SIM_DMA_CELL_CYCLES);
+    p->count += p->cell_size;
+    sim_dma_event(chn, DMA_EV_CELL_DONE);
+    if ((p->count >= block) || is_match)
+    {
+        p->count = 0;
+        p->src_ptr = 0;
+        p->dst_ptr = 0;
+        p->is_enabled = p->is_auto_enabled;
+        sim_dma_event(chn, DMA_EV_BLOCK_DONE);
+    }
+}
+
+static void sim_dma_service(void)
+{
+    uint32_t event, priority, chn;
+
+    while (sim_dma_pending_tail != sim_dma_pending_head)
+    {
+        event = sim_dma_pending[sim_dma_pending_tail];
+        sim_dma_pending_tail = (sim_dma_pending_tail + 1) % SIM_DMA_PENDING_SIZE;
+        for (priority = 4 ; priority-- > 0 ; )
+        {
+            for (chn = 0 ; chn < DMA_CHANNELS ; chn++)
+            {
+                if (sim_dma[chn].is_enabled && (sim_dma[chn].priority == priority) &&
+                    (sim_dma[chn].event_control & DMA_EV_START_IRQ_EN) &&
+                    (((sim_dma[chn].event_control >> 8) & 0xff) == event))
+                {
+                    sim_dma_cell((DmaChannel) chn);
+                }
+            }
+        }
+    }
+}
+
+// A cell can raise a new event (SPI shifter ...): it is serviced once the
+// current cell is completed, never from inside it.
+static void sim_dma_force(DmaChannel chn)
+{
+    bool is_servicing = sim_dma_is_servicing;
+
+    sim_dma_is_servicing = true;
+    sim_dma_cell(chn);
+    if (!is_servicing)
+    {
+        sim_dma_service();
+        sim_dma_is_servicing = false;
+    }
+}
+
+void sim_dma_on_irq(uint32_t irq)
+{
+    if (((sim_dma_pending_head + 1) % SIM_DMA_PENDING_SIZE) == sim_dma_pending_tail)
+    {
+        SIM_ABORT("too many pending DMA start events");
+    }
+    sim_dma_pending[sim_dma_pending_head] = irq;
+    sim_dma_pending_head = (sim_dma_pending_head + 1) % SIM_DMA_PENDING_SIZE;
+
+    if (!sim_dma_is_servicing)
+    {
+        sim_dma_is_servicing = true;
+        sim_dma_service();
+        sim_dma_is_servicing = false;
+    }
+}
+
+void DmaChnOpen(DmaChannel chn, DmaChannelPri chPri, DmaOpenFlags oFlags)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    memset(&sim_dma[chn], 0, sizeof(sim_dma[chn]));
+    sim_dma[chn].is_open = true;
+    sim_dma[chn].priority = (uint8_t) chPri;
+    sim_dma[chn].is_auto_enabled = (oFlags & DMA_OPEN_AUTO) != 0;
+    sim_dma[chn].is_match_enabled = (oFlags & DMA_OPEN_MATCH) != 0;
+    sim_dma[chn].is_enabled = (oFlags & DMA_OPEN_ENABLE) != 0;
+    sim_leave();
+}
+
+void DmaChnEnable(DmaChannel chn)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].is_enabled = true;
+    sim_leave();
+}
+
+void DmaChnDisable(DmaChannel chn)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].is_enabled = false;
+    sim_leave();
+}
+
+void DmaChnSetControlFlags(DmaChannel chn, DmaChnCtrlFlags dmaChnCtrlFlags)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    if (dmaChnCtrlFlags & DMA_CTL_AUTO_ENABLE)
+    {
+        sim_dma[chn].is_auto_enabled = true;
+    }
+    if (dmaChnCtrlFlags & DMA_CTL_CHN_ENABLE)
+    {
+        sim_dma[chn].is_enabled = true;
+    }
+    sim_leave();
+}
+
+void DmaChnClrControlFlags(DmaChannel chn, DmaChnCtrlFlags dmaChnCtrlFlags)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    if (dmaChnCtrlFlags & DMA_CTL_AUTO_ENABLE)
+    {
+        sim_dma[chn].is_auto_enabled = false;
+    }
+    if (dmaChnCtrlFlags & DMA_CTL_CHN_ENABLE)
+    {
+        sim_dma[chn].is_enabled = false;
+    }
+    sim_leave();
+}
+
+void DmaChnSetEventControl(DmaChannel chn, unsigned int dmaEvCtrl)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].event_control = dmaEvCtrl;
+    sim_leave();
+}
+
+void DmaChnSetEvEnableFlags(DmaChannel chn, DmaEvFlags eFlags)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].ev_enable |= eFlags;
+    sim_leave();
+}
+
+void DmaChnClrEvEnableFlags(DmaChannel chn, DmaEvFlags eFlags)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].ev_enable &= ~eFlags;
+    sim_leave();
+}
+
+void DmaChnClrEvFlags(DmaChannel chn, DmaEvFlags eFlags)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].ev_flags &= ~eFlags;
+    sim_leave();
+}
+
+DmaEvFlags DmaChnGetEvFlags(DmaChannel chn)
+{
+    DmaEvFlags flags;
+
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    flags = (DmaEvFlags) sim_dma[chn].ev_flags;
+    sim_leave();
+    return flags;
+}
+
+DmaTxferRes DmaChnSetTxfer(DmaChannel chn, const void *vSrcAdd, void *vDstAdd, int srcSize, int dstSize, int cellSize)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].p_src = (const uint8_t *) vSrcAdd;
+    sim_dma[chn].p_dst = (uint8_t *) vDstAdd;
+    sim_dma[chn].src_size = (uint32_t) srcSize;
+    sim_dma[chn].dst_size = (uint32_t) dstSize;
+    sim_dma[chn].cell_size = (uint32_t) cellSize;
+    sim_dma[chn].src_ptr = 0;
+    sim_dma[chn].dst_ptr = 0;
+    sim_dma[chn].count = 0;
+    sim_leave();
+    return ((srcSize <= 0) || (dstSize <= 0) || (cellSize <= 0) || (cellSize > 4)) ? DMA_TXFER_SIZE_ERR : DMA_TXFER_OK;
+}
+
+DmaTxferRes DmaChnStartTxfer(DmaChannel chn, DmaWaitMode wMode, unsigned long retries)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].is_enabled = true;
+    sim_dma_force(chn);
+    sim_leave();
+    return DMA_TXFER_OK;
+}
+
+void DmaChnForceTxfer(DmaChannel chn)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma_force(chn);
+    sim_leave();
+}
+
+void DmaChnAbortTxfer(DmaChannel chn)
+{
+    sim_enter();
+    sim_account(SIM_DMA_API_CYCLES);
+    sim_dma[chn].is_enabled = false;
+    sim_dma[chn].src_ptr = 0;
+    sim_dma[chn].dst_ptr = 0;
+    sim_dma[chn].count = 0;
+    sim_leave();
+}
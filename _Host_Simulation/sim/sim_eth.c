@@ -0,0 +1,519 @@
+/*********************************************************************
+*	Host simulation - Ethernet controller (plib EthXxx functions) + PHY
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   RX: the buffers given by EthRxBuffersAppend() are filled, in order, by
+*   the injected frames. EthRxGetBuffer() gives them to the stack and
+*   EthRxAcknowledgeBuffer() gives them back to the controller (sticky).
+*   TX: a buffer given to EthTxSendBuffer() lasts (preamble + frame + IFG)
+*   at 100 Mbps, it is captured for the tests and can be acknowledged
+*   once sent.
+*   PHY (LAN8740, RMII, MIIM): the soft reset is immediate, the
+*   auto-negotiation ends SIM_ETH_AN_CYCLES after its restart with a link
+*   partner able to do everything.
+*********************************************************************/
+
+#include <peripheral/eth.h>
+#include "sim_internal.h"
+
+#define SIM_ETH_RX_BUFFERS          32
+#define SIM_ETH_TX_BUFFERS          16
+#define SIM_ETH_CAPTURE_SIZE        64
+#define SIM_ETH_FRAME_SIZE          1536
+#define SIM_ETH_API_CYCLES          20
+#define SIM_ETH_BYTE_CYCLES(n)      ((uint64_t) (n) * 8 * SIM_CLOCK_FREQ / 100000000ull)
+#define SIM_ETH_OVERHEAD            (8 + 4 + 12)            // Preamble + FCS + inter frame gap
+#define SIM_ETH_AN_CYCLES           SIM_US(500)
+
+#define SIM_PHY_BMCON               0
+#define SIM_PHY_BMSTAT              1
+#define SIM_PHY_PHYID1              2
+#define SIM_PHY_PHYID2              3
+#define SIM_PHY_ANAD                4
+#define SIM_PHY_ANLPAD              5
+#define SIM_PHY_ANEXP               6
+#define SIM_PHY_SMR                 18
+#define SIM_PHY_BMCON_AN_RESTART    0x0200
+#define SIM_PHY_BMCON_AN_ENABLE     0x1000
+#define SIM_PHY_BMCON_RESET         0x8000
+#define SIM_PHY_BMSTAT_CAPABILITIES 0x7809                  // 100/10 FDX/HDX, AN able, extended
+#define SIM_PHY_BMSTAT_LINK         0x0004
+#define SIM_PHY_BMSTAT_AN_COMPLETE  0x0020
+
+typedef enum
+{
+    SIM_ETH_RX_FREE = 0,        // Owned by the controller
+    SIM_ETH_RX_FULL,            // Received, not yet given to the stack
+    SIM_ETH_RX_GIVEN            // Given to the stack, not yet acknowledged
+} SIM_ETH_RX_STATE;
+
+typedef struct
+{
+    uint8_t             *p_buffer;
+    SIM_ETH_RX_STATE    state;
+    uint64_t            order;
+    sEthRxPktStat       stat;
+} SIM_ETH_RX;
+
+typedef struct
+{
+    const void          *p_buffer;
+    uint16_t            size;
+    bool                is_done;
+} SIM_ETH_TX;
+
+typedef struct
+{
+    SIM_ETH_RX          rx[SIM_ETH_RX_BUFFERS];
+    uint8_t             number_of_rx;
+    uint64_t            rx_order;
+    int                 rx_buffer_size;
+    SIM_ETH_TX          tx[SIM_ETH_TX_BUFFERS];
+    uint8_t             tx_head;
+    uint8_t             tx_count;
+    uint8_t             tx_sending;             // Number of buffers (from head) already sent
+    uint64_t            tx_end;
+    uint8_t             capture[SIM_ETH_CAPTURE_SIZE][SIM_ETH_FRAME_SIZE];
+    uint16_t            capture_size[SIM_ETH_CAPTURE_SIZE];
+    uint32_t            capture_head;
+    uint32_t            capture_count;
+    bool                is_opened;
+    bool                is_link_up;
+    uint16_t            phy[32];
+    uint64_t            an_end;
+    bool                is_an_running;
+    uint16_t            miim_result;
+} SIM_ETH;
+
+static SIM_ETH sim_eth;
+
+/*******************************************************************************
+ * PHY
+ ******************************************************************************/
+static void sim_phy_update(void)
+{
+    uint16_t bmstat = SIM_PHY_BMSTAT_CAPABILITIES;
+
+    if (sim_eth.is_an_running && (sim_now() >= sim_eth.an_end))
+    {
+        sim_eth.is_an_running = false;
+        sim_eth.phy[SIM_PHY_BMCON] &= ~SIM_PHY_BMCON_AN_RESTART;
+    }
+    if (sim_eth.is_link_up && !sim_eth.is_an_running)
+    {
+        bmstat |= SIM_PHY_BMSTAT_LINK;
+        if (sim_eth.phy[SIM_PHY_BMCON] & SIM_PHY_BMCON_AN_ENABLE)
+        {
+            bmstat |= SIM_PHY_BMSTAT_AN_COMPLETE;
+        }
+    }
+    sim_eth.phy[SIM_PHY_BMSTAT] = bmstat;
+    sim_eth.phy[SIM_PHY_ANLPAD] = sim_eth.is_link_up ? 0x05e1 : 0;     // 100/10 FDX/HDX + pause
+    sim_eth.phy[SIM_PHY_ANEXP] = sim_eth.is_link_up ? 0x0001 : 0;      // Link partner AN able
+}
+
+static void sim_phy_reset(void)
+{
+    memset(sim_eth.phy, 0, sizeof(sim_eth.phy));
+    sim_eth.phy[SIM_PHY_BMCON] = 0x3000;            // 100 Mbps, AN enabled
+    sim_eth.phy[SIM_PHY_PHYID1] = 0x0007;
+    sim_eth.phy[SIM_PHY_PHYID2] = 0xc110;
+    sim_eth.phy[SIM_PHY_ANAD] = 0x01e1;
+    sim_eth.phy[SIM_PHY_SMR] = 0x40e0;              // RMII, PHY address 0
+    sim_eth.is_an_running = false;
+    sim_phy_update();
+}
+
+static void sim_phy_write(uint8_t reg, uint16_t value)
+{
+    if (reg == SIM_PHY_BMCON)
+    {
+        if (value & SIM_PHY_BMCON_RESET)
+        {
+            sim_phy_reset();
+            return;
+        }
+        sim_eth.phy[reg] = value;
+        if ((value & SIM_PHY_BMCON_AN_ENABLE) && (value & SIM_PHY_BMCON_AN_RESTART))
+        {
+            sim_eth.is_an_running = true;
+            sim_eth.an_end = sim_now() + SIM_ETH_AN_CYCLES;
+        }
+    }
+    else if ((reg != SIM_PHY_BMSTAT) && (reg < 32))
+    {
+        sim_eth.phy[reg] = value;
+    }
+    sim_phy_update();
+}
+
+/*******************************************************************************
+ * Model
+ ******************************************************************************/
+static void sim_eth_tx_start(void)
+{
+    SIM_ETH_TX *p;
+
+    if ((sim_eth.tx_sending < sim_eth.tx_count) && (sim_eth.tx_end == UINT64_MAX))
+    {
+        p = &sim_eth.tx[(sim_eth.tx_head + sim_eth.tx_sending) % SIM_ETH_TX_BUFFERS];
+        sim_eth.tx_end = sim_now() + SIM_ETH_BYTE_CYCLES(p->size + SIM_ETH_OVERHEAD);
+    }
+}
+
+static uint64_t sim_eth_next_event(void)
+{
+    return sim_eth.tx_end;
+}
+
+static void sim_eth_run(uint64_t now)
+{
+    SIM_ETH_TX *p;
+    uint32_t slot;
+
+    if (sim_eth.tx_end > now)
+    {
+        return;
+    }
+    p = &sim_eth.tx[(sim_eth.tx_head + sim_eth.tx_sending) % SIM_ETH_TX_BUFFERS];
+    slot = (sim_eth.capture_head + sim_eth.capture_count) % SIM_ETH_CAPTURE_SIZE;
+    memcpy(sim_eth.capture[slot], p->p_buffer, p->size);
+    sim_eth.capture_size[slot] = p->size;
+    if (sim_eth.capture_count < SIM_ETH_CAPTURE_SIZE)
+    {
+        sim_eth.capture_count++;
+    }
+    else
+    {
+        sim_eth.capture_head = (sim_eth.capture_head + 1) % SIM_ETH_CAPTURE_SIZE;
+    }
+    p->is_done = true;
+    sim_eth.tx_sending++;
+    sim_eth.tx_end = UINT64_MAX;
+    sim_eth_tx_start();
+}
+
+static void sim_eth_reset(void)
+{
+    memset(&sim_eth, 0, sizeof(sim_eth));
+    sim_eth.tx_end = UINT64_MAX;
+    sim_eth.is_link_up = true;
+    sim_phy_reset();
+}
+
+static const sim_model_t sim_eth_model =
+{
+    .next_event = sim_eth_next_event,
+    .run = sim_eth_run,
+    .reset = sim_eth_reset
+};
+
+void sim_eth_init(void)
+{
+    sim_model_register(&sim_eth_model);
+}
+
+void sim_eth_set_link(bool up)
+{
+    sim_eth.is_link_up = up;
+    sim_phy_update();
+}
+
+bool sim_eth_inject(const uint8_t *p_frame, size_t size)
+{
+    SIM_ETH_RX *p = NULL;
+    uint8_t i;
+
+    if (!sim_eth.is_opened || !sim_eth.is_link_up || (size > (size_t) sim_eth.rx_buffer_size))
+    {
+        return false;
+    }
+    for (i = 0 ; i < sim_eth.number_of_rx ; i++)
+    {
+        if (sim_eth.rx[i].state == SIM_ETH_RX_FREE)
+        {
+            p = &sim_eth.rx[i];
+            break;
+        }
+    }
+    if (p == NULL)
+    {
+        return false;
+    }
+
+    memcpy(p->p_buffer, p_frame, size);
+    p->state = SIM_ETH_RX_FULL;
+    p->order = sim_eth.rx_order++;
+    p->stat.w = 0;
+    p->stat.rxBytes = (unsigned) size;
+    p->stat.rxOk = 1;
+    p->stat.bcast = ((p_frame[0] & p_frame[1] & p_frame[2] & p_frame[3] & p_frame[4] & p_frame[5]) == 0xff) ? 1 : 0;
+    p->stat.mcast = (!p->stat.bcast && (p_frame[0] & 0x01)) ? 1 : 0;
+    p->stat.runtPkt = (size < 60) ? 1 : 0;
+    sim_irq_raise(_ETH_IRQ);
+    return true;
+}
+
+size_t sim_eth_get_tx(uint8_t *p_frame, size_t size)
+{
+    size_t n;
+
+    if (sim_eth.capture_count == 0)
+    {
+        return 0;
+    }
+    n = sim_eth.capture_size[sim_eth.capture_head];
+    n = (n < size) ? n : size;
+    memcpy(p_frame, sim_eth.capture[sim_eth.capture_head], n);
+    sim_eth.capture_head = (sim_eth.capture_head + 1) % SIM_ETH_CAPTURE_SIZE;
+    sim_eth.capture_count--;
+    return n;
+}
+
+uint32_t sim_eth_get_tx_pending(void)
+{
+    return sim_eth.tx_count - sim_eth.tx_sending;
+}
+
+/*******************************************************************************
+ * plib
+ ******************************************************************************/
+void EthInit(void)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    sim_eth.number_of_rx = 0;
+    sim_eth.tx_head = 0;
+    sim_eth.tx_count = 0;
+    sim_eth.tx_sending = 0;
+    sim_eth.tx_end = UINT64_MAX;
+    sim_eth.is_opened = false;
+    sim_leave();
+}
+
+void EthMACOpen(eEthOpenFlags oFlags, eEthMacPauseType pauseType)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    sim_eth.is_opened = true;
+    sim_leave();
+}
+
+void EthRxFiltersClr(eEthRxFilters rxFilters)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    sim_leave();
+}
+
+void EthRxFiltersSet(eEthRxFilters rxFilters)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    sim_leave();
+}
+
+int EthDescriptorsPoolAdd(int nDescriptors, eEthDcptType dType, pEthBuffAlloc fAlloc, void *fParam)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES * nDescriptors);
+    sim_leave();
+    return nDescriptors;
+}
+
+eEthRes EthRxSetBufferSize(int rxBuffSize)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    sim_eth.rx_buffer_size = (rxBuffSize > SIM_ETH_FRAME_SIZE) ? SIM_ETH_FRAME_SIZE : rxBuffSize;
+    sim_leave();
+    return ETH_RES_OK;
+}
+
+eEthRes EthRxBuffersAppend(void *ppBuff[], int nBuffs, eEthBuffFlags rxFlags)
+{
+    eEthRes res = ETH_RES_OK;
+    int i;
+
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    for (i = 0 ; i < nBuffs ; i++)
+    {
+        if (sim_eth.number_of_rx >= SIM_ETH_RX_BUFFERS)
+        {
+            res = ETH_RES_NO_DESCRIPTORS;
+            break;
+        }
+        sim_eth.rx[sim_eth.number_of_rx].p_buffer = (uint8_t *) ppBuff[i];
+        sim_eth.rx[sim_eth.number_of_rx].state = SIM_ETH_RX_FREE;
+        sim_eth.number_of_rx++;
+    }
+    sim_leave();
+    return res;
+}
+
+eEthRes EthRxGetBuffer(void **ppBuff, const sEthRxPktStat **pRxStat)
+{
+    SIM_ETH_RX *p = NULL;
+    uint8_t i;
+
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    for (i = 0 ; i < sim_eth.number_of_rx ; i++)
+    {
+        if ((sim_eth.rx[i].state == SIM_ETH_RX_FULL) && ((p == NULL) || (sim_eth.rx[i].order < p->order)))
+        {
+            p = &sim_eth.rx[i];
+        }
+    }
+    if (p != NULL)
+    {
+        p->state = SIM_ETH_RX_GIVEN;
+        *ppBuff = p->p_buffer;
+        if (pRxStat != NULL)
+        {
+            *pRxStat = &p->stat;
+        }
+    }
+    else
+    {
+        *ppBuff = NULL;
+    }
+    sim_leave();
+    return (p != NULL) ? ETH_RES_OK : ETH_RES_NO_PACKET;
+}
+
+eEthRes EthRxAcknowledgeBuffer(const void *pBuff, pEthPktAckF ackFnc, void *fParam)
+{
+    eEthRes res = (pBuff != NULL) ? ETH_RES_USPACE_ERR : ETH_RES_OK;
+    uint8_t i;
+
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    for (i = 0 ; i < sim_eth.number_of_rx ; i++)
+    {
+        if ((sim_eth.rx[i].state == SIM_ETH_RX_GIVEN) && ((pBuff == NULL) || (sim_eth.rx[i].p_buffer == pBuff)))
+        {
+            sim_eth.rx[i].state = SIM_ETH_RX_FREE;
+            if (ackFnc != NULL)
+            {
+                (*ackFnc)(sim_eth.rx[i].p_buffer, 0, fParam);
+            }
+            res = ETH_RES_OK;
+        }
+    }
+    sim_leave();
+    return res;
+}
+
+int EthDescriptorsGetRxUnack(void)
+{
+    int n = 0;
+    uint8_t i;
+
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    for (i = 0 ; i < sim_eth.number_of_rx ; i++)
+    {
+        n += (sim_eth.rx[i].state != SIM_ETH_RX_FREE) ? 1 : 0;
+    }
+    sim_leave();
+    return n;
+}
+
+eEthRes EthTxSendBuffer(const void *pBuff, unsigned short nBytes)
+{
+    eEthRes res = ETH_RES_OK;
+
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    if (!sim_eth.is_opened)
+    {
+        res = ETH_RES_NOT_READY_ERR;
+    }
+    else if ((sim_eth.tx_count >= SIM_ETH_TX_BUFFERS) || (nBytes > SIM_ETH_FRAME_SIZE))
+    {
+        res = ETH_RES_NO_DESCRIPTORS;
+    }
+    else
+    {
+        sim_eth.tx[(sim_eth.tx_head + sim_eth.tx_count) % SIM_ETH_TX_BUFFERS] = (SIM_ETH_TX) {.p_buffer = pBuff, .size = nBytes, .is_done = false};
+        sim_eth.tx_count++;
+        sim_eth_tx_start();
+    }
+    sim_leave();
+    return res;
+}
+
+// Only the sent buffers at the head of the queue are acknowledged (the
+// controller gives them back in order).
+eEthRes EthTxAcknowledgeBuffer(const void *pBuff, pEthPktAckF ackFnc, void *fParam)
+{
+    SIM_ETH_TX *p;
+    eEthRes res = ETH_RES_OK;
+
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    while (sim_eth.tx_sending > 0)
+    {
+        p = &sim_eth.tx[sim_eth.tx_head];
+        if ((pBuff != NULL) && (p->p_buffer != pBuff))
+        {
+            res = ETH_RES_PACKET_QUEUED;
+            break;
+        }
+        if (ackFnc != NULL)
+        {
+            (*ackFnc)((void *) p->p_buffer, 0, fParam);
+        }
+        sim_eth.tx_head = (sim_eth.tx_head + 1) % SIM_ETH_TX_BUFFERS;
+        sim_eth.tx_count--;
+        sim_eth.tx_sending--;
+        if (pBuff != NULL)
+        {
+            break;
+        }
+    }
+    if ((pBuff == NULL) && (sim_eth.tx_count > 0))
+    {
+        res = ETH_RES_PACKET_QUEUED;
+    }
+    sim_leave();
+    return res;
+}
+
+void EthMIIMConfig(unsigned int hostClock, unsigned int miimClock)
+{
+    sim_enter();
+    sim_account(SIM_ETH_API_CYCLES);
+    sim_leave();
+}
+
+// A MIIM frame lasts 64 MDC periods (2.5 MHz).
+void EthMIIMReadStart(unsigned int rIx, unsigned int phyAdd)
+{
+    sim_enter();
+    sim_account(64 * (SIM_CLOCK_FREQ / 2500000ull));
+    sim_phy_update();
+    sim_eth.miim_result = ((phyAdd == 0) && (rIx < 32)) ? sim_eth.phy[rIx] : 0xffff;
+    sim_leave();
+}
+
+void EthMIIMWriteStart(unsigned int rIx, unsigned int phyAdd, unsigned short wData)
+{
+    sim_enter();
+    sim_account(64 * (SIM_CLOCK_FREQ / 2500000ull));
+    if (phyAdd == 0)
+    {
+        sim_phy_write((uint8_t) rIx, wData);
+    }
+    sim_leave();
+}
+
+unsigned short EthMIIMReadResult(void)
+{
+    return sim_eth.miim_result;
+}
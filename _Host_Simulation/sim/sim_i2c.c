@@ -0,0 +1,380 @@
+/*********************************************************************
+*	Host simulation - I2C modules (master)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Each request of the master (SEN, RSEN, PEN, RCEN, ACKEN, write of
+*   I2CxTRN) lasts a number of bits of 2 * (I2CxBRG + 2) cycles then
+*   raises the master event. The first byte after a START is the address
+*   of the attached slave (ACK if it matches).
+*   sim_i2c_force_collision() simulates another master: the next START
+*   collides (BCL + bus collision event, the request is cancelled) and the
+*   bus stays busy (S = 1) until the STOP of the other master (P = 1). A
+*   START requested while the bus is busy collides too.
+*********************************************************************/
+
+#include "sim_internal.h"
+
+#define SIM_I2C_NUMBER              5
+#define SIM_I2C_MAX_SLAVES          4
+#define SIM_I2C_CON(b)              ((b) + 0x00)
+#define SIM_I2C_STAT(b)             ((b) + 0x10)
+#define SIM_I2C_BRG(b)              ((b) + 0x40)
+#define SIM_I2C_TRN(b)              ((b) + 0x50)
+#define SIM_I2C_RCV(b)              ((b) + 0x60)
+
+#define SIM_I2C_CON_SEN             0x00000001
+#define SIM_I2C_CON_RSEN            0x00000002
+#define SIM_I2C_CON_PEN             0x00000004
+#define SIM_I2C_CON_RCEN            0x00000008
+#define SIM_I2C_CON_ACKEN           0x00000010
+#define SIM_I2C_CON_ACKDT           0x00000020
+#define SIM_I2C_CON_ON              0x00008000
+#define SIM_I2C_CON_REQUESTS        0x0000001f
+
+#define SIM_I2C_STAT_TBF            0x00000001
+#define SIM_I2C_STAT_RBF            0x00000002
+#define SIM_I2C_STAT_S              0x00000008
+#define SIM_I2C_STAT_P              0x00000010
+#define SIM_I2C_STAT_BCL            0x00000400
+#define SIM_I2C_STAT_TRSTAT         0x00004000
+#define SIM_I2C_STAT_ACKSTAT        0x00008000
+
+typedef enum
+{
+    SIM_I2C_OP_NONE = 0,
+    SIM_I2C_OP_START,
+    SIM_I2C_OP_RESTART,
+    SIM_I2C_OP_STOP,
+    SIM_I2C_OP_RECEIVE,
+    SIM_I2C_OP_ACK,
+    SIM_I2C_OP_TRANSMIT
+} SIM_I2C_OP;
+
+typedef struct
+{
+    uint8_t                 address;
+    const sim_i2c_slave_t   *p_slave;
+    void                    *p_context;
+} SIM_I2C_SLAVE;
+
+typedef struct
+{
+    SIM_I2C_SLAVE   slaves[SIM_I2C_MAX_SLAVES];
+    uint8_t         number_of_slaves;
+    SIM_I2C_OP      op;
+    uint64_t        op_end;
+    uint8_t         data;
+    bool            is_address_expected;
+    int             selected;           // Index of the addressed slave (-1: none)
+    bool            is_read;
+    bool            is_acknowledged;    // ACK of the master after the last byte read
+    bool            is_collision_forced;
+    uint64_t        busy_cycles;
+    bool            is_bus_busy;        // Transaction of another master
+    uint64_t        bus_free;
+    uint32_t        collision_count;
+} SIM_I2C;
+
+static const uint32_t sim_i2c_base[SIM_I2C_NUMBER] = {0xBF805300, 0xBF805400, 0xBF805000, 0xBF805100, 0xBF805200};
+static const uint32_t sim_i2c_bus_irq[SIM_I2C_NUMBER] = {_I2C1_BUS_IRQ, _I2C2_BUS_IRQ, _I2C3_BUS_IRQ, _I2C4_BUS_IRQ, _I2C5_BUS_IRQ};
+static const uint32_t sim_i2c_master_irq[SIM_I2C_NUMBER] = {_I2C1_MASTER_IRQ, _I2C2_MASTER_IRQ, _I2C3_MASTER_IRQ, _I2C4_MASTER_IRQ, _I2C5_MASTER_IRQ};
+static SIM_I2C sim_i2c[SIM_I2C_NUMBER];
+
+static int sim_i2c_module(uint32_t reg)
+{
+    int i;
+
+    for (i = 0 ; i < SIM_I2C_NUMBER ; i++)
+    {
+        if ((reg & ~0x000000ff) == sim_i2c_base[i])
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint64_t sim_i2c_bit_cycles(uint8_t i)
+{
+    return 2 * ((uint64_t) (SIM_RW(SIM_I2C_BRG(sim_i2c_base[i])) & 0x0000ffff) + 2);
+}
+
+static void sim_i2c_stat(uint8_t i, uint32_t clear, uint32_t set)
+{
+    uint32_t reg = SIM_I2C_STAT(sim_i2c_base[i]);
+
+    SIM_RW(reg) = (SIM_RW(reg) & ~clear) | set;
+}
+
+static void sim_i2c_request(uint8_t i, SIM_I2C_OP op, uint32_t bits)
+{
+    sim_i2c[i].op = op;
+    sim_i2c[i].op_end = sim_now() + bits * sim_i2c_bit_cycles(i);
+}
+
+static void sim_i2c_collision(uint8_t i)
+{
+    SIM_I2C *p = &sim_i2c[i];
+
+    SIM_RW(SIM_I2C_CON(sim_i2c_base[i])) &= ~SIM_I2C_CON_REQUESTS;
+    sim_i2c_stat(i, SIM_I2C_STAT_TBF | SIM_I2C_STAT_TRSTAT, SIM_I2C_STAT_BCL);
+    p->op = SIM_I2C_OP_NONE;
+    p->collision_count++;
+    sim_irq_raise(sim_i2c_bus_irq[i]);
+}
+
+static void sim_i2c_slave_stop(uint8_t i)
+{
+    SIM_I2C *p = &sim_i2c[i];
+
+    if ((p->selected >= 0) && (p->slaves[p->selected].p_slave->stop != NULL))
+    {
+        (*p->slaves[p->selected].p_slave->stop)(p->slaves[p->selected].p_context);
+    }
+    p->selected = -1;
+}
+
+static bool sim_i2c_slave_transmit(uint8_t i, uint8_t data)
+{
+    SIM_I2C *p = &sim_i2c[i];
+    const SIM_I2C_SLAVE *p_slave;
+    uint8_t n;
+
+    if (p->is_address_expected)
+    {
+        p->is_address_expected = false;
+        sim_i2c_slave_stop(i);
+        for (n = 0 ; n < p->number_of_slaves ; n++)
+        {
+            if (p->slaves[n].address == (data >> 1))
+            {
+                p->selected = n;
+                p->is_read = (data & 0x01) != 0;
+                if (p->slaves[n].p_slave->start != NULL)
+                {
+                    (*p->slaves[n].p_slave->start)(p->slaves[n].p_context, p->is_read);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+    if ((p->selected < 0) || p->is_read)
+    {
+        return false;
+    }
+    p_slave = &p->slaves[p->selected];
+    return (p_slave->p_slave->write != NULL) ? (*p_slave->p_slave->write)(p_slave->p_context, data) : false;
+}
+
+static uint64_t sim_i2c_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_I2C_NUMBER ; i++)
+    {
+        if ((sim_i2c[i].op != SIM_I2C_OP_NONE) && (sim_i2c[i].op_end < next))
+        {
+            next = sim_i2c[i].op_end;
+        }
+        if (sim_i2c[i].is_bus_busy && (sim_i2c[i].bus_free < next))
+        {
+            next = sim_i2c[i].bus_free;
+        }
+    }
+    return next;
+}
+
+static void sim_i2c_run(uint64_t now)
+{
+    SIM_I2C *p;
+    uint32_t con_reg;
+    const SIM_I2C_SLAVE *p_slave;
+    bool ack;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_I2C_NUMBER ; i++)
+    {
+        p = &sim_i2c[i];
+        con_reg = SIM_I2C_CON(sim_i2c_base[i]);
+
+        if (p->is_bus_busy && (p->bus_free <= now))
+        {
+            // STOP of the other master.
+            p->is_bus_busy = false;
+            sim_i2c_stat(i, SIM_I2C_STAT_S, SIM_I2C_STAT_P);
+        }
+        if ((p->op == SIM_I2C_OP_NONE) || (p->op_end > now))
+        {
+            continue;
+        }
+
+        switch (p->op)
+        {
+            case SIM_I2C_OP_START:
+            case SIM_I2C_OP_RESTART:
+                SIM_RW(con_reg) &= ~(SIM_I2C_CON_SEN | SIM_I2C_CON_RSEN);
+                sim_i2c_stat(i, SIM_I2C_STAT_P, SIM_I2C_STAT_S);
+                p->is_address_expected = true;
+                p->is_acknowledged = true;
+                break;
+            case SIM_I2C_OP_STOP:
+                SIM_RW(con_reg) &= ~SIM_I2C_CON_PEN;
+                sim_i2c_stat(i, SIM_I2C_STAT_S, SIM_I2C_STAT_P);
+                sim_i2c_slave_stop(i);
+                break;
+            case SIM_I2C_OP_TRANSMIT:
+                ack = sim_i2c_slave_transmit(i, p->data);
+                sim_i2c_stat(i, SIM_I2C_STAT_TBF | SIM_I2C_STAT_TRSTAT | SIM_I2C_STAT_ACKSTAT, ack ? 0 : SIM_I2C_STAT_ACKSTAT);
+                break;
+            case SIM_I2C_OP_RECEIVE:
+                SIM_RW(con_reg) &= ~SIM_I2C_CON_RCEN;
+                p_slave = (p->selected >= 0) ? &p->slaves[p->selected] : NULL;
+                SIM_RW(SIM_I2C_RCV(sim_i2c_base[i])) = ((p_slave != NULL) && p->is_read && (p_slave->p_slave->read != NULL)) ? (*p_slave->p_slave->read)(p_slave->p_context, p->is_acknowledged) : 0xff;
+                sim_i2c_stat(i, 0, SIM_I2C_STAT_RBF);
+                break;
+            case SIM_I2C_OP_ACK:
+                SIM_RW(con_reg) &= ~SIM_I2C_CON_ACKEN;
+                p->is_acknowledged = !(SIM_RW(con_reg) & SIM_I2C_CON_ACKDT);
+                break;
+            default:
+                break;
+        }
+        p->op = SIM_I2C_OP_NONE;
+        sim_irq_raise(sim_i2c_master_irq[i]);
+    }
+}
+
+static void sim_i2c_read(uint32_t reg)
+{
+    int i = sim_i2c_module(reg);
+
+    if (reg == SIM_I2C_RCV(sim_i2c_base[i]))
+    {
+        sim_i2c_stat(i, SIM_I2C_STAT_RBF, 0);
+    }
+}
+
+static void sim_i2c_write(uint32_t reg, uint32_t previous)
+{
+    int i = sim_i2c_module(reg);
+    SIM_I2C *p = &sim_i2c[i];
+    uint32_t base = sim_i2c_base[i];
+    uint32_t con = SIM_RW(SIM_I2C_CON(base));
+    uint32_t requested = (reg == SIM_I2C_CON(base)) ? (con & ~previous & SIM_I2C_CON_REQUESTS) : 0;
+
+    if (!(con & SIM_I2C_CON_ON))
+    {
+        p->op = SIM_I2C_OP_NONE;
+        SIM_RW(SIM_I2C_CON(base)) &= ~SIM_I2C_CON_REQUESTS;
+        return;
+    }
+
+    if (requested)
+    {
+        if (p->op != SIM_I2C_OP_NONE)
+        {
+            // Request while the module is not idle: ignored (as on the device, with IWCOL).
+            SIM_RW(SIM_I2C_CON(base)) &= ~requested;
+        }
+        else if (requested & SIM_I2C_CON_SEN)
+        {
+            if (p->is_collision_forced)
+            {
+                p->is_collision_forced = false;
+                p->is_bus_busy = true;
+                p->bus_free = sim_now() + p->busy_cycles;
+                sim_i2c_stat(i, SIM_I2C_STAT_P, SIM_I2C_STAT_S);
+                sim_i2c_collision(i);
+            }
+            else if (p->is_bus_busy)
+            {
+                sim_i2c_collision(i);
+            }
+            else
+            {
+                sim_i2c_request(i, SIM_I2C_OP_START, 1);
+            }
+        }
+        else if (requested & SIM_I2C_CON_RSEN)
+        {
+            sim_i2c_request(i, SIM_I2C_OP_RESTART, 1);
+        }
+        else if (requested & SIM_I2C_CON_PEN)
+        {
+            sim_i2c_request(i, SIM_I2C_OP_STOP, 1);
+        }
+        else if (requested & SIM_I2C_CON_RCEN)
+        {
+            sim_i2c_request(i, SIM_I2C_OP_RECEIVE, 8);
+        }
+        else if (requested & SIM_I2C_CON_ACKEN)
+        {
+            sim_i2c_request(i, SIM_I2C_OP_ACK, 1);
+        }
+    }
+    else if ((reg == SIM_I2C_TRN(base)) && (p->op == SIM_I2C_OP_NONE))
+    {
+        p->data = (uint8_t) SIM_RW(reg);
+        sim_i2c_stat(i, 0, SIM_I2C_STAT_TBF | SIM_I2C_STAT_TRSTAT);
+        sim_i2c_request(i, SIM_I2C_OP_TRANSMIT, 9);
+    }
+}
+
+static void sim_i2c_reset(void)
+{
+    uint8_t i;
+
+    memset(sim_i2c, 0, sizeof(sim_i2c));
+    for (i = 0 ; i < SIM_I2C_NUMBER ; i++)
+    {
+        sim_i2c[i].selected = -1;
+    }
+}
+
+static const sim_model_t sim_i2c_model =
+{
+    .next_event = sim_i2c_next_event,
+    .run = sim_i2c_run,
+    .reset = sim_i2c_reset
+};
+
+void sim_i2c_init(void)
+{
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_I2C_NUMBER ; i++)
+    {
+        sim_region_register(sim_i2c_base[i], 0x70, sim_i2c_read, sim_i2c_write);
+    }
+    sim_model_register(&sim_i2c_model);
+}
+
+void sim_i2c_attach(uint8_t module, uint8_t address, const sim_i2c_slave_t *p_slave, void *p_context)
+{
+    SIM_I2C *p = &sim_i2c[module];
+
+    if (p->number_of_slaves >= SIM_I2C_MAX_SLAVES)
+    {
+        SIM_ABORT("I2C %u: too many slaves", module + 1);
+    }
+    p->slaves[p->number_of_slaves].address = address;
+    p->slaves[p->number_of_slaves].p_slave = p_slave;
+    p->slaves[p->number_of_slaves].p_context = p_context;
+    p->number_of_slaves++;
+}
+
+void sim_i2c_force_collision(uint8_t module, uint64_t busy_cycles)
+{
+    sim_i2c[module].is_collision_forced = true;
+    sim_i2c[module].busy_cycles = busy_cycles;
+}
+
+uint32_t sim_i2c_get_collision_count(uint8_t module)
+{
+    return sim_i2c[module].collision_count;
+}
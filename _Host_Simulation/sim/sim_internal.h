@@ -0,0 +1,77 @@
+/*********************************************************************
+*	Host simulation - interface between the core and the models
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The models work on the device addresses (0xBF8xxxxx) through the
+*   read / write view SIM_RW(): they never trap. The registers touched by
+*   the library are routed to the models by sim_region_register().
+*********************************************************************/
+
+#ifndef __HOST_SIM_INTERNAL_H
+#define __HOST_SIM_INTERNAL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xc.h>
+#include "sim.h"
+
+extern uint32_t *sim_rw;
+
+#define SIM_RW(a)                   (sim_rw[((uint32_t) (a) - SIM_SFR_BASE) >> 2])
+#define SIM_REG_CLR                 0x4
+#define SIM_REG_SET                 0x8
+#define SIM_REG_INV                 0xC
+
+#define SIM_ABORT(...)              do { fprintf(stderr, "sim: " __VA_ARGS__); fputc('\n', stderr); abort(); } while (0)
+
+// Register hooks. reg is the device address of the register (without the
+// CLR / SET / INV offset). The write hook is called once the new value is
+// in the register (previous is the value before the write).
+typedef void (*sim_read_hook_t)(uint32_t reg);
+typedef void (*sim_write_hook_t)(uint32_t reg, uint32_t previous);
+void sim_region_register(uint32_t first, uint32_t size, sim_read_hook_t read, sim_write_hook_t write);
+
+// Accesses of the models (DMA) with the effects of the library accesses.
+bool sim_is_sfr(const volatile void *p);
+uint32_t sim_sfr_device_address(const volatile void *p);
+uint32_t sim_bus_read(uint32_t address);
+void sim_bus_write(uint32_t address, uint32_t value);
+
+// Time. The models give their next event and run everything due at 'now'.
+typedef struct
+{
+    uint64_t (*next_event)(void);
+    void (*run)(uint64_t now);
+    void (*reset)(void);
+} sim_model_t;
+void sim_model_register(const sim_model_t *p_model);
+void sim_account(uint64_t cycles);      // Time spent by the library (API of the plib)
+
+// Entry / exit of the plib functions implemented by the simulation: the
+// interrupts are dispatched when leaving the outermost one.
+void sim_enter(void);
+void sim_leave(void);
+
+// Interrupt controller
+void sim_irq_set_flag(uint32_t irq);
+void sim_irq_clr_flag(uint32_t irq);
+void sim_irq_dispatch(void);
+
+// Links between the models
+void sim_dma_on_irq(uint32_t irq);
+void sim_dma_reset(void);
+void sim_adc_on_timer3(void);
+void sim_ports_init(void);
+void sim_timers_init(void);
+void sim_spi_init(void);
+void sim_uart_init(void);
+void sim_i2c_init(void);
+void sim_adc_init(void);
+void sim_can_init(void);
+void sim_eth_init(void);
+
+#endif
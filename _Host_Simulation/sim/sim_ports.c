@@ -0,0 +1,125 @@
+/*********************************************************************
+*	Host simulation - I/O ports (PORTA .. PORTG)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   PORTx returns the LATx bits of the outputs (TRISx = 0) and the levels
+*   given by sim_port_set_input() for the inputs. A write of PORTx goes
+*   to LATx. The watchers (chip select of the device models ...) are
+*   called on each change of level of their pin.
+*********************************************************************/
+
+#include "sim_internal.h"
+
+#define SIM_PORTS_BASE              0xBF886000
+#define SIM_PORTS_NUMBER            7
+#define SIM_PORT_TRIS(p)            (SIM_PORTS_BASE + ((p) - 1) * 0x40 + 0x00)
+#define SIM_PORT_PORT(p)            (SIM_PORTS_BASE + ((p) - 1) * 0x40 + 0x10)
+#define SIM_PORT_LAT(p)             (SIM_PORTS_BASE + ((p) - 1) * 0x40 + 0x20)
+#define SIM_MAX_WATCHERS            32
+
+typedef struct
+{
+    uint8_t             port;
+    uint8_t             indice;
+    bool                level;
+    sim_pin_callback_t  callback;
+    void                *p_context;
+} SIM_WATCHER;
+
+static uint32_t sim_port_inputs[SIM_PORTS_NUMBER + 1];
+static SIM_WATCHER sim_watchers[SIM_MAX_WATCHERS];
+static uint32_t sim_number_of_watchers = 0;
+
+static void sim_port_update(uint8_t port)
+{
+    uint32_t tris = SIM_RW(SIM_PORT_TRIS(port));
+    uint32_t i;
+    bool level;
+
+    SIM_RW(SIM_PORT_PORT(port)) = (sim_port_inputs[port] & tris) | (SIM_RW(SIM_PORT_LAT(port)) & ~tris);
+
+    for (i = 0 ; i < sim_number_of_watchers ; i++)
+    {
+        if (sim_watchers[i].port == port)
+        {
+            level = (SIM_RW(SIM_PORT_PORT(port)) >> sim_watchers[i].indice) & 1;
+            if (level != sim_watchers[i].level)
+            {
+                sim_watchers[i].level = level;
+                (*sim_watchers[i].callback)(sim_watchers[i].p_context, level);
+            }
+        }
+    }
+}
+
+static void sim_port_write(uint32_t reg, uint32_t previous)
+{
+    uint8_t port = (uint8_t) ((reg - SIM_PORTS_BASE) / 0x40 + 1);
+
+    if ((reg & 0x30) == 0x10)
+    {
+        SIM_RW(SIM_PORT_LAT(port)) = SIM_RW(reg);
+    }
+    sim_port_update(port);
+}
+
+static void sim_ports_reset(void)
+{
+    uint8_t port;
+
+    sim_number_of_watchers = 0;
+    for (port = 1 ; port <= SIM_PORTS_NUMBER ; port++)
+    {
+        sim_port_inputs[port] = 0;
+        SIM_RW(SIM_PORT_TRIS(port)) = 0x0000ffff;
+        sim_port_update(port);
+    }
+}
+
+static const sim_model_t sim_ports_model =
+{
+    .next_event = NULL,
+    .run = NULL,
+    .reset = sim_ports_reset
+};
+
+void sim_ports_init(void)
+{
+    sim_region_register(SIM_PORTS_BASE, SIM_PORTS_NUMBER * 0x40, NULL, sim_port_write);
+    sim_model_register(&sim_ports_model);
+}
+
+bool sim_port_get_output(uint8_t port, uint8_t indice)
+{
+    return (SIM_RW(SIM_PORT_PORT(port)) >> indice) & 1;
+}
+
+void sim_port_set_input(uint8_t port, uint8_t indice, bool level)
+{
+    if (level)
+    {
+        sim_port_inputs[port] |= (1u << indice);
+    }
+    else
+    {
+        sim_port_inputs[port] &= ~(1u << indice);
+    }
+    sim_port_update(port);
+}
+
+void sim_port_watch(uint8_t port, uint8_t indice, sim_pin_callback_t callback, void *p_context)
+{
+    if (sim_number_of_watchers >= SIM_MAX_WATCHERS)
+    {
+        SIM_ABORT("too many pin watchers");
+    }
+    sim_watchers[sim_number_of_watchers].port = port;
+    sim_watchers[sim_number_of_watchers].indice = indice;
+    sim_watchers[sim_number_of_watchers].level = (SIM_RW(SIM_PORT_PORT(port)) >> indice) & 1;
+    sim_watchers[sim_number_of_watchers].callback = callback;
+    sim_watchers[sim_number_of_watchers].p_context = p_context;
+    sim_number_of_watchers++;
+}
@@ -0,0 +1,252 @@
+/*********************************************************************
+*	Host simulation - SPI modules (master)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   A word written in SPIxBUF goes to the shift register if it is idle
+*   (TX event) or waits in the transmit buffer. A word lasts
+*   bits * 2 * (SPIxBRG + 1) cycles. At the end of a word, the attached
+*   device gives the received word (receive buffer, RX event) and the
+*   waiting word (if any) goes to the shift register (TX event).
+*   The receive buffer is 1 word deep (4 with ENHBUF); SPIROV is set when
+*   a word is lost.
+*********************************************************************/
+
+#include "sim_internal.h"
+
+#define SIM_SPI_NUMBER              4
+#define SIM_SPI_CON(b)              ((b) + 0x00)
+#define SIM_SPI_STAT(b)             ((b) + 0x10)
+#define SIM_SPI_BUF(b)              ((b) + 0x20)
+#define SIM_SPI_BRG(b)              ((b) + 0x30)
+
+#define SIM_SPI_CON_ON              0x00008000
+#define SIM_SPI_CON_MODE32          0x00000800
+#define SIM_SPI_CON_MODE16          0x00000400
+#define SIM_SPI_CON_ENHBUF          0x00010000
+
+#define SIM_SPI_STAT_RBF            0x00000001
+#define SIM_SPI_STAT_TBF            0x00000002
+#define SIM_SPI_STAT_TBE            0x00000008
+#define SIM_SPI_STAT_RBE            0x00000020
+#define SIM_SPI_STAT_ROV            0x00000040
+#define SIM_SPI_STAT_SRMT           0x00000080
+#define SIM_SPI_STAT_BUSY           0x00000800
+
+#define SIM_SPI_FIFO_SIZE           4
+
+typedef struct
+{
+    sim_spi_device_t    device;
+    void                *p_context;
+    bool                is_shifting;
+    uint32_t            shift_word;
+    uint8_t             shift_width;
+    uint64_t            shift_end;
+    bool                is_held;
+    uint32_t            held_word;
+    uint32_t            rx_fifo[SIM_SPI_FIFO_SIZE];
+    uint8_t             rx_head;
+    uint8_t             rx_count;
+    uint64_t            word_count;
+} SIM_SPI;
+
+static const uint32_t sim_spi_base[SIM_SPI_NUMBER] = {0xBF805E00, 0xBF805A00, 0xBF805800, 0xBF805C00};
+static const uint32_t sim_spi_rx_irq[SIM_SPI_NUMBER] = {_SPI1_RX_IRQ, _SPI2_RX_IRQ, _SPI3_RX_IRQ, _SPI4_RX_IRQ};
+static const uint32_t sim_spi_tx_irq[SIM_SPI_NUMBER] = {_SPI1_TX_IRQ, _SPI2_TX_IRQ, _SPI3_TX_IRQ, _SPI4_TX_IRQ};
+static SIM_SPI sim_spi[SIM_SPI_NUMBER];
+
+static int sim_spi_module(uint32_t reg)
+{
+    int i;
+
+    for (i = 0 ; i < SIM_SPI_NUMBER ; i++)
+    {
+        if ((reg & ~0x000000ff) == sim_spi_base[i])
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint8_t sim_spi_width(uint8_t i)
+{
+    uint32_t con = SIM_RW(SIM_SPI_CON(sim_spi_base[i]));
+
+    return (con & SIM_SPI_CON_MODE32) ? 32 : ((con & SIM_SPI_CON_MODE16) ? 16 : 8);
+}
+
+static void sim_spi_update_status(uint8_t i)
+{
+    SIM_SPI *p = &sim_spi[i];
+    uint32_t stat = SIM_RW(SIM_SPI_STAT(sim_spi_base[i])) & SIM_SPI_STAT_ROV;
+
+    stat |= (p->rx_count > 0) ? SIM_SPI_STAT_RBF : SIM_SPI_STAT_RBE;
+    stat |= p->is_held ? SIM_SPI_STAT_TBF : SIM_SPI_STAT_TBE;
+    stat |= (p->is_shifting || p->is_held) ? SIM_SPI_STAT_BUSY : SIM_SPI_STAT_SRMT;
+    SIM_RW(SIM_SPI_STAT(sim_spi_base[i])) = stat;
+}
+
+static void sim_spi_shift(uint8_t i, uint32_t word)
+{
+    SIM_SPI *p = &sim_spi[i];
+    uint32_t brg = SIM_RW(SIM_SPI_BRG(sim_spi_base[i])) & 0x00000fff;
+
+    p->is_shifting = true;
+    p->shift_width = sim_spi_width(i);
+    p->shift_word = (p->shift_width == 32) ? word : (word & ((1u << p->shift_width) - 1));
+    p->shift_end = sim_now() + (uint64_t) p->shift_width * 2 * (brg + 1);
+    sim_spi_update_status(i);
+    sim_irq_raise(sim_spi_tx_irq[i]);
+}
+
+static uint64_t sim_spi_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_SPI_NUMBER ; i++)
+    {
+        if (sim_spi[i].is_shifting && (sim_spi[i].shift_end < next))
+        {
+            next = sim_spi[i].shift_end;
+        }
+    }
+    return next;
+}
+
+static void sim_spi_run(uint64_t now)
+{
+    SIM_SPI *p;
+    uint32_t rx;
+    uint8_t i;
+    uint8_t depth;
+
+    for (i = 0 ; i < SIM_SPI_NUMBER ; i++)
+    {
+        p = &sim_spi[i];
+        if (!p->is_shifting || (p->shift_end > now))
+        {
+            continue;
+        }
+        p->is_shifting = false;
+        p->word_count++;
+        rx = (p->device != NULL) ? (*p->device)(p->p_context, p->shift_word, p->shift_width) : 0xffffffff;
+        if (p->shift_width < 32)
+        {
+            rx &= (1u << p->shift_width) - 1;
+        }
+
+        depth = (SIM_RW(SIM_SPI_CON(sim_spi_base[i])) & SIM_SPI_CON_ENHBUF) ? SIM_SPI_FIFO_SIZE : 1;
+        if (p->rx_count < depth)
+        {
+            p->rx_fifo[(p->rx_head + p->rx_count) % SIM_SPI_FIFO_SIZE] = rx;
+            p->rx_count++;
+        }
+        else
+        {
+            SIM_RW(SIM_SPI_STAT(sim_spi_base[i])) |= SIM_SPI_STAT_ROV;
+        }
+        sim_spi_update_status(i);
+        sim_irq_raise(sim_spi_rx_irq[i]);
+
+        if (p->is_held)
+        {
+            p->is_held = false;
+            sim_spi_shift(i, p->held_word);
+        }
+    }
+}
+
+static void sim_spi_read(uint32_t reg)
+{
+    int i = sim_spi_module(reg);
+    SIM_SPI *p = &sim_spi[i];
+
+    if (reg == SIM_SPI_BUF(sim_spi_base[i]) && (p->rx_count > 0))
+    {
+        SIM_RW(reg) = p->rx_fifo[p->rx_head];
+        p->rx_head = (p->rx_head + 1) % SIM_SPI_FIFO_SIZE;
+        p->rx_count--;
+        sim_spi_update_status(i);
+    }
+}
+
+static void sim_spi_write(uint32_t reg, uint32_t previous)
+{
+    int i = sim_spi_module(reg);
+    SIM_SPI *p = &sim_spi[i];
+    uint32_t base = sim_spi_base[i];
+
+    if (reg == SIM_SPI_CON(base))
+    {
+        if (!(SIM_RW(reg) & SIM_SPI_CON_ON))
+        {
+            p->is_shifting = false;
+            p->is_held = false;
+            p->rx_count = 0;
+        }
+        sim_spi_update_status(i);
+    }
+    else if (reg == SIM_SPI_STAT(base))
+    {
+        sim_spi_update_status(i);
+    }
+    else if ((reg == SIM_SPI_BUF(base)) && (SIM_RW(SIM_SPI_CON(base)) & SIM_SPI_CON_ON))
+    {
+        if (!p->is_shifting)
+        {
+            sim_spi_shift(i, SIM_RW(reg));
+        }
+        else if (!p->is_held)
+        {
+            p->is_held = true;
+            p->held_word = SIM_RW(reg);
+            sim_spi_update_status(i);
+        }
+        // Transmit buffer full: the word is lost (as on the device).
+    }
+}
+
+static void sim_spi_reset(void)
+{
+    uint8_t i;
+
+    memset(sim_spi, 0, sizeof(sim_spi));
+    for (i = 0 ; i < SIM_SPI_NUMBER ; i++)
+    {
+        sim_spi_update_status(i);
+    }
+}
+
+static const sim_model_t sim_spi_model =
+{
+    .next_event = sim_spi_next_event,
+    .run = sim_spi_run,
+    .reset = sim_spi_reset
+};
+
+void sim_spi_init(void)
+{
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_SPI_NUMBER ; i++)
+    {
+        sim_region_register(sim_spi_base[i], 0x40, sim_spi_read, sim_spi_write);
+    }
+    sim_model_register(&sim_spi_model);
+}
+
+void sim_spi_attach(uint8_t module, sim_spi_device_t device, void *p_context)
+{
+    sim_spi[module].device = device;
+    sim_spi[module].p_context = p_context;
+}
+
+uint64_t sim_spi_get_word_count(uint8_t module)
+{
+    return sim_spi[module].word_count;
+}
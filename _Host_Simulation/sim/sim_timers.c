@@ -0,0 +1,158 @@
+/*********************************************************************
+*	Host simulation - TIMER modules (1, 2, 3, 4 et 5)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Internal clock (PBCLK) and prescaler only (no gated mode, no 32 bits
+*   mode). TMRx goes back to zero on the timer clock which follows the
+*   match with PRx and sets the interrupt flag. A period of TIMER3 starts
+*   a conversion sequence of the ADC (SSRC = 2).
+*********************************************************************/
+
+#include "sim_internal.h"
+
+#define SIM_TMR_BASE(n)             (0xBF800600 + 0x200 * (n))
+#define SIM_TMR_CON(n)              (SIM_TMR_BASE(n) + 0x00)
+#define SIM_TMR_TMR(n)              (SIM_TMR_BASE(n) + 0x10)
+#define SIM_TMR_PR(n)               (SIM_TMR_BASE(n) + 0x20)
+#define SIM_TMR_NUMBER              5
+#define SIM_TMR_ON                  0x00008000
+
+typedef struct
+{
+    uint64_t    last;           // Time of the last update of TMRx
+    uint32_t    remainder;      // Cycles of the prescaler already counted
+} SIM_TIMER;
+
+static SIM_TIMER sim_timers[SIM_TMR_NUMBER];
+static const uint32_t sim_tmr_irq[SIM_TMR_NUMBER] = {_TIMER_1_IRQ, _TIMER_2_IRQ, _TIMER_3_IRQ, _TIMER_4_IRQ, _TIMER_5_IRQ};
+
+static uint32_t sim_timer_prescaler(uint8_t n)
+{
+    static const uint32_t ps_1[4] = {1, 8, 64, 256};
+    static const uint32_t ps_2345[8] = {1, 2, 4, 8, 16, 32, 64, 256};
+    uint32_t tckps = (SIM_RW(SIM_TMR_CON(n)) >> 4) & 0x7;
+
+    return (n == 0) ? ps_1[tckps & 0x3] : ps_2345[tckps];
+}
+
+static uint32_t sim_timer_period(uint8_t n)
+{
+    uint32_t pr = SIM_RW(SIM_TMR_PR(n)) & 0x0000ffff;
+
+    return (pr == 0) ? 0x00010000 : (pr + 1);
+}
+
+// Timer clocks before the next return to zero (match with PRx or roll over).
+static uint32_t sim_timer_ticks_to_reset(uint8_t n)
+{
+    uint32_t counter = SIM_RW(SIM_TMR_TMR(n)) & 0x0000ffff;
+    uint32_t period = sim_timer_period(n);
+
+    return (counter < period) ? (period - counter) : (0x00010000 - counter);
+}
+
+static uint64_t sim_timers_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint64_t t;
+    uint8_t n;
+
+    for (n = 0 ; n < SIM_TMR_NUMBER ; n++)
+    {
+        if (SIM_RW(SIM_TMR_CON(n)) & SIM_TMR_ON)
+        {
+            t = sim_timers[n].last + (uint64_t) sim_timer_ticks_to_reset(n) * sim_timer_prescaler(n) - sim_timers[n].remainder;
+            if (t < next)
+            {
+                next = t;
+            }
+        }
+    }
+    return next;
+}
+
+static void sim_timers_run(uint64_t now)
+{
+    uint64_t cycles, ticks;
+    uint32_t prescaler, counter, period, to_reset;
+    uint8_t n;
+
+    for (n = 0 ; n < SIM_TMR_NUMBER ; n++)
+    {
+        if (!(SIM_RW(SIM_TMR_CON(n)) & SIM_TMR_ON) || (now <= sim_timers[n].last))
+        {
+            sim_timers[n].last = (now > sim_timers[n].last) ? now : sim_timers[n].last;
+            continue;
+        }
+        prescaler = sim_timer_prescaler(n);
+        cycles = (now - sim_timers[n].last) + sim_timers[n].remainder;
+        ticks = cycles / prescaler;
+        sim_timers[n].remainder = (uint32_t) (cycles % prescaler);
+        sim_timers[n].last = now;
+
+        counter = SIM_RW(SIM_TMR_TMR(n)) & 0x0000ffff;
+        period = sim_timer_period(n);
+        while (ticks > 0)
+        {
+            to_reset = (counter < period) ? (period - counter) : (0x00010000 - counter);
+            if (ticks < to_reset)
+            {
+                counter += (uint32_t) ticks;
+                break;
+            }
+            ticks -= to_reset;
+            if (counter < period)
+            {
+                sim_irq_raise(sim_tmr_irq[n]);
+                if (n == 2)
+                {
+                    sim_adc_on_timer3();
+                }
+            }
+            counter = 0;
+            if (ticks >= period)
+            {
+                // Several periods without event (time jump of the caller): the flag is already set.
+                ticks %= period;
+            }
+        }
+        SIM_RW(SIM_TMR_TMR(n)) = counter;
+    }
+}
+
+static void sim_timer_write(uint32_t reg, uint32_t previous)
+{
+    uint8_t n = (uint8_t) ((reg - SIM_TMR_BASE(0)) / 0x200);
+
+    if ((reg == SIM_TMR_CON(n)) && !(previous & SIM_TMR_ON) && (SIM_RW(reg) & SIM_TMR_ON))
+    {
+        sim_timers[n].last = sim_now();
+        sim_timers[n].remainder = 0;
+    }
+    else if (reg == SIM_TMR_TMR(n))
+    {
+        SIM_RW(reg) &= 0x0000ffff;
+        sim_timers[n].remainder = 0;
+    }
+}
+
+static void sim_timers_reset(void)
+{
+    memset(sim_timers, 0, sizeof(sim_timers));
+}
+
+static const sim_model_t sim_timers_model =
+{
+    .next_event = sim_timers_next_event,
+    .run = sim_timers_run,
+    .reset = sim_timers_reset
+};
+
+void sim_timers_init(void)
+{
+    sim_region_register(SIM_TMR_BASE(0), 0x200 * SIM_TMR_NUMBER, NULL, sim_timer_write);
+    sim_model_register(&sim_timers_model);
+}
@@ -0,0 +1,300 @@
+/*********************************************************************
+*	Host simulation - UART modules
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   8 levels transmit FIFO + shift register, one character lasts
+*   (start + data + parity + stop) bits of 16 (or 4 with BRGH) times
+*   (UxBRG + 1) cycles. The TX event follows UTXISEL (not full, all
+*   transmitted, FIFO empty). The sent characters are captured for the
+*   tests. The injected characters arrive at the baudrate in a 8 levels
+*   receive FIFO (OERR when it is full).
+*********************************************************************/
+
+#include "sim_internal.h"
+
+#define SIM_UART_NUMBER             6
+#define SIM_UART_MODE(b)            ((b) + 0x00)
+#define SIM_UART_STA(b)             ((b) + 0x10)
+#define SIM_UART_TX(b)              ((b) + 0x20)
+#define SIM_UART_RX(b)              ((b) + 0x30)
+#define SIM_UART_BRG(b)             ((b) + 0x40)
+
+#define SIM_UART_MODE_ON            0x00008000
+#define SIM_UART_MODE_BRGH          0x00000008
+#define SIM_UART_STA_URXDA          0x00000001
+#define SIM_UART_STA_OERR           0x00000002
+#define SIM_UART_STA_RIDLE          0x00000010
+#define SIM_UART_STA_TRMT           0x00000100
+#define SIM_UART_STA_UTXBF          0x00000200
+#define SIM_UART_STA_UTXEN          0x00000400
+
+#define SIM_UART_FIFO_SIZE          8
+#define SIM_UART_CAPTURE_SIZE       8192
+#define SIM_UART_INCOMING_SIZE      1024
+
+typedef struct
+{
+    uint8_t     tx_fifo[SIM_UART_FIFO_SIZE];
+    uint8_t     tx_head;
+    uint8_t     tx_count;
+    bool        is_shifting;
+    uint8_t     shift_data;
+    uint64_t    shift_end;
+    uint8_t     rx_fifo[SIM_UART_FIFO_SIZE];
+    uint8_t     rx_head;
+    uint8_t     rx_count;
+    uint8_t     incoming[SIM_UART_INCOMING_SIZE];
+    uint32_t    incoming_head;
+    uint32_t    incoming_count;
+    uint64_t    incoming_next;
+    uint8_t     capture[SIM_UART_CAPTURE_SIZE];
+    uint32_t    capture_head;
+    uint32_t    capture_count;
+} SIM_UART;
+
+static const uint32_t sim_uart_base[SIM_UART_NUMBER] = {0xBF806000, 0xBF806800, 0xBF806400, 0xBF806200, 0xBF806A00, 0xBF806600};
+static const uint32_t sim_uart_rx_irq[SIM_UART_NUMBER] = {_UART1_RX_IRQ, _UART2_RX_IRQ, _UART3_RX_IRQ, _UART4_RX_IRQ, _UART5_RX_IRQ, _UART6_RX_IRQ};
+static const uint32_t sim_uart_tx_irq[SIM_UART_NUMBER] = {_UART1_TX_IRQ, _UART2_TX_IRQ, _UART3_TX_IRQ, _UART4_TX_IRQ, _UART5_TX_IRQ, _UART6_TX_IRQ};
+static SIM_UART sim_uart[SIM_UART_NUMBER];
+
+static int sim_uart_module(uint32_t reg)
+{
+    int i;
+
+    for (i = 0 ; i < SIM_UART_NUMBER ; i++)
+    {
+        if ((reg & ~0x000000ff) == sim_uart_base[i])
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static uint64_t sim_uart_character_cycles(uint8_t i)
+{
+    uint32_t mode = SIM_RW(SIM_UART_MODE(sim_uart_base[i]));
+    uint32_t brg = SIM_RW(SIM_UART_BRG(sim_uart_base[i])) & 0x0000ffff;
+    uint32_t bits = 1 + (((mode >> 1) & 0x3) == 0x3 ? 9 : 8) + ((((mode >> 1) & 0x3) == 0x1) || (((mode >> 1) & 0x3) == 0x2) ? 1 : 0) + ((mode & 0x1) ? 2 : 1);
+
+    return (uint64_t) bits * ((mode & SIM_UART_MODE_BRGH) ? 4 : 16) * (brg + 1);
+}
+
+static void sim_uart_update_status(uint8_t i)
+{
+    SIM_UART *p = &sim_uart[i];
+    uint32_t sta = SIM_RW(SIM_UART_STA(sim_uart_base[i])) & ~(SIM_UART_STA_URXDA | SIM_UART_STA_TRMT | SIM_UART_STA_UTXBF | SIM_UART_STA_RIDLE);
+
+    sta |= (p->rx_count > 0) ? SIM_UART_STA_URXDA : 0;
+    sta |= (!p->is_shifting && (p->tx_count == 0)) ? SIM_UART_STA_TRMT : 0;
+    sta |= (p->tx_count >= SIM_UART_FIFO_SIZE) ? SIM_UART_STA_UTXBF : 0;
+    sta |= (p->incoming_count == 0) ? SIM_UART_STA_RIDLE : 0;
+    SIM_RW(SIM_UART_STA(sim_uart_base[i])) = sta;
+}
+
+static void sim_uart_tx_event(uint8_t i, bool is_slot_freed)
+{
+    SIM_UART *p = &sim_uart[i];
+    uint32_t utxisel = (SIM_RW(SIM_UART_STA(sim_uart_base[i])) >> 14) & 0x3;
+
+    if (((utxisel == 0) && is_slot_freed) ||
+        ((utxisel == 1) && !p->is_shifting && (p->tx_count == 0)) ||
+        ((utxisel == 2) && is_slot_freed && (p->tx_count == 0)))
+    {
+        sim_irq_raise(sim_uart_tx_irq[i]);
+    }
+}
+
+// Next character of the FIFO to the shift register.
+static void sim_uart_shift(uint8_t i)
+{
+    SIM_UART *p = &sim_uart[i];
+
+    if (p->is_shifting || (p->tx_count == 0))
+    {
+        return;
+    }
+    p->is_shifting = true;
+    p->shift_data = p->tx_fifo[p->tx_head];
+    p->tx_head = (p->tx_head + 1) % SIM_UART_FIFO_SIZE;
+    p->tx_count--;
+    p->shift_end = sim_now() + sim_uart_character_cycles(i);
+    sim_uart_update_status(i);
+    sim_uart_tx_event(i, true);
+}
+
+static uint64_t sim_uart_next_event(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_UART_NUMBER ; i++)
+    {
+        if (sim_uart[i].is_shifting && (sim_uart[i].shift_end < next))
+        {
+            next = sim_uart[i].shift_end;
+        }
+        if ((sim_uart[i].incoming_count > 0) && (sim_uart[i].incoming_next < next))
+        {
+            next = sim_uart[i].incoming_next;
+        }
+    }
+    return next;
+}
+
+static void sim_uart_run(uint64_t now)
+{
+    SIM_UART *p;
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_UART_NUMBER ; i++)
+    {
+        p = &sim_uart[i];
+        if (p->is_shifting && (p->shift_end <= now))
+        {
+            p->is_shifting = false;
+            p->capture[(p->capture_head + p->capture_count) % SIM_UART_CAPTURE_SIZE] = p->shift_data;
+            if (p->capture_count < SIM_UART_CAPTURE_SIZE)
+            {
+                p->capture_count++;
+            }
+            else
+            {
+                p->capture_head = (p->capture_head + 1) % SIM_UART_CAPTURE_SIZE;
+            }
+            sim_uart_update_status(i);
+            sim_uart_tx_event(i, false);
+            sim_uart_shift(i);
+        }
+        if ((p->incoming_count > 0) && (p->incoming_next <= now))
+        {
+            if (p->rx_count < SIM_UART_FIFO_SIZE)
+            {
+                p->rx_fifo[(p->rx_head + p->rx_count) % SIM_UART_FIFO_SIZE] = p->incoming[p->incoming_head];
+                p->rx_count++;
+            }
+            else
+            {
+                SIM_RW(SIM_UART_STA(sim_uart_base[i])) |= SIM_UART_STA_OERR;
+            }
+            p->incoming_head = (p->incoming_head + 1) % SIM_UART_INCOMING_SIZE;
+            p->incoming_count--;
+            p->incoming_next = now + sim_uart_character_cycles(i);
+            sim_uart_update_status(i);
+            sim_irq_raise(sim_uart_rx_irq[i]);
+        }
+    }
+}
+
+static void sim_uart_read(uint32_t reg)
+{
+    int i = sim_uart_module(reg);
+    SIM_UART *p = &sim_uart[i];
+
+    if ((reg == SIM_UART_RX(sim_uart_base[i])) && (p->rx_count > 0))
+    {
+        SIM_RW(reg) = p->rx_fifo[p->rx_head];
+        p->rx_head = (p->rx_head + 1) % SIM_UART_FIFO_SIZE;
+        p->rx_count--;
+        sim_uart_update_status(i);
+    }
+}
+
+static void sim_uart_write(uint32_t reg, uint32_t previous)
+{
+    int i = sim_uart_module(reg);
+    SIM_UART *p = &sim_uart[i];
+    uint32_t base = sim_uart_base[i];
+
+    if (reg == SIM_UART_MODE(base))
+    {
+        if (!(SIM_RW(reg) & SIM_UART_MODE_ON))
+        {
+            p->tx_count = 0;
+            p->rx_count = 0;
+            p->is_shifting = false;
+        }
+        sim_uart_update_status(i);
+    }
+    else if (reg == SIM_UART_STA(base))
+    {
+        sim_uart_update_status(i);
+    }
+    else if (reg == SIM_UART_TX(base))
+    {
+        if ((SIM_RW(SIM_UART_MODE(base)) & SIM_UART_MODE_ON) && (SIM_RW(SIM_UART_STA(base)) & SIM_UART_STA_UTXEN) && (p->tx_count < SIM_UART_FIFO_SIZE))
+        {
+            p->tx_fifo[(p->tx_head + p->tx_count) % SIM_UART_FIFO_SIZE] = (uint8_t) SIM_RW(reg);
+            p->tx_count++;
+            sim_uart_update_status(i);
+            sim_uart_shift(i);
+        }
+    }
+}
+
+static void sim_uart_reset(void)
+{
+    uint8_t i;
+
+    memset(sim_uart, 0, sizeof(sim_uart));
+    for (i = 0 ; i < SIM_UART_NUMBER ; i++)
+    {
+        sim_uart_update_status(i);
+    }
+}
+
+static const sim_model_t sim_uart_model =
+{
+    .next_event = sim_uart_next_event,
+    .run = sim_uart_run,
+    .reset = sim_uart_reset
+};
+
+void sim_uart_init(void)
+{
+    uint8_t i;
+
+    for (i = 0 ; i < SIM_UART_NUMBER ; i++)
+    {
+        sim_region_register(sim_uart_base[i], 0x50, sim_uart_read, sim_uart_write);
+    }
+    sim_model_register(&sim_uart_model);
+}
+
+size_t sim_uart_get_tx(uint8_t module, uint8_t *p_buffer, size_t size)
+{
+    SIM_UART *p = &sim_uart[module];
+    size_t n = 0;
+
+    while ((n < size) && (p->capture_count > 0))
+    {
+        p_buffer[n++] = p->capture[p->capture_head];
+        p->capture_head = (p->capture_head + 1) % SIM_UART_CAPTURE_SIZE;
+        p->capture_count--;
+    }
+    return n;
+}
+
+void sim_uart_inject_rx(uint8_t module, const uint8_t *p_data, size_t size)
+{
+    SIM_UART *p = &sim_uart[module];
+    size_t n;
+
+    for (n = 0 ; n < size ; n++)
+    {
+        if (p->incoming_count >= SIM_UART_INCOMING_SIZE)
+        {
+            SIM_ABORT("UART %u: too many injected characters", module + 1);
+        }
+        if (p->incoming_count == 0)
+        {
+            p->incoming_next = sim_now() + sim_uart_character_cycles(module);
+        }
+        p->incoming[(p->incoming_head + p->incoming_count) % SIM_UART_INCOMING_SIZE] = p_data[n];
+        p->incoming_count++;
+    }
+    sim_uart_update_status(module);
+}
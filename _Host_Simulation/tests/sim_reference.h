@@ -0,0 +1,289 @@
+/*********************************************************************
+*	Host simulation - previous implementations
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Copies of the code replaced by the optimized versions: references of
+*   the equivalence tests and of the benchmarks. XC32 compiles 'double' as
+*   a 32 bits float (no -fno-short-double): the floating point constants
+*   of the previous code are written as float here to give the results of
+*   the target.
+*********************************************************************/
+
+#ifndef __HOST_SIM_REFERENCE_H
+#define __HOST_SIM_REFERENCE_H
+
+/*******************************************************************************
+ * e_ws2812b.c (release 1.20): encoding of a LED (percent -> 9 SPI bytes).
+ ******************************************************************************/
+static inline void reference_ws2812b_encode_level(uint8_t *p, RGB_COLOR rgbColor)
+{
+    // GREEN
+    p[0] = 0x92 | ((rgbColor.green & 0x80) >> 1) | ((rgbColor.green & 0x40) >> 3) | ((rgbColor.green & 0x20) >> 5);
+    p[1] = 0x49 | ((rgbColor.green & 0x10) << 1) | ((rgbColor.green & 0x08) >> 1);
+    p[2] = 0x24 | ((rgbColor.green & 0x04) << 5) | ((rgbColor.green & 0x02) << 3) | ((rgbColor.green & 0x01) << 1);
+    // RED
+    p[3] = 0x92 | ((rgbColor.red & 0x80) >> 1) | ((rgbColor.red & 0x40) >> 3) | ((rgbColor.red & 0x20) >> 5);
+    p[4] = 0x49 | ((rgbColor.red & 0x10) << 1) | ((rgbColor.red & 0x08) >> 1);
+    p[5] = 0x24 | ((rgbColor.red & 0x04) << 5) | ((rgbColor.red & 0x02) << 3) | ((rgbColor.red & 0x01) << 1);
+    // BLUE
+    p[6] = 0x92 | ((rgbColor.blue & 0x80) >> 1) | ((rgbColor.blue & 0x40) >> 3) | ((rgbColor.blue & 0x20) >> 5);
+    p[7] = 0x49 | ((rgbColor.blue & 0x10) << 1) | ((rgbColor.blue & 0x08) >> 1);
+    p[8] = 0x24 | ((rgbColor.blue & 0x04) << 5) | ((rgbColor.blue & 0x02) << 3) | ((rgbColor.blue & 0x01) << 1);
+}
+
+static inline void reference_ws2812b_encode_percent(uint8_t *p, RGB_COLOR rgbColor)
+{
+    rgbColor.red *= 2.55f;
+    rgbColor.green *= 2.55f;
+    rgbColor.blue *= 2.55f;
+    reference_ws2812b_encode_level(p, rgbColor);
+}
+
+/*******************************************************************************
+ * utilities.c (before color.c): float TSV <-> RGB conversions and transitions.
+ ******************************************************************************/
+static inline TSV_COLOR reference_rgb_to_tsv(RGB_COLOR rgbColor)
+{
+    TSV_COLOR ret;
+    float min, max, delta, tShade;
+
+    min = (rgbColor.red < rgbColor.green) ? rgbColor.red : rgbColor.green;
+    min = (min < rgbColor.blue) ? min : rgbColor.blue;
+    max = (rgbColor.red > rgbColor.green) ? rgbColor.red : rgbColor.green;
+    max = (max > rgbColor.blue) ? max : rgbColor.blue;
+    delta = max - min;
+
+    if(max > 0.0f)
+    {
+        if(rgbColor.red >= max)
+        {
+            tShade = (100.0f * ((rgbColor.green - rgbColor.blue) / delta));
+        }
+        else if(rgbColor.green >= max)
+        {
+            tShade = (100.0f * (2.0f + ((rgbColor.blue - rgbColor.red) / delta)));
+        }
+        else
+        {
+            tShade = (100.0f * (4.0f + ((rgbColor.red - rgbColor.green) / delta)));
+        }
+
+        ret.shade = (tShade >= 0.0f ? ((WORD) tShade) : ((WORD) (tShade + 599.0f)));
+        ret.saturation = (WORD) ((delta / max) * 100.0f);
+        ret.intensity = (BYTE) max;
+    }
+    else
+    {
+        ret.shade = 0;
+        ret.saturation = 100;
+        ret.intensity = 0;
+    }
+
+    return ret;
+}
+
+static inline RGB_COLOR reference_tsv_to_rgb(TSV_COLOR tsvColor)
+{
+    RGB_COLOR ret = {0, 0, 0};
+    BYTE tempShade = ((tsvColor.shade / 100) % 6);
+    float f = (float) ((float)(tsvColor.shade / 100.0f) - (float)tempShade);
+    int l = tsvColor.intensity * (100 - tsvColor.saturation) / 100;
+    int m = tsvColor.intensity * (100 - (f * tsvColor.saturation)) / 100;
+    int n = tsvColor.intensity * (100 - tsvColor.saturation + (f * tsvColor.saturation)) / 100;
+
+    if((tsvColor.shade > 600) || (tsvColor.saturation > 100) || (tsvColor.intensity > 100))
+    {
+        return ret;
+    }
+    switch (tempShade)
+    {
+        case 0: ret.red = tsvColor.intensity; ret.green = n; ret.blue = l; break;
+        case 1: ret.red = m; ret.green = tsvColor.intensity; ret.blue = l; break;
+        case 2: ret.red = l; ret.green = tsvColor.intensity; ret.blue = n; break;
+        case 3: ret.red = l; ret.green = m; ret.blue = tsvColor.intensity; break;
+        case 4: ret.red = n; ret.green = l; ret.blue = tsvColor.intensity; break;
+        case 5: ret.red = tsvColor.intensity; ret.green = l; ret.blue = m; break;
+    }
+    return ret;
+}
+
+// Note: the former code used saturation_threshold for a shade difference
+// over 300 (600 - saturation_threshold), color.c uses the shortest way.
+static inline WORD reference_get_number_of_step(TSV_COLOR color1, TSV_COLOR color2)
+{
+    WORD ret = 0;
+    WORD shade_threshold = abs((int) (color1.shade - color2.shade));
+    WORD saturation_threshold = abs((int) (color1.saturation - color2.saturation));
+    WORD intensity_threshold = abs((int) (color1.intensity - color2.intensity));
+    (shade_threshold > 300)?(shade_threshold = (600-saturation_threshold)):0;
+    ret = shade_threshold;
+    (ret < saturation_threshold)?(ret = saturation_threshold):0;
+    (ret < intensity_threshold)?(ret = intensity_threshold):0;
+    return ret;
+}
+
+static inline TSV_COLOR reference_get_middle(TSV_COLOR color1, TSV_COLOR color2, WORD indice, WORD thresholdToFrom)
+{
+    TSV_COLOR ret;
+
+    if((thresholdToFrom != indice) && ((color1.shade != color2.shade) || (color1.saturation != color2.saturation) || (color1.intensity != color2.intensity)))
+    {
+        float temp = 0.0f;
+        WORD shade_threshold = 0;
+        BOOL sens = 0;      // --
+
+        if(color1.shade > color2.shade)
+        {
+            shade_threshold = color1.shade - color2.shade;
+            if(shade_threshold > 300)
+            {
+                shade_threshold = 600 - shade_threshold;
+                sens = 1;   // ++
+            }
+        }
+        else if(color1.shade < color2.shade)
+        {
+            shade_threshold = color2.shade - color1.shade;
+            if(shade_threshold > 300)
+            {
+                shade_threshold = 600 - shade_threshold;
+            }
+            else
+            {
+                sens = 1;
+            }
+        }
+        else
+        {
+            ret.shade = color1.shade;
+        }
+
+        if(color1.shade != color2.shade)
+        {
+            if(sens)
+            {
+                temp = (float) (color1.shade + indice*shade_threshold/thresholdToFrom);
+            }
+            else
+            {
+                temp = (float) (600.0f + color1.shade - indice*shade_threshold/thresholdToFrom);
+            }
+            if(temp >= 600.0f)
+            {
+                temp -= 600.0f;
+            }
+            ret.shade = (WORD) temp;
+        }
+
+        if(color1.saturation >= color2.saturation)
+        {
+            temp = (float) (color1.saturation - indice*(color1.saturation - color2.saturation)/thresholdToFrom);
+        }
+        else
+        {
+            temp = (float) (color1.saturation + indice*(color2.saturation - color1.saturation)/thresholdToFrom);
+        }
+        ret.saturation = (BYTE) temp;
+
+        if(color1.intensity >= color2.intensity)
+        {
+            temp = (float) (color1.intensity - indice*(color1.intensity - color2.intensity)/thresholdToFrom);
+        }
+        else
+        {
+            temp = (float) (color1.intensity + indice*(color2.intensity - color1.intensity)/thresholdToFrom);
+        }
+        ret.intensity = (BYTE) temp;
+    }
+    else
+    {
+        ret = color2;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+ * utilities.c (before the integer statistics): float window of fu_adc_average.
+ ******************************************************************************/
+typedef struct
+{
+    float *p_buffer;
+    uint16_t size;
+    uint16_t index_buffer;
+    float sum_of_buffer;
+    float average;
+} REFERENCE_AVERAGE_VAR;
+
+static inline void reference_average_add(REFERENCE_AVERAGE_VAR *var, uint16_t sample)
+{
+    var->sum_of_buffer -= var->p_buffer[var->index_buffer];
+    var->p_buffer[var->index_buffer] = (float) sample;
+    var->sum_of_buffer += var->p_buffer[var->index_buffer];
+    var->average = var->sum_of_buffer / var->size;
+    if (++var->index_buffer >= var->size)
+    {
+        var->index_buffer = 0;
+    }
+}
+
+/*******************************************************************************
+ * s35_ethernet_TCPIP.c (before CalcIPChecksumPartial): 16-bit words summed
+ * one at a time (buffer WORD aligned).
+ ******************************************************************************/
+static inline WORD reference_calc_ip_checksum(BYTE* buffer, WORD count)
+{
+    WORD i = count >> 1; // divide by 2;
+    WORD *val = (WORD*) buffer;
+    DWORD_VAL sum;
+
+    sum.Val = 0;
+    while (i--)
+    {
+        sum.Val += (DWORD) *val++;
+    }
+    // Add in the sum of the remaining byte, if present
+    if(count & 0x1)
+    {
+        sum.Val += (DWORD)*(BYTE*) val;
+    }
+
+    sum.Val = (DWORD) sum.w[0] + (DWORD) sum.w[1];  // Do an end-around carry (one's complement arrithmatic)
+    sum.w[0] += sum.w[1];       // Do another end-around carry in case if the prior add caused a carry out
+
+    return ~sum.w[0];
+}
+
+/*******************************************************************************
+ * s35_ethernet_OSI-3_NetworkLayer.c (before CalcIPChecksumUpdate): checksum
+ * of the ICMP echo reply (type 8 -> 0). dwVal: first 4 bytes of the message.
+ ******************************************************************************/
+static inline DWORD reference_icmp_echo_reply(DWORD_VAL dwVal)
+{
+    dwVal.v[0] = 0x00; // Type: 0 (ICMP echo/ping reply)
+    dwVal.v[2] += 8; // Subtract 0x0800 from the checksum
+    if (dwVal.v[2] < 8u)
+    {
+        dwVal.v[3]++;
+        if (dwVal.v[3] == 0u)
+        {
+            dwVal.v[2]++;
+        }
+    }
+    return dwVal.Val;
+}
+
+/*******************************************************************************
+ * utilities.c (before the table of fu_ntc): float temperature of a 10 bits
+ * code (pull resistor 10k).
+ ******************************************************************************/
+static inline float reference_ntc_temperature(uint16_t code, float t0, float r0, float b)
+{
+    float avg = code;
+    return 1.0f / ((1.0f / (t0 + 273.15f)) + (1.0f / b) * logf((10000 / ((1024 / avg) - 1)) / r0)) - 273.15f;
+}
+
+#endif
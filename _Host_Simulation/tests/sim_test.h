@@ -0,0 +1,89 @@
+/*********************************************************************
+*	Host simulation - minimal test framework
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   One executable per test file (one ctest each). A test is a function
+*   run by SIM_TEST_RUN(): the simulation is reset before it. A failed
+*   check prints its location and the test continues; the executable
+*   returns 1 if a check failed.
+*********************************************************************/
+
+#ifndef __HOST_SIM_TEST_H
+#define __HOST_SIM_TEST_H
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "../../PLIB.h"
+#include "sim.h"
+
+static int sim_test_failures = 0;
+static int sim_test_checks = 0;
+
+#define SIM_CHECK(cond)                                                                     \
+    do                                                                                      \
+    {                                                                                       \
+        sim_test_checks++;                                                                  \
+        if (!(cond))                                                                        \
+        {                                                                                   \
+            sim_test_failures++;                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);      \
+        }                                                                                   \
+    } while (0)
+
+#define SIM_CHECK_EQUAL(expected, actual)                                                   \
+    do                                                                                      \
+    {                                                                                       \
+        long long _e = (long long) (expected), _a = (long long) (actual);                   \
+        sim_test_checks++;                                                                  \
+        if (_e != _a)                                                                       \
+        {                                                                                   \
+            sim_test_failures++;                                                            \
+            fprintf(stderr, "%s:%d: %s: expected %lld, got %lld\n", __FILE__, __LINE__, #actual, _e, _a);  \
+        }                                                                                   \
+    } while (0)
+
+#define SIM_TEST_RUN(test)                                                                  \
+    do                                                                                      \
+    {                                                                                       \
+        int _failures = sim_test_failures;                                                  \
+        sim_test_init(SIM_MODE_TRAP);                                                       \
+        test();                                                                             \
+        printf("%-48s %s\n", #test, (_failures == sim_test_failures) ? "ok" : "FAILED");   \
+    } while (0)
+
+#define SIM_TEST_END()                                                                      \
+    do                                                                                      \
+    {                                                                                       \
+        printf("%d checks, %d failed\n", sim_test_checks, sim_test_failures);              \
+        return (sim_test_failures == 0) ? 0 : 1;                                            \
+    } while (0)
+
+// Reset of the simulation and TIMER1 as the application configures it for
+// mGetTick() (PBCLK / 8, PR1 = 0xFFFF).
+static inline void sim_test_init(SIM_MODE mode)
+{
+    sim_init(SIM_MODE_TRAP);
+    T1CON = 0;
+    TMR1 = 0;
+    PR1 = 0xffff;
+    T1CONSET = TMR_ON | TMR_1_PS_1_8;
+    sim_set_mode(mode);
+}
+
+// Host time stamp counter (benchmarks).
+static inline uint64_t sim_test_rdtsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+#endif
+}
+
+#endif
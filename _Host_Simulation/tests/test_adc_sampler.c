@@ -0,0 +1,102 @@
+/*********************************************************************
+*	Host simulation - s17_adc sampler (TIMER3 scans, per-channel rings)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The n-th conversion of a channel gives (n + 100 x channel) & 0x3ff.
+*********************************************************************/
+
+#include "sim_test.h"
+
+static uint32_t conversions[16];
+
+static uint16_t adc_source(void *p_context, uint8_t channel, uint64_t now)
+{
+    return (conversions[channel]++ + 100 * channel) & 0x3ff;
+}
+
+static void adc_isr(void)
+{
+    adc10_interrupt_handler();
+}
+
+// 3 channels, a conversion every 10 us: a scan every 30 us.
+static void sampler_init(void)
+{
+    sim_test_init(SIM_MODE_TRAP);
+    memset(conversions, 0, sizeof(conversions));
+    sim_adc_set_source(adc_source, NULL);
+    sim_irq_attach(IRQ_AD1, adc_isr);
+    adc10_sampler_init(AN1 | AN3 | AN15, ADC10_VDD_VSS, 10, IRQ_PRIORITY_LEVEL_4);
+}
+
+static bool is_sequence(const uint16_t *p_samples, uint16_t n, uint8_t channel, uint32_t first)
+{
+    uint16_t i;
+
+    for (i = 0 ; i < n ; i++)
+    {
+        if (p_samples[i] != ((first + i + 100 * channel) & 0x3ff))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_samples_in_order(void)
+{
+    uint16_t samples[ADC10_SAMPLER_DEPTH];
+    uint16_t n;
+
+    sampler_init();
+    SIM_CHECK_EQUAL(ADC10_NO_SAMPLE, adc10_read(AN3));
+    sim_advance(SIM_US(30 * 20 + 15));
+    SIM_CHECK_EQUAL(20, sim_adc_get_scan_count());
+
+    n = adc10_get_samples(AN3, samples, 8);
+    SIM_CHECK_EQUAL(8, n);
+    SIM_CHECK(is_sequence(samples, n, 3, 0));
+    n = adc10_get_samples(AN3, samples, ADC10_SAMPLER_DEPTH);
+    SIM_CHECK_EQUAL(12, n);
+    SIM_CHECK(is_sequence(samples, n, 3, 8));
+    SIM_CHECK_EQUAL(0, adc10_get_samples(AN3, samples, ADC10_SAMPLER_DEPTH));
+
+    n = adc10_get_samples(AN15, samples, ADC10_SAMPLER_DEPTH);
+    SIM_CHECK_EQUAL(20, n);
+    SIM_CHECK(is_sequence(samples, n, 15, 0));
+    SIM_CHECK_EQUAL((19 + 100) & 0x3ff, adc10_read(AN1));
+    SIM_CHECK_EQUAL(0, adc10_get_samples(AN2, samples, ADC10_SAMPLER_DEPTH));
+    SIM_CHECK_EQUAL(0, adc10_get_overrun(AN3));
+}
+
+// A full ring (ADC10_SAMPLER_DEPTH samples) is returned whole, the samples
+// overwritten before are counted.
+static void test_overrun(void)
+{
+    uint16_t samples[ADC10_SAMPLER_DEPTH];
+    uint16_t n;
+
+    sampler_init();
+    sim_advance(SIM_US(30 * ADC10_SAMPLER_DEPTH + 15));
+    n = adc10_get_samples(AN1, samples, ADC10_SAMPLER_DEPTH);
+    SIM_CHECK_EQUAL(ADC10_SAMPLER_DEPTH, n);
+    SIM_CHECK(is_sequence(samples, n, 1, 0));
+    SIM_CHECK_EQUAL(0, adc10_get_overrun(AN1));
+
+    sim_advance(SIM_US(30 * (ADC10_SAMPLER_DEPTH + 10)));
+    n = adc10_get_samples(AN1, samples, ADC10_SAMPLER_DEPTH);
+    SIM_CHECK_EQUAL(ADC10_SAMPLER_DEPTH, n);
+    SIM_CHECK(is_sequence(samples, n, 1, ADC10_SAMPLER_DEPTH + 10));
+    SIM_CHECK_EQUAL(10, adc10_get_overrun(AN1));
+    SIM_CHECK_EQUAL(0, adc10_get_overrun(AN3));
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_samples_in_order);
+    SIM_TEST_RUN(test_overrun);
+    SIM_TEST_END();
+}
@@ -0,0 +1,124 @@
+/*********************************************************************
+*	Host simulation - utilities AVERAGE_VAR (integer statistics, filters)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Compared to the former float window (sim_reference.h) and to the
+*   statistics computed again over the whole window.
+*********************************************************************/
+
+#include <math.h>
+#include "sim_test.h"
+#include "sim_reference.h"
+
+#define WINDOW_SIZE     30
+
+AVERAGE_DEF(avg, AN3, WINDOW_SIZE, 0);
+AVERAGE_FILTER_DEF(avg_decimated, AN3, 8, 0, 2, 0);
+AVERAGE_FILTER_DEF(avg_iir, AN3, 8, 0, 0, 4);
+
+static uint32_t seed = 1;
+
+static uint16_t random_sample(void)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 22;          // 10 bits
+}
+
+// Window of the last samples (exact): average, variance, min, max.
+static void window_statistics(const uint16_t *p_samples, uint32_t count, double *p_average, double *p_variance, uint16_t *p_min, uint16_t *p_max)
+{
+    double sum = 0.0, sum_of_squares = 0.0;
+    uint32_t i;
+
+    *p_min = 0xffff;
+    *p_max = 0;
+    for (i = count - WINDOW_SIZE ; i < count ; i++)
+    {
+        sum += p_samples[i];
+        sum_of_squares += (double) p_samples[i] * p_samples[i];
+        (p_samples[i] < *p_min) ? (*p_min = p_samples[i]) : 0;
+        (p_samples[i] > *p_max) ? (*p_max = p_samples[i]) : 0;
+    }
+    *p_average = sum / WINDOW_SIZE;
+    *p_variance = sum_of_squares / WINDOW_SIZE - *p_average * *p_average;
+}
+
+// 1M samples: the integer sums stay exact, the former float sum drifts.
+static void test_average_vs_float(void)
+{
+    static uint16_t samples[1000000];
+    float reference_buffer[WINDOW_SIZE] = {0};
+    REFERENCE_AVERAGE_VAR reference = {reference_buffer, WINDOW_SIZE, 0, 0.0f, 0.0f};
+    double average, variance, drift = 0.0;
+    uint32_t i, failures = 0;
+    uint16_t min, max;
+
+    for (i = 0 ; i < 1000000 ; i++)
+    {
+        samples[i] = random_sample();
+        fu_average_add_samples(&avg, &samples[i], 1);
+        reference_average_add(&reference, samples[i]);
+        if ((i >= WINDOW_SIZE) && ((i % 1000) == 0))
+        {
+            window_statistics(samples, i + 1, &average, &variance, &min, &max);
+            failures += (fabs(avg.average - average) > 1e-4);
+            failures += (fabs(fu_average_get_variance(&avg) - variance) > 1e-5 * (1.0 + variance));
+            failures += (fu_average_get_min(&avg) != min);
+            failures += (fu_average_get_max(&avg) != max);
+            (fabs(reference.average - average) > drift) ? (drift = fabs(reference.average - average)) : 0;
+        }
+    }
+    SIM_CHECK_EQUAL(0, failures);
+    SIM_CHECK(drift < 0.01);
+    printf("    float window: max drift %.2e (integer window: exact)\n", drift);
+}
+
+// 2^2 samples summed then divided give one sample of the window.
+static void test_decimation(void)
+{
+    uint16_t batch[4 * 8];
+    uint32_t i, expected = 0;
+
+    for (i = 0 ; i < 4 * 8 ; i++)
+    {
+        batch[i] = 100 + i;
+    }
+    SIM_CHECK_EQUAL(0, fu_average_add_samples(&avg_decimated, batch, 3));
+    SIM_CHECK_EQUAL(8, fu_average_add_samples(&avg_decimated, &batch[3], 4 * 8 - 3));
+    for (i = 0 ; i < 8 ; i++)
+    {
+        expected += (4 * (100 + 4 * i) + 6) >> 2;
+    }
+    SIM_CHECK_EQUAL(expected, avg_decimated.sum_of_buffer);
+    SIM_CHECK_EQUAL(AVERAGE_FILTER_SHIFT_MAX - 1, AVERAGE_FILTER_CHECK_SHIFT(AVERAGE_FILTER_SHIFT_MAX - 1));
+}
+
+// Q8 IIR compared to the float filter y += (x - y) / 16.
+static void test_iir_vs_float(void)
+{
+    double reference = 0.0, error = 0.0;
+    uint16_t sample;
+    uint32_t i;
+
+    for (i = 0 ; i < 100000 ; i++)
+    {
+        sample = (i < 50000) ? random_sample() : 1000;
+        fu_average_add_samples(&avg_iir, &sample, 1);
+        reference = (i == 0) ? sample : reference + (sample - reference) / 16.0;
+        (fabs(fu_average_get_iir(&avg_iir) - reference) > error) ? (error = fabs(fu_average_get_iir(&avg_iir) - reference)) : 0;
+    }
+    SIM_CHECK(error < 16.0 / 256.0);
+    SIM_CHECK(fabs(fu_average_get_iir(&avg_iir) - 1000.0) < 16.0 / 256.0);
+    SIM_CHECK_EQUAL(0.0f, fu_average_get_iir(&avg));
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_average_vs_float);
+    SIM_TEST_RUN(test_decimation);
+    SIM_TEST_RUN(test_iir_vs_float);
+    SIM_TEST_END();
+}
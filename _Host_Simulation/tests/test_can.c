@@ -0,0 +1,200 @@
+/*********************************************************************
+*	Host simulation - s34_can (reception of a CAN log, frames table)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "sim_test.h"
+
+// Filters last written by CANDeamonFilters: reset with the simulation.
+extern CAN_FILTERS currentFilters[CAN_NUM_OF_MODULES];
+
+// candump log (an ID of 8 digits is an extended frame). The same ID 0x100
+// is used by a standard and an extended frame, 0x321 stops after 31 ms.
+static const char *can_log[] =
+{
+    "(0.000120) can0 100#0011",
+    "(0.000560) can0 7FF#0102030405060700",
+    "(0.000900) can0 321#",
+    "(0.002780) can0 1ABCDEF0#02",
+    "(0.005340) can0 00000100#DEADBE05",
+    "(0.010120) can0 100#0A11",
+    "(0.010900) can0 321#",
+    "(0.020120) can0 100#1411",
+    "(0.020900) can0 321#",
+    "(0.025340) can0 00000100#DEADBE19",
+    "(0.025560) can0 7FF#0102030405060719",
+    "(0.030120) can0 100#1E11",
+    "(0.030900) can0 321#",
+    "(0.035780) can0 1ABCDEF0#23",
+    "(0.040120) can0 100#2811",
+    "(0.045340) can0 00000100#DEADBE2D",
+    "(0.050120) can0 100#3211",
+    "(0.050560) can0 7FF#0102030405060732",
+    "(0.060120) can0 100#3C11",
+    "(0.065340) can0 00000100#DEADBE41",
+    "(0.068780) can0 1ABCDEF0#44",
+    "(0.070120) can0 100#4611",
+    "(0.075560) can0 7FF#010203040506074B",
+    "(0.080120) can0 100#5011",
+    "(0.085340) can0 00000100#DEADBE55",
+    "(0.090120) can0 100#5A11",
+};
+#define CAN_LOG_SIZE        (sizeof(can_log) / sizeof(can_log[0]))
+
+typedef struct
+{
+    uint64_t    time;           // us
+    uint32_t    id;
+    bool        ide;
+    uint8_t     dlc;
+    uint8_t     data[8];
+} CAN_LOG_ENTRY;
+
+static CAN_LOG_ENTRY can_parse(const char *p_line)
+{
+    CAN_LOG_ENTRY entry = {0};
+    unsigned seconds, micro_seconds;
+    char id[16], data[17] = {0};
+    uint32_t i;
+
+    sscanf(p_line, "(%u.%u) can0 %15[0-9A-F]#%16[0-9A-F]", &seconds, &micro_seconds, id, data);
+    entry.time = (uint64_t) seconds * 1000000 + micro_seconds;
+    entry.id = strtoul(id, NULL, 16);
+    entry.ide = (strlen(id) == 8);
+    entry.dlc = strlen(data) / 2;
+    for (i = 0 ; i < entry.dlc ; i++)
+    {
+        unsigned byte;
+        sscanf(&data[i * 2], "%2x", &byte);
+        entry.data[i] = byte;
+    }
+    return entry;
+}
+
+// The main loop reads the tick more often than the TIMER1 overflows.
+static void can_advance_to(uint64_t time)
+{
+    while (sim_now() < time)
+    {
+        sim_advance(((time - sim_now()) > SIM_MS(1)) ? SIM_MS(1) : (time - sim_now()));
+        mGetTick();
+    }
+}
+
+static void can_test_init(CAN_FRAMES *p_frames)
+{
+    CAN_FILTERS filters = INIT_CAN_FILTERS();
+
+    memset(currentFilters, 0xff, sizeof(currentFilters));
+    CANInit(CAN1, 500000);
+    filters.mask[CAN_FILTER_MASK0] = 0;             // All the frames (standard and extended)
+    filters.enableFilterAndAttachMask[CAN_FILTER0] = CAN_ENABLE_FILTER | CAN_FILTER_MASK0;
+    CANDeamonFilters(CAN1, &filters);
+    CANSetLinkForFramesReception(CAN1, p_frames);
+}
+
+// Replay of the log: each frame is stored once by ID + IDE with its last
+// data, length and period (interrupt then main loop after each frame).
+static void test_log_replay(void)
+{
+    CAN_FRAMES_DEF(rx, 8);
+    CAN_LOG_ENTRY entries[CAN_LOG_SIZE], *p_last, *p_previous;
+    uint64_t start;
+    uint32_t i, j;
+    CAN_FRAME *p_frame;
+
+    can_test_init(&rx);
+    start = sim_now();
+    for (i = 0 ; i < CAN_LOG_SIZE ; i++)
+    {
+        entries[i] = can_parse(can_log[i]);
+        can_advance_to(start + SIM_US(entries[i].time));
+        SIM_CHECK(sim_can_inject(CAN1, entries[i].id, entries[i].ide, entries[i].dlc, entries[i].data));
+        CANTaskRx(CAN1);
+        CANDeamonRx(CAN1);
+    }
+    SIM_CHECK_EQUAL(CAN_LOG_SIZE, CANGetRxStats(CAN1).received);
+    SIM_CHECK_EQUAL(0, CANGetRxStats(CAN1).ring_overflow);
+    SIM_CHECK_EQUAL(0, CANGetRxStats(CAN1).table_overflow);
+    SIM_CHECK_EQUAL(5, rx.numberOfFrame);
+
+    // Last reception and the one before of each frame of the log.
+    for (i = 0 ; i < CAN_LOG_SIZE ; i++)
+    {
+        p_last = NULL;
+        p_previous = NULL;
+        for (j = 0 ; j < CAN_LOG_SIZE ; j++)
+        {
+            if ((entries[j].id == entries[i].id) && (entries[j].ide == entries[i].ide))
+            {
+                p_previous = p_last;
+                p_last = &entries[j];
+            }
+        }
+        p_frame = CANGetFrame(&rx, CAN_FRAME_KEY(entries[i].id, entries[i].ide));
+        SIM_CHECK(p_frame != NULL);
+        if (p_frame == NULL)
+        {
+            continue;
+        }
+        SIM_CHECK_EQUAL(entries[i].id, p_frame->id);
+        SIM_CHECK_EQUAL(entries[i].ide, p_frame->idExtended);
+        SIM_CHECK_EQUAL(p_last->dlc, p_frame->length);
+        SIM_CHECK(memcmp(p_last->data, p_frame->data, p_last->dlc) == 0);
+        // The reception time is read in the interrupt (+/- 1 tick).
+        SIM_CHECK(llabs((long long) p_frame->period - (long long) ((p_last->time - p_previous->time) * TICK_1US)) <= 1);
+    }
+
+    // The standard and the extended frame 0x100 are two frames.
+    SIM_CHECK_EQUAL(2, CANGetFrame(&rx, 0x100)->length);
+    SIM_CHECK_EQUAL(4, CANGetFrame(&rx, CAN_FRAME_KEY(0x100, CAN_ID_EXTENDED))->length);
+    SIM_CHECK(CANGetFrame(&rx, 0x1ABCDEF0) == NULL);
+
+    // 0x321 is no more on the bus (last reception 59 ms ago).
+    for (i = 0 ; i < 2 * rx.maxNumberOfFrame ; i++)
+    {
+        CANFreedomReceiveMemory(&rx, TICK_1MS * 25);
+    }
+    SIM_CHECK_EQUAL(4, rx.numberOfFrame);
+    SIM_CHECK(CANGetFrame(&rx, 0x321) == NULL);
+    SIM_CHECK(CANGetFrame(&rx, 0x7FF) != NULL);
+    SIM_CHECK(CANGetFrame(&rx, CAN_FRAME_KEY(0x1ABCDEF0, CAN_ID_EXTENDED)) != NULL);
+}
+
+// Each table has its own cursor: the old frames of two tables released
+// alternately are all removed (one check by call), the others are kept.
+static void test_freedom_by_table(void)
+{
+    CAN_FRAMES_DEF(rx1, 4);
+    CAN_FRAMES_DEF(rx2, 4);
+    uint32_t i;
+
+    sim_advance(SIM_MS(100));
+    for (i = 0 ; i < 3 ; i++)
+    {
+        CANAddFrame(&rx1, 0x10 + i, CAN_ID_STANDARD, 8, 0);
+        CANAddFrame(&rx2, 0x20 + i, CAN_ID_EXTENDED, 8, 0);
+    }
+    rx1.ptrFrames[1].tick = mGetTick();
+    for (i = 0 ; i < 3 ; i++)
+    {
+        CANFreedomReceiveMemory(&rx1, TICK_1MS * 10);
+        CANFreedomReceiveMemory(&rx2, TICK_1MS * 10);
+    }
+    SIM_CHECK_EQUAL(1, rx1.numberOfFrame);
+    SIM_CHECK_EQUAL(0, rx2.numberOfFrame);
+    SIM_CHECK(CANGetFrame(&rx1, 0x11) != NULL);
+    SIM_CHECK(CANGetFrame(&rx1, 0x10) == NULL);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_log_replay);
+    SIM_TEST_RUN(test_freedom_by_table);
+    SIM_TEST_END();
+}
@@ -0,0 +1,138 @@
+/*********************************************************************
+*	Host simulation - s34_can (CANFiltersCompile)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The compiled filters are programmed by CANDeamonFilters and checked
+*   with the acceptance of the CAN model (sim_can_inject).
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+
+// Filters last written by CANDeamonFilters: reset with the simulation.
+extern CAN_FILTERS currentFilters[CAN_NUM_OF_MODULES];
+
+static CAN_FILTERS_REPORT filters_compile(const CAN_ID_RANGE *p_ranges, BYTE number_of_ranges)
+{
+    CAN_FILTERS filters = INIT_CAN_FILTERS();
+    CAN_FILTERS_REPORT report;
+
+    memset(currentFilters, 0xff, sizeof(currentFilters));
+    CANInit(CAN1, 500000);
+    CANFiltersCompile(&filters, p_ranges, number_of_ranges, &report);
+    CANDeamonFilters(CAN1, &filters);
+    return report;
+}
+
+static bool filters_accept(uint32_t id, bool ide)
+{
+    static const uint8_t data[8] = {0};
+
+    return sim_can_inject(CAN1, id, ide, 8, data);
+}
+
+// Standard IDs only: the report is exact (all the 2048 IDs are tried).
+static void test_standard_ids(void)
+{
+    static const CAN_ID_RANGE ranges[] = {INIT_CAN_ID(0x100), INIT_CAN_ID(0x208), INIT_CAN_ID_RANGE(0x300, 0x37F), INIT_CAN_ID_RANGE(0x7F0, 0x7FF), INIT_CAN_ID(0x555)};
+    CAN_FILTERS_REPORT report = filters_compile(ranges, 5);
+    uint32_t id, accepted = 0, missed = 0;
+
+    for (id = 0 ; id <= 0x7FF ; id++)
+    {
+        bool is_subscribed = (id == 0x100) || (id == 0x208) || (id == 0x555) || ((id >= 0x300) && (id <= 0x37F)) || (id >= 0x7F0);
+
+        accepted += filters_accept(id, false);
+        missed += is_subscribed && !filters_accept(id, false);
+    }
+    SIM_CHECK_EQUAL(0, missed);
+    SIM_CHECK_EQUAL(1 + 1 + 1 + 128 + 16, report.subscribed);
+    SIM_CHECK_EQUAL(accepted, report.accepted);
+    SIM_CHECK(report.numberOfFilters <= 31);
+    SIM_CHECK(report.numberOfMasks <= CAN_NUM_OF_FILTER_MASKS);
+    SIM_CHECK_EQUAL((1000ull * (report.accepted - report.subscribed)) / report.accepted, report.falseAcceptRatio);
+}
+
+// The type of frame is compared: the standard 0x100 and the extended
+// 0x18FEF100 are received, not the extended 0x100 nor the standard 0x0F1.
+static void test_standard_and_extended_ids(void)
+{
+    static const CAN_ID_RANGE ranges[] = {INIT_CAN_ID(0x100), INIT_CAN_EXT_ID(0x18FEF100), INIT_CAN_EXT_ID_RANGE(0x18DA0000, 0x18DA00FF)};
+    CAN_FILTERS_REPORT report = filters_compile(ranges, 3);
+    uint32_t id, missed = 0;
+
+    SIM_CHECK(filters_accept(0x100, false));
+    SIM_CHECK(!filters_accept(0x100, true));
+    SIM_CHECK(filters_accept(0x18FEF100, true));
+    SIM_CHECK(!filters_accept(0x0F1, false));
+    SIM_CHECK(!filters_accept(0x18FEF101, true));
+    for (id = 0x18DA0000 ; id <= 0x18DA00FF ; id++)
+    {
+        missed += !filters_accept(id, true);
+    }
+    SIM_CHECK_EQUAL(0, missed);
+    SIM_CHECK(!filters_accept(0x18DA0100, true));
+    SIM_CHECK_EQUAL(1 + 1 + 256, report.subscribed);
+    SIM_CHECK_EQUAL(1 + 1 + 256, report.accepted);
+    SIM_CHECK_EQUAL(0, report.falseAcceptRatio);
+}
+
+// More blocks than filters and masks: merged, every subscribed ID stays
+// accepted and the report is an upper bound.
+static void test_merged_filters(void)
+{
+    CAN_ID_RANGE ranges[48];
+    CAN_FILTERS_REPORT report;
+    uint32_t i, missed = 0;
+
+    for (i = 0 ; i < 40 ; i++)
+    {
+        ranges[i] = (CAN_ID_RANGE) INIT_CAN_EXT_ID(0x10000000 + i * 0x12345);
+    }
+    for (i = 40 ; i < 48 ; i++)
+    {
+        ranges[i] = (CAN_ID_RANGE) INIT_CAN_ID_RANGE(i * 40, i * 40 + (i % 7));
+    }
+    report = filters_compile(ranges, 48);
+    for (i = 0 ; i < 40 ; i++)
+    {
+        missed += !filters_accept(0x10000000 + i * 0x12345, true);
+    }
+    for (i = 40 ; i < 48 ; i++)
+    {
+        missed += !filters_accept(i * 40, false) || !filters_accept(i * 40 + (i % 7), false);
+    }
+    SIM_CHECK_EQUAL(0, missed);
+    SIM_CHECK(report.numberOfFilters <= 31);
+    SIM_CHECK(report.numberOfMasks <= CAN_NUM_OF_FILTER_MASKS);
+    SIM_CHECK(report.accepted >= report.subscribed);
+    SIM_CHECK(report.falseAcceptRatio <= 1000);
+}
+
+// All the standard and extended IDs: 2^11 + 2^29 IDs accepted and
+// subscribed. The number of accepted IDs is on 64 bits (31 overlapping
+// filters of 2^29 IDs do not fit in a DWORD).
+static void test_all_ids(void)
+{
+    static const CAN_ID_RANGE ranges[] = {INIT_CAN_ID_RANGE(0, 0x7FF), INIT_CAN_EXT_ID_RANGE(0, CAN_ID_MAX)};
+    CAN_FILTERS_REPORT report = filters_compile(ranges, 2);
+
+    SIM_CHECK_EQUAL(8, sizeof(report.accepted));
+    SIM_CHECK_EQUAL(0x800 + 0x20000000ull, report.subscribed);
+    SIM_CHECK_EQUAL(0x800 + 0x20000000ull, report.accepted);
+    SIM_CHECK_EQUAL(0, report.falseAcceptRatio);
+    SIM_CHECK(filters_accept(0x7FF, false));
+    SIM_CHECK(filters_accept(CAN_ID_MAX, true));
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_standard_ids);
+    SIM_TEST_RUN(test_standard_and_extended_ids);
+    SIM_TEST_RUN(test_merged_filters);
+    SIM_TEST_RUN(test_all_ids);
+    SIM_TEST_END();
+}
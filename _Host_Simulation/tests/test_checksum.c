@@ -0,0 +1,221 @@
+/*********************************************************************
+*	Host simulation - s35_ethernet Internet checksum (CalcIPChecksum*)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Compared to the former 16-bit loop (sim_reference.h), which is called
+*   on a WORD aligned copy of the data (its precondition).
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+#include "sim_reference.h"
+#include "../bench/bench_eth.h"
+
+#define CHECKSUM_DATA_SIZE      1600
+
+static BYTE data[CHECKSUM_DATA_SIZE + 8] __attribute__((aligned(4)));
+static BYTE copy[CHECKSUM_DATA_SIZE + 8] __attribute__((aligned(4)));
+static uint32_t seed = 1;
+
+static void fill_data(void)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < sizeof(data) ; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = seed >> 24;
+    }
+}
+
+static WORD reference_checksum(const BYTE *p, WORD count)
+{
+    static BYTE aligned[CHECKSUM_DATA_SIZE + 8] __attribute__((aligned(4)));
+
+    memcpy(aligned, p, count);
+    return reference_calc_ip_checksum(aligned, count);
+}
+
+// Every start alignment and every length (odd lengths: zero padded).
+static void test_checksum_kernel(void)
+{
+    uint32_t offset, count, failures = 0;
+
+    fill_data();
+    for (offset = 0 ; offset < 8 ; offset++)
+    {
+        for (count = 0 ; count <= CHECKSUM_DATA_SIZE ; count++)
+        {
+            failures += (CalcIPChecksum(&data[offset], count) != reference_checksum(&data[offset], count));
+        }
+    }
+    SIM_CHECK_EQUAL(0, failures);
+
+    memset(data, 0xff, sizeof(data));
+    SIM_CHECK_EQUAL(reference_checksum(data, CHECKSUM_DATA_SIZE), CalcIPChecksum(data, CHECKSUM_DATA_SIZE));
+    SIM_CHECK_EQUAL(reference_checksum(&data[1], CHECKSUM_DATA_SIZE - 1), CalcIPChecksum(&data[1], CHECKSUM_DATA_SIZE - 1));
+}
+
+// Packet summed in two blocks: even split (Partial chained), any split (Add).
+static void test_checksum_blocks(void)
+{
+    uint32_t offset, split, failures = 0;
+    WORD count = 1461, sum;
+
+    fill_data();
+    for (offset = 0 ; offset < 4 ; offset++)
+    {
+        for (split = 0 ; split <= count ; split++)
+        {
+            if (!(split & 1))
+            {
+                sum = CalcIPChecksumPartial(0, &data[offset], split);
+                sum = CalcIPChecksumPartial(sum, &data[offset + split], count - split);
+                failures += ((WORD) ~sum != reference_checksum(&data[offset], count));
+            }
+            sum = CalcIPChecksumPartial(0, &data[offset], split);
+            sum = CalcIPChecksumAdd(sum, CalcIPChecksumPartial(0, &data[offset + split], count - split), split);
+            failures += ((WORD) ~sum != reference_checksum(&data[offset], count));
+        }
+    }
+    SIM_CHECK_EQUAL(0, failures);
+}
+
+// Same or different alignments of the source and of the destination.
+static void test_checksum_copy(void)
+{
+    uint32_t source, dest, count, failures = 0;
+    WORD sum;
+
+    fill_data();
+    for (source = 0 ; source < 4 ; source++)
+    {
+        for (dest = 0 ; dest < 4 ; dest++)
+        {
+            for (count = 0 ; count <= 200 ; count++)
+            {
+                memset(copy, 0, sizeof(copy));
+                sum = CalcIPChecksumCopy(0, &copy[dest], &data[source], count);
+                failures += (memcmp(&copy[dest], &data[source], count) != 0);
+                failures += ((WORD) ~sum != reference_checksum(&data[source], count));
+                failures += (copy[dest + count] != 0);
+            }
+        }
+    }
+    SIM_CHECK_EQUAL(0, failures);
+}
+
+// ICMP echo reply (type 8 -> 0): the RFC 1624 update gives the checksum of
+// the reply computed again. The former '+ 0x0800' gives the same value,
+// but 0xFFFF instead of 0x0000 (both are a zero in one's complement).
+static void test_checksum_update(void)
+{
+    BYTE message[8] __attribute__((aligned(4))) = {8, 0, 0, 0, 0, 0, 0, 1};
+    uint32_t id, failures = 0, zeros = 0;
+    DWORD_VAL dwVal, expected;
+    WORD checksum;
+
+    for (id = 0 ; id < 0x10000 ; id++)
+    {
+        message[0] = 8;
+        message[2] = message[3] = 0;
+        message[4] = id >> 8;
+        message[5] = id & 0xff;
+        checksum = reference_calc_ip_checksum(message, sizeof(message));
+        memcpy(&message[2], &checksum, 2);
+        memcpy(&dwVal, message, 4);
+
+        expected.Val = reference_icmp_echo_reply(dwVal);
+        dwVal.w[1] = CalcIPChecksumUpdate(dwVal.w[1], dwVal.w[0], dwVal.w[0] & 0xff00u);
+        dwVal.v[0] = 0x00;
+
+        message[0] = 0;
+        message[2] = message[3] = 0;
+        failures += (dwVal.w[1] != reference_calc_ip_checksum(message, sizeof(message)));
+        if (dwVal.Val != expected.Val)
+        {
+            zeros++;
+            failures += (dwVal.w[1] != 0x0000) || (expected.w[1] != 0xffff);
+        }
+    }
+    SIM_CHECK_EQUAL(0, failures);
+    SIM_CHECK_EQUAL(1, zeros);
+    SIM_CHECK_EQUAL(0x1234, CalcIPChecksumUpdate(CalcIPChecksumUpdate(0x1234, 0x0008, 0x0000), 0x0000, 0x0008));
+}
+
+static void eth_task(uint32_t ms)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < ms ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        mGetTick();
+        ETH_StackTask();
+    }
+}
+
+// Segment sent by SendTCP (summed while copied): checked with the former
+// routine over the pseudo header and the segment.
+static WORD tcp_segment_checksum(const uint8_t *p_frame, size_t size)
+{
+    static BYTE segment[12 + 1536] __attribute__((aligned(4)));
+    WORD length = ((p_frame[16] << 8) | p_frame[17]) - 20;
+
+    memcpy(&segment[0], &p_frame[26], 8);       // Source and destination IP
+    segment[8] = 0;
+    segment[9] = IP_PROTOCOLE_TCP;
+    segment[10] = length >> 8;
+    segment[11] = length & 0xff;
+    memcpy(&segment[12], &p_frame[14 + 20], length);
+    return reference_calc_ip_checksum(segment, 12 + length);
+}
+
+static void test_tcp_checksum(void)
+{
+    static uint8_t frame[1536];
+    static const char *texts[] = {"a", "ab", "abc", "odd length", "even length!", "the sum of the payload while it is copied"};
+    TCP_SOCKET s;
+    size_t size;
+    uint32_t i;
+
+    bench_eth_init();
+    s = TCPOpen(0, TCP_OPEN_SERVER, 8080);
+    bench_eth_build_tcp(8080, 1000, 0, SYN, 0xFFFF);
+    SIM_CHECK(sim_eth_inject(bench_eth_frame, bench_eth_frame_size));
+    eth_task(1);
+    sim_advance(SIM_US(200));
+    size = sim_eth_get_tx(frame, sizeof(frame));
+    SIM_CHECK(size != 0);
+    SIM_CHECK_EQUAL(SYN | ACK, frame[14 + 20 + 13]);
+    SIM_CHECK_EQUAL(0, tcp_segment_checksum(frame, size));
+
+    bench_eth_build_tcp(8080, 1001, ((DWORD) frame[38] << 24 | frame[39] << 16 | frame[40] << 8 | frame[41]) + 1, ACK, 0xFFFF);
+    SIM_CHECK(sim_eth_inject(bench_eth_frame, bench_eth_frame_size));
+    eth_task(1);
+    SIM_CHECK(TCPIsConnected(s));
+
+    for (i = 0 ; i < sizeof(texts) / sizeof(texts[0]) ; i++)
+    {
+        TCPPutString(s, (BYTE*) texts[i]);
+        TCPFlush(s);
+        sim_advance(SIM_US(200));
+        size = sim_eth_get_tx(frame, sizeof(frame));
+        SIM_CHECK_EQUAL(20 + 20 + strlen(texts[i]), (frame[16] << 8) | frame[17]);
+        SIM_CHECK_EQUAL(0, tcp_segment_checksum(frame, size));
+    }
+    TCPClose(s);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_checksum_kernel);
+    SIM_TEST_RUN(test_checksum_blocks);
+    SIM_TEST_RUN(test_checksum_copy);
+    SIM_TEST_RUN(test_checksum_update);
+    SIM_TEST_RUN(test_tcp_checksum);
+    SIM_TEST_END();
+}
@@ -0,0 +1,209 @@
+/*********************************************************************
+*	Host simulation - color (integer TSV / RGB vs the former float code)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The integer code truncates the exact value, the float code could be
+*   one unit below (0.29 stored as 0.28999...): the results are equal or
+*   one unit above, never below.
+*********************************************************************/
+
+#include <stdlib.h>
+#include "sim_test.h"
+#include "sim_reference.h"
+
+static int32_t color_error(int32_t expected, int32_t actual)
+{
+    return actual - expected;
+}
+
+// Shade difference by the shortest way around the colour wheel.
+static int32_t color_shade_error(int32_t expected, int32_t actual)
+{
+    int32_t error = actual - expected;
+
+    if (error > (COLOR_SHADE_MAX / 2))
+    {
+        error -= COLOR_SHADE_MAX;
+    }
+    else if (error < -(COLOR_SHADE_MAX / 2))
+    {
+        error += COLOR_SHADE_MAX;
+    }
+    return error;
+}
+
+static void color_update_bounds(int32_t error, int32_t *p_min, int32_t *p_max)
+{
+    (error < *p_min) ? (*p_min = error) : 0;
+    (error > *p_max) ? (*p_max = error) : 0;
+}
+
+// All the TSV colours (600 x 101 x 101). The shade 600 is the shade 0: the
+// float code took a fraction of 6 there (green over 100%, wrapped byte).
+static void test_tsv_to_rgb(void)
+{
+    int32_t min = 0, max = 0;
+    uint32_t shade, saturation, intensity, exact = 0, total = 0;
+    RGB_COLOR expected, actual;
+
+    for (shade = 0 ; shade < COLOR_SHADE_MAX ; shade++)
+    {
+        for (saturation = 0 ; saturation <= COLOR_PERCENT_MAX ; saturation++)
+        {
+            for (intensity = 0 ; intensity <= COLOR_PERCENT_MAX ; intensity++)
+            {
+                TSV_COLOR tsv = {shade, saturation, intensity};
+
+                expected = reference_tsv_to_rgb(tsv);
+                actual = color_tsv_to_rgb(tsv);
+                color_update_bounds(color_error(expected.red, actual.red), &min, &max);
+                color_update_bounds(color_error(expected.green, actual.green), &min, &max);
+                color_update_bounds(color_error(expected.blue, actual.blue), &min, &max);
+                exact += (expected.red == actual.red) && (expected.green == actual.green) && (expected.blue == actual.blue);
+                total++;
+            }
+        }
+    }
+    printf("    tsv -> rgb: error [%d, %d], %u / %u exact\n", min, max, exact, total);
+    SIM_CHECK(min >= 0);
+    SIM_CHECK(max <= 1);
+
+    for (saturation = 0 ; saturation <= COLOR_PERCENT_MAX ; saturation++)
+    {
+        expected = color_tsv_to_rgb((TSV_COLOR) {0, saturation, 100});
+        actual = color_tsv_to_rgb((TSV_COLOR) {COLOR_SHADE_MAX, saturation, 100});
+        SIM_CHECK((expected.red == actual.red) && (expected.green == actual.green) && (expected.blue == actual.blue));
+    }
+
+    // Out of range: black for both.
+    actual = color_tsv_to_rgb((TSV_COLOR) {601, 100, 100});
+    SIM_CHECK_EQUAL(0, actual.red | actual.green | actual.blue);
+    actual = color_tsv_to_rgb((TSV_COLOR) {0, 101, 100});
+    SIM_CHECK_EQUAL(0, actual.red | actual.green | actual.blue);
+    actual = fUtilitiesTSVtoRGB((TSV_COLOR) {0, 100, 101});
+    SIM_CHECK_EQUAL(0, actual.red | actual.green | actual.blue);
+}
+
+// All the RGB colours (101 x 101 x 101).
+static void test_rgb_to_tsv(void)
+{
+    int32_t shade_min = 0, shade_max = 0, min = 0, max = 0;
+    uint32_t red, green, blue;
+    TSV_COLOR expected, actual;
+
+    for (red = 0 ; red <= COLOR_PERCENT_MAX ; red++)
+    {
+        for (green = 0 ; green <= COLOR_PERCENT_MAX ; green++)
+        {
+            for (blue = 0 ; blue <= COLOR_PERCENT_MAX ; blue++)
+            {
+                RGB_COLOR rgb = {red, green, blue};
+
+                expected = reference_rgb_to_tsv(rgb);
+                actual = color_rgb_to_tsv(rgb);
+                if ((red == green) && (green == blue))
+                {
+                    // Grey: the float code divides 0 by 0 (NaN shade).
+                    SIM_CHECK_EQUAL(0, actual.shade);
+                    SIM_CHECK_EQUAL(red ? 0 : 100, actual.saturation);
+                    SIM_CHECK_EQUAL(red, actual.intensity);
+                    continue;
+                }
+                color_update_bounds(color_shade_error(expected.shade, actual.shade), &shade_min, &shade_max);
+                color_update_bounds(color_error(expected.saturation, actual.saturation), &min, &max);
+                SIM_CHECK_EQUAL(expected.intensity, actual.intensity);
+            }
+        }
+    }
+    printf("    rgb -> tsv: shade error [%d, %d], saturation error [%d, %d]\n", shade_min, shade_max, min, max);
+    SIM_CHECK(shade_min >= 0);
+    SIM_CHECK(shade_max <= 1);
+    SIM_CHECK(min >= 0);
+    SIM_CHECK(max <= 1);
+}
+
+// The number of steps is the same where the shades are at most 300 apart.
+// Beyond, the former code took 600 - saturation difference: color.c takes
+// the shade difference by the shortest way.
+static void test_number_of_step(void)
+{
+    uint32_t shade1, shade2, saturation, mismatches = 0;
+    uint16_t expected;
+
+    for (shade1 = 0 ; shade1 <= COLOR_SHADE_MAX ; shade1 += 3)
+    {
+        for (shade2 = 0 ; shade2 <= COLOR_SHADE_MAX ; shade2 += 7)
+        {
+            for (saturation = 0 ; saturation <= COLOR_PERCENT_MAX ; saturation += 25)
+            {
+                TSV_COLOR c1 = {shade1, saturation, 100}, c2 = {shade2, 100 - saturation, saturation};
+                uint32_t diff = abs((int) shade1 - (int) shade2);
+
+                if (diff <= (COLOR_SHADE_MAX / 2))
+                {
+                    expected = reference_get_number_of_step(c1, c2);
+                }
+                else
+                {
+                    expected = COLOR_SHADE_MAX - diff;
+                    (expected < abs((int) c1.saturation - (int) c2.saturation)) ? (expected = abs((int) c1.saturation - (int) c2.saturation)) : 0;
+                    (expected < abs((int) c1.intensity - (int) c2.intensity)) ? (expected = abs((int) c1.intensity - (int) c2.intensity)) : 0;
+                }
+                mismatches += (expected != color_tsv_get_number_of_step(c1, c2));
+                mismatches += (color_tsv_get_number_of_step(c1, c2) != color_tsv_get_number_of_step(c2, c1));
+            }
+        }
+    }
+    SIM_CHECK_EQUAL(0, mismatches);
+    SIM_CHECK_EQUAL(0, color_tsv_get_number_of_step(COLOR_RED, COLOR_RED));
+}
+
+// Every step of transitions between a set of colours (both directions).
+static void test_get_middle(void)
+{
+    static const TSV_COLOR colors[] =
+    {
+        {0, 100, 100}, {50, 80, 20}, {120, 100, 100}, {299, 0, 50}, {300, 100, 0},
+        {301, 33, 66}, {450, 100, 100}, {599, 10, 90}, {600, 100, 100}
+    };
+    const uint32_t number_of_colors = sizeof(colors) / sizeof(colors[0]);
+    int32_t shade_min = 0, shade_max = 0, min = 0, max = 0;
+    uint32_t i, j;
+    uint16_t indice, number_of_step;
+
+    for (i = 0 ; i < number_of_colors ; i++)
+    {
+        for (j = 0 ; j < number_of_colors ; j++)
+        {
+            number_of_step = color_tsv_get_number_of_step(colors[i], colors[j]);
+            for (indice = 0 ; indice <= number_of_step ; indice++)
+            {
+                TSV_COLOR expected = reference_get_middle(colors[i], colors[j], indice, number_of_step);
+                TSV_COLOR actual = color_tsv_get_middle(colors[i], colors[j], indice, number_of_step);
+
+                color_update_bounds(color_shade_error(expected.shade, actual.shade), &shade_min, &shade_max);
+                color_update_bounds(color_error(expected.saturation, actual.saturation), &min, &max);
+                color_update_bounds(color_error(expected.intensity, actual.intensity), &min, &max);
+            }
+            // Departure and arrival.
+            SIM_CHECK_EQUAL(colors[j].shade, color_tsv_get_middle(colors[i], colors[j], number_of_step, number_of_step).shade);
+        }
+    }
+    printf("    middle: shade error [%d, %d], saturation / intensity error [%d, %d]\n", shade_min, shade_max, min, max);
+    SIM_CHECK_EQUAL(0, shade_min);
+    SIM_CHECK_EQUAL(0, shade_max);
+    SIM_CHECK_EQUAL(0, min);
+    SIM_CHECK_EQUAL(0, max);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_tsv_to_rgb);
+    SIM_TEST_RUN(test_rgb_to_tsv);
+    SIM_TEST_RUN(test_number_of_step);
+    SIM_TEST_RUN(test_get_middle);
+    SIM_TEST_END();
+}
@@ -0,0 +1,240 @@
+/*********************************************************************
+*	Host simulation - s35_ethernet ARP cache (held packets)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The ARP requests sent by the stack are read on the TX side of the
+*   Ethernet model and the responses are injected as Ethernet frames.
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+
+#define ETH_FRAME_SIZE          1536
+#define ETH_TYPE_OFFSET         12
+#define ETH_PAYLOAD_OFFSET      14
+#define IP_PROTOCOL_OFFSET      (ETH_PAYLOAD_OFFSET + 9)
+#define IP_DEST_OFFSET          (ETH_PAYLOAD_OFFSET + 16)
+#define IP_PAYLOAD_OFFSET       (ETH_PAYLOAD_OFFSET + 20)
+#define ARP_TARGET_IP_OFFSET    (ETH_PAYLOAD_OFFSET + 24)
+
+static const uint8_t my_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const uint8_t peer_mac[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x20};
+static const uint8_t my_ip[4] = {192, 168, 1, 10};
+static const uint8_t peer_ip[4] = {192, 168, 1, 20};
+static const uint8_t gateway_ip[4] = {192, 168, 1, 1};
+static const uint8_t remote_ip[4] = {10, 0, 0, 5};        // Not on our subnet: through the gateway
+
+static uint8_t frame[ETH_FRAME_SIZE];
+
+static DWORD eth_ip(const uint8_t *p_ip)
+{
+    return p_ip[0] | (p_ip[1] << 8ul) | (p_ip[2] << 16ul) | ((DWORD) p_ip[3] << 24ul);
+}
+
+static void eth_task(uint32_t ms)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < ms ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        mGetTick();
+        ETH_StackTask();
+    }
+}
+
+static void eth_init(void)
+{
+    ETH_StackInit((BYTE*) "02:00:00:00:00:01", (BYTE*) "192.168.1.10", FALSE);
+    eth_task(5);
+    while (sim_eth_get_tx(frame, sizeof(frame)));
+}
+
+// Next frame sent: its size (0: none).
+static size_t eth_get_tx(void)
+{
+    sim_advance(SIM_US(200));   // Frames queued behind the one on the wire
+    memset(frame, 0, sizeof(frame));
+    return sim_eth_get_tx(frame, sizeof(frame));
+}
+
+static bool eth_is_arp_request(const uint8_t *p_ip)
+{
+    return (frame[ETH_TYPE_OFFSET] == 0x08) && (frame[ETH_TYPE_OFFSET + 1] == 0x06) && (frame[ETH_PAYLOAD_OFFSET + 7] == 1) && (memcmp(&frame[ARP_TARGET_IP_OFFSET], p_ip, 4) == 0);
+}
+
+static bool eth_is_ip_packet(BYTE protocol, const uint8_t *p_ip)
+{
+    return (frame[ETH_TYPE_OFFSET] == 0x08) && (frame[ETH_TYPE_OFFSET + 1] == 0x00) && (memcmp(frame, peer_mac, 6) == 0) && (frame[IP_PROTOCOL_OFFSET] == protocol) && (memcmp(&frame[IP_DEST_OFFSET], p_ip, 4) == 0);
+}
+
+// ARP response of 'p_ip' (MAC address: peer_mac).
+static void eth_inject_arp_response(const uint8_t *p_ip)
+{
+    uint8_t response[60] = {0};
+
+    memcpy(&response[0], my_mac, 6);
+    memcpy(&response[6], peer_mac, 6);
+    response[12] = 0x08; response[13] = 0x06;
+    response[14] = 0x00; response[15] = 0x01;               // Ethernet
+    response[16] = 0x08; response[17] = 0x00;               // IPv4
+    response[18] = 6; response[19] = 4;
+    response[20] = 0x00; response[21] = 0x02;               // Response
+    memcpy(&response[22], peer_mac, 6);
+    memcpy(&response[28], p_ip, 4);
+    memcpy(&response[32], my_mac, 6);
+    memcpy(&response[38], my_ip, 4);
+    SIM_CHECK(sim_eth_inject(response, sizeof(response)));
+}
+
+static void eth_udp_send(UDP_SOCKET s, const char *p_text)
+{
+    SIM_CHECK(UDPIsPutReady(s) > 0);
+    UDPPutArray((BYTE*) p_text, strlen(p_text));
+    UDPFlush();
+}
+
+// A datagram sent before the resolution is held and sent with the ARP
+// response (one ARP request only).
+static void test_udp_held_until_response(void)
+{
+    UDP_SOCKET s;
+
+    eth_init();
+    s = UDPOpenEx(eth_ip(peer_ip), UDP_OPEN_IP_ADDRESS, 0, 5000);
+    eth_udp_send(s, "hello");
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_arp_request(peer_ip));
+    eth_task(1);
+    SIM_CHECK_EQUAL(0, eth_get_tx());
+
+    eth_inject_arp_response(peer_ip);
+    eth_task(1);
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_ip_packet(IP_PROTOCOLE_UDP, peer_ip));
+    SIM_CHECK_EQUAL(5000, (frame[IP_PAYLOAD_OFFSET + 2] << 8) | frame[IP_PAYLOAD_OFFSET + 3]);
+    SIM_CHECK_EQUAL(8 + 5, (frame[IP_PAYLOAD_OFFSET + 4] << 8) | frame[IP_PAYLOAD_OFFSET + 5]);
+    SIM_CHECK(memcmp(&frame[IP_PAYLOAD_OFFSET + 8], "hello", 5) == 0);
+    SIM_CHECK_EQUAL(0, eth_get_tx());
+
+    // Resolved: sent at once
+    eth_udp_send(s, "again");
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_ip_packet(IP_PROTOCOLE_UDP, peer_ip));
+    SIM_CHECK(memcmp(&frame[IP_PAYLOAD_OFFSET + 8], "again", 5) == 0);
+    UDPClose(s);
+}
+
+// ARP_QUEUE_DEPTH datagrams are held, in order; the next ones and the
+// ones longer than ARP_QUEUE_PACKET_SIZE are dropped.
+static void test_udp_queue_limits(void)
+{
+    static char text[ARP_QUEUE_PACKET_SIZE + 1];
+    UDP_SOCKET s;
+    uint32_t i;
+
+    eth_init();
+    s = UDPOpenEx(eth_ip(peer_ip), UDP_OPEN_IP_ADDRESS, 0, 5000);
+    memset(text, 'x', ARP_QUEUE_PACKET_SIZE);
+    eth_udp_send(s, text);
+    for (i = 0 ; i < ARP_QUEUE_DEPTH + 1 ; i++)
+    {
+        char number[2] = {'0' + i, 0};
+
+        eth_udp_send(s, number);
+    }
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_arp_request(peer_ip));
+    SIM_CHECK_EQUAL(0, eth_get_tx());
+
+    eth_inject_arp_response(peer_ip);
+    eth_task(1);
+    for (i = 0 ; i < ARP_QUEUE_DEPTH ; i++)
+    {
+        SIM_CHECK(eth_get_tx() > 0);
+        SIM_CHECK(eth_is_ip_packet(IP_PROTOCOLE_UDP, peer_ip));
+        SIM_CHECK_EQUAL('0' + i, frame[IP_PAYLOAD_OFFSET + 8]);
+    }
+    SIM_CHECK_EQUAL(0, eth_get_tx());
+    UDPClose(s);
+}
+
+// Outside our subnet the gateway is resolved, the datagram keeps its
+// final destination.
+static void test_udp_through_gateway(void)
+{
+    UDP_SOCKET s;
+
+    eth_init();
+    s = UDPOpenEx(eth_ip(remote_ip), UDP_OPEN_IP_ADDRESS, 0, 5000);
+    eth_udp_send(s, "far");
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_arp_request(gateway_ip));
+
+    eth_inject_arp_response(gateway_ip);
+    eth_task(1);
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_ip_packet(IP_PROTOCOLE_UDP, remote_ip));
+    SIM_CHECK(memcmp(&frame[IP_PAYLOAD_OFFSET + 8], "far", 3) == 0);
+    UDPClose(s);
+}
+
+// Without response the request is sent ARP_MAX_RETRY times, then the
+// entry and its held packets are released.
+static void test_unresolved_entry_released(void)
+{
+    UDP_SOCKET s;
+    uint32_t requests = 0;
+
+    eth_init();
+    s = UDPOpenEx(eth_ip(peer_ip), UDP_OPEN_IP_ADDRESS, 0, 5000);
+    UDPClose(s);    // No more request from the socket: only the ones of the ARP cache
+    s = UDPOpenEx(eth_ip(peer_ip), UDP_OPEN_IP_ADDRESS, 0, 5000);
+    eth_udp_send(s, "lost");
+    UDPClose(s);
+    eth_task(ARP_MAX_RETRY * (ARP_RETRY_INTERVAL / TICK_1MS) + 100);
+    while (eth_get_tx() > 0)
+    {
+        requests += eth_is_arp_request(peer_ip);
+    }
+    SIM_CHECK_EQUAL(ARP_MAX_RETRY, requests);
+
+    eth_inject_arp_response(peer_ip);
+    eth_task(1);
+    SIM_CHECK_EQUAL(0, eth_get_tx());
+}
+
+// The SYN of a client socket is held and sent with the ARP response.
+static void test_tcp_syn_held_until_response(void)
+{
+    TCP_SOCKET s;
+
+    eth_init();
+    s = TCPOpen(eth_ip(peer_ip), TCP_OPEN_IP_ADDRESS, 80);
+    SIM_CHECK(s != INVALID_SOCKET);
+    eth_task(1);
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_arp_request(peer_ip));
+    SIM_CHECK_EQUAL(0, eth_get_tx());
+
+    eth_inject_arp_response(peer_ip);
+    eth_task(1);
+    SIM_CHECK(eth_get_tx() > 0);
+    SIM_CHECK(eth_is_ip_packet(IP_PROTOCOLE_TCP, peer_ip));
+    SIM_CHECK_EQUAL(80, (frame[IP_PAYLOAD_OFFSET + 2] << 8) | frame[IP_PAYLOAD_OFFSET + 3]);
+    SIM_CHECK_EQUAL(SYN, frame[IP_PAYLOAD_OFFSET + 13]);
+    TCPDisconnect(s);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_udp_held_until_response);
+    SIM_TEST_RUN(test_udp_queue_limits);
+    SIM_TEST_RUN(test_udp_through_gateway);
+    SIM_TEST_RUN(test_unresolved_entry_released);
+    SIM_TEST_RUN(test_tcp_syn_held_until_response);
+    SIM_TEST_END();
+}
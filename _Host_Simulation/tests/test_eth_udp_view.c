@@ -0,0 +1,112 @@
+/*********************************************************************
+*	Host simulation - s35_ethernet UDP zero-copy reads (UDPPeek)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   The EMAC RX buffer of a borrowed segment is kept (StackTask stops)
+*   until UDPConsume releases all the bytes or UDPClose closes the socket.
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+#include "../bench/bench_eth.h"
+
+static void eth_task(uint32_t ms)
+{
+    uint32_t i;
+
+    for (i = 0 ; i < ms ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        mGetTick();
+        ETH_StackTask();
+    }
+}
+
+static void eth_receive_udp(uint16_t port)
+{
+    bench_eth_build_udp(port);
+    SIM_CHECK(sim_eth_inject(bench_eth_frame, bench_eth_frame_size));
+    eth_task(1);
+}
+
+static void test_peek_consume(void)
+{
+    UDP_SOCKET s;
+    RX_VIEW view;
+
+    bench_eth_init();
+    s = UDPOpenEx(0, UDP_OPEN_SERVER, 7000, 0);
+    eth_receive_udp(7000);
+
+    SIM_CHECK_EQUAL(8, UDPPeek(s, &view));
+    SIM_CHECK(memcmp(view.data[0], "demuxing", 8) == 0);
+    SIM_CHECK(view.data[1] == NULL);
+    SIM_CHECK(UDPIsViewBorrowed());
+
+    SIM_CHECK_EQUAL(3, UDPConsume(s, 3));
+    eth_task(1);
+    SIM_CHECK(UDPIsViewBorrowed());
+    SIM_CHECK_EQUAL(5, UDPPeek(s, &view));
+    SIM_CHECK(memcmp(view.data[0], "uxing", 5) == 0);
+
+    SIM_CHECK_EQUAL(5, UDPConsume(s, 100));
+    SIM_CHECK(!UDPIsViewBorrowed());
+    SIM_CHECK_EQUAL(0, UDPConsume(s, 1));
+
+    eth_receive_udp(7000);
+    SIM_CHECK_EQUAL(8, UDPIsGetReady(s));
+    UDPClose(s);
+}
+
+// UDPConsume works on its socket, not on the last active one.
+static void test_consume_other_socket(void)
+{
+    UDP_SOCKET s1, s2;
+    RX_VIEW view;
+
+    bench_eth_init();
+    s1 = UDPOpenEx(0, UDP_OPEN_SERVER, 7000, 0);
+    s2 = UDPOpenEx(0, UDP_OPEN_SERVER, 7001, 0);
+    eth_receive_udp(7000);
+
+    SIM_CHECK_EQUAL(8, UDPPeek(s1, &view));
+    SIM_CHECK_EQUAL(0, UDPIsGetReady(s2));
+    SIM_CHECK_EQUAL(0, UDPConsume(s2, 8));
+    SIM_CHECK(UDPIsViewBorrowed());
+    SIM_CHECK_EQUAL(8, UDPConsume(s1, 8));
+    SIM_CHECK(!UDPIsViewBorrowed());
+    UDPClose(s1);
+    UDPClose(s2);
+}
+
+// Closing the socket (even not the active one) gives the buffer back.
+static void test_close_releases_view(void)
+{
+    UDP_SOCKET s1, s2;
+    RX_VIEW view;
+
+    bench_eth_init();
+    s1 = UDPOpenEx(0, UDP_OPEN_SERVER, 7000, 0);
+    s2 = UDPOpenEx(0, UDP_OPEN_SERVER, 7001, 0);
+    eth_receive_udp(7000);
+
+    SIM_CHECK_EQUAL(8, UDPPeek(s1, &view));
+    SIM_CHECK_EQUAL(0, UDPIsGetReady(s2));
+    UDPClose(s1);
+    SIM_CHECK(!UDPIsViewBorrowed());
+
+    eth_receive_udp(7001);
+    SIM_CHECK_EQUAL(8, UDPIsGetReady(s2));
+    UDPClose(s2);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_peek_consume);
+    SIM_TEST_RUN(test_consume_other_socket);
+    SIM_TEST_RUN(test_close_releases_view);
+    SIM_TEST_END();
+}
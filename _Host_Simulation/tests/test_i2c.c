@@ -0,0 +1,243 @@
+/*********************************************************************
+*	Host simulation - s24_i2c (transaction queue) with a slave model
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+
+#define I2C_TEST_ADDRESS        0x80        // 8 bits address (write)
+
+/*******************************************************************************
+ * Slave model: 256 registers, the first byte written after the address is 
+ * the register pointer, auto-increment on each byte written or read (as the
+ * PCA9685 with MODE1.AI).
+ ******************************************************************************/
+typedef struct
+{
+    uint8_t     registers[256];
+    uint8_t     pointer;
+    bool        is_pointer_expected;
+    uint32_t    start_count;            // START or RESTART addressed to the slave
+    uint32_t    read_start_count;
+    uint32_t    stop_count;
+} SIM_I2C_REGISTERS;
+
+static SIM_I2C_REGISTERS slave_model;
+static uint32_t callback_count = 0;
+static uint8_t callback_order[3];
+
+static void slave_start(void *p_context, bool is_read)
+{
+    SIM_I2C_REGISTERS *p = (SIM_I2C_REGISTERS *) p_context;
+
+    p->start_count++;
+    p->read_start_count += is_read;
+    p->is_pointer_expected = !is_read;
+}
+
+static bool slave_write(void *p_context, uint8_t data)
+{
+    SIM_I2C_REGISTERS *p = (SIM_I2C_REGISTERS *) p_context;
+
+    if (p->is_pointer_expected)
+    {
+        p->is_pointer_expected = false;
+        p->pointer = data;
+    }
+    else
+    {
+        p->registers[p->pointer++] = data;
+    }
+    return true;
+}
+
+static uint8_t slave_read(void *p_context, bool ack)
+{
+    SIM_I2C_REGISTERS *p = (SIM_I2C_REGISTERS *) p_context;
+
+    return p->registers[p->pointer++];
+}
+
+static void slave_stop(void *p_context)
+{
+    ((SIM_I2C_REGISTERS *) p_context)->stop_count++;
+}
+
+static const sim_i2c_slave_t slave_registers = {slave_start, slave_write, slave_read, slave_stop};
+
+static void transaction_done(void *p_context)
+{
+    callback_order[callback_count++ % 3] = (uint8_t) (uintptr_t) p_context;
+}
+
+static void i2c2_isr(void)
+{
+    i2c_master_interrupt_handler(I2C2);
+}
+
+static void i2c_test_init(IRQ_PRIORITY priority)
+{
+    memset(&slave_model, 0, sizeof(slave_model));
+    callback_count = 0;
+    sim_i2c_attach(I2C2, I2C_TEST_ADDRESS >> 1, &slave_registers, &slave_model);
+    i2c_init_as_master(I2C2, NULL, I2C_FREQUENCY_400KHZ, I2C_CONTINUE_ON_IDLE | I2C_DISABLE_SMBUS);
+    i2c_queue_init(I2C2, priority);
+    if (priority != IRQ_PRIORITY_DISABLED)
+    {
+        sim_irq_attach(IRQ_I2C1M + I2C2, i2c2_isr);
+        sim_irq_attach(IRQ_I2C1B + I2C2, i2c2_isr);
+    }
+}
+
+// Advances the time (and polls the queue) until the queue is idle.
+static bool i2c_test_run(uint64_t timeout)
+{
+    uint64_t start = sim_now();
+
+    while (!i2c_queue_is_idle(I2C2) && (sim_now() - start < timeout))
+    {
+        i2c_queue_deamon(I2C2);
+        sim_advance(SIM_US(1));
+    }
+    return i2c_queue_is_idle(I2C2);
+}
+
+/*******************************************************************************
+ * Tests
+ ******************************************************************************/
+// 64 registers of a PCA9685 (LED0_ON_L..LED15_OFF_H) in one auto-increment 
+// burst, polled.
+static void test_write_burst(void)
+{
+    static uint8_t tx[64];
+    I2C_TRANSACTION_DEF(write_leds, I2C_TEST_ADDRESS, 0x06, 1, tx, sizeof(tx), NULL, 0, transaction_done, (void *) 0);
+    uint32_t i;
+
+    i2c_test_init(IRQ_PRIORITY_DISABLED);
+    for (i = 0 ; i < sizeof(tx) ; i++)
+    {
+        tx[i] = (uint8_t) (i * 3 + 1);
+    }
+    SIM_CHECK(i2c_transaction_submit(I2C2, &write_leds));
+    SIM_CHECK(!i2c_transaction_submit(I2C2, &write_leds));     // Already pending
+    SIM_CHECK(i2c_test_run(SIM_MS(5)));
+
+    SIM_CHECK(!write_leds.is_pending);
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_SUCCESS, write_leds.result);
+    SIM_CHECK_EQUAL(1, callback_count);
+    SIM_CHECK_EQUAL(0, memcmp(&slave_model.registers[0x06], tx, sizeof(tx)));
+    SIM_CHECK_EQUAL(0, slave_model.registers[0x05]);
+    SIM_CHECK_EQUAL(0, slave_model.registers[0x06 + sizeof(tx)]);
+    SIM_CHECK_EQUAL(1, slave_model.start_count);
+    SIM_CHECK_EQUAL(1, slave_model.stop_count);
+}
+
+// Register then repeated start and read, driven by the interruption.
+static void test_read_repeated_start(void)
+{
+    static uint8_t rx[6];
+    I2C_TRANSACTION_DEF(read_acc, I2C_TEST_ADDRESS, 0x28, 1, NULL, 0, rx, sizeof(rx), transaction_done, (void *) 0);
+    uint32_t i;
+
+    i2c_test_init(IRQ_PRIORITY_LEVEL_3);
+    for (i = 0 ; i < 256 ; i++)
+    {
+        slave_model.registers[i] = (uint8_t) ~i;
+    }
+    SIM_CHECK(i2c_transaction_submit(I2C2, &read_acc));
+    while (read_acc.is_pending && (sim_now() < SIM_MS(1)))
+    {
+        sim_advance(SIM_US(1));
+    }
+
+    SIM_CHECK(!read_acc.is_pending);
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_SUCCESS, read_acc.result);
+    for (i = 0 ; i < sizeof(rx) ; i++)
+    {
+        SIM_CHECK_EQUAL((uint8_t) ~(0x28 + i), rx[i]);
+    }
+    SIM_CHECK_EQUAL(2, slave_model.start_count);
+    SIM_CHECK_EQUAL(1, slave_model.read_start_count);
+    SIM_CHECK_EQUAL(2, slave_model.stop_count);         // The model deselects the slave at the repeated start
+    irq_enable(IRQ_I2C1M + I2C2, IRQ_DISABLED);
+    irq_enable(IRQ_I2C1B + I2C2, IRQ_DISABLED);
+}
+
+// A component which does not answer does not block the next transactions.
+static void test_nack(void)
+{
+    static const uint8_t tx[2] = {0x12, 0x34};
+    I2C_TRANSACTION_DEF(write_absent, 0x42, 0x00, 1, tx, sizeof(tx), NULL, 0, transaction_done, (void *) 0);
+    I2C_TRANSACTION_DEF(write_present, I2C_TEST_ADDRESS, 0x10, 1, tx, sizeof(tx), NULL, 0, transaction_done, (void *) 1);
+
+    i2c_test_init(IRQ_PRIORITY_DISABLED);
+    SIM_CHECK(i2c_transaction_submit(I2C2, &write_absent));
+    SIM_CHECK(i2c_transaction_submit(I2C2, &write_present));
+    SIM_CHECK(i2c_test_run(SIM_MS(1)));
+
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_NACK, write_absent.result);
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_SUCCESS, write_present.result);
+    SIM_CHECK_EQUAL(2, callback_count);
+    SIM_CHECK_EQUAL(0, callback_order[0]);
+    SIM_CHECK_EQUAL(1, callback_order[1]);
+    SIM_CHECK_EQUAL(0x12, slave_model.registers[0x10]);
+    SIM_CHECK_EQUAL(0x34, slave_model.registers[0x11]);
+}
+
+// After a bus collision, the queue waits for the stop of the other master
+// (I2CSTAT.P) before the next start: a single collision.
+static void test_bus_collision(void)
+{
+    static const uint8_t tx[4] = {1, 2, 3, 4};
+    I2C_TRANSACTION_DEF(write0, I2C_TEST_ADDRESS, 0x00, 1, tx, sizeof(tx), NULL, 0, transaction_done, (void *) 0);
+    I2C_TRANSACTION_DEF(write1, I2C_TEST_ADDRESS, 0x10, 1, tx, sizeof(tx), NULL, 0, transaction_done, (void *) 1);
+    I2C_TRANSACTION_DEF(write2, I2C_TEST_ADDRESS, 0x20, 1, tx, sizeof(tx), NULL, 0, transaction_done, (void *) 2);
+    uint64_t start;
+
+    i2c_test_init(IRQ_PRIORITY_LEVEL_3);
+    sim_i2c_force_collision(I2C2, SIM_US(500));
+    start = sim_now();
+    SIM_CHECK(i2c_transaction_submit(I2C2, &write0));
+    SIM_CHECK(i2c_transaction_submit(I2C2, &write1));
+    sim_advance(SIM_US(100));
+
+    // Bus still busy: write1 waits, write2 is queued behind it.
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_BUS_COLLISION, write0.result);
+    SIM_CHECK(!write0.is_pending);
+    SIM_CHECK(write1.is_pending);
+    SIM_CHECK(i2c_transaction_submit(I2C2, &write2));
+    i2c_queue_deamon(I2C2);
+    sim_advance(SIM_US(100));
+    SIM_CHECK(write1.is_pending);
+    SIM_CHECK_EQUAL(1, sim_i2c_get_collision_count(I2C2));
+    SIM_CHECK_EQUAL(0, slave_model.start_count);
+
+    // Stop of the other master: the daemon starts write1, the interruption chains write2.
+    SIM_CHECK(i2c_test_run(SIM_MS(2)));
+    SIM_CHECK(sim_now() - start >= SIM_US(500));
+    SIM_CHECK_EQUAL(1, sim_i2c_get_collision_count(I2C2));
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_SUCCESS, write1.result);
+    SIM_CHECK_EQUAL(I2C_TRANSACTION_SUCCESS, write2.result);
+    SIM_CHECK_EQUAL(3, callback_count);
+    SIM_CHECK_EQUAL(0, callback_order[0]);
+    SIM_CHECK_EQUAL(1, callback_order[1]);
+    SIM_CHECK_EQUAL(2, callback_order[2]);
+    SIM_CHECK_EQUAL(0, memcmp(&slave_model.registers[0x10], tx, sizeof(tx)));
+    SIM_CHECK_EQUAL(0, memcmp(&slave_model.registers[0x20], tx, sizeof(tx)));
+    SIM_CHECK_EQUAL(0, slave_model.registers[0x00]);
+    irq_enable(IRQ_I2C1M + I2C2, IRQ_DISABLED);
+    irq_enable(IRQ_I2C1B + I2C2, IRQ_DISABLED);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_write_burst);
+    SIM_TEST_RUN(test_read_repeated_start);
+    SIM_TEST_RUN(test_nack);
+    SIM_TEST_RUN(test_bus_collision);
+    SIM_TEST_END();
+}
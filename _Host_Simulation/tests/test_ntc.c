@@ -0,0 +1,89 @@
+/*********************************************************************
+*	Host simulation - utilities NTC (table of the ADC codes)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Compared to the beta equation (exact ADC code) from -40 to 200 C and
+*   to the former float formula (sim_reference.h) on the 10 bits codes.
+*********************************************************************/
+
+#include <math.h>
+#include "sim_test.h"
+#include "sim_reference.h"
+
+#define NTC_T0          25
+#define NTC_R0          10000
+#define NTC_B           3380
+
+NTC_DEF(ntc, AN1, NTC_T0, NTC_R0, NTC_B);
+
+// ADC code (x64) of the divider for a temperature (beta equation).
+static uint16_t beta_code_x64(double temperature)
+{
+    double r = NTC_R0 * exp(NTC_B * (1.0 / (temperature + 273.15) - 1.0 / (NTC_T0 + 273.15)));
+    return (uint16_t) (1024.0 * 64.0 * r / (r + NTC_PULL_RESISTOR_DEFAULT) + 0.5);
+}
+
+// Sweep by 0.01 C: error of the table and of the interpolation < 0.2 C.
+static void test_sweep(void)
+{
+    double error, max_error = 0.0, max_error_temperature = 0.0;
+    int32_t centi;
+
+    for (centi = NTC_TABLE_T_MIN * 100 ; centi <= NTC_TABLE_T_MAX * 100 ; centi++)
+    {
+        error = fabs((fu_ntc_code_to_centi(&ntc, beta_code_x64(centi / 100.0)) - centi) / 100.0);
+        if (error > max_error)
+        {
+            max_error = error;
+            max_error_temperature = centi / 100.0;
+        }
+    }
+    SIM_CHECK(max_error < 0.2);
+    printf("    beta equation: max error %.2f C at %.2f C\n", max_error, max_error_temperature);
+}
+
+// 10 bits codes (one acquisition) in the range of the table.
+static void test_vs_former(void)
+{
+    double error, max_error = 0.0;
+    uint16_t code;
+    float former;
+
+    for (code = 1 ; code < 1024 ; code++)
+    {
+        former = reference_ntc_temperature(code, NTC_T0, NTC_R0, NTC_B);
+        if ((former >= NTC_TABLE_T_MIN) && (former <= NTC_TABLE_T_MAX))
+        {
+            error = fabs(fu_ntc_code_to_centi(&ntc, code << 6) / 100.0 - former);
+            (error > max_error) ? (max_error = error) : 0;
+        }
+    }
+    SIM_CHECK(max_error < 0.2);
+    printf("    former float formula: max difference %.2f C\n", max_error);
+}
+
+// The temperature decreases with the code over the whole range (x64).
+static void test_monotonic(void)
+{
+    int32_t centi, previous = fu_ntc_code_to_centi(&ntc, 0);
+    uint32_t code, failures = 0;
+
+    for (code = 1 ; code <= 0xffff ; code++)
+    {
+        centi = fu_ntc_code_to_centi(&ntc, code);
+        failures += (centi > previous);
+        previous = centi;
+    }
+    SIM_CHECK_EQUAL(0, failures);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_sweep);
+    SIM_TEST_RUN(test_vs_former);
+    SIM_TEST_RUN(test_monotonic);
+    SIM_TEST_END();
+}
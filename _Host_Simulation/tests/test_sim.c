@@ -0,0 +1,123 @@
+/*********************************************************************
+*	Host simulation - checks of the models used by the other tests
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include "sim_test.h"
+
+static uint32_t timer2_events = 0;
+static bool is_chip_select_low = true;
+
+static void timer2_event(uint8_t id)
+{
+    timer2_events++;
+}
+
+static void timer2_isr(void)
+{
+    irq_clr_flag(IRQ_T2);
+    timer_interrupt_handler(TIMER2);
+}
+
+static uint32_t spi_device_not(void *p_context, uint32_t tx, uint8_t width)
+{
+    is_chip_select_low &= !sim_port_get_output(bRA, 0);
+    return (~tx) & 0xff;
+}
+
+// TMR1 (PBCLK / 8) wraps every 6.5 ms: the tick must follow the time when
+// it is read more often than that (the overflows are claimed by the reader).
+static void test_tick_follows_tmr1(void)
+{
+    uint64_t tick = timer_get_tick();
+    uint64_t delta;
+    uint8_t i;
+
+    for (i = 0 ; i < 100 ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        timer_get_tick();
+    }
+    delta = timer_get_tick() - tick;
+    SIM_CHECK(delta >= TICK_100MS);
+    SIM_CHECK(delta < TICK_100MS + TICK_1MS);
+}
+
+static void test_set_clr_inv_registers(void)
+{
+    LATA = 0;
+    LATASET = 0x0005;
+    LATAINV = 0x0003;
+    LATACLR = 0x0004;
+    SIM_CHECK_EQUAL(0x0002, LATA);
+}
+
+// The handler attached to IRQ_T2 (IrqTab) runs when the flag, the enable
+// bit and the priority allow it.
+static void test_irq_dispatch(void)
+{
+    uint32_t status;
+
+    timer2_events = 0;
+    sim_irq_attach(IRQ_T2, timer2_isr);
+    timer_init_2345_us(TIMER2, timer2_event, TMR_ON, 1000);
+    IRQInit(IRQ_T2, IRQ_ENABLED, IRQ_PRIORITY_LEVEL_3, IRQ_SUB_PRIORITY_LEVEL_0);
+
+    sim_advance(SIM_MS(10) + SIM_US(10));
+    SIM_CHECK_EQUAL(10, timer2_events);
+
+    status = __builtin_disable_interrupts();
+    sim_advance(SIM_MS(5));
+    SIM_CHECK_EQUAL(10, timer2_events);
+    SIM_CHECK(irq_get_flag(IRQ_T2));
+    if (status & 0x00000001)
+    {
+        __builtin_enable_interrupts();
+    }
+    SIM_CHECK_EQUAL(11, timer2_events);
+}
+
+// A transfer of the queue (DMA channels 0 & 4) through SpiModules[SPI1].
+static void test_spi_transfer(void)
+{
+    _IO chip_select = {bRA, 0};
+    uint8_t tx[16], rx[16];
+    uint64_t start;
+    uint8_t i;
+
+    for (i = 0 ; i < sizeof(tx) ; i++)
+    {
+        tx[i] = i * 17;
+    }
+    memset(rx, 0, sizeof(rx));
+    is_chip_select_low = true;
+    sim_spi_attach(SPI1, spi_device_not, NULL);
+    SPIInit(SPI1, 10000000, SPI_CONF_MSTEN | SPI_CONF_SMP_MIDDLE | SPI_CONF_CKE_ON | SPI_CONF_MODE8 | SPI_CONF_ON);
+    SPIInitIOAsChipSelect(chip_select);
+    spi_queue_init(SPI1, IRQ_PRIORITY_DISABLED);
+
+    start = sim_now();
+    while (SPIWriteAndStoreByteArray(SPI1, chip_select, tx, rx, sizeof(tx)));
+
+    for (i = 0 ; i < sizeof(tx) ; i++)
+    {
+        SIM_CHECK_EQUAL((uint8_t) ~tx[i], rx[i]);
+    }
+    SIM_CHECK_EQUAL(sizeof(tx), sim_spi_get_word_count(SPI1));
+    SIM_CHECK(is_chip_select_low);
+    SIM_CHECK(sim_port_get_output(bRA, 0));
+    // 128 bits at 10 MHz.
+    SIM_CHECK(sim_now() - start >= SIM_US(128) / 10);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_tick_follows_tmr1);
+    SIM_TEST_RUN(test_set_clr_inv_registers);
+    SIM_TEST_RUN(test_irq_dispatch);
+    SIM_TEST_RUN(test_spi_transfer);
+    SIM_TEST_END();
+}
@@ -0,0 +1,376 @@
+/*********************************************************************
+*	Host simulation - s23_spi (transaction queue, segments) and e_25lc512
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+
+#define SPI_TEST_FREQ           10000000
+#define SPI_TEST_CONFIG         (SPI_CONF_MSTEN | SPI_CONF_SMP_MIDDLE | SPI_CONF_CKE_ON | SPI_CONF_MODE8 | SPI_CONF_ON)
+
+/*******************************************************************************
+ * Devices
+ ******************************************************************************/
+typedef struct
+{
+    uint8_t     chip_select[64];        // Chip select low for each word (0xff: none or more than one)
+    uint32_t    count;
+} SPI_TEST_BUS_LOG;
+
+static SPI_TEST_BUS_LOG bus_log;
+static uint8_t callback_order[3];
+static uint8_t callback_count = 0;
+static uint32_t chip_select_falls = 0;
+static uint32_t dma_isr_count = 0;
+
+// Returns the index of the word in the transaction and logs the chip select
+// asserted (RA0..RA2).
+static uint32_t spi_device_counter(void *p_context, uint32_t tx, uint8_t width)
+{
+    uint8_t i, low = 0xff, number_of_low = 0;
+
+    for (i = 0 ; i < 3 ; i++)
+    {
+        if (!sim_port_get_output(bRA, i))
+        {
+            low = i;
+            number_of_low++;
+        }
+    }
+    if (bus_log.count < sizeof(bus_log.chip_select))
+    {
+        bus_log.chip_select[bus_log.count] = (number_of_low == 1) ? low : 0xff;
+    }
+    return (bus_log.count++) & 0xff;
+}
+
+static void chip_select_watch(void *p_context, bool level)
+{
+    if (!level)
+    {
+        chip_select_falls++;
+    }
+}
+
+static void transfer_done(void *p_context)
+{
+    callback_order[callback_count++ % 3] = (uint8_t) (uintptr_t) p_context;
+}
+
+static void dma5_isr(void)
+{
+    dma_isr_count++;
+    spi_dma_interrupt_handler(SPI2);
+}
+
+static void spi_test_init(IRQ_PRIORITY priority)
+{
+    _IO chip_select[3] = {{bRA, 0}, {bRA, 1}, {bRA, 2}};
+    uint8_t i;
+
+    memset(&bus_log, 0, sizeof(bus_log));
+    callback_count = 0;
+    chip_select_falls = 0;
+    dma_isr_count = 0;
+    sim_spi_attach(SPI2, spi_device_counter, NULL);
+    SPIInit(SPI2, SPI_TEST_FREQ, SPI_TEST_CONFIG);
+    for (i = 0 ; i < 3 ; i++)
+    {
+        SPIInitIOAsChipSelect(chip_select[i]);
+    }
+    spi_queue_init(SPI2, priority);
+}
+
+/*******************************************************************************
+ * 25LC512 model: instructions, status register, 128 bytes pages and write
+ * time (WIP).
+ ******************************************************************************/
+typedef struct
+{
+    uint8_t     memory[0x10000];
+    uint8_t     instruction;
+    uint16_t    address;
+    uint32_t    index;
+    bool        wel;
+    uint8_t     bp;
+    uint64_t    busy_until;
+    uint32_t    wren_count;
+    uint32_t    rdsr_count;
+    uint32_t    wrsr_count;
+    uint32_t    rejected_count;     // Write / erase without WEL or while busy
+} SIM_25LC512;
+
+static SIM_25LC512 eeprom_model;
+
+static bool eeprom_is_busy(void)
+{
+    return sim_now() < eeprom_model.busy_until;
+}
+
+static uint32_t spi_device_25lc512(void *p_context, uint32_t tx, uint8_t width)
+{
+    SIM_25LC512 *p = (SIM_25LC512 *) p_context;
+    uint32_t rx = 0xff;
+
+    if (p->index == 0)
+    {
+        p->instruction = (uint8_t) tx;
+        if (p->instruction == _25LC512_INST_RDSR)
+        {
+            p->rdsr_count++;
+        }
+    }
+    else
+    {
+        switch (p->instruction)
+        {
+            case _25LC512_INST_RDSR:
+                rx = (p->wel ? 0x02 : 0x00) | (eeprom_is_busy() ? 0x01 : 0x00) | p->bp;
+                break;
+            case _25LC512_INST_WRSR:
+                if (p->index == 1)
+                {
+                    p->bp = tx & 0x0c;
+                }
+                break;
+            case _25LC512_INST_READ:
+            case _25LC512_INST_WRITE:
+                if (p->index < 3)
+                {
+                    p->address = (p->address << 8) | (tx & 0xff);
+                }
+                else if (p->instruction == _25LC512_INST_READ)
+                {
+                    rx = p->memory[p->address++];
+                }
+                else if (p->wel && !eeprom_is_busy())
+                {
+                    p->memory[p->address] = (uint8_t) tx;
+                    p->address = (p->address & ~0x7f) | ((p->address + 1) & 0x7f);
+                }
+                break;
+        }
+    }
+    p->index++;
+    return rx;
+}
+
+static void eeprom_chip_select_watch(void *p_context, bool level)
+{
+    SIM_25LC512 *p = (SIM_25LC512 *) p_context;
+
+    if (!level)
+    {
+        p->index = 0;
+        p->address = 0;
+        return;
+    }
+    switch (p->instruction)
+    {
+        case _25LC512_INST_WREN:
+            p->wel = true;
+            p->wren_count++;
+            break;
+        case _25LC512_INST_WRSR:
+            p->wrsr_count++;
+            p->wel = false;
+            break;
+        case _25LC512_INST_WRITE:
+        case _25LC512_INST_CHIP_ERASE:
+            if (!p->wel || eeprom_is_busy())
+            {
+                p->rejected_count++;
+                break;
+            }
+            if (p->instruction == _25LC512_INST_CHIP_ERASE)
+            {
+                memset(p->memory, 0xff, sizeof(p->memory));
+            }
+            p->wel = false;
+            p->busy_until = sim_now() + SIM_US(500);
+            break;
+    }
+}
+
+static void eeprom_run(_25LC512_CONFIG *var)
+{
+    uint32_t guard = 0;
+
+    while (var->spi_params.flags && (guard++ < 100000))
+    {
+        var->spi_params.bus_management_params.is_running = true;
+        e_25lc512_deamon(var);
+        sim_advance(SIM_US(10));
+    }
+    SIM_CHECK_EQUAL(0, var->spi_params.flags);
+}
+
+/*******************************************************************************
+ * Tests
+ ******************************************************************************/
+// 3 transfers submitted back to back on 3 devices (DMA interruption): they
+// are sent in order, one chip select at a time, and their callbacks are
+// called in the same order.
+static void test_queue_order(void)
+{
+    static uint8_t tx[3][8];
+    static uint8_t rx[3][8];
+    SPI_TRANSFER_DEF(transfer0, __PA0, SPI_CONF_MODE8 | SPI_CONF_CKE_ON, 0, tx[0], rx[0], 8, transfer_done, (void *) 0);
+    SPI_TRANSFER_DEF(transfer1, __PA1, SPI_CONF_MODE8 | SPI_CONF_CKE_ON, 0, tx[1], rx[1], 8, transfer_done, (void *) 1);
+    SPI_TRANSFER_DEF(transfer2, __PA2, SPI_CONF_MODE8 | SPI_CONF_CKE_ON, 0, tx[2], rx[2], 8, transfer_done, (void *) 2);
+    uint64_t start;
+    uint32_t i;
+
+    spi_test_init(IRQ_PRIORITY_LEVEL_3);
+    sim_irq_attach(IRQ_DMA4 + SPI2, dma5_isr);
+
+    start = sim_now();
+    SIM_CHECK(spi_transfer_submit(SPI2, &transfer0));
+    SIM_CHECK(spi_transfer_submit(SPI2, &transfer1));
+    SIM_CHECK(spi_transfer_submit(SPI2, &transfer2));
+    SIM_CHECK(!spi_transfer_submit(SPI2, &transfer1));     // Already pending
+    while (!spi_queue_is_idle(SPI2) && (sim_now() - start < SIM_MS(1)))
+    {
+        sim_advance(SIM_US(1));
+    }
+
+    SIM_CHECK(spi_queue_is_idle(SPI2));
+    SIM_CHECK_EQUAL(3, dma_isr_count);
+    SIM_CHECK_EQUAL(3, callback_count);
+    SIM_CHECK_EQUAL(0, callback_order[0]);
+    SIM_CHECK_EQUAL(1, callback_order[1]);
+    SIM_CHECK_EQUAL(2, callback_order[2]);
+    SIM_CHECK_EQUAL(24, bus_log.count);
+    for (i = 0 ; i < 24 ; i++)
+    {
+        SIM_CHECK_EQUAL(i / 8, bus_log.chip_select[i]);
+    }
+    for (i = 0 ; i < 8 ; i++)
+    {
+        SIM_CHECK_EQUAL(16 + i, rx[2][i]);
+    }
+    // 192 bits at 10 MHz, the transfers are chained by the ISR.
+    SIM_CHECK(sim_now() - start >= SIM_US(192) / 10);
+    SIM_CHECK(sim_now() - start < SIM_US(192) / 10 + SIM_US(20));
+    irq_enable(IRQ_DMA4 + SPI2, IRQ_DISABLED);
+}
+
+// A header and a payload in a single chip select assertion (polling).
+static void test_segments(void)
+{
+    _IO chip_select = {bRA, 1};
+    uint8_t header[3] = {0x03, 0x12, 0x34};
+    uint8_t payload[5] = {0};
+    SPI_SEGMENT segments[2] =
+    {
+        SPI_SEGMENT_INSTANCE(header, NULL, 3),
+        SPI_SEGMENT_INSTANCE(NULL, payload, 5)
+    };
+    uint32_t i, guard = 0;
+
+    spi_test_init(IRQ_PRIORITY_DISABLED);
+    sim_port_watch(bRA, 1, chip_select_watch, NULL);
+    while (SPIWriteAndStoreSegments(SPI2, chip_select, segments, 2) && (guard++ < 10000));
+
+    SIM_CHECK_EQUAL(1, chip_select_falls);
+    // The 0xff of a reception only segment are sent ahead (SPIxBUF + shift
+    // register): up to 2 extra clocks before the release of the chip select.
+    SIM_CHECK(bus_log.count >= 8);
+    SIM_CHECK(bus_log.count <= 10);
+    for (i = 0 ; i < 5 ; i++)
+    {
+        SIM_CHECK_EQUAL(3 + i, payload[i]);
+    }
+    SIM_CHECK(sim_port_get_output(bRA, 1));
+}
+
+// An invalid transfer is reported (not as completed) and does not block the
+// next one.
+static void test_rejected_transfer(void)
+{
+    _IO chip_select = {bRA, 0};
+    uint8_t tx[4] = {1, 2, 3, 4};
+    SPI_SEGMENT segments[2] =
+    {
+        SPI_SEGMENT_INSTANCE(tx, NULL, 4),
+        SPI_SEGMENT_INSTANCE(tx, NULL, 0)
+    };
+    uint32_t guard = 0;
+
+    spi_test_init(IRQ_PRIORITY_DISABLED);
+    SIM_CHECK_EQUAL(SPI_TRANSFER_REJECTED, SPIWriteAndStoreByteArray(SPI2, chip_select, tx, NULL, 0));
+    SIM_CHECK_EQUAL(SPI_TRANSFER_REJECTED, SPIWriteAndStoreByteArray(SPI2, chip_select, NULL, NULL, 4));
+    SIM_CHECK_EQUAL(SPI_TRANSFER_REJECTED, SPIWriteAndStoreSegments(SPI2, chip_select, segments, 2));
+    SIM_CHECK_EQUAL(0, bus_log.count);
+    SIM_CHECK(spi_queue_is_idle(SPI2));
+
+    while (SPIWriteAndStoreByteArray(SPI2, chip_select, tx, NULL, 4) && (guard++ < 10000));
+    SIM_CHECK_EQUAL(4, bus_log.count);
+}
+
+// Write of 150 bytes across a page boundary, read back: the status
+// register, WREN and WRSR go through the queue (8 bits mode kept).
+static void test_25lc512_write_read(void)
+{
+    _25LC512_DEF(eeprom, SPI2, __PD3, TICK_20MS, 150, 150);
+    uint32_t i;
+
+    memset(&eeprom_model, 0, sizeof(eeprom_model));
+    memset(eeprom_model.memory, 0xff, sizeof(eeprom_model.memory));
+    eeprom_model.bp = _25LC512_ENABLE_SECTOR0123_PROTECTION;
+    sim_spi_attach(SPI2, spi_device_25lc512, &eeprom_model);
+    sim_port_watch(bRD, 3, eeprom_chip_select_watch, &eeprom_model);
+    SPIInit(SPI2, SPI_TEST_FREQ, SPI_TEST_CONFIG);
+    spi_queue_init(SPI2, IRQ_PRIORITY_DISABLED);
+
+    SET_BIT(eeprom.spi_params.flags, SM_25LC512_WRITE_STATUS_REGISTER);
+    eeprom_run(&eeprom);
+    SIM_CHECK_EQUAL(1, eeprom_model.wrsr_count);
+    SIM_CHECK_EQUAL(_25LC512_DISABLE_ALL_SECTOR_PROTECTION, eeprom_model.bp);
+
+    eeprom.registers.dW.size = 150;
+    for (i = 0 ; i < 150 ; i++)
+    {
+        eeprom.registers.dW.p[i] = (uint8_t) (i * 7 + 1);
+    }
+    e_25lc512_write_bytes(eeprom, 100);
+    eeprom_run(&eeprom);
+    for (i = 0 ; i < 150 ; i++)
+    {
+        SIM_CHECK_EQUAL((uint8_t) (i * 7 + 1), eeprom_model.memory[100 + i]);
+    }
+    SIM_CHECK_EQUAL(0xff, eeprom_model.memory[99]);
+    SIM_CHECK_EQUAL(0xff, eeprom_model.memory[250]);
+    // 2 pages: one WREN each, the status is polled during the write time.
+    SIM_CHECK_EQUAL(2, eeprom_model.wren_count);
+    SIM_CHECK(eeprom_model.rdsr_count > 3);
+    SIM_CHECK_EQUAL(0, eeprom_model.rejected_count);
+
+    e_25lc512_read_bytes(eeprom, 100, 150);
+    eeprom_run(&eeprom);
+    for (i = 0 ; i < 150 ; i++)
+    {
+        SIM_CHECK_EQUAL((uint8_t) (i * 7 + 1), eeprom.registers.dR.p[i]);
+    }
+
+    e_25lc512_chip_erase(eeprom);
+    eeprom_run(&eeprom);
+    SIM_CHECK_EQUAL(3, eeprom_model.wren_count);
+    SIM_CHECK_EQUAL(0xff, eeprom_model.memory[100]);
+    SIM_CHECK_EQUAL(0, eeprom_model.rejected_count);
+
+    SIM_CHECK_EQUAL(0, SPI2CON & (SPI_CONF_MODE16 | SPI_CONF_MODE32));
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_queue_order);
+    SIM_TEST_RUN(test_segments);
+    SIM_TEST_RUN(test_rejected_transfer);
+    SIM_TEST_RUN(test_25lc512_write_read);
+    SIM_TEST_END();
+}
@@ -0,0 +1,98 @@
+/*********************************************************************
+*	Host simulation - s35_ethernet TCP FIFO pool (TCPOpenEx)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*
+*   Default pool: TCP_PIC_RAM_SIZE = MAX_TCP_SOCKETS * (200 + 500 + 2).
+*********************************************************************/
+
+#include "sim_test.h"
+
+static uint8_t frame[1536];
+
+// Link up and TX drained: TCPClose sends a RST (MACIsTxReady waits the wire).
+static void tcp_init(void)
+{
+    uint32_t i;
+
+    ETH_StackInit((BYTE*) "02:00:00:00:00:01", (BYTE*) "192.168.1.10", FALSE);
+    for (i = 0 ; i < 10 ; i++)
+    {
+        sim_advance(SIM_MS(1));
+        mGetTick();
+        ETH_StackTask();
+    }
+    while (sim_eth_get_tx(frame, sizeof(frame)));
+}
+
+// No window scaling: the FIFOs are limited to TCP_MAX_FIFO_SIZE bytes.
+static void test_fifo_sizes(void)
+{
+    TCP_SOCKET s;
+
+    tcp_init();
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8000, 0, 100));
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8000, 100, 0));
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8000, TCP_MAX_FIFO_SIZE + 1, 100));
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8000, 100, TCP_MAX_FIFO_SIZE + 1));
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8000, 0xFFFF, 0xFFFF));
+
+    s = TCPOpenEx(0, TCP_OPEN_SERVER, 8000, 1, 1);
+    SIM_CHECK(s != INVALID_SOCKET);
+    TCPClose(s);
+}
+
+// The whole pool in one socket, then given back by TCPClose.
+static void test_pool_reuse(void)
+{
+    WORD size = TCP_PIC_RAM_SIZE / 2 - 1;
+    TCP_SOCKET s1, s2;
+
+    tcp_init();
+    s1 = TCPOpenEx(0, TCP_OPEN_SERVER, 8000, size, size);
+    SIM_CHECK(s1 != INVALID_SOCKET);
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8001, 1, 1));
+    TCPClose(s1);
+
+    s1 = TCPOpen(0, TCP_OPEN_SERVER, 8000);
+    s2 = TCPOpenEx(0, TCP_OPEN_SERVER, 8001, size, size);
+    SIM_CHECK(s1 != INVALID_SOCKET);
+    SIM_CHECK_EQUAL(INVALID_SOCKET, s2);
+    TCPClose(s1);
+    s2 = TCPOpenEx(0, TCP_OPEN_SERVER, 8001, size, size);
+    SIM_CHECK(s2 != INVALID_SOCKET);
+    TCPClose(s2);
+}
+
+// First fit: the block of a closed socket between two opened ones is used
+// again by a socket of the same size.
+static void test_first_fit(void)
+{
+    TCP_SOCKET s[MAX_TCP_SOCKETS];
+    uint32_t i;
+
+    tcp_init();
+    for (i = 0 ; i < MAX_TCP_SOCKETS ; i++)
+    {
+        s[i] = TCPOpen(0, TCP_OPEN_SERVER, 8000 + i);
+        SIM_CHECK(s[i] != INVALID_SOCKET);
+    }
+    TCPClose(s[1]);
+    SIM_CHECK_EQUAL(INVALID_SOCKET, TCPOpenEx(0, TCP_OPEN_SERVER, 8001, TCP_SOCKET_TX_BUFFER_SIZE + 1, TCP_SOCKET_RX_BUFFER_SIZE));
+    s[1] = TCPOpen(0, TCP_OPEN_SERVER, 8001);
+    SIM_CHECK(s[1] != INVALID_SOCKET);
+    for (i = 0 ; i < MAX_TCP_SOCKETS ; i++)
+    {
+        TCPClose(s[i]);
+    }
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_fifo_sizes);
+    SIM_TEST_RUN(test_pool_reuse);
+    SIM_TEST_RUN(test_first_fit);
+    SIM_TEST_END();
+}
@@ -0,0 +1,137 @@
+/*********************************************************************
+*	Host simulation - s14_timers (64 bits tick, deadlines)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include "sim_test.h"
+
+static volatile uint64_t isr_tick = 0;
+static volatile uint64_t main_tick = 0;
+static volatile uint32_t backward_count = 0;
+static volatile uint32_t isr_count = 0;
+
+static void timer2_isr(void)
+{
+    uint64_t tick;
+
+    irq_clr_flag(IRQ_T2);
+    tick = timer_get_tick();
+    if ((tick < isr_tick) || (tick < main_tick))
+    {
+        backward_count++;
+    }
+    isr_tick = tick;
+    isr_count++;
+}
+
+// Ticks of TIMER1 (PBCLK / 8) since the reset of the simulation.
+static uint64_t expected_tick(void)
+{
+    return sim_now() / 8;
+}
+
+// The main loop of the application reads the tick more often than the
+// period of TMR1 (6.5 ms).
+static void advance_ms(uint32_t ms)
+{
+    while (ms--)
+    {
+        sim_advance(SIM_MS(1));
+        timer_get_tick();
+    }
+}
+
+// The main loop and an ISR firing every 2 us (in the middle of the snapshots
+// of the main loop) read the tick across 3 wraps of TMR1.
+static void test_tick_is_monotonic_under_preemption(void)
+{
+    uint64_t tick, previous_isr_tick, start = timer_get_tick();
+
+    isr_tick = start;
+    main_tick = start;
+    backward_count = 0;
+    isr_count = 0;
+    sim_set_access_cost(8);
+    sim_irq_attach(IRQ_T2, timer2_isr);
+    timer_init_2345_us(TIMER2, NULL, TMR_ON, 2);
+    IRQInit(IRQ_T2, IRQ_ENABLED, IRQ_PRIORITY_LEVEL_5, IRQ_SUB_PRIORITY_LEVEL_0);
+
+    while (sim_now() < SIM_MS(20))
+    {
+        previous_isr_tick = isr_tick;
+        tick = timer_get_tick();
+        if ((tick < main_tick) || (tick < previous_isr_tick))
+        {
+            backward_count++;
+        }
+        main_tick = tick;
+    }
+    irq_enable(IRQ_T2, IRQ_DISABLED);
+    sim_set_access_cost(2);
+
+    SIM_CHECK(isr_count > 9000);
+    SIM_CHECK_EQUAL(0, backward_count);
+    // No overflow lost or counted twice (the tick is TMR1 extended).
+    tick = timer_get_tick() - start;
+    SIM_CHECK(tick + 4 >= expected_tick());
+    SIM_CHECK(tick <= expected_tick());
+}
+
+// The overflow pending when TMR1 is read is accounted once.
+static void test_tick_at_the_wrap(void)
+{
+    uint64_t before, after;
+
+    sim_advance((0x10000 - 2) * 8);
+    before = timer_get_tick();
+    sim_advance(4 * 8);
+    SIM_CHECK(irq_get_flag(IRQ_T1));
+    after = timer_get_tick();
+    SIM_CHECK(!irq_get_flag(IRQ_T1));
+    SIM_CHECK(after > before);
+    SIM_CHECK(after - before < 16);
+}
+
+static void test_deadline(void)
+{
+    tick_deadline_t deadline;
+    uint32_t count = 0;
+
+    timer_deadline_arm(&deadline, TICK_10MS);
+    SIM_CHECK(!timer_deadline_is_expired(&deadline));
+    SIM_CHECK(timer_deadline_get_remaining(&deadline) > TICK_10MS - TICK_1MS / 10);
+    advance_ms(5);
+    SIM_CHECK(!timer_deadline_check_and_rearm(&deadline));
+    advance_ms(5);
+    SIM_CHECK(timer_deadline_is_expired(&deadline));
+    SIM_CHECK_EQUAL(0, timer_deadline_get_remaining(&deadline));
+
+    // Periodic: no drift over 100 periods polled every 1 ms.
+    timer_deadline_arm(&deadline, TICK_10MS);
+    while (sim_now() < SIM_MS(10) + SIM_MS(1000) + SIM_US(500))
+    {
+        advance_ms(1);
+        if (timer_deadline_check_and_rearm(&deadline))
+        {
+            count++;
+        }
+    }
+    SIM_CHECK_EQUAL(100, count);
+
+    // Late by more than one period: the missed periods are skipped.
+    advance_ms(35);
+    SIM_CHECK(timer_deadline_check_and_rearm(&deadline));
+    SIM_CHECK(!timer_deadline_check_and_rearm(&deadline));
+    SIM_CHECK(timer_deadline_get_remaining(&deadline) > TICK_10MS - TICK_1MS);
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_tick_is_monotonic_under_preemption);
+    SIM_TEST_RUN(test_tick_at_the_wrap);
+    SIM_TEST_RUN(test_deadline);
+    SIM_TEST_END();
+}
@@ -0,0 +1,288 @@
+/*********************************************************************
+*	Host simulation - e_ws2812b (frame synchronous rendering, dirty ranges)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+
+#define WS_TEST_LEDS            60
+#define WS_TEST_FRAMES          48
+
+// Frames received by the strip (SDO of SPI1, a frame by chip select assertion).
+static uint8_t ws_frames[WS_TEST_FRAMES][WS_TEST_LEDS * WS2812B_BYTES_PER_LED];
+static uint32_t ws_frame_sizes[WS_TEST_FRAMES];
+static uint32_t ws_number_of_frames = 0;
+
+static uint32_t ws_device(void *p_context, uint32_t tx, uint8_t width)
+{
+    uint32_t frame = ws_number_of_frames - 1;
+
+    if ((ws_number_of_frames > 0) && (frame < WS_TEST_FRAMES) && (ws_frame_sizes[frame] < sizeof(ws_frames[0])))
+    {
+        ws_frames[frame][ws_frame_sizes[frame]++] = (uint8_t) tx;
+    }
+    return 0;
+}
+
+static void ws_chip_select_watch(void *p_context, bool level)
+{
+    if (!level)
+    {
+        ws_number_of_frames++;
+    }
+}
+
+static void ws_test_init(void)
+{
+    memset(ws_frames, 0, sizeof(ws_frames));
+    memset(ws_frame_sizes, 0, sizeof(ws_frame_sizes));
+    ws_number_of_frames = 0;
+    sim_spi_attach(SPI1, ws_device, NULL);
+    sim_port_watch(bRA, 0, ws_chip_select_watch, NULL);
+    SPIInit(SPI1, 2400000, SPI_CONF_MSTEN | SPI_CONF_SMP_MIDDLE | SPI_CONF_CKE_ON | SPI_CONF_MODE8 | SPI_CONF_ON);
+    spi_queue_init(SPI1, IRQ_PRIORITY_DISABLED);
+}
+
+// Runs the daemon until number_of_frames frames have been completely sent.
+static void ws_flush_frames(WS2812B_PARAMS *var, uint32_t number_of_frames)
+{
+    uint32_t guard = 0;
+
+    while (number_of_frames && (guard++ < 100000))
+    {
+        if (!eWS2812BFlush(0, var))
+        {
+            number_of_frames--;
+        }
+        sim_advance(SIM_US(50));
+    }
+    SIM_CHECK_EQUAL(0, number_of_frames);
+}
+
+// Color (0..255 levels) of a LED in a received frame: the data bit is the
+// middle one of each group of 3 SPI bits (0: 100, 1: 110), GRB order.
+static RGB_COLOR ws_decode(uint32_t frame, uint16_t led)
+{
+    const uint8_t *p = &ws_frames[frame][led * WS2812B_BYTES_PER_LED];
+    uint8_t channel[3] = {0};
+    uint32_t i, bit;
+
+    for (i = 0 ; i < 24 ; i++)
+    {
+        bit = i * 3 + 1;
+        channel[i / 8] = (channel[i / 8] << 1) | ((p[bit / 8] >> (7 - (bit % 8))) & 1);
+    }
+    return (RGB_COLOR) {.red = channel[1], .green = channel[0], .blue = channel[2]};
+}
+
+static bool ws_is_equal(RGB_COLOR a, RGB_COLOR b)
+{
+    return (a.red == b.red) && (a.green == b.green) && (a.blue == b.blue);
+}
+
+static RGB_COLOR ws_level(TSV_COLOR tsv)
+{
+    return color_rgb_to_level(color_tsv_to_rgb(tsv));
+}
+
+// A triangle effect on all the LEDs: each frame shows all the LEDs at the
+// same step (the effects of a frame are evaluated at the same time).
+static void test_frame_is_synchronous(void)
+{
+    WS2812B_DEF(leds, SPI1, __PA0, WS_TEST_LEDS, WS_TEST_LEDS);
+    uint32_t frame, distinct = 0;
+    uint16_t led;
+    uint8_t previous = 0;
+
+    ws_test_init();
+    ws2812b_put_color_effect(leds, 0, LED_ALL, COLOR_BLUE, WS2812B_EFFECT_TRIANGLE, WS2812B_REPETITION_INFINITE, TICK_20MS);
+    ws_flush_frames(&leds, 40);
+
+    SIM_CHECK(ws_number_of_frames >= 40);
+    for (frame = 0 ; frame < 40 ; frame++)
+    {
+        SIM_CHECK_EQUAL(WS_TEST_LEDS * WS2812B_BYTES_PER_LED, ws_frame_sizes[frame]);
+        for (led = 1 ; led < WS_TEST_LEDS ; led++)
+        {
+            if (!ws_is_equal(ws_decode(frame, 0), ws_decode(frame, led)))
+            {
+                SIM_CHECK_EQUAL(ws_decode(frame, 0).blue, ws_decode(frame, led).blue);
+                break;
+            }
+        }
+        if (ws_decode(frame, 0).blue != previous)
+        {
+            distinct++;
+            previous = ws_decode(frame, 0).blue;
+        }
+    }
+    // The effect is running (a frame every 1.85 ms, 20 ms period).
+    SIM_CHECK(distinct > 20);
+}
+
+// A modification of a segment is sent in the next frames, a frame being
+// sent is never modified and the LEDs out of the modified range are not
+// encoded again.
+static void test_only_dirty_leds_are_encoded(void)
+{
+    WS2812B_DEF(leds, SPI1, __PA0, WS_TEST_LEDS, 20, 40, WS_TEST_LEDS);
+    uint32_t frame, first_red = 0;
+    uint16_t led;
+
+    ws_test_init();
+    ws2812b_put_color(leds, 0, LED_ALL, COLOR_WHITE);
+    ws2812b_put_color(leds, 1, LED_ALL, COLOR_WHITE);
+    ws2812b_put_color(leds, 2, LED_ALL, COLOR_WHITE);
+    ws_flush_frames(&leds, 3);
+    for (led = 0 ; led < WS_TEST_LEDS ; led++)
+    {
+        SIM_CHECK(ws_is_equal(ws_level(COLOR_WHITE), ws_decode(2, led)));
+    }
+
+    // LED 5 is not modified: its bytes must not be written again.
+    memset(&leds.buffer.p[5 * WS2812B_BYTES_PER_LED], 0, WS2812B_BYTES_PER_LED);
+    memset(&leds.p_back_buffer[5 * WS2812B_BYTES_PER_LED], 0, WS2812B_BYTES_PER_LED);
+
+    // Modification while a frame is sent.
+    eWS2812BFlush(0, &leds);
+    SIM_CHECK(leds.is_sending);
+    ws2812b_put_color(leds, 2, LED_ALL, COLOR_RED);
+    ws_flush_frames(&leds, 4);
+
+    SIM_CHECK_EQUAL(7, ws_number_of_frames);
+    for (frame = 3 ; frame < 7 ; frame++)
+    {
+        SIM_CHECK(ws_is_equal(ws_decode(frame, 40), ws_decode(frame, WS_TEST_LEDS - 1)));
+        if (!first_red && ws_is_equal(ws_level(COLOR_RED), ws_decode(frame, 40)))
+        {
+            first_red = frame;
+        }
+        SIM_CHECK(ws_is_equal(ws_level(COLOR_WHITE), ws_decode(frame, 39)));
+        SIM_CHECK_EQUAL(0, ws_frames[frame][5 * WS2812B_BYTES_PER_LED]);
+    }
+    // The frame in progress stays white, the next one is red.
+    SIM_CHECK_EQUAL(4, first_red);
+    SIM_CHECK(ws_is_equal(ws_level(COLOR_RED), ws_decode(6, 59)));
+}
+
+// Segments out of range, empty or ending beyond the LED array are refused
+// (no access to p_effects[] out of the array with one effect by segment).
+static void test_segment_range_checks(void)
+{
+    WS2812B_DEF(leds, SPI1, __PA0, WS_TEST_LEDS, 20, 40, WS_TEST_LEDS);
+    WS2812B_DEF_SEGMENT_EFFECTS(segment_leds, SPI1, __PA0, WS_TEST_LEDS, 20, 20, WS_TEST_LEDS);
+    WS2812B_DEF(short_leds, SPI1, __PA0, 30, 20, WS_TEST_LEDS);
+    WS2812B_DEF(no_segment, SPI1, __PA0, 10);
+    WS2812B_ANIMATION anim;
+
+    ws_test_init();
+    SIM_CHECK_EQUAL(0, ws2812b_put_color(leds, 2, LED_ALL, COLOR_RED));
+    SIM_CHECK_EQUAL(1, ws2812b_put_color(leds, 3, LED_ALL, COLOR_RED));
+    SIM_CHECK_EQUAL(1, ws2812b_put_color_from_to(leds, 2, LED_ALL, COLOR_RED, 0, 20));
+    SIM_CHECK(!eWS2812BIsSegmentUpdated(3, FIRST_LED, LAST_LED, leds));
+
+    // 3 effects for 3 segments, the segment 1 is empty.
+    SIM_CHECK_EQUAL(3, sizeof(segment_leds_effects_ram_allocation) / sizeof(WS2812B_EFFECT));
+    SIM_CHECK_EQUAL(0, ws2812b_put_color_effect(segment_leds, 2, LED_ALL, COLOR_RED, WS2812B_EFFECT_TRIANGLE, 1, TICK_20MS));
+    SIM_CHECK_EQUAL(1, ws2812b_put_color_effect(segment_leds, 1, LED_ALL, COLOR_RED, WS2812B_EFFECT_TRIANGLE, 1, TICK_20MS));
+    SIM_CHECK_EQUAL(1, ws2812b_put_color_effect(segment_leds, 3, LED_ALL, COLOR_RED, WS2812B_EFFECT_TRIANGLE, 1, TICK_20MS));
+    SIM_CHECK(!eWS2812BIsSegmentUpdated(1, FIRST_LED, LAST_LED, segment_leds));
+
+    // The segment 1 ends beyond the 30 LEDs: only 30 LEDs are sent.
+    SIM_CHECK_EQUAL(0, ws2812b_put_color(short_leds, 0, LED_ALL, COLOR_RED));
+    SIM_CHECK_EQUAL(1, ws2812b_put_color(short_leds, 1, LED_ALL, COLOR_RED));
+    ws_flush_frames(&short_leds, 1);
+    SIM_CHECK_EQUAL(30 * WS2812B_BYTES_PER_LED, ws_frame_sizes[0]);
+
+    // No segment: nothing to modify, nothing sent.
+    SIM_CHECK_EQUAL(1, ws2812b_put_color(no_segment, 0, LED_ALL, COLOR_RED));
+    SIM_CHECK(!eWS2812BIsSegmentUpdated(0, FIRST_LED, LAST_LED, no_segment));
+    SIM_CHECK_EQUAL(1, eWS2812BFlush(0, &no_segment));
+    SIM_CHECK_EQUAL(1, ws_number_of_frames);
+
+    // An animation on a segment which does not exist is finished.
+    eWS2812BSetAnimationParams(0, 3, FIRST_LED, LAST_LED, 4, 0, 0, COLOR_RED, COLOR_BLUE, 0, 0, 0, 1, TICK_1MS, TICK_20MS, &anim, leds);
+    SIM_CHECK_EQUAL(0, eWS2812BAnimation(&anim, &leds));
+}
+
+// One effect by segment gives the colours of one effect by LED (both
+// strips rendered in lockstep, the second one on SPI2).
+static void test_segment_effects_match_led_effects(void)
+{
+    WS2812B_DEF(leds, SPI1, __PA0, WS_TEST_LEDS, 20, 40, WS_TEST_LEDS);
+    WS2812B_DEF_SEGMENT_EFFECTS(segment_leds, SPI2, __PA1, WS_TEST_LEDS, 20, 40, WS_TEST_LEDS);
+    uint32_t guard = 0;
+    uint16_t led;
+
+    ws_test_init();
+    SPIInit(SPI2, 2400000, SPI_CONF_MSTEN | SPI_CONF_SMP_MIDDLE | SPI_CONF_CKE_ON | SPI_CONF_MODE8 | SPI_CONF_ON);
+    spi_queue_init(SPI2, IRQ_PRIORITY_DISABLED);
+    ws2812b_put_color(leds, 0, LED_ALL, COLOR_GREEN);
+    ws2812b_put_color(segment_leds, 0, LED_ALL, COLOR_GREEN);
+    ws2812b_put_gradient_effect(leds, 1, LED_ALL, COLOR_RED, COLOR_BLUE, WS2812B_EFFECT_TRIANGLE | WS2812B_RESTORE_COLOR, 2, TICK_20MS);
+    ws2812b_put_gradient_effect(segment_leds, 1, LED_ALL, COLOR_RED, COLOR_BLUE, WS2812B_EFFECT_TRIANGLE | WS2812B_RESTORE_COLOR, 2, TICK_20MS);
+    ws2812b_put_gradient_delay(leds, 2, LED_ALL, COLOR_WHITE, COLOR_PURPLE, TICK_20MS);
+    ws2812b_put_gradient_delay(segment_leds, 2, LED_ALL, COLOR_WHITE, COLOR_PURPLE, TICK_20MS);
+    SIM_CHECK(!eWS2812BIsSegmentUpdated(1, FIRST_LED, LAST_LED, segment_leds));
+
+    while (!(eWS2812BIsSegmentUpdated(1, FIRST_LED, LAST_LED, leds) && eWS2812BIsSegmentUpdated(2, FIRST_LED, LAST_LED, leds)
+            && eWS2812BIsSegmentUpdated(1, FIRST_LED, LAST_LED, segment_leds) && eWS2812BIsSegmentUpdated(2, FIRST_LED, LAST_LED, segment_leds))
+            && (guard++ < 10000))
+    {
+        eWS2812BFlush(0, &leds);
+        eWS2812BFlush(0, &segment_leds);
+        sim_advance(SIM_US(50));
+    }
+    SIM_CHECK(guard < 10000);
+    // One more frame for the last effects (restoration of the colours).
+    ws_flush_frames(&leds, 2);
+    ws_flush_frames(&segment_leds, 2);
+    SIM_CHECK_EQUAL(0, leds.p_output[25].intensity);
+    for (led = 0 ; led < WS_TEST_LEDS ; led++)
+    {
+        SIM_CHECK_EQUAL(leds.p_output[led].shade, segment_leds.p_output[led].shade);
+        SIM_CHECK_EQUAL(leds.p_output[led].saturation, segment_leds.p_output[led].saturation);
+        SIM_CHECK_EQUAL(leds.p_output[led].intensity, segment_leds.p_output[led].intensity);
+    }
+    SIM_CHECK_EQUAL(COLOR_PURPLE.shade, segment_leds.p_output[WS_TEST_LEDS - 1].shade);
+}
+
+// A transition longer than 2^32 ticks (500 s, 100 steps of 5 s).
+static void test_effect_longer_than_32_bits(void)
+{
+    WS2812B_DEF(leds, SPI1, __PA0, 10, 10);
+    uint32_t i;
+
+    // 32 bytes by effect: the RAM figures of e_ws2812b.h.
+    SIM_CHECK_EQUAL(32, sizeof(WS2812B_EFFECT));
+
+    ws_test_init();
+    ws2812b_put_color_delay(leds, 0, LED_ALL, COLOR_WHITE, (uint64_t) TICK_1S * 500);
+    SIM_CHECK(leds.p_effects[0].time_execution == (uint64_t) TICK_1S * 500);
+    ws_flush_frames(&leds, 1);
+
+    // The TIMER1 overflows are counted by the reads of the tick.
+    for (i = 0 ; i < 20000 ; i++)
+    {
+        sim_advance(SIM_MS(5));
+        mGetTick();
+    }
+    ws_flush_frames(&leds, 2);
+    SIM_CHECK(leds.p_output[0].intensity >= 19);
+    SIM_CHECK(leds.p_output[0].intensity <= 21);
+    SIM_CHECK(!eWS2812BIsSegmentUpdated(0, FIRST_LED, LAST_LED, leds));
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_frame_is_synchronous);
+    SIM_TEST_RUN(test_only_dirty_leds_are_encoded);
+    SIM_TEST_RUN(test_segment_range_checks);
+    SIM_TEST_RUN(test_segment_effects_match_led_effects);
+    SIM_TEST_RUN(test_effect_longer_than_32_bits);
+    SIM_TEST_END();
+}
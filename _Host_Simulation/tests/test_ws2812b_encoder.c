@@ -0,0 +1,93 @@
+/*********************************************************************
+*	Host simulation - e_ws2812b_encoder (bit exact with release 1.20)
+*	Author : Sbastien PERREAU
+*
+*	Revision history	:
+*               17/10/2026      - Initial release
+*********************************************************************/
+
+#include <string.h>
+#include "sim_test.h"
+#include "sim_reference.h"
+
+static bool is_same_bitstream(const uint8_t *p_a, const uint8_t *p_b, uint32_t size)
+{
+    return memcmp(p_a, p_b, size) == 0;
+}
+
+// The table gives the mask and shift code for the 256 levels of each channel.
+static void test_encode_level(void)
+{
+    uint8_t expected[WS2812B_BYTES_PER_LED], actual[WS2812B_BYTES_PER_LED];
+    uint32_t level, failures = 0;
+    RGB_COLOR color;
+
+    for (level = 0 ; level < 256 ; level++)
+    {
+        color = (RGB_COLOR) {.red = level, .green = 255 - level, .blue = level ^ 0x5a};
+        reference_ws2812b_encode_level(expected, color);
+        eWS2812BEncodeLevel(actual, color);
+        failures += !is_same_bitstream(expected, actual, WS2812B_BYTES_PER_LED);
+    }
+    SIM_CHECK_EQUAL(0, failures);
+}
+
+// Integer scaling of the percents (0..100) == '*= 2.55' of the target.
+static void test_encode_percent(void)
+{
+    uint8_t expected[WS2812B_BYTES_PER_LED], actual[WS2812B_BYTES_PER_LED];
+    uint32_t red, green, failures = 0;
+    RGB_COLOR color;
+
+    for (red = 0 ; red <= 100 ; red++)
+    {
+        for (green = 0 ; green <= 100 ; green++)
+        {
+            color = (RGB_COLOR) {.red = red, .green = green, .blue = (red + green) % 101};
+            reference_ws2812b_encode_percent(expected, color);
+            eWS2812BEncodePercent(actual, color);
+            failures += !is_same_bitstream(expected, actual, WS2812B_BYTES_PER_LED);
+        }
+    }
+    SIM_CHECK_EQUAL(0, failures);
+}
+
+// The bulk encoding is the one of each LED (intensity 255: no scaling).
+static void test_encode_array(void)
+{
+    static RGB_COLOR colors[300];
+    static uint8_t expected[300 * WS2812B_BYTES_PER_LED], actual[300 * WS2812B_BYTES_PER_LED];
+    uint32_t i;
+
+    for (i = 0 ; i < 300 ; i++)
+    {
+        colors[i] = (RGB_COLOR) {.red = i, .green = i * 7, .blue = i * 13};
+        reference_ws2812b_encode_level(&expected[i * WS2812B_BYTES_PER_LED], colors[i]);
+    }
+    eWS2812BEncodeArray(actual, colors, 300, 255);
+    SIM_CHECK(is_same_bitstream(expected, actual, sizeof(actual)));
+
+    // Intensity: (level * (intensity + 1)) >> 8.
+    eWS2812BEncodeArray(actual, colors, 300, 127);
+    for (i = 0 ; i < 300 ; i++)
+    {
+        colors[i] = (RGB_COLOR) {.red = colors[i].red / 2, .green = colors[i].green / 2, .blue = colors[i].blue / 2};
+        reference_ws2812b_encode_level(&expected[i * WS2812B_BYTES_PER_LED], colors[i]);
+    }
+    SIM_CHECK(is_same_bitstream(expected, actual, sizeof(actual)));
+
+    eWS2812BEncodeArray(actual, colors, 300, 0);
+    reference_ws2812b_encode_level(expected, (RGB_COLOR) {0, 0, 0});
+    for (i = 0 ; i < 300 ; i++)
+    {
+        SIM_CHECK(is_same_bitstream(expected, &actual[i * WS2812B_BYTES_PER_LED], WS2812B_BYTES_PER_LED));
+    }
+}
+
+int main(void)
+{
+    SIM_TEST_RUN(test_encode_level);
+    SIM_TEST_RUN(test_encode_percent);
+    SIM_TEST_RUN(test_encode_array);
+    SIM_TEST_END();
+}
@@ -7,10 +7,14 @@
 *               06/10/2018      - Compatibility PLIB
 *                               - No dependencies to xc32 library
 *                               - Add comments   
+*               17/10/2026      - Replace the mGetTick() macro by an ISR safe
+*                               timebase (timer_get_tick / timer_get_core_tick)
+*                               - Add tick_deadline_t helpers
 *********************************************************************/
 
 #include "../PLIB.h"
 
+extern const IRQ_REGISTERS IrqTab[];
 extern const TIMER_REGISTERS * TimerModules[];
 const TIMER_REGISTERS * TimerModules[] =
 {
@@ -22,6 +26,19 @@ const TIMER_REGISTERS * TimerModules[] =
 };
 static basic_event_handler_t timer_event_handler[TIMER_NUMBER_OF_MODULES] = {NULL};
 
+/*
+ * Timebase (TIMER1 extended to 64 bits and core timer extended to 64 bits).
+ * Each 64-bit counter is protected by a sequence counter: the writer (any 
+ * context, interrupts masked during the update) makes the sequence odd while
+ * it modifies the counter, the readers never lock and just retry when the 
+ * sequence changed during their snapshot.
+ */
+static volatile uint64_t tick_overflow = 0;
+static volatile uint32_t tick_sequence = 0;
+static volatile uint64_t core_tick_high = 0;
+static volatile uint32_t core_tick_last = 0;
+static volatile uint32_t core_tick_sequence = 0;
+
 /*******************************************************************************
  * Function: 
  *      void timer_init_2345_us(TIMER_MODULE id, uint32_t config, double period_us)
@@ -166,3 +183,259 @@ void timer_interrupt_handler(TIMER_MODULE id)
         (*timer_event_handler[id])(id);
     }
 }
+
+/*******************************************************************************
+ * Function: 
+ *      static void timer_tick_claim_overflow(void)
+ * 
+ * Description:
+ *      This routine is the only writer of the TIMER1 extension. If the TIMER1 
+ *      overflow flag is set then it adds one period (PR1 + 1) to the software
+ *      part of the tick and clears the flag. Interrupts are masked during the
+ *      few instructions of the update so a nested call (ISR) can not claim the
+ *      same overflow twice.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+static void timer_tick_claim_overflow(void)
+{
+    TIMER_REGISTERS * p_timer = (TIMER_REGISTERS *) TimerModules[TIMER1];
+    IRQ_REGISTERS * p_irq = (IRQ_REGISTERS *) &IrqTab[IRQ_T1];
+    uint32_t status = __builtin_disable_interrupts();
+    
+    if (p_irq->IFS[REG] & p_irq->MASK)
+    {
+        tick_sequence++;
+        tick_overflow += (uint64_t) p_timer->PR + 1;
+        p_irq->IFS[REG_CLR] = p_irq->MASK;
+        tick_sequence++;
+    }
+    
+    if (status & 0x00000001)
+    {
+        __builtin_enable_interrupts();
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint64_t timer_get_tick(void)
+ * 
+ * Description:
+ *      This routine returns the 64-bit system tick (TIMER1 extended by software).
+ *      It replaces the previous mGetTick() macro (mGetTick() now calls this 
+ *      function). It can be called from the main loop and from any ISR: the
+ *      snapshot is retried until the software part, TMR1 and the overflow flag
+ *      are coherent, so the returned value is monotonic and never torn.
+ *      TIMER1 has to be configured by the application (TMR_1_PS_1_8, 
+ *      PR1 = 0xFFFF) and its interrupt flag must not be cleared elsewhere.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      The current tick value (see. TICK_xxx defines).
+ * 
+ * Example:
+ *      uint64_t tick = timer_get_tick();
+ *      ...
+ *      if ((timer_get_tick() - tick) >= TICK_10MS) { ... }
+ ******************************************************************************/
+uint64_t timer_get_tick(void)
+{
+    TIMER_REGISTERS * p_timer = (TIMER_REGISTERS *) TimerModules[TIMER1];
+    IRQ_REGISTERS * p_irq = (IRQ_REGISTERS *) &IrqTab[IRQ_T1];
+    uint32_t sequence;
+    uint64_t high;
+    uint32_t low;
+    
+    do
+    {
+        sequence = tick_sequence;
+        high = tick_overflow;
+        low = p_timer->TMR;
+        if (p_irq->IFS[REG] & p_irq->MASK)
+        {
+            // An overflow is pending: account for it then take a new snapshot.
+            timer_tick_claim_overflow();
+            sequence = tick_sequence + 1;
+        }
+    }
+    while ((sequence & 0x00000001) || (sequence != tick_sequence));
+    
+    return (high + low);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint64_t timer_get_core_tick(void)
+ * 
+ * Description:
+ *      This routine returns the 64-bit high resolution tick based on the core
+ *      timer (CP0 Count register, CORE_TIMER_FREQ). The 32-bit hardware counter
+ *      wraps every 2^32 / CORE_TIMER_FREQ (107 seconds at 40 MHz) so this 
+ *      function has to be called at least once per wrap period to keep the 
+ *      extension coherent. It is ISR safe (same sequence mechanism as 
+ *      timer_get_tick).
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      The current core tick value (CORE_TICK_1US per micro-second).
+ * 
+ * Example:
+ *      uint64_t t0 = timer_get_core_tick();
+ *      ...
+ *      cycles = (timer_get_core_tick() - t0) * 2;
+ ******************************************************************************/
+uint64_t timer_get_core_tick(void)
+{
+    uint32_t sequence;
+    uint32_t status;
+    uint32_t last;
+    uint32_t count;
+    uint64_t high;
+    
+    do
+    {
+        sequence = core_tick_sequence;
+        high = core_tick_high;
+        last = core_tick_last;
+        count = _CP0_GET_COUNT();
+    }
+    while ((sequence & 0x00000001) || (sequence != core_tick_sequence));
+    
+    if (count < last)
+    {
+        high += 0x100000000ull;
+    }
+    
+    // Publish the new reference only if nobody did it since the snapshot.
+    status = __builtin_disable_interrupts();
+    if (sequence == core_tick_sequence)
+    {
+        core_tick_sequence++;
+        core_tick_high = high;
+        core_tick_last = count;
+        core_tick_sequence++;
+    }
+    if (status & 0x00000001)
+    {
+        __builtin_enable_interrupts();
+    }
+    
+    return (high + count);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void timer_deadline_arm(tick_deadline_t *deadline, uint64_t period)
+ * 
+ * Description:
+ *      This routine arms a deadline: it expires 'period' ticks after now.
+ * 
+ * Parameters:
+ *      *deadline: The pointer of tick_deadline_t.
+ *      period: The period in ticks (see. TICK_xxx defines).
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      static tick_deadline_t timeout = TICK_DEADLINE_INSTANCE(TICK_100MS);
+ *      timer_deadline_arm(&timeout, TICK_100MS);
+ ******************************************************************************/
+void timer_deadline_arm(tick_deadline_t *deadline, uint64_t period)
+{
+    deadline->period = period;
+    deadline->expiry = timer_get_tick() + period;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool timer_deadline_is_expired(const tick_deadline_t *deadline)
+ * 
+ * Description:
+ *      This routine checks if a deadline is reached. The deadline is not 
+ *      modified (one shot usage).
+ * 
+ * Parameters:
+ *      *deadline: The pointer of tick_deadline_t.
+ * 
+ * Return:
+ *      true if the deadline is reached, false otherwise.
+ * 
+ * Example:
+ *      if (timer_deadline_is_expired(&timeout)) { ... }
+ ******************************************************************************/
+bool timer_deadline_is_expired(const tick_deadline_t *deadline)
+{
+    return (timer_get_tick() >= deadline->expiry);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool timer_deadline_check_and_rearm(tick_deadline_t *deadline)
+ * 
+ * Description:
+ *      This routine is used for periodic tasks. If the deadline is reached 
+ *      then the next one is set one period later (no drift). If the task is
+ *      late by more than one period, the missed periods are skipped and the 
+ *      next deadline is set one period after now.
+ * 
+ * Parameters:
+ *      *deadline: The pointer of tick_deadline_t.
+ * 
+ * Return:
+ *      true if the deadline was reached (and re-armed), false otherwise.
+ * 
+ * Example:
+ *      static tick_deadline_t refresh = TICK_DEADLINE_INSTANCE(TICK_20MS);
+ *      if (timer_deadline_check_and_rearm(&refresh)) { ... }
+ ******************************************************************************/
+bool timer_deadline_check_and_rearm(tick_deadline_t *deadline)
+{
+    uint64_t now = timer_get_tick();
+    
+    if (now < deadline->expiry)
+    {
+        return false;
+    }
+    
+    deadline->expiry += deadline->period;
+    if (deadline->expiry <= now)
+    {
+        deadline->expiry = now + deadline->period;
+    }
+    return true;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint64_t timer_deadline_get_remaining(const tick_deadline_t *deadline)
+ * 
+ * Description:
+ *      This routine returns the number of ticks before the deadline.
+ * 
+ * Parameters:
+ *      *deadline: The pointer of tick_deadline_t.
+ * 
+ * Return:
+ *      The remaining ticks (0 if the deadline is reached).
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+uint64_t timer_deadline_get_remaining(const tick_deadline_t *deadline)
+{
+    uint64_t now = timer_get_tick();
+    return (now >= deadline->expiry) ? 0 : (deadline->expiry - now);
+}
@@ -1,12 +1,8 @@
 #ifndef __DEF_TIMERS
 #define __DEF_TIMERS
 
-volatile QWORD getTick;
-volatile QWORD temporary_tmr1_value;
-
-#define TMR1_GET_INT_FLAG           (IFS0bits.T1IF)
-#define mGetTick()                  ((!(temporary_tmr1_value = TMR1) | TMR1_GET_INT_FLAG)?(temporary_tmr1_value + (getTick += (TMR1_GET_INT_FLAG << 16)) + (TMR1_GET_INT_FLAG = 0)):(temporary_tmr1_value + getTick))
-#define mTickCompare(var)           (mGetTick() - var)
+#define mGetTick()                  (timer_get_tick())
+#define mTickCompare(var)           (timer_get_tick() - (var))
 #define TICK_INIT                   (0ul)
 #define TICK_0                      (0ul)
         
@@ -84,6 +80,13 @@ volatile QWORD temporary_tmr1_value;
 #error "timer.h - value not define for getTick"
 #endif
 
+/*
+ * The core timer (CP0 Count) increments every 2 SYSCLK cycles. SYSCLK is 
+ * supposed to be equal to PERIPHERAL_FREQ (PBDIV = 1).
+ */
+#define CORE_TIMER_FREQ             (PERIPHERAL_FREQ / 2)
+#define CORE_TICK_1US               (CORE_TIMER_FREQ / 1000000L)
+
 #define TMR_ON                      (1 << _T1CON_ON_POSITION)       /* Timer ON */
 #define TMR_OFF                     (0)                             /* Timer OFF */
 #define TMR_IDLE_STOP               (1 << _T1CON_SIDL_POSITION)     /* stop during idle */
@@ -137,6 +140,18 @@ typedef struct
     volatile UINT32 PRINV;
 } TIMER_REGISTERS;
 
+typedef struct
+{
+    uint64_t    expiry;
+    uint64_t    period;
+} tick_deadline_t;
+
+#define TICK_DEADLINE_INSTANCE(_period)     \
+{                                           \
+    .expiry = 0,                            \
+    .period = _period                       \
+}
+
 void timer_init_2345_us(TIMER_MODULE id, basic_event_handler_t evt_handler, uint32_t config, uint32_t period_us);
 #define timer_init_2345_hz(id, evt_handler, config, freq_hz)        (timer_init_2345_us(id, evt_handler, config, (uint32_t)(1000000.0/freq_hz)))
 double timer_get_period_us(TIMER_MODULE id);
@@ -144,5 +159,12 @@ double timer_get_period_us(TIMER_MODULE id);
 
 
 void timer_interrupt_handler(TIMER_MODULE id);
+
+uint64_t timer_get_tick(void);
+uint64_t timer_get_core_tick(void);
+void timer_deadline_arm(tick_deadline_t *deadline, uint64_t period);
+bool timer_deadline_is_expired(const tick_deadline_t *deadline);
+bool timer_deadline_check_and_rearm(tick_deadline_t *deadline);
+uint64_t timer_deadline_get_remaining(const tick_deadline_t *deadline);
 	
 #endif
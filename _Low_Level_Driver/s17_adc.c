@@ -7,6 +7,9 @@
 *       06/10/2018      - Compatibility PLIB
 *                       - No dependencies to xc32 library
 *                       - Add comments   
+*       17/10/2026      - Channel to buffer slot map (adc10_read)
+*                       - Sampler: scans triggered by TIMER3 and moved in
+*                         per-channel rings by the ADC interrupt
 * 
 *   Informations:
 *   -------------
@@ -14,10 +17,37 @@
 *   Interruptions are disable and acquisitions are made all the time.
 *   For example if AN1, AN9 and AN15 are enable then the user can 
 *   retrieve the data at any time with the routine ADC10Read(channel).
+*
+*   Sampler (adc10_sampler_init):
+*   -----------------------------
+*   TIMER3 starts a conversion every 'conversion_period_us' so each channel
+*   is sampled every (conversion_period_us x number of channels) us. At the
+*   end of each scan the ADC interrupt copies the results in the ring of
+*   each channel (ADC10_SAMPLER_DEPTH samples). The main loop retrieves all
+*   the samples received since its last call with adc10_get_samples(): no
+*   sample is lost as long as it is called at least once every
+*   ADC10_SAMPLER_DEPTH scans (otherwise the oldest ones are overwritten
+*   and counted by adc10_get_overrun()). The rings take
+*   ADC10_SAMPLER_CHANNELS x ADC10_SAMPLER_DEPTH x 2 bytes of RAM: define
+*   ADC10_SAMPLER_CHANNELS with the number of channels of the application.
+*   TIMER3 can not be used by another driver when the sampler is used.
 *********************************************************************/
 
 #include "../PLIB.h"
 
+static uint8_t adc10_slot[ADC10_NUMBER_OF_CHANNELS] = {[0 ... (ADC10_NUMBER_OF_CHANNELS - 1)] = ADC10_NO_SLOT};    // Channel (0..15) to buffer slot (ADC10_NO_SLOT if not scanned)
+static uint8_t adc10_number_of_slots = 0;
+static bool adc10_is_sampler_running = false;
+static uint16_t adc10_samples[ADC10_SAMPLER_CHANNELS][ADC10_SAMPLER_DEPTH];     // Indexed by slot
+static volatile uint32_t adc10_scan_count = 0;                                  // Number of scans stored (ring head)
+static uint32_t adc10_read_count[ADC10_SAMPLER_CHANNELS];                       // Ring tail of each slot
+static uint32_t adc10_overrun[ADC10_SAMPLER_CHANNELS];
+
+static inline uint8_t _adc10_get_slot(ADC10_ANALOG_PIN channel)
+{
+    return (channel == 0) ? ADC10_NO_SLOT : adc10_slot[__builtin_ctz(channel)];
+}
+
 /*******************************************************************************
  * Function: 
  *      void adc10_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref)
@@ -41,13 +71,21 @@ void adc10_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref)
     uint8_t i = 0;
     uint8_t numberOfSamplesBetweenInterrupts = 0;
     
-    for(i = 0 ; i < 16 ; i++)
+    // The scan converts the channels by increasing number: the result of the
+    // n-th scanned channel is in ADC1BUFn.
+    for(i = 0 ; i < ADC10_NUMBER_OF_CHANNELS ; i++)
     {
         if((channels >> i) & 0x0001)
         {
-            numberOfSamplesBetweenInterrupts++;
+            adc10_slot[i] = numberOfSamplesBetweenInterrupts++;
+        }
+        else
+        {
+            adc10_slot[i] = ADC10_NO_SLOT;
         }
     }
+    adc10_number_of_slots = numberOfSamplesBetweenInterrupts;
+    adc10_is_sampler_running = false;
     
     AD1CON1CLR = ADC_MODULE_ON_MASK;
     AD1CSSL = channels;         // Select input channel to scan
@@ -55,7 +93,8 @@ void adc10_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref)
     AD1PCFG = ~channels;        // Set IO as analog pin
     AD1CHS = 0;                 // Ignore these bits because ADC_SCAN_ON in AD1CON2.
     AD1CON3 = ADC_CONV_CLK_INTERNAL_RC | ADC_SAMPLE_TIME_15;
-    AD1CON2 = vref | ADC_SCAN_ON | (numberOfSamplesBetweenInterrupts << 2);
+    // SMPI = number of conversions per scan - 1 (the buffer restarts at ADC1BUF0 at each scan)
+    AD1CON2 = vref | ADC_SCAN_ON | (((numberOfSamplesBetweenInterrupts > 0) ? (numberOfSamplesBetweenInterrupts - 1) : 0) << _AD1CON2_SMPI_POSITION);
     AD1CON1 = ADC_MODULE_ON | ADC_FORMAT_INTG16 | ADC_CLK_AUTO | ADC_AUTO_SAMPLING_ON;
 }
 
@@ -70,24 +109,236 @@ void adc10_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref)
  *      channel: The channel you want to read its value.
  * 
  * Return:
- *      The channel's value (10 bits 0..1023).
+ *      The channel's value (10 bits 0..1023). With the sampler, it is the
+ *      last sample stored in the ring of the channel (ADC10_NO_SAMPLE until
+ *      the first scan is stored).
  * 
  * Example:
  *      See. _EXAMPLE_AVERAGE_AND_NTC()
  ******************************************************************************/
 uint16_t adc10_read(ADC10_ANALOG_PIN channel)
 {
-    uint8_t i, j;
-    for(i = 0, j = 0 ; i < 16 ; i++)
+    uint8_t slot = _adc10_get_slot(channel);
+    
+    if (slot == ADC10_NO_SLOT)
+    {
+        return 0;
+    }
+    if (adc10_is_sampler_running)
     {
-        if((AD1CSSL >> i) & 0x0001)
+        if (adc10_scan_count == 0)
         {
-            j++;
+            return ADC10_NO_SAMPLE;
         }
-        if((channel >> i) & 0x0001)
+        return adc10_samples[slot][(adc10_scan_count - 1) & (ADC10_SAMPLER_DEPTH - 1)];
+    }
+    return (*(&ADC1BUF0 + (slot * 4)));
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void adc10_sampler_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref, uint32_t conversion_period_us, IRQ_PRIORITY priority)
+ * 
+ * Description:
+ *      This routine initializes the ADC10 module as adc10_init() but the
+ *      conversions are started by TIMER3 (fixed sample rate) and the results
+ *      of each scan are stored by adc10_interrupt_handler() in the rings of
+ *      the channels. When at most 8 channels are scanned, the ADC buffer is
+ *      split in two halves: the interrupt reads one half while the ADC fills
+ *      the other one.
+ * 
+ * Parameters:
+ *      channels: Indicate all channels used (only the ADC10_SAMPLER_CHANNELS
+ *          lowest ones are scanned).
+ *      vref: Indicate the reference voltage used.
+ *      conversion_period_us: Period between two conversions (a channel is
+ *          sampled every conversion_period_us x number of channels).
+ *      priority: The priority of the ADC interruption.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      void __ISR(_ADC_VECTOR, IPL4SOFT) AdcHandler(void)
+ *      {
+ *          adc10_interrupt_handler();
+ *      }
+ *      ...
+ *      adc10_sampler_init(AN1|AN2|AN3|AN15, ADC10_VREFP_VREFN, 10, IRQ_PRIORITY_LEVEL_4);    // 25 kHz per channel
+ *      ...
+ *      n = adc10_get_samples(AN3, samples, 64);
+ ******************************************************************************/
+void adc10_sampler_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref, uint32_t conversion_period_us, IRQ_PRIORITY priority)
+{
+    uint32_t others = channels;
+    uint8_t i;
+    
+    // A ring for the ADC10_SAMPLER_CHANNELS lowest channels only
+    for (i = 0 ; (i < ADC10_SAMPLER_CHANNELS) && (others != 0) ; i++)
+    {
+        others &= others - 1;
+    }
+    channels &= ~others;
+    
+    irq_enable(IRQ_AD1, IRQ_DISABLED);
+    adc10_init(channels, vref);
+    AD1CON1CLR = ADC_MODULE_ON_MASK;
+    
+    adc10_scan_count = 0;
+    for (i = 0 ; i < ADC10_SAMPLER_CHANNELS ; i++)
+    {
+        adc10_read_count[i] = 0;
+        adc10_overrun[i] = 0;
+    }
+    
+    if ((adc10_number_of_slots > 0) && (adc10_number_of_slots <= 8))
+    {
+        AD1CON2SET = ADC_BUF_DUAL;
+    }
+    AD1CON1 = ADC_FORMAT_INTG16 | ADC_CLK_TMR3 | ADC_AUTO_SAMPLING_ON;
+    
+    timer_init_2345_us(TIMER3, NULL, TMR_ON | TMR_SOURCE_INT | TMR_IDLE_CON | TMR_GATE_OFF, conversion_period_us);
+    
+    adc10_is_sampler_running = true;
+    IRQInit(IRQ_AD1, IRQ_ENABLED, priority, IRQ_SUB_PRIORITY_LEVEL_0);
+    AD1CON1SET = ADC_MODULE_ON;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void adc10_interrupt_handler(void)
+ * 
+ * Description:
+ *      This routine must be called in the ADC interrupt handler (sampler
+ *      only). It copies the results of the last scan in the rings of the
+ *      channels and clears the interrupt flag.
+ * 
+ * Parameters:
+ *      none
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      See. adc10_sampler_init()
+ ******************************************************************************/
+void adc10_interrupt_handler(void)
+{
+    volatile unsigned int *p_buffer = &ADC1BUF0;
+    uint32_t index = adc10_scan_count & (ADC10_SAMPLER_DEPTH - 1);
+    uint8_t slot;
+    
+    // BUFS = 1: the ADC fills ADC1BUF8..F, the results are in ADC1BUF0..7 (and the opposite)
+    if ((AD1CON2 & _AD1CON2_BUFM_MASK) && !(AD1CON2 & _AD1CON2_BUFS_MASK))
+    {
+        p_buffer = &ADC1BUF8;
+    }
+    
+    for (slot = 0 ; slot < adc10_number_of_slots ; slot++)
+    {
+        adc10_samples[slot][index] = p_buffer[slot * 4];
+    }
+    __sync_synchronize();       // The samples are written before being published
+    adc10_scan_count++;
+    
+    irq_clr_flag(IRQ_AD1);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint16_t adc10_get_samples(ADC10_ANALOG_PIN channel, uint16_t *p_samples, uint16_t max_samples)
+ * 
+ * Description:
+ *      This routine copies (oldest first) the samples of a channel stored by
+ *      the sampler since the previous call, at most 'max_samples'. The next
+ *      call returns the following ones. If more than ADC10_SAMPLER_DEPTH
+ *      samples have been stored since the previous call then the oldest ones
+ *      are lost (cf. adc10_get_overrun()), as the ones overwritten by the
+ *      interrupt during the copy (the count of scans is read again after
+ *      it: these samples are removed from the result).
+ * 
+ * Parameters:
+ *      channel: The channel you want to read its samples.
+ *      p_samples: The destination (at least max_samples values).
+ *      max_samples: The maximum number of samples to copy.
+ * 
+ * Return:
+ *      The number of samples copied (10 bits 0..1023 each).
+ * 
+ * Example:
+ *      See. adc10_sampler_init()
+ ******************************************************************************/
+uint16_t adc10_get_samples(ADC10_ANALOG_PIN channel, uint16_t *p_samples, uint16_t max_samples)
+{
+    uint8_t slot = _adc10_get_slot(channel);
+    uint32_t head = adc10_scan_count;
+    uint32_t tail, lost;
+    uint16_t *p_ring;
+    uint16_t i, n;
+    
+    if ((slot == ADC10_NO_SLOT) || !adc10_is_sampler_running)
+    {
+        return 0;
+    }
+    __sync_synchronize();       // The samples are read after the head
+    
+    tail = adc10_read_count[slot];
+    if ((head - tail) > ADC10_SAMPLER_DEPTH)
+    {
+        adc10_overrun[slot] += (head - tail) - ADC10_SAMPLER_DEPTH;
+        tail = head - ADC10_SAMPLER_DEPTH;
+    }
+    n = ((head - tail) < max_samples) ? (head - tail) : max_samples;
+    
+    p_ring = adc10_samples[slot];
+    for (i = 0 ; i < n ; i++)
+    {
+        p_samples[i] = p_ring[(tail + i) & (ADC10_SAMPLER_DEPTH - 1)];
+    }
+    __sync_synchronize();       // The head is read again after the samples
+    
+    // Scans stored during the copy: the first samples may be from them
+    lost = adc10_scan_count - tail;
+    if (lost > ADC10_SAMPLER_DEPTH)
+    {
+        lost -= ADC10_SAMPLER_DEPTH;
+        if (lost > n)
         {
-            return (*(&ADC1BUF0+((j-1) * 4)));
+            lost = n;
+        }
+        adc10_overrun[slot] += lost;
+        n -= lost;
+        tail += lost;
+        for (i = 0 ; i < n ; i++)
+        {
+            p_samples[i] = p_samples[i + lost];
         }
     }
-    return 0;
+    adc10_read_count[slot] = tail + n;
+    
+    return n;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      uint32_t adc10_get_overrun(ADC10_ANALOG_PIN channel)
+ * 
+ * Description:
+ *      This routine returns the number of samples of a channel overwritten
+ *      in its ring before being read by adc10_get_samples().
+ * 
+ * Parameters:
+ *      channel: The channel.
+ * 
+ * Return:
+ *      The number of samples lost.
+ * 
+ * Example:
+ *      none
+ ******************************************************************************/
+uint32_t adc10_get_overrun(ADC10_ANALOG_PIN channel)
+{
+    uint8_t slot = _adc10_get_slot(channel);
+    
+    return ((slot == ADC10_NO_SLOT) || !adc10_is_sampler_running) ? 0 : adc10_overrun[slot];
 }
@@ -33,12 +33,38 @@ typedef enum
 #define ADC_MODULE_ON               (1 << _AD1CON1_ADON_POSITION)
 #define ADC_FORMAT_INTG16           (0x00 << _AD1CON1_FORM_POSITION)
 #define ADC_CLK_AUTO                (7 << _AD1CON1_SSRC_POSITION)
+#define ADC_CLK_TMR3                (2 << _AD1CON1_SSRC_POSITION)
 #define ADC_AUTO_SAMPLING_ON        (1 << _AD1CON1_ASAM_POSITION) 
 #define ADC_SCAN_ON                 (1 << _AD1CON2_CSCNA_POSITION)
+#define ADC_BUF_DUAL                (1 << _AD1CON2_BUFM_POSITION)
 #define ADC_CONV_CLK_INTERNAL_RC    (1 << _AD1CON3_ADRC_POSITION)
 #define ADC_SAMPLE_TIME_15          (0x0F << _AD1CON3_SAMC_POSITION)
 
+#define ADC10_NUMBER_OF_CHANNELS    16
+#define ADC10_NO_SLOT               0xff
+#define ADC10_NO_SAMPLE             0xffff  // adc10_read(): the sampler has not stored a scan yet
+
+#ifndef ADC10_SAMPLER_DEPTH
+#define ADC10_SAMPLER_DEPTH         64      // Samples kept per channel by the sampler (power of 2)
+#endif
+
+#ifndef ADC10_SAMPLER_CHANNELS
+#define ADC10_SAMPLER_CHANNELS      ADC10_NUMBER_OF_CHANNELS    // Channels scanned by the sampler at most (RAM: ADC10_SAMPLER_CHANNELS x ADC10_SAMPLER_DEPTH x 2 bytes)
+#endif
+
+#if ((ADC10_SAMPLER_DEPTH & (ADC10_SAMPLER_DEPTH - 1)) != 0)
+#error "ADC10_SAMPLER_DEPTH must be a power of 2"
+#endif
+
+#if ((ADC10_SAMPLER_CHANNELS < 1) || (ADC10_SAMPLER_CHANNELS > ADC10_NUMBER_OF_CHANNELS))
+#error "ADC10_SAMPLER_CHANNELS must be between 1 and ADC10_NUMBER_OF_CHANNELS"
+#endif
+
 void adc10_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref);
 uint16_t adc10_read(ADC10_ANALOG_PIN channel);
+void adc10_sampler_init(ADC10_ANALOG_PIN channels, ADC10_VOLTAGE_REF vref, uint32_t conversion_period_us, IRQ_PRIORITY priority);
+void adc10_interrupt_handler(void);
+uint16_t adc10_get_samples(ADC10_ANALOG_PIN channel, uint16_t *p_samples, uint16_t max_samples);
+uint32_t adc10_get_overrun(ADC10_ANALOG_PIN channel);
 
 #endif
@@ -13,6 +13,14 @@
 *                       pour correctif bug lorsque rxBuffer == NULL et qu'on
 *                       utilise Byte Array et SPIWriteAndStore8_16_32.
 *       04/01/2018      - Add "SPIEnable" function.
+*       17/10/2026      - Add a transaction queue per SPI module (spi_transfer_submit).
+*                       The end of transfer is given by the DMA block done event
+*                       instead of an estimated EOT delay.
+*                       - Add scatter-gather transfers (SPI_SEGMENT) and
+*                       SPIWriteAndStoreSegments(...).
+*                       - SPIWriteAndStoreByteArray / Segments return 
+*                       SPI_TRANSFER_REJECTED instead of 0 (completed) when
+*                       the queue refuses the transfer.
 *********************************************************************/
 
 #include "../PLIB.h"
@@ -42,6 +50,36 @@ IRQ_SOURCE spiIrqSource[] =
     IRQ_SPI4RX
 };
 
+static const uint8_t spi_tx_irq[] =
+{
+    _SPI1_TX_IRQ,
+    _SPI2_TX_IRQ,
+    _SPI3_TX_IRQ,
+    _SPI4_TX_IRQ
+};
+
+static const uint8_t spi_rx_irq[] =
+{
+    _SPI1_RX_IRQ,
+    _SPI2_RX_IRQ,
+    _SPI3_RX_IRQ,
+    _SPI4_RX_IRQ
+};
+
+// Bits of SPIxCON which can be changed by a SPI_TRANSFER.
+#define SPI_TRANSFER_MODE_MASK      (SPI_CONF_MODE16 | SPI_CONF_MODE32 | SPI_CONF_CKP_HIGH | SPI_CONF_CKE_ON | SPI_CONF_SMP_END)
+
+typedef struct
+{
+    SPI_TRANSFER    *p_head;        // Transfer in progress
+    SPI_TRANSFER    *p_tail;
+    bool            is_initialized;
+    bool            is_irq_enabled;
+} SPI_QUEUE;
+
+static SPI_QUEUE spi_queue[SPI_NUMBER_OF_MODULES] = {{0}};
+static const uint32_t spi_dummy_tx = 0xffffffff;
+
 void SPIInit(SPI_MODULE id, QWORD freqHz, SPI_CONFIG config)
 {
     SPI_REGISTERS * spiRegister = (SPI_REGISTERS *)SpiModules[id];
@@ -187,42 +225,43 @@ BYTE SPIWriteAndStore8_16_32(SPI_MODULE spi_module, _IO chip_select, uint32_t tx
     return functionState[spi_module];
 }
 
-BYTE SPIWriteAndStoreByteArray(SPI_MODULE spi_module, _IO chip_select, void *txBuffer, void *rxBuffer, uint32_t size)
+static BYTE spi_write_and_store_transfer(SPI_MODULE spi_module, _IO chip_select, void *txBuffer, void *rxBuffer, uint32_t size, const SPI_SEGMENT *p_segments, uint8_t number_of_segments)
 {
     SPI_REGISTERS *spiRegister = (SPI_REGISTERS *)SpiModules[spi_module];
     static BYTE functionState[SPI_NUMBER_OF_MODULES] = {0};
-    static QWORD tickEOT[SPI_NUMBER_OF_MODULES] = {0};
-    static QWORD periodEOT[SPI_NUMBER_OF_MODULES] = {0};
+    static SPI_TRANSFER transfer[SPI_NUMBER_OF_MODULES] = {{{0}}};
     
     switch(functionState[spi_module])
     {
         case 0:
-            spiRegister->SPIxCONbits.MODE16 = ((SPI_CONF_MODE8 >> 10) & 0x00000001);
-            spiRegister->SPIxCONbits.MODE32 = ((SPI_CONF_MODE8 >> 11) & 0x00000001);
             SPICurrentChipSelect[spi_module] = chip_select;
             
-            DmaChnSetTxfer(DMA_CHANNEL0+spi_module, txBuffer, (void*)&spiRegister->SPIxBUF, size, 1, 1);
-            periodEOT[spi_module] = (QWORD) ((size*8*20*(spiRegister->SPIxBRG + 1)/(PERIPHERAL_FREQ/1000000))*TICK_1US/10 + 1);
-            if(rxBuffer != NULL)
+            // 8 bits transfer, clock polarity and phase unchanged.
+            transfer[spi_module].chip_select = chip_select;
+            transfer[spi_module].mode = (SPI_CONFIG) ((spiRegister->SPIxCON & SPI_TRANSFER_MODE_MASK & ~(SPI_CONF_MODE16 | SPI_CONF_MODE32)) | SPI_CONF_MODE8);
+            transfer[spi_module].freq_hz = 0;
+            transfer[spi_module].p_tx = txBuffer;
+            transfer[spi_module].p_rx = rxBuffer;
+            transfer[spi_module].size = size;
+            transfer[spi_module].p_segments = p_segments;
+            transfer[spi_module].number_of_segments = number_of_segments;
+            transfer[spi_module].callback = NULL;
+            
+            if (!spi_transfer_submit(spi_module, &transfer[spi_module]))
             {
-                DmaChnSetTxfer(DMA_CHANNEL4+spi_module, (void*)&spiRegister->SPIxBUF, (void*)rxBuffer, 1, size, 1);
+                // Invalid transfer: never reported as completed.
+                return SPI_TRANSFER_REJECTED;
             }
-            
-            ports_clr_bit(chip_select);
-            DmaChnEnable(DMA_CHANNEL4+spi_module);                         // Enable the DMA channel
-            DmaChnStartTxfer(DMA_CHANNEL0+spi_module, DMA_WAIT_NOT, 0);    // Force the DMA transfer
-            
-            tickEOT[spi_module] = mGetTick();
             functionState[spi_module] = 1;
             break;
         case 1:
-            // Do nothing .. just wait the end of transmission
-            if(mTickCompare(tickEOT[spi_module]) >= periodEOT[spi_module])
+            // Do nothing .. just wait the end of transmission (DMA block done)
+            if (!spi_queue[spi_module].is_irq_enabled)
+            {
+                spi_dma_interrupt_handler(spi_module);
+            }
+            if (!transfer[spi_module].is_pending)
             {
-                ports_set_bit(chip_select);
-                irq_clr_flag(spiIrqSource[spi_module]);
-                DmaChnAbortTxfer(DMA_CHANNEL4+spi_module);
-                DmaChnDisable(DMA_CHANNEL4+spi_module);
                 functionState[spi_module] = 0;
             }
             break;
@@ -230,3 +269,419 @@ BYTE SPIWriteAndStoreByteArray(SPI_MODULE spi_module, _IO chip_select, void *txB
 
     return functionState[spi_module];
 }
+
+BYTE SPIWriteAndStoreByteArray(SPI_MODULE spi_module, _IO chip_select, void *txBuffer, void *rxBuffer, uint32_t size)
+{
+    return spi_write_and_store_transfer(spi_module, chip_select, txBuffer, rxBuffer, size, NULL, 0);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      BYTE SPIWriteAndStoreSegments(SPI_MODULE spi_module, _IO chip_select, const SPI_SEGMENT *p_segments, uint8_t number_of_segments)
+ * 
+ * Description:
+ *      Same as SPIWriteAndStoreByteArray but the frame is a list of segments
+ *      (tx pointer, rx pointer, size) sent in a single chip select 
+ *      transaction. A command header and a payload can be sent without 
+ *      being copied in a same buffer. The segments and their buffers must 
+ *      not be modified until the function returns 0.
+ * 
+ * Parameters:
+ *      spi_module: The SPI module you want to use.
+ *      chip_select: The chip select of the device.
+ *      *p_segments: The list of segments.
+ *      number_of_segments: The number of segments in the list.
+ * 
+ * Return:
+ *      0 when the transfer is completed (the function must be called until 
+ *      it returns 0). SPI_TRANSFER_REJECTED if the transfer is invalid (size
+ *      = 0 or no buffer, for a segment too): nothing is sent.
+ * 
+ * Example:
+ *      SPI_SEGMENT segments[2] = 
+ *      {
+ *          SPI_SEGMENT_INSTANCE(header, NULL, 3),
+ *          SPI_SEGMENT_INSTANCE(NULL, p_data, size)
+ *      };
+ *      if (!SPIWriteAndStoreSegments(SPI2, chip_select, segments, 2)) { ... }
+ ******************************************************************************/
+BYTE SPIWriteAndStoreSegments(SPI_MODULE spi_module, _IO chip_select, const SPI_SEGMENT *p_segments, uint8_t number_of_segments)
+{
+    return spi_write_and_store_transfer(spi_module, chip_select, NULL, NULL, 0, p_segments, number_of_segments);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void spi_queue_init(SPI_MODULE id, IRQ_PRIORITY priority)
+ * 
+ * Description:
+ *      This routine initializes the transaction queue of a SPI module. The 
+ *      DMA channel (DMA_CHANNEL0 + id) is used for the transmission and the 
+ *      DMA channel (DMA_CHANNEL4 + id) for the reception. The end of each 
+ *      transfer is given by the block done event of DMA_CHANNEL4 + id.
+ *      If priority is not IRQ_PRIORITY_DISABLED, the DMA interruption is 
+ *      enabled and your interrupt vector (_DMA_4_VECTOR + id) must call 
+ *      spi_dma_interrupt_handler(id) (the IPL of the vector must match the 
+ *      priority). Otherwise spi_dma_interrupt_handler(id) must be polled.
+ *      The SPI module must be initialized (SPIInit) as a master without the
+ *      enhanced buffer.
+ *      This function is called by spi_transfer_submit (polling mode) if 
+ *      the queue has not been initialized.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ *      priority: The priority of the DMA interruption (IRQ_PRIORITY_DISABLED
+ *                  for the polling mode).
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      void __ISR(_DMA_5_VECTOR, IPL3SOFT) Dma5Handler(void)
+ *      {
+ *          spi_dma_interrupt_handler(SPI2);
+ *      }
+ *      ...
+ *      SPIInit(SPI2, 10000000, SPI_CONF_MSTEN | SPI_CONF_SMP_MIDDLE | SPI_CONF_CKE_ON | SPI_CONF_MODE8 | SPI_CONF_ON);
+ *      spi_queue_init(SPI2, IRQ_PRIORITY_LEVEL_3);
+ ******************************************************************************/
+void spi_queue_init(SPI_MODULE id, IRQ_PRIORITY priority)
+{
+    SPI_QUEUE *p_queue = &spi_queue[id];
+    
+    irq_enable(IRQ_DMA4 + id, IRQ_DISABLED);
+    
+    DmaChnOpen(DMA_CHANNEL0 + id, DMA_CHN_PRI2, DMA_OPEN_DEFAULT);
+    DmaChnOpen(DMA_CHANNEL4 + id, DMA_CHN_PRI3, DMA_OPEN_DEFAULT);  // The reception must not be late on the transmission.
+    DmaChnSetEvEnableFlags(DMA_CHANNEL4 + id, DMA_EV_BLOCK_DONE);
+    DmaChnClrEvFlags(DMA_CHANNEL4 + id, DMA_EV_ALL_EVNTS);
+    
+    p_queue->is_irq_enabled = (priority != IRQ_PRIORITY_DISABLED);
+    p_queue->is_initialized = true;
+    
+    if (p_queue->is_irq_enabled)
+    {
+        IRQInit(IRQ_DMA4 + id, IRQ_ENABLED, priority, IRQ_SUB_PRIORITY_LEVEL_0);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void spi_segment_start(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+ * 
+ * Description:
+ *      This routine configures the DMA channels for the current segment of 
+ *      a transfer (.segment_index) and starts it. The chip select is already 
+ *      asserted.
+ *      If there is no reception buffer, the transmission is done by the 
+ *      DMA_CHANNEL4 + id so that its block done event still gives the end 
+ *      of the segment. If there is no transmission buffer, 0xff are sent by
+ *      DMA_CHANNEL0 + id (auto enable) until the end of the reception.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ *      *p_transfer: The pointer of the transfer in progress.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void spi_segment_start(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+{
+    SPI_REGISTERS *spiRegister = (SPI_REGISTERS *)SpiModules[id];
+    uint32_t width = (p_transfer->mode & SPI_CONF_MODE32) ? 4 : ((p_transfer->mode & SPI_CONF_MODE16) ? 2 : 1);
+    const void *p_tx = p_transfer->p_tx;
+    void *p_rx = p_transfer->p_rx;
+    uint32_t size = p_transfer->size;
+    uint32_t dummy;
+    
+    if (p_transfer->p_segments != NULL)
+    {
+        p_tx = p_transfer->p_segments[p_transfer->segment_index].p_tx;
+        p_rx = p_transfer->p_segments[p_transfer->segment_index].p_rx;
+        size = p_transfer->p_segments[p_transfer->segment_index].size;
+    }
+    
+    while (SPIIsRxAvailable(id))
+    {
+        dummy = spiRegister->SPIxBUF;
+    }
+    spiRegister->SPIxSTATCLR = _SPI1STAT_SPIROV_MASK;
+    irq_clr_flag(spiIrqSource[id]);
+    DmaChnClrEvFlags(DMA_CHANNEL4 + id, DMA_EV_ALL_EVNTS);
+    
+    if (p_rx == NULL)
+    {
+        DmaChnSetEventControl(DMA_CHANNEL4 + id, DMA_EV_START_IRQ(spi_tx_irq[id]));
+        DmaChnSetTxfer(DMA_CHANNEL4 + id, (void *)p_tx, (void *)&spiRegister->SPIxBUF, size, width, width);
+        DmaChnStartTxfer(DMA_CHANNEL4 + id, DMA_WAIT_NOT, 0);
+    }
+    else
+    {
+        DmaChnSetEventControl(DMA_CHANNEL4 + id, DMA_EV_START_IRQ(spi_rx_irq[id]));
+        DmaChnSetTxfer(DMA_CHANNEL4 + id, (void *)&spiRegister->SPIxBUF, p_rx, width, size, width);
+        
+        DmaChnSetEventControl(DMA_CHANNEL0 + id, DMA_EV_START_IRQ(spi_tx_irq[id]));
+        if (p_tx == NULL)
+        {
+            DmaChnSetControlFlags(DMA_CHANNEL0 + id, DMA_CTL_AUTO_ENABLE);
+            DmaChnSetTxfer(DMA_CHANNEL0 + id, (void *)&spi_dummy_tx, (void *)&spiRegister->SPIxBUF, width, width, width);
+        }
+        else
+        {
+            DmaChnClrControlFlags(DMA_CHANNEL0 + id, DMA_CTL_AUTO_ENABLE);
+            DmaChnSetTxfer(DMA_CHANNEL0 + id, (void *)p_tx, (void *)&spiRegister->SPIxBUF, size, width, width);
+        }
+        
+        DmaChnEnable(DMA_CHANNEL4 + id);
+        DmaChnStartTxfer(DMA_CHANNEL0 + id, DMA_WAIT_NOT, 0);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void spi_segment_end(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+ * 
+ * Description:
+ *      This routine terminates the current segment of a transfer once its 
+ *      DMA block done event occured.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ *      *p_transfer: The pointer of the transfer in progress.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void spi_segment_end(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+{
+    SPI_REGISTERS *spiRegister = (SPI_REGISTERS *)SpiModules[id];
+    const void *p_tx = p_transfer->p_tx;
+    void *p_rx = p_transfer->p_rx;
+    
+    if (p_transfer->p_segments != NULL)
+    {
+        p_tx = p_transfer->p_segments[p_transfer->segment_index].p_tx;
+        p_rx = p_transfer->p_segments[p_transfer->segment_index].p_rx;
+    }
+    
+    if (p_rx == NULL)
+    {
+        // The last character is in SPIxBUF: wait the end of its shift (2 characters max).
+        while (!spiRegister->SPIxSTATbits.SPITBE || spiRegister->SPIxSTATbits.SPIBUSY);
+    }
+    else if (p_tx == NULL)
+    {
+        DmaChnAbortTxfer(DMA_CHANNEL0 + id);
+        DmaChnClrControlFlags(DMA_CHANNEL0 + id, DMA_CTL_AUTO_ENABLE);
+        // A last 0xff can be in progress.
+        while (spiRegister->SPIxSTATbits.SPIBUSY);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void spi_transfer_start(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+ * 
+ * Description:
+ *      This routine configures the SPI module (mode, clock) for a transfer,
+ *      asserts the chip select and starts the first segment.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ *      *p_transfer: The pointer of the transfer to start.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void spi_transfer_start(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+{
+    SPI_REGISTERS *spiRegister = (SPI_REGISTERS *)SpiModules[id];
+    
+    if ((spiRegister->SPIxCON & SPI_TRANSFER_MODE_MASK) != (p_transfer->mode & SPI_TRANSFER_MODE_MASK))
+    {
+        spiRegister->SPIxCONbits.SPION = OFF;
+        spiRegister->SPIxCONCLR = SPI_TRANSFER_MODE_MASK;
+        spiRegister->SPIxCONSET = (p_transfer->mode & SPI_TRANSFER_MODE_MASK);
+        spiRegister->SPIxCONbits.SPION = ON;
+    }
+    if (p_transfer->freq_hz > 0)
+    {
+        SPISetFreq(id, p_transfer->freq_hz);
+    }
+    
+    p_transfer->segment_index = 0;
+    ports_clr_bit(p_transfer->chip_select);
+    spi_segment_start(id, p_transfer);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool spi_transfer_submit(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+ * 
+ * Description:
+ *      This routine adds a transfer at the end of the queue of a SPI module.
+ *      The transfer starts immediately if the queue is empty, otherwise it 
+ *      is started (from spi_dma_interrupt_handler) as soon as the previous 
+ *      one is completed. The chip select is asserted only during the 
+ *      transfer. At the end, .is_pending is cleared and the .callback is 
+ *      called (from the DMA interruption if it is enabled).
+ *      The SPI_TRANSFER and its buffers must not be modified while the 
+ *      transfer is pending. No memory is allocated: the queue is a linked
+ *      list of the SPI_TRANSFER themselves.
+ *      Do not mix the queue with SPIWriteAndStore / SPIWriteAndStore8_16_32 
+ *      on a same SPI module.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ *      *p_transfer: The pointer of the transfer to add.
+ * 
+ * Return:
+ *      true if the transfer has been added, false if it is already pending
+ *      or invalid (size = 0 or no buffer, for the transfer or one of its 
+ *      segments).
+ * 
+ * Example:
+ *      static uint8_t tx[4] = {0x03, 0x00, 0x10, 0x00};
+ *      static uint8_t rx[4];
+ *      SPI_TRANSFER_DEF(read_eeprom, __PD3, SPI_CONF_MODE8 | SPI_CONF_CKE_ON, 10000000, tx, rx, 4, NULL, NULL);
+ *      spi_transfer_submit(SPI2, &read_eeprom);
+ ******************************************************************************/
+bool spi_transfer_submit(SPI_MODULE id, SPI_TRANSFER *p_transfer)
+{
+    SPI_QUEUE *p_queue = &spi_queue[id];
+    uint32_t status;
+    uint8_t i;
+    
+    if (p_transfer->is_pending)
+    {
+        return false;
+    }
+    if (p_transfer->p_segments == NULL)
+    {
+        if ((p_transfer->size == 0) || ((p_transfer->p_tx == NULL) && (p_transfer->p_rx == NULL)))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (p_transfer->number_of_segments == 0)
+        {
+            return false;
+        }
+        for (i = 0 ; i < p_transfer->number_of_segments ; i++)
+        {
+            if ((p_transfer->p_segments[i].size == 0) || ((p_transfer->p_segments[i].p_tx == NULL) && (p_transfer->p_segments[i].p_rx == NULL)))
+            {
+                return false;
+            }
+        }
+    }
+    
+    if (!p_queue->is_initialized)
+    {
+        spi_queue_init(id, IRQ_PRIORITY_DISABLED);
+    }
+    
+    p_transfer->next = NULL;
+    p_transfer->is_pending = true;
+    
+    status = __builtin_disable_interrupts();
+    if (p_queue->p_head == NULL)
+    {
+        p_queue->p_head = p_transfer;
+        p_queue->p_tail = p_transfer;
+        spi_transfer_start(id, p_transfer);
+    }
+    else
+    {
+        p_queue->p_tail->next = p_transfer;
+        p_queue->p_tail = p_transfer;
+    }
+    if (status & 0x00000001)
+    {
+        __builtin_enable_interrupts();
+    }
+    
+    return true;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool spi_queue_is_idle(SPI_MODULE id)
+ * 
+ * Description:
+ *      This routine returns the state of the queue of a SPI module.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ * 
+ * Return:
+ *      true if there is no transfer in progress or waiting.
+ ******************************************************************************/
+bool spi_queue_is_idle(SPI_MODULE id)
+{
+    return (spi_queue[id].p_head == NULL);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void spi_dma_interrupt_handler(SPI_MODULE id)
+ * 
+ * Description:
+ *      This routine must be called by the interrupt vector of the DMA channel
+ *      (DMA_CHANNEL4 + id) or polled if this interruption is disabled. 
+ *      At the end of a segment, it starts the next segment of the transfer.
+ *      At the end of a transfer, it releases the chip select, starts the 
+ *      next transfer of the queue (back to back) then calls the callback 
+ *      of the completed one. It does nothing if the transfer in progress 
+ *      is not completed.
+ * 
+ * Parameters:
+ *      id: The SPI module you want to use.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      See. spi_queue_init
+ ******************************************************************************/
+void spi_dma_interrupt_handler(SPI_MODULE id)
+{
+    SPI_QUEUE *p_queue = &spi_queue[id];
+    SPI_TRANSFER *p_transfer = p_queue->p_head;
+    
+    if ((p_transfer == NULL) || !(DmaChnGetEvFlags(DMA_CHANNEL4 + id) & DMA_EV_BLOCK_DONE))
+    {
+        return;
+    }
+    DmaChnClrEvFlags(DMA_CHANNEL4 + id, DMA_EV_ALL_EVNTS);
+    irq_clr_flag(IRQ_DMA4 + id);
+    
+    spi_segment_end(id, p_transfer);
+    if ((p_transfer->p_segments != NULL) && (++p_transfer->segment_index < p_transfer->number_of_segments))
+    {
+        // Next segment in the same chip select transaction.
+        spi_segment_start(id, p_transfer);
+        return;
+    }
+    ports_set_bit(p_transfer->chip_select);
+    irq_clr_flag(spiIrqSource[id]);
+    
+    p_queue->p_head = p_transfer->next;
+    if (p_queue->p_head == NULL)
+    {
+        p_queue->p_tail = NULL;
+    }
+    else
+    {
+        spi_transfer_start(id, p_queue->p_head);
+    }
+    
+    p_transfer->next = NULL;
+    p_transfer->is_pending = false;
+    if (p_transfer->callback != NULL)
+    {
+        (*p_transfer->callback)(p_transfer->p_context);
+    }
+}
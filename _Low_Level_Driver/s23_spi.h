@@ -236,16 +236,68 @@ typedef struct
     .spi_module = _spi_module,                      \
     .chip_select = { _io_port, _io_indice },        \
     .is_chip_select_initialize = false,             \
-    .bus_management_params =                        \
-    {                                               \
-        .is_running = false,                        \
-        .waiting_period = _periodic_time,           \
-        .tick = -1                                  \
-    },                                              \
+    .bus_management_params = BUS_MANAGEMENT_PARAMS_INSTANCE(_periodic_time), \
     .flags = _flags,                                \
     .state_machine = {0}                            \
 }
 
+// Returned by SPIWriteAndStoreByteArray / SPIWriteAndStoreSegments when the
+// queue refuses the transfer (never 0: the caller does not see a completion).
+#define SPI_TRANSFER_REJECTED           0xff
+
+typedef void (*spi_transfer_callback_t)(void *p_context);
+
+typedef struct
+{
+    const void              *p_tx;          // NULL: 0xff are sent
+    void                    *p_rx;          // NULL: received data are dropped
+    uint32_t                size;           // Number of bytes (multiple of the data width)
+} SPI_SEGMENT;
+
+#define SPI_SEGMENT_INSTANCE(_p_tx, _p_rx, _size)   \
+{                                                   \
+    .p_tx = _p_tx,                                  \
+    .p_rx = _p_rx,                                  \
+    .size = _size                                   \
+}
+
+typedef struct _SPI_TRANSFER
+{
+    _IO                     chip_select;    // Asserted (low) only during the transfer
+    SPI_CONFIG              mode;           // SPI_CONF_MODE8/16/32 | SPI_CONF_CKP_xxx | SPI_CONF_CKE_xxx | SPI_CONF_SMP_xxx
+    QWORD                   freq_hz;        // 0: keep the current frequency
+    const void              *p_tx;
+    void                    *p_rx;          // NULL: received data are dropped
+    uint32_t                size;           // Number of bytes (multiple of the data width)
+    const SPI_SEGMENT       *p_segments;    // If not NULL, replaces p_tx/p_rx/size (one chip select for all the segments)
+    uint8_t                 number_of_segments;
+    uint8_t                 segment_index;
+    spi_transfer_callback_t callback;       // Called at the end of the transfer (can be NULL)
+    void                    *p_context;
+    volatile bool           is_pending;     // Set by spi_transfer_submit, cleared at the end of the transfer
+    struct _SPI_TRANSFER    *next;
+} SPI_TRANSFER;
+
+#define SPI_TRANSFER_INSTANCE(_io_port, _io_indice, _mode, _freq_hz, _p_tx, _p_rx, _size, _callback, _p_context)    \
+{                                                   \
+    .chip_select = { _io_port, _io_indice },        \
+    .mode = _mode,                                  \
+    .freq_hz = _freq_hz,                            \
+    .p_tx = _p_tx,                                  \
+    .p_rx = _p_rx,                                  \
+    .size = _size,                                  \
+    .p_segments = NULL,                             \
+    .number_of_segments = 0,                        \
+    .segment_index = 0,                             \
+    .callback = _callback,                          \
+    .p_context = _p_context,                        \
+    .is_pending = false,                            \
+    .next = NULL                                    \
+}
+
+#define SPI_TRANSFER_DEF(_name, _cs_pin, _mode, _freq_hz, _p_tx, _p_rx, _size, _callback, _p_context)   \
+static SPI_TRANSFER _name = SPI_TRANSFER_INSTANCE(_XBR(_cs_pin), _IND(_cs_pin), _mode, _freq_hz, _p_tx, _p_rx, _size, _callback, _p_context)
+
 void SPIInit(SPI_MODULE id, QWORD freqHz, SPI_CONFIG config);
 void SPIEnable(SPI_MODULE mSpiModule, BOOL enable);
 void SPIInitIOAsChipSelect(_IO chip_select);
@@ -259,5 +311,11 @@ BOOL SPIIsTxAvailable(SPI_MODULE mSpiModule);
 BOOL SPIWriteAndStore(SPI_MODULE mSpiModule, _IO chip_select, uint32_t txData, uint32_t* rxData, bool releaseChipSelect);
 BYTE SPIWriteAndStore8_16_32(SPI_MODULE spi_module, _IO chip_select, uint32_t txData, uint32_t *rxData, SPI_CONFIG confMode);
 BYTE SPIWriteAndStoreByteArray(SPI_MODULE spi_module, _IO chip_select, void *txBuffer, void *rxBuffer, uint32_t size);
+BYTE SPIWriteAndStoreSegments(SPI_MODULE spi_module, _IO chip_select, const SPI_SEGMENT *p_segments, uint8_t number_of_segments);
+
+void spi_queue_init(SPI_MODULE id, IRQ_PRIORITY priority);
+bool spi_transfer_submit(SPI_MODULE id, SPI_TRANSFER *p_transfer);
+bool spi_queue_is_idle(SPI_MODULE id);
+void spi_dma_interrupt_handler(SPI_MODULE id);
 
 #endif
@@ -4,6 +4,8 @@
 *
 *	Revision history	:
 *		04/12/2018		- Initial release
+*		17/10/2026		- Add a transaction queue per I2C module driven by the master
+*						event interruption (i2c_transaction_submit).
 *********************************************************************/
 
 #include "../PLIB.h"
@@ -20,6 +22,19 @@ const I2C_REGISTERS * I2cModules[] =
 static uint32_t real_frequency_tab[I2C_NUMBER_OF_MODULES] = {0};
 static serial_event_handler_t serial_event_handler[I2C_NUMBER_OF_MODULES] = {NULL};
 
+typedef struct
+{
+    I2C_TRANSACTION     *p_head;            // Transaction in progress
+    I2C_TRANSACTION     *p_tail;
+    I2C_STATE_MACHIN    state;              // Step of the transaction in progress
+    uint16_t            index;              // Index in p_tx or p_rx
+    bool                is_read_phase;
+    bool                is_initialized;
+    bool                is_irq_enabled;
+} I2C_QUEUE;
+
+static I2C_QUEUE i2c_queue[I2C_NUMBER_OF_MODULES] = {{0}};
+
 void i2c_init_as_master(    I2C_MODULE id, 
                             serial_event_handler_t evt_handler,
                             I2C_FREQUENCY frequency,
@@ -159,3 +174,458 @@ void i2c_interrupt_handler(I2C_MODULE id, IRQ_EVENT_TYPE evt_type, uint32_t data
         (*serial_event_handler[id])(id, evt_type, data);
     }
 }
+
+/*******************************************************************************
+ * Function: 
+ *      void i2c_queue_init(I2C_MODULE id, IRQ_PRIORITY priority)
+ * 
+ * Description:
+ *      This routine initializes the transaction queue of an I2C module. Each
+ *      step of a transaction (start, address, register, data, repeated start,
+ *      acknowledge, stop) is started by the master event of the previous 
+ *      one so a transaction does not need the main loop.
+ *      If priority is not IRQ_PRIORITY_DISABLED, the master event and the bus
+ *      collision interruptions are enabled and the interrupt vector of the 
+ *      module (_I2C_x_VECTOR) must call i2c_master_interrupt_handler(id) (the
+ *      IPL of the vector must match the priority). Otherwise 
+ *      i2c_queue_deamon(id) must be polled.
+ *      The I2C module must be initialized (i2c_init_as_master) without event
+ *      handler.
+ *      This function is called by i2c_transaction_submit (polling mode) if 
+ *      the queue has not been initialized.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ *      priority: The priority of the interruptions (IRQ_PRIORITY_DISABLED for
+ *                  the polling mode).
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      void __ISR(_I2C_2_VECTOR, IPL3SOFT) I2c2Handler(void)
+ *      {
+ *          i2c_master_interrupt_handler(I2C2);
+ *      }
+ *      ...
+ *      i2c_init_as_master(I2C2, NULL, I2C_FREQUENCY_400KHZ, I2C_CONTINUE_ON_IDLE | I2C_DISABLE_SMBUS);
+ *      i2c_queue_init(I2C2, IRQ_PRIORITY_LEVEL_3);
+ ******************************************************************************/
+void i2c_queue_init(I2C_MODULE id, IRQ_PRIORITY priority)
+{
+    I2C_QUEUE *p_queue = &i2c_queue[id];
+    
+    irq_enable(IRQ_I2C1M + id, IRQ_DISABLED);
+    irq_enable(IRQ_I2C1B + id, IRQ_DISABLED);
+    irq_clr_flag(IRQ_I2C1M + id);
+    irq_clr_flag(IRQ_I2C1B + id);
+    
+    p_queue->state = _HOME;
+    p_queue->is_irq_enabled = (priority != IRQ_PRIORITY_DISABLED);
+    p_queue->is_initialized = true;
+    
+    if (p_queue->is_irq_enabled)
+    {
+        IRQInit(IRQ_I2C1M + id, IRQ_ENABLED, priority, IRQ_SUB_PRIORITY_LEVEL_0);
+        IRQInit(IRQ_I2C1B + id, IRQ_ENABLED, priority, IRQ_SUB_PRIORITY_LEVEL_0);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static bool i2c_is_bus_idle(I2C_MODULE id)
+ * 
+ * Description:
+ *      This routine returns the state of the bus: idle if the last condition
+ *      detected is a stop (I2CSTAT.P) or if no start has been detected since
+ *      the module is enabled. After a bus collision, the bus stays busy until
+ *      the stop of the other master.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ * 
+ * Return:
+ *      true if a start can be generated.
+ ******************************************************************************/
+static bool i2c_is_bus_idle(I2C_MODULE id)
+{
+    I2C_REGISTERS * p_i2c = (I2C_REGISTERS *) I2cModules[id];
+    return (p_i2c->I2CSTATbits.P || !p_i2c->I2CSTATbits.S);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void i2c_transaction_start(I2C_MODULE id, I2C_TRANSACTION *p_transaction)
+ * 
+ * Description:
+ *      This routine generates the start condition of a transaction. The 
+ *      next steps are done by i2c_master_interrupt_handler.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ *      *p_transaction: The pointer of the transaction to start.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void i2c_transaction_start(I2C_MODULE id, I2C_TRANSACTION *p_transaction)
+{
+    I2C_QUEUE *p_queue = &i2c_queue[id];
+    
+    p_queue->index = 0;
+    p_queue->is_read_phase = ((p_transaction->register_size == 0) && (p_transaction->tx_size == 0));
+    p_queue->state = _START;
+    i2c_start(id);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void i2c_queue_start_when_idle(I2C_MODULE id)
+ * 
+ * Description:
+ *      This routine starts the transaction at the head of the queue if it 
+ *      is waiting for the bus (_WAIT_BUS_IDLE) and if the bus is idle.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void i2c_queue_start_when_idle(I2C_MODULE id)
+{
+    I2C_QUEUE *p_queue = &i2c_queue[id];
+    
+    if ((p_queue->state == _WAIT_BUS_IDLE) && i2c_is_bus_idle(id))
+    {
+        i2c_transaction_start(id, p_queue->p_head);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      static void i2c_transaction_end(I2C_MODULE id)
+ * 
+ * Description:
+ *      This routine removes the transaction in progress from the queue, 
+ *      starts the next one (back to back, or as soon as the bus is idle 
+ *      after a bus collision) then calls the callback of the completed one.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+static void i2c_transaction_end(I2C_MODULE id)
+{
+    I2C_QUEUE *p_queue = &i2c_queue[id];
+    I2C_TRANSACTION *p_transaction = p_queue->p_head;
+    
+    p_queue->p_head = p_transaction->next;
+    if (p_queue->p_head == NULL)
+    {
+        p_queue->state = _HOME;
+        p_queue->p_tail = NULL;
+    }
+    else
+    {
+        p_queue->state = _WAIT_BUS_IDLE;
+        i2c_queue_start_when_idle(id);
+    }
+    
+    p_transaction->next = NULL;
+    p_transaction->is_pending = false;
+    if (p_transaction->callback != NULL)
+    {
+        (*p_transaction->callback)(p_transaction->p_context);
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool i2c_transaction_submit(I2C_MODULE id, I2C_TRANSACTION *p_transaction)
+ * 
+ * Description:
+ *      This routine adds a transaction at the end of the queue of an I2C 
+ *      module. The transaction starts immediately if the queue is empty 
+ *      and the bus is idle, otherwise it is started as soon as the previous
+ *      one is completed (or as soon as the stop of the other master is 
+ *      detected after a bus collision).
+ *      A transaction is:
+ *      START - address (W) - register (0, 1 or 2 bytes) - p_tx[0..tx_size-1]
+ *      then, if rx_size > 0:
+ *      RESTART - address (R) - p_rx[0..rx_size-1] (the last byte is NACK)
+ *      and STOP. If there is neither register nor p_tx, the transaction 
+ *      begins directly with the read. The data bursts rely on the register
+ *      auto-increment of the component (PCA9685: MODE1.AI, some sensors: 
+ *      bit 7 of the register address).
+ *      At the end, .result is set, .is_pending is cleared and the .callback
+ *      is called (from the interruption if it is enabled). If the component
+ *      does not acknowledge a byte, the transaction is stopped with 
+ *      .result = I2C_TRANSACTION_NACK.
+ *      The I2C_TRANSACTION and its buffers must not be modified while the 
+ *      transaction is pending. No memory is allocated: the queue is a linked
+ *      list of the I2C_TRANSACTION themselves.
+ *      Do not mix the queue with the byte functions (i2c_start, i2c_send_byte
+ *      ...) on a same I2C module.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ *      *p_transaction: The pointer of the transaction to add.
+ * 
+ * Return:
+ *      true if the transaction has been added, false if it is already pending
+ *      or invalid (register_size > 2, size without buffer or nothing to do).
+ * 
+ * Example:
+ *      static uint8_t acc[6];
+ *      I2C_TRANSACTION_DEF(read_acc, 0x30, (0x28 | 0x80), 1, NULL, 0, acc, 6, NULL, NULL);
+ *      i2c_transaction_submit(I2C2, &read_acc);
+ *      ...
+ *      if (!read_acc.is_pending && (read_acc.result == I2C_TRANSACTION_SUCCESS)) { ... }
+ ******************************************************************************/
+bool i2c_transaction_submit(I2C_MODULE id, I2C_TRANSACTION *p_transaction)
+{
+    I2C_QUEUE *p_queue = &i2c_queue[id];
+    uint32_t status;
+    
+    if (p_transaction->is_pending)
+    {
+        return false;
+    }
+    if ((p_transaction->register_size > 2) || 
+        ((p_transaction->tx_size > 0) && (p_transaction->p_tx == NULL)) || 
+        ((p_transaction->rx_size > 0) && (p_transaction->p_rx == NULL)) || 
+        ((p_transaction->register_size == 0) && (p_transaction->tx_size == 0) && (p_transaction->rx_size == 0)))
+    {
+        return false;
+    }
+    
+    if (!p_queue->is_initialized)
+    {
+        i2c_queue_init(id, IRQ_PRIORITY_DISABLED);
+    }
+    
+    p_transaction->next = NULL;
+    p_transaction->result = I2C_TRANSACTION_SUCCESS;
+    p_transaction->is_pending = true;
+    
+    status = __builtin_disable_interrupts();
+    if (p_queue->p_head == NULL)
+    {
+        p_queue->p_head = p_transaction;
+        p_queue->p_tail = p_transaction;
+        p_queue->state = _WAIT_BUS_IDLE;
+    }
+    else
+    {
+        p_queue->p_tail->next = p_transaction;
+        p_queue->p_tail = p_transaction;
+    }
+    i2c_queue_start_when_idle(id);
+    if (status & 0x00000001)
+    {
+        __builtin_enable_interrupts();
+    }
+    
+    return true;
+}
+
+/*******************************************************************************
+ * Function: 
+ *      bool i2c_queue_is_idle(I2C_MODULE id)
+ * 
+ * Description:
+ *      This routine returns the state of the queue of an I2C module.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ * 
+ * Return:
+ *      true if there is no transaction in progress or waiting.
+ ******************************************************************************/
+bool i2c_queue_is_idle(I2C_MODULE id)
+{
+    return (i2c_queue[id].p_head == NULL);
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void i2c_queue_deamon(I2C_MODULE id)
+ * 
+ * Description:
+ *      This routine advances the transactions of an I2C module in polling 
+ *      mode (call it in the main loop). If the interruptions are enabled
+ *      (see. i2c_queue_init), it only starts the next transaction when the
+ *      bus is idle again after a bus collision (no interruption on the stop
+ *      of the other master). Drivers using the queue can call it in both 
+ *      cases.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ * 
+ * Return:
+ *      none
+ ******************************************************************************/
+void i2c_queue_deamon(I2C_MODULE id)
+{
+    uint32_t status;
+    
+    if (i2c_queue[id].is_initialized && !i2c_queue[id].is_irq_enabled)
+    {
+        i2c_master_interrupt_handler(id);
+    }
+    else if (i2c_queue[id].is_initialized && (i2c_queue[id].state == _WAIT_BUS_IDLE))
+    {
+        status = __builtin_disable_interrupts();
+        i2c_queue_start_when_idle(id);
+        if (status & 0x00000001)
+        {
+            __builtin_enable_interrupts();
+        }
+    }
+}
+
+/*******************************************************************************
+ * Function: 
+ *      void i2c_master_interrupt_handler(I2C_MODULE id)
+ * 
+ * Description:
+ *      This routine must be called by the interrupt vector of the I2C module
+ *      (master event and bus collision) or polled with i2c_queue_deamon. 
+ *      At each master event, it starts the next step of the transaction in 
+ *      progress. It does nothing if there is no event.
+ *      A bus collision ends the transaction in progress (result = 
+ *      I2C_TRANSACTION_BUS_COLLISION), the module having released the bus.
+ *      The next transaction waits for the stop of the other master 
+ *      (_WAIT_BUS_IDLE, I2CSTAT.P): a start on the busy bus would collide 
+ *      again.
+ * 
+ * Parameters:
+ *      id: The I2C module you want to use.
+ * 
+ * Return:
+ *      none
+ * 
+ * Example:
+ *      See. i2c_queue_init
+ ******************************************************************************/
+void i2c_master_interrupt_handler(I2C_MODULE id)
+{
+    I2C_REGISTERS * p_i2c = (I2C_REGISTERS *) I2cModules[id];
+    I2C_QUEUE *p_queue = &i2c_queue[id];
+    I2C_TRANSACTION *p_transaction = p_queue->p_head;
+    
+    if (p_i2c->I2CSTATbits.BCL)
+    {
+        p_i2c->I2CSTATCLR = _I2C1STAT_BCL_MASK;
+        irq_clr_flag(IRQ_I2C1B + id);
+        irq_clr_flag(IRQ_I2C1M + id);
+        if (p_transaction != NULL)
+        {
+            p_transaction->result = I2C_TRANSACTION_BUS_COLLISION;
+            i2c_transaction_end(id);
+        }
+        return;
+    }
+    if (p_queue->state == _WAIT_BUS_IDLE)
+    {
+        irq_clr_flag(IRQ_I2C1M + id);
+        i2c_queue_start_when_idle(id);
+        return;
+    }
+    if (!irq_get_flag(IRQ_I2C1M + id))
+    {
+        return;
+    }
+    irq_clr_flag(IRQ_I2C1M + id);
+    if (p_transaction == NULL)
+    {
+        return;
+    }
+    
+    switch (p_queue->state)
+    {
+        case _START:
+        case _RESTART:
+            
+            p_i2c->I2CTX = (p_transaction->address_component & 0xfe) | (p_queue->is_read_phase ? 0x01 : 0x00);
+            p_queue->state = _ADDRESS_COMPONENT_LSB;
+            break;
+            
+        case _ADDRESS_COMPONENT_LSB:
+        case _ADDRESS_REGISTER_MSB:
+        case _ADDRESS_REGISTER_LSB:
+        case _SEND_BYTE:
+            
+            if (p_i2c->I2CSTATbits.ACKSTAT)
+            {
+                p_transaction->result = I2C_TRANSACTION_NACK;
+                p_queue->state = _STOP;
+                i2c_stop(id);
+            }
+            else if (p_queue->is_read_phase)
+            {
+                p_queue->state = _READ_BYTE;
+                i2c_receiver_active_sequence(id);
+            }
+            else if ((p_queue->state == _ADDRESS_COMPONENT_LSB) && (p_transaction->register_size == 2))
+            {
+                p_i2c->I2CTX = (p_transaction->address_register >> 8) & 0xff;
+                p_queue->state = _ADDRESS_REGISTER_MSB;
+            }
+            else if (((p_queue->state == _ADDRESS_COMPONENT_LSB) && (p_transaction->register_size == 1)) || (p_queue->state == _ADDRESS_REGISTER_MSB))
+            {
+                p_i2c->I2CTX = (p_transaction->address_register >> 0) & 0xff;
+                p_queue->state = _ADDRESS_REGISTER_LSB;
+            }
+            else if (p_queue->index < p_transaction->tx_size)
+            {
+                p_i2c->I2CTX = p_transaction->p_tx[p_queue->index++];
+                p_queue->state = _SEND_BYTE;
+            }
+            else if (p_transaction->rx_size > 0)
+            {
+                p_queue->index = 0;
+                p_queue->is_read_phase = true;
+                p_queue->state = _RESTART;
+                i2c_restart(id);
+            }
+            else
+            {
+                p_queue->state = _STOP;
+                i2c_stop(id);
+            }
+            break;
+            
+        case _READ_BYTE:
+            
+            p_transaction->p_rx[p_queue->index++] = (uint8_t) p_i2c->I2CRX;
+            p_queue->state = _WAIT_AND_VERIFY;
+            i2c_send_ack(id, (p_queue->index < p_transaction->rx_size));
+            break;
+            
+        case _WAIT_AND_VERIFY:
+            
+            if (p_queue->index < p_transaction->rx_size)
+            {
+                p_queue->state = _READ_BYTE;
+                i2c_receiver_active_sequence(id);
+            }
+            else
+            {
+                p_queue->state = _STOP;
+                i2c_stop(id);
+            }
+            break;
+            
+        case _STOP:
+            
+            i2c_transaction_end(id);
+            break;
+            
+        default:
+            break;
+    }
+}
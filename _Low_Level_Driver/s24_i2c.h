@@ -50,6 +50,7 @@ typedef enum
     _SEND_BYTE,
     _READ_BYTE,
     _WAIT_AND_VERIFY,
+    _WAIT_BUS_IDLE,
     _STOP,
     _FAIL
 } I2C_STATE_MACHIN;
@@ -77,16 +78,55 @@ typedef struct
     .module = _module,                              \
     .address_component = _address,                  \
     .address_registers = 0,                         \
-    .bus_management_params =                        \
-    {                                               \
-        .is_running = false,                        \
-        .waiting_period = _periodic_time,           \
-        .tick = -1                                  \
-    },                                              \
+    .bus_management_params = BUS_MANAGEMENT_PARAMS_INSTANCE(_periodic_time), \
     .flags = _flags,                                \
     .state_machine = {0}                            \
 }
 
+typedef void (*i2c_transaction_callback_t)(void *p_context);
+
+typedef enum
+{
+    I2C_TRANSACTION_SUCCESS = 0,
+    I2C_TRANSACTION_NACK,                   // The component (or one of the bytes) has not been acknowledged
+    I2C_TRANSACTION_BUS_COLLISION
+} I2C_TRANSACTION_RESULT;
+
+typedef struct _I2C_TRANSACTION
+{
+    uint8_t                     address_component;  // 8 bits address (write), the R/W bit is set by the driver
+    uint16_t                    address_register;
+    uint8_t                     register_size;      // 0, 1 or 2 bytes (MSB first)
+    const uint8_t               *p_tx;              // Sent after the register (auto-increment burst)
+    uint16_t                    tx_size;
+    uint8_t                     *p_rx;              // Read after a repeated start (or a start if nothing is written)
+    uint16_t                    rx_size;
+    i2c_transaction_callback_t  callback;           // Called at the end of the transaction (can be NULL)
+    void                        *p_context;
+    volatile bool               is_pending;         // Set by i2c_transaction_submit, cleared at the end of the transaction
+    volatile I2C_TRANSACTION_RESULT result;
+    struct _I2C_TRANSACTION     *next;
+} I2C_TRANSACTION;
+
+#define I2C_TRANSACTION_INSTANCE(_address, _register, _register_size, _p_tx, _tx_size, _p_rx, _rx_size, _callback, _p_context)    \
+{                                                   \
+    .address_component = _address,                  \
+    .address_register = _register,                  \
+    .register_size = _register_size,                \
+    .p_tx = _p_tx,                                  \
+    .tx_size = _tx_size,                            \
+    .p_rx = _p_rx,                                  \
+    .rx_size = _rx_size,                            \
+    .callback = _callback,                          \
+    .p_context = _p_context,                        \
+    .is_pending = false,                            \
+    .result = I2C_TRANSACTION_SUCCESS,              \
+    .next = NULL                                    \
+}
+
+#define I2C_TRANSACTION_DEF(_name, _address, _register, _register_size, _p_tx, _tx_size, _p_rx, _rx_size, _callback, _p_context)   \
+static I2C_TRANSACTION _name = I2C_TRANSACTION_INSTANCE(_address, _register, _register_size, _p_tx, _tx_size, _p_rx, _rx_size, _callback, _p_context)
+
 typedef union 
 {
   struct 
@@ -210,4 +250,10 @@ bool i2c_is_busy(I2C_MODULE id);
 void i2c_set_slave_address(I2C_MODULE id, uint32_t address, uint32_t mask, I2C_ADDRESS_MODE mode);
 void i2c_interrupt_handler(I2C_MODULE id, IRQ_EVENT_TYPE evt_type, uint32_t data);
 
+void i2c_queue_init(I2C_MODULE id, IRQ_PRIORITY priority);
+bool i2c_transaction_submit(I2C_MODULE id, I2C_TRANSACTION *p_transaction);
+bool i2c_queue_is_idle(I2C_MODULE id);
+void i2c_queue_deamon(I2C_MODULE id);
+void i2c_master_interrupt_handler(I2C_MODULE id);
+
 #endif
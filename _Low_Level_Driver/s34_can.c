@@ -9,6 +9,23 @@
 *                       - Improvement of the CANTaskTx() routine 
 *                       - Sort by increasing period when a frame is added CANAddFrame() -> Necessary for the new CANTaskTx()
 *                       - Global refresh in can.h and can.c
+*       17/10/2026      - Reception drained from the interrupt (CANTaskRx) into a ring buffer
+*                         and stored by CANDeamonRx (main loop) in a preallocated CAN_FRAMES table
+*                       - CAN_FRAMES_DEF: static tables with a hash index on the ID (no more malloc)
+*                       - Extended ID received = (SID << 18) | EID (29 bits)
+*                       - CANTaskTx: min-heap on the next transmission time, fills all the free
+*                         places of the Tx FIFO in one pass (a frame stays due if the FIFO is full)
+*                       - Up to CAN_FRAMES_MAX frames (16 bits indices), CANGetIndiceID / CANGetFrame
+*                         take a pointer on the CAN_FRAMES variable
+*                       - Extended ID transmitted = SID: bits 28..18 / EID: bits 17..0
+*                       - CANFiltersCompile: masks and filters computed from a list of IDs / ranges
+*                       - Filters / masks with CAN_FILTER_EXTENDED in the layout of the received IDs,
+*                         CAN_FILTER_MIDE to tell apart the standard and extended frames
+*                       - The frames of a CAN_FRAMES variable are found by key (ID + IDE): a standard
+*                         and an extended frame with the same ID are two frames. The 'id' parameter
+*                         of CANGetFrame, CANSetData... is CAN_FRAME_KEY(id, CAN_ID_EXTENDED) for an
+*                         extended frame (the ID alone for a standard frame)
+*                       - CANFreedomReceiveMemory: cursor in the CAN_FRAMES variable
 *
 * 
 * FILTERS:
@@ -28,12 +45,16 @@
 * and active only one filter assign with this mask:
 * filters.mask[CAN_FILTER_MASK0] = 0x00000000;
 * filters.enableFilterAndAttachMask[CAN_FILTER0] = CAN_ENABLE_FILTER | CAN_FILTER_MASK0; 
+* The CAN_FILTERS variable can also be computed by CANFiltersCompile from the list of IDs and ranges
+* of IDs the application subscribes to (it minimises the IDs accepted by the hardware and not subscribed).
+* An ID or a mask with CAN_FILTER_EXTENDED is in the layout of the received IDs ((SID << 18) | EID),
+* otherwise SID = bits 10..0. A mask with CAN_FILTER_MIDE accepts only the type of frame of the filter.
 * 
 * 
 * Example of application in the main program:
 
-    CAN_FRAMES framesTx = INIT_CAN_FRAMES();                // Define Tx variable
-    CAN_FRAMES framesRx = INIT_CAN_FRAMES();                // Define Rx variable
+    CAN_FRAMES_DEF(framesTx, 16);                           // Define Tx variable (16 frames max)
+    CAN_FRAMES_DEF(framesRx, 32);                           // Define Rx variable (32 frames max)
     CAN_FILTERS filters = INIT_CAN_FILTERS();               // Define filters variable
     ...
     filters.mask[CAN_FILTER_MASK0] = CAN_DEFAULT_MASK0;     // Param MASK 0
@@ -55,7 +76,7 @@
 
      while(1)
     {
-        CAN_FRAME *frame_0x300 = CANGetFrame(framesRx, 0x300);
+        CAN_FRAME *frame_0x300 = CANGetFrame(&framesRx, 0x300);
         
         CANSetData1Byte(&framesTx, 0x600, 0, framesRx.numberOfFrame);
         if(framesRx.numberOfFrame > 0)
@@ -78,11 +99,18 @@
             ...
         }
 
+        CANDeamonRx(CAN1);
         CANFreedomReceiveMemory(&framesRx, TICK_2S);
         CANTaskTx(CAN1, &framesTx);
         CANDeamonFilters(CAN1, &filters);
 
     }
+
+    void __ISR(_CAN_1_VECTOR, IPL5SOFT) Can1Handler(void)   // IRQInit(IRQ_CAN1, IRQ_ENABLED, IRQ_PRIORITY_LEVEL_5, IRQ_SUB_PRIORITY_LEVEL_0)
+    {
+        CANTaskRx(CAN1);
+        irq_clr_flag(IRQ_CAN1);
+    }
 *********************************************************************/
 
 #include "../PLIB.h"
@@ -90,6 +118,16 @@
 CAN_FILTERS currentFilters[CAN_NUM_OF_MODULES] = {INIT_CAN_FILTERS(), INIT_CAN_FILTERS()};
 BYTE CANMessageFifoArea[CAN_NUM_OF_MODULES][CAN_SIZE_MESSAGE_FIFO_AREA];
 CAN_FRAMES *mCANAdressFramesRx[CAN_NUM_OF_MODULES];
+
+// Rx ring (single producer: CANTaskRx in the interrupt / single consumer: CANDeamonRx).
+static CAN_RX_ENTRY canRxRing[CAN_NUM_OF_MODULES][CAN_RX_RING_SIZE];
+static volatile uint16_t canRxHead[CAN_NUM_OF_MODULES] = {0};      // Only written by CANTaskRx
+static volatile uint16_t canRxTail[CAN_NUM_OF_MODULES] = {0};      // Only written by CANDeamonRx
+static CAN_RX_STATS canRxStats[CAN_NUM_OF_MODULES];
+
+#define CAN_FRAMES_HASH(key)        (((key) * 2654435761u) >> 16)
+#define CAN_FRAMES_KEY(frames, slot) CAN_FRAME_KEY((frames)->ptrFrames[slot].id, (frames)->ptrFrames[slot].idExtended)
+#define CAN_FRAME_DUE(frames, slot) ((frames)->ptrFrames[slot].tick + (frames)->ptrFrames[slot].period)
 const CAN_REGISTERS * mCANModules[CAN_NUM_OF_MODULES] = 
 {
 #ifdef CAN1_BASE_ADDRESS
@@ -209,7 +247,9 @@ void CANInit(CAN_MODULE module, DWORD busSpeed)
 
     filter      - the desire Filter n (n=0..31).
 
-    id          - the new ID for the selected filter n.
+    id          - the new ID for the selected filter n. Standard (legacy) layout:
+                  SID = bits 10..0, EID = bits 28..11. With CAN_FILTER_EXTENDED:
+                  extended frame, ID = (SID << 18) | EID (as the received IDs).
 
   Returns:
 
@@ -227,12 +267,19 @@ static void CANConfigFilter(CAN_MODULE module, CAN_FILTER filter, UINT32 id)
     saveEnableMask = (canRegisters->canFilterControlRegs[mCANFilterControlMap[filter].fltcon].CxFLTCON & mCANFilterControlMap[filter].fltEnMask);
     // Disable filter
     canRegisters->canFilterControlRegs[mCANFilterControlMap[filter].fltcon].CxFLTCONCLR = mCANFilterControlMap[filter].fltEnMask;    
-	id &= 0x1FFFFFFF;
-    sid = (id & 0x7FF);
-    eid = (id & 0x1FFFF800) >> 11;
+    if(id & CAN_FILTER_EXTENDED)
+    {
+        sid = (id >> 18) & 0x7FF;
+        eid = id & 0x3FFFF;
+    }
+    else
+    {
+        sid = (id & 0x7FF);
+        eid = (id & 0x1FFFF800) >> 11;
+    }
     canRegisters->canFilterRegs[filter].CxRXFbits.SID = sid;
     canRegisters->canFilterRegs[filter].CxRXFbits.EID = eid;
-    canRegisters->canFilterRegs[filter].CxRXFbits.EXID = 1;
+    canRegisters->canFilterRegs[filter].CxRXFbits.EXID = (id & CAN_FILTER_EXTENDED) ? 1 : 0;
     // Restore enable mask
     if(saveEnableMask > 0)
     {
@@ -256,7 +303,9 @@ static void CANConfigFilter(CAN_MODULE module, CAN_FILTER filter, UINT32 id)
 
     mask        - the desire Mask n (n=0..3).
 
-    maskbits    - the new value for the selected mask n.
+    maskbits    - the new value for the selected mask n. Same layouts as the
+                  filters (CAN_FILTER_EXTENDED). With CAN_FILTER_MIDE, the
+                  type of frame (standard / extended) must match the filter.
 
   Returns:
 
@@ -273,12 +322,19 @@ static void CANConfigMask(CAN_MODULE module, CAN_FILTER_MASK mask, UINT32 maskbi
     CANSetOperatingMode(module, CAN_CONFIGURATION);
     while(CANGetOperatingMode(module) != CAN_CONFIGURATION);
     
-	maskbits &= 0x1FFFFFFF;
-    sid = (maskbits & 0x7FF);
-    eid = (maskbits & 0x1FFFF800) >> 11;
+    if(maskbits & CAN_FILTER_EXTENDED)
+    {
+        sid = (maskbits >> 18) & 0x7FF;
+        eid = maskbits & 0x3FFFF;
+    }
+    else
+    {
+        sid = (maskbits & 0x7FF);
+        eid = (maskbits & 0x1FFFF800) >> 11;
+    }
     canRegisters->canFilterMaskRegs[mask].CxRXMbits.SID = sid;
     canRegisters->canFilterMaskRegs[mask].CxRXMbits.EID = eid;
-    canRegisters->canFilterMaskRegs[mask].CxRXMbits.MIDE = 0;
+    canRegisters->canFilterMaskRegs[mask].CxRXMbits.MIDE = (maskbits & CAN_FILTER_MIDE) ? 1 : 0;
     
     // Set Normal mode
     CANSetOperatingMode(module, CAN_NORMAL_OPERATION);
@@ -380,6 +436,497 @@ void CANDeamonFilters(CAN_MODULE module, CAN_FILTERS *filters)
     }
 }
 
+/*******************************************************************************
+  Function:
+    static UINT32 CANFilterEntrySize(UINT32 mask)
+
+  Description:
+    This routine returns the size of the block of keys accepted by a filter
+    with the mask in parameter (2 ^ number of "don't care" bits). It is the
+    cost used by the planner (a standard ID is a block of 2^18 keys).
+
+  Parameters:
+    mask        - The mask (30 bits key: IDE, SID, EID).
+
+  Returns:
+    The number of accepted keys.
+  *****************************************************************************/
+static UINT32 CANFilterEntrySize(UINT32 mask)
+{
+    return (1ul << (30 - __builtin_popcount(mask & CAN_FILTER_KEY_MAX)));
+}
+
+/*******************************************************************************
+  Function:
+    static UINT32 CANFilterEntryAccepted(const CAN_FILTER_ENTRY *entry)
+
+  Description:
+    This routine returns the number of IDs (standard and extended) accepted
+    by an entry of the planner.
+
+  Parameters:
+    entry       - The entry (30 bits key: IDE, SID, EID).
+
+  Returns:
+    The number of accepted IDs.
+  *****************************************************************************/
+static UINT32 CANFilterEntryAccepted(const CAN_FILTER_ENTRY *entry)
+{
+    BYTE dcSid = 11 - __builtin_popcount(entry->mask & 0x1FFC0000);
+    BYTE dcEid = 18 - __builtin_popcount(entry->mask & 0x0003FFFF);
+    UINT32 accepted = 0;
+
+    if(!(entry->mask & CAN_FILTER_EXTENDED) || !(entry->id & CAN_FILTER_EXTENDED))
+    {
+        accepted += (1ul << dcSid);             // Standard frames (the EID is not compared)
+    }
+    if(!(entry->mask & CAN_FILTER_EXTENDED) || (entry->id & CAN_FILTER_EXTENDED))
+    {
+        accepted += (1ul << (dcSid + dcEid));   // Extended frames
+    }
+    return accepted;
+}
+
+/*******************************************************************************
+  Function:
+    static BOOL CANFiltersRangeGet(const CAN_ID_RANGE *range, UINT32 *first, UINT32 *last)
+
+  Description:
+    This routine returns the bounds of a range of IDs: standard IDs are
+    0..0x7FF, extended IDs are CAN_FILTER_EXTENDED | ID. A range is extended
+    if it is declared with CAN_FILTER_EXTENDED (INIT_CAN_EXT_ID...) or if its
+    last ID is above 0x7FF.
+
+  Parameters:
+    range       - The range of IDs.
+
+    first       - The first ID of the range.
+
+    last        - The last ID of the range.
+
+  Returns:
+    TRUE if the range is extended.
+  *****************************************************************************/
+static BOOL CANFiltersRangeGet(const CAN_ID_RANGE *range, UINT32 *first, UINT32 *last)
+{
+    if(((range->first | range->last) & CAN_FILTER_EXTENDED) || ((range->last & CAN_ID_MAX) > 0x7FF))
+    {
+        *first = (range->first & CAN_ID_MAX) | CAN_FILTER_EXTENDED;
+        *last = (range->last & CAN_ID_MAX) | CAN_FILTER_EXTENDED;
+        return TRUE;
+    }
+    *first = range->first & 0x7FF;
+    *last = range->last & 0x7FF;
+    return FALSE;
+}
+
+/*******************************************************************************
+  Function:
+    static BYTE CANFiltersPlanAbsorb(CAN_FILTER_ENTRY *entries, BYTE n, BYTE ind)
+
+  Description:
+    This routine removes the entries accepting a subset of the IDs of the
+    entry 'ind' (useless filters).
+
+  Parameters:
+    entries     - The working entries of the planner.
+
+    n           - The number of entries.
+
+    ind         - The indice of the reference entry.
+
+  Returns:
+    The new number of entries.
+  *****************************************************************************/
+static BYTE CANFiltersPlanAbsorb(CAN_FILTER_ENTRY *entries, BYTE n, BYTE ind)
+{
+    UINT32 mask = entries[ind].mask;
+    UINT32 id = entries[ind].id;
+    BYTE i = 0;
+
+    while(i < n)
+    {
+        if((i != ind) && ((mask & ~entries[i].mask) == 0) && ((entries[i].id & mask) == id))
+        {
+            entries[i] = entries[--n];
+            if(ind == n)
+            {
+                ind = i;
+            }
+            continue;
+        }
+        i++;
+    }
+    return n;
+}
+
+/*******************************************************************************
+  Function:
+    static BYTE CANFiltersPlanMergeBest(CAN_FILTER_ENTRY *entries, BYTE n)
+
+  Description:
+    This routine merges the two entries adding the fewest false accepts:
+    the merged mask only keeps the bits common to both masks for which
+    both IDs are equal.
+
+  Parameters:
+    entries     - The working entries of the planner.
+
+    n           - The number of entries (>= 2).
+
+  Returns:
+    The new number of entries.
+  *****************************************************************************/
+static BYTE CANFiltersPlanMergeBest(CAN_FILTER_ENTRY *entries, BYTE n)
+{
+    BYTE i, j, best_i = 0, best_j = 1;
+    int32_t cost, best_cost = 0x7FFFFFFF;
+    UINT32 mask;
+
+    for(i = 0 ; i < n ; i++)
+    {
+        for(j = i + 1 ; j < n ; j++)
+        {
+            mask = entries[i].mask & entries[j].mask & ~(entries[i].id ^ entries[j].id);
+            cost = (int32_t) CANFilterEntrySize(mask) - (int32_t) CANFilterEntrySize(entries[i].mask) - (int32_t) CANFilterEntrySize(entries[j].mask);
+            if(cost < best_cost)
+            {
+                best_cost = cost;
+                best_i = i;
+                best_j = j;
+            }
+        }
+    }
+
+    entries[best_i].mask &= entries[best_j].mask & ~(entries[best_i].id ^ entries[best_j].id);
+    entries[best_i].id &= entries[best_i].mask;
+    entries[best_j] = entries[--n];
+    if(best_i == n)
+    {
+        best_i = best_j;
+    }
+    return CANFiltersPlanAbsorb(entries, n, best_i);
+}
+
+/*******************************************************************************
+  Function:
+    static BYTE CANFiltersPlanGetMasks(CAN_FILTER_ENTRY *entries, BYTE n, UINT32 *masks)
+
+  Description:
+    This routine lists the different masks used by the entries.
+
+  Parameters:
+    entries     - The working entries of the planner.
+
+    n           - The number of entries.
+
+    masks       - The list of masks (n elements max).
+
+  Returns:
+    The number of different masks.
+  *****************************************************************************/
+static BYTE CANFiltersPlanGetMasks(CAN_FILTER_ENTRY *entries, BYTE n, UINT32 *masks)
+{
+    BYTE i, j, numberOfMasks = 0;
+
+    for(i = 0 ; i < n ; i++)
+    {
+        for(j = 0 ; (j < numberOfMasks) && (masks[j] != entries[i].mask) ; j++);
+        if(j == numberOfMasks)
+        {
+            masks[numberOfMasks++] = entries[i].mask;
+        }
+    }
+    return numberOfMasks;
+}
+
+/*******************************************************************************
+  Function:
+    static BYTE CANFiltersPlanMergeMasks(CAN_FILTER_ENTRY *entries, BYTE n)
+
+  Description:
+    This routine replaces the two masks whose merge (common bits) adds the
+    fewest false accepts on the entries using them.
+
+  Parameters:
+    entries     - The working entries of the planner.
+
+    n           - The number of entries.
+
+  Returns:
+    The new number of entries.
+  *****************************************************************************/
+static BYTE CANFiltersPlanMergeMasks(CAN_FILTER_ENTRY *entries, BYTE n)
+{
+    UINT32 masks[CAN_FILTERS_PLAN_SIZE];
+    UINT32 mask, best_a = 0, best_b = 0;
+    UINT32 cost, best_cost = 0xFFFFFFFF;
+    BYTE numberOfMasks = CANFiltersPlanGetMasks(entries, n, masks);
+    BYTE a, b, i;
+
+    for(a = 0 ; a < numberOfMasks ; a++)
+    {
+        for(b = a + 1 ; b < numberOfMasks ; b++)
+        {
+            mask = masks[a] & masks[b];
+            cost = 0;
+            for(i = 0 ; i < n ; i++)
+            {
+                if((entries[i].mask == masks[a]) || (entries[i].mask == masks[b]))
+                {
+                    cost += CANFilterEntrySize(mask) - CANFilterEntrySize(entries[i].mask);
+                }
+            }
+            if(cost < best_cost)
+            {
+                best_cost = cost;
+                best_a = masks[a];
+                best_b = masks[b];
+            }
+        }
+    }
+
+    mask = best_a & best_b;
+    for(i = 0 ; i < n ; i++)
+    {
+        if((entries[i].mask == best_a) || (entries[i].mask == best_b))
+        {
+            entries[i].mask = mask;
+            entries[i].id &= mask;
+        }
+    }
+    for(i = 0 ; i < n ; i++)
+    {
+        n = CANFiltersPlanAbsorb(entries, n, i);
+    }
+    return n;
+}
+
+/*******************************************************************************
+  Function:
+    static BYTE CANFiltersPlanAdd(CAN_FILTER_ENTRY *entries, BYTE n, UINT32 id, UINT32 mask)
+
+  Description:
+    This routine adds an entry (block of IDs) to the planner. If the
+    working entries are full, the two closest entries are merged first.
+
+  Parameters:
+    entries     - The working entries of the planner.
+
+    n           - The number of entries.
+
+    id          - The ID of the block.
+
+    mask        - The mask of the block.
+
+  Returns:
+    The new number of entries.
+  *****************************************************************************/
+static BYTE CANFiltersPlanAdd(CAN_FILTER_ENTRY *entries, BYTE n, UINT32 id, UINT32 mask)
+{
+    BYTE i;
+
+    for(i = 0 ; i < n ; i++)
+    {
+        if(((entries[i].mask & ~mask) == 0) && ((id & entries[i].mask) == entries[i].id))
+        {
+            return n;       // Already accepted
+        }
+    }
+    if(n >= CAN_FILTERS_PLAN_SIZE)
+    {
+        n = CANFiltersPlanMergeBest(entries, n);
+    }
+    entries[n].id = id;
+    entries[n].mask = mask;
+    return CANFiltersPlanAbsorb(entries, n + 1, n);
+}
+
+/*******************************************************************************
+  Function:
+    void CANFiltersCompile(CAN_FILTERS *filters, const CAN_ID_RANGE *ranges, BYTE numberOfRanges, CAN_FILTERS_REPORT *report)
+
+  Description:
+    This routine computes the masks and the filters accepting the IDs (and
+    ranges of IDs) the application subscribes to. The CAN_FILTERS variable
+    is then programmed by CANDeamonFilters (as a hand-packed variable).
+    Each range is split into aligned blocks (one mask/filter each). While
+    there are more than 31 filters, the two filters whose merge adds the
+    fewest accepted IDs are merged. Then, while there are more than 4
+    different masks, the two masks whose merge adds the fewest accepted IDs
+    are merged. The IDs accepted by the hardware but not subscribed
+    (false accepts) are then filtered by the CPU.
+    The standard and extended frames are told apart (IDE compared, MIDE):
+    a range is extended if it is declared with INIT_CAN_EXT_ID(_RANGE) or
+    if its last ID is above 0x7FF. The filters and masks are written in the
+    extended layout (CAN_FILTER_EXTENDED) except the filters of standard
+    frames.
+    The number of accepted IDs is exact with standard IDs only (0..0x7FF)
+    and an upper bound otherwise (overlapping filters are counted twice:
+    64 bits, 31 filters accepting 2^29 extended IDs each do not fit in 32 bits).
+    This routine is long (several ms with many ranges): call it at the
+    initialisation or when the subscriptions change.
+
+  Parameters:
+    filters         - The CAN_FILTERS variable to fill.
+
+    ranges          - The IDs subscribed (first == last for a single ID).
+
+    numberOfRanges  - The number of ranges.
+
+    report          - The result (can be NULL).
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    const CAN_ID_RANGE rxIds[] = {INIT_CAN_ID(0x100), INIT_CAN_ID(0x208), INIT_CAN_ID_RANGE(0x300, 0x37F), INIT_CAN_EXT_ID(0x18FEF100)};
+    CAN_FILTERS filters = INIT_CAN_FILTERS();
+    CAN_FILTERS_REPORT report;
+
+    CANFiltersCompile(&filters, rxIds, 4, &report);
+    ...
+    CANDeamonFilters(CAN1, &filters);
+    </code>
+  *****************************************************************************/
+void CANFiltersCompile(CAN_FILTERS *filters, const CAN_ID_RANGE *ranges, BYTE numberOfRanges, CAN_FILTERS_REPORT *report)
+{
+    CAN_FILTER_ENTRY entries[CAN_FILTERS_PLAN_SIZE];
+    UINT32 masks[CAN_FILTERS_PLAN_SIZE];
+    UINT32 id, first, last, start, end, size, mask;
+    BOOL isStandard = TRUE, found;
+    BYTE n = 0, numberOfMasks, i, j, k;
+
+    // Split every range into aligned blocks of keys: [id, id + 2^k - 1] with id multiple of 2^k
+    // Key = IDE (bit 29) | SID (bits 28..18) | EID (bits 17..0): a standard ID is a block of 2^18 keys.
+    for(i = 0 ; i < numberOfRanges ; i++)
+    {
+        if(CANFiltersRangeGet(&ranges[i], &first, &last))
+        {
+            isStandard = FALSE;
+        }
+        else
+        {
+            first = first << 18;
+            last = (last << 18) | 0x3FFFF;
+        }
+        for(id = first ; (first <= last) && (id <= last) ; id += size)
+        {
+            k = (id == 0) ? 30 : __builtin_ctz(id);
+            k = (k > 30) ? 30 : k;
+            while((id + (1ul << k) - 1) > last)
+            {
+                k--;
+            }
+            size = 1ul << k;
+            n = CANFiltersPlanAdd(entries, n, id, CAN_FILTER_KEY_MAX & ~(size - 1));
+            if((id + size - 1) == last)
+            {
+                break;
+            }
+        }
+    }
+
+    while(n > 31)
+    {
+        n = CANFiltersPlanMergeBest(entries, n);
+    }
+    while((numberOfMasks = CANFiltersPlanGetMasks(entries, n, masks)) > CAN_NUM_OF_FILTER_MASKS)
+    {
+        n = CANFiltersPlanMergeMasks(entries, n);
+    }
+
+    // Keys -> CAN_FILTERS (the masks are always in the extended layout, MIDE = IDE bit of the key)
+    for(i = 0 ; i < CAN_NUM_OF_FILTER_MASKS ; i++)
+    {
+        mask = (i < numberOfMasks) ? masks[i] : CAN_FILTER_KEY_MAX;
+        filters->mask[i] = (mask & CAN_ID_MAX) | CAN_FILTER_EXTENDED | ((mask & CAN_FILTER_EXTENDED) ? CAN_FILTER_MIDE : 0);
+    }
+    for(i = 0 ; i < 31 ; i++)
+    {
+        filters->id[i] = 0;
+        filters->enableFilterAndAttachMask[i] = CAN_DISABLE_FILTER;
+        if(i < n)
+        {
+            for(j = 0 ; masks[j] != entries[i].mask ; j++);
+            if((entries[i].mask & CAN_FILTER_EXTENDED) && !(entries[i].id & CAN_FILTER_EXTENDED))
+            {
+                filters->id[i] = (entries[i].id >> 18) & 0x7FF;     // Standard frames only
+            }
+            else
+            {
+                filters->id[i] = entries[i].id | CAN_FILTER_EXTENDED;
+            }
+            filters->enableFilterAndAttachMask[i] = CAN_ENABLE_FILTER | j;
+        }
+    }
+
+    if(report != NULL)
+    {
+        report->numberOfFilters = n;
+        report->numberOfMasks = numberOfMasks;
+        report->subscribed = 0;
+        report->accepted = 0;
+        if(isStandard)
+        {
+            for(id = 0 ; id <= 0x7FF ; id++)
+            {
+                for(i = 0 ; (i < n) && (((id << 18) & entries[i].mask) != entries[i].id) ; i++);
+                report->accepted += (i < n);
+                for(i = 0 ; (i < numberOfRanges) && ((id < (ranges[i].first & 0x7FF)) || (id > (ranges[i].last & 0x7FF))) ; i++);
+                report->subscribed += (i < numberOfRanges);
+            }
+        }
+        else
+        {
+            for(i = 0 ; i < n ; i++)
+            {
+                report->accepted += (QWORD) CANFilterEntryAccepted(&entries[i]);
+            }
+            // Union of the ranges (sweep on the ranges by increasing first ID, the standard IDs first)
+            for(id = 0 ; ; id = end + 1)
+            {
+                found = FALSE;
+                for(i = 0 ; i < numberOfRanges ; i++)
+                {
+                    CANFiltersRangeGet(&ranges[i], &first, &last);
+                    first = (first < id) ? id : first;
+                    if((first <= last) && (last >= id) && (!found || (first < start)))
+                    {
+                        found = TRUE;
+                        start = first;
+                        end = last;
+                    }
+                }
+                if(!found)
+                {
+                    break;
+                }
+                do
+                {
+                    k = 0;
+                    for(i = 0 ; i < numberOfRanges ; i++)
+                    {
+                        CANFiltersRangeGet(&ranges[i], &first, &last);
+                        if((first <= (end + 1)) && (last > end))
+                        {
+                            end = last;
+                            k = 1;
+                        }
+                    }
+                }while(k);
+                report->subscribed += end - start + 1;
+                if(end == CAN_FILTER_KEY_MAX)
+                {
+                    break;
+                }
+            }
+        }
+        report->falseAcceptRatio = (report->accepted == 0) ? 0 : (WORD) ((1000ull * (report->accepted - report->subscribed)) / report->accepted);
+    }
+}
+
 /*******************************************************************************
   Function:
     BOOL CANAddMessageFifoBuffer(CAN_MODULE module, CAN_CHANNEL channel, DWORD id, BOOL idExtended, BYTE length, BYTE* data);
@@ -427,8 +974,8 @@ static BOOL CANAddMessageFifoBuffer(CAN_MODULE module, CAN_CHANNEL channel, DWOR
 
         if(idExtended)
         {
-            sid = 0;
-            eid = (id&0x3FFFFFFF);
+            sid = (id >> 18)&0x000007FF;
+            eid = (id&0x0003FFFF);
         }
 
         message->msgSID.SID = sid;
@@ -506,6 +1053,10 @@ BOOL CANSendMessage(CAN_MODULE module, CAN_CHANNEL channel, DWORD id, BOOL idExt
   Description:
     This routine is the deamon for the CAN transmission (full management of frames).
     This function must be called in the main loop (go inside as much as possible).
+    The enabled frames are kept in a min-heap on their next transmission time
+    (tick + period): only the due frames are read, and all of them are queued
+    in the Tx FIFO in one pass (then flushed). If the FIFO is full, the
+    remaining frames stay due and are sent at the next call.
 
   Parameters:
     module      - Identifies the desired CAN module.
@@ -521,19 +1072,255 @@ BOOL CANSendMessage(CAN_MODULE module, CAN_CHANNEL channel, DWORD id, BOOL idExt
   *****************************************************************************/
 void CANTaskTx(CAN_MODULE module, CAN_FRAMES *frames)
 {     
-    BYTE i = 0;
     CAN_REGISTERS * canRegisters = (CAN_REGISTERS *)mCANModules[module];
+    CAN_FRAME *frame;
+    QWORD tick = mGetTick();
+    BOOL isQueued = FALSE;
+    
+    while(frames->heap_size > 0)
+    {
+        frame = &frames->ptrFrames[frames->p_heap[0]];
+        // The earliest frame is not due (or already sent in this pass): nothing else to send
+        if((frame->tick == tick) || ((tick - frame->tick) < frame->period))
+        {
+            break;
+        }
+        if(!CANAddMessageFifoBuffer(module, CAN_CHANNEL0, frame->id, frame->idExtended, frame->length, frame->data))
+        {
+            break;
+        }
+        frame->tick = tick;
+        CANHeapSiftDown(frames, 0);
+        isQueued = TRUE;
+    }
     
+    if(isQueued)
+    {
+        // TxFlush
+        canRegisters->canFifoRegisters[CAN_CHANNEL0].CxFIFOCONSET = 0x00000008;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    static void CANFramesIndexInsert(CAN_FRAMES *frames, uint16_t slot)
+
+  Description:
+    This routine adds a frame (already stored in the table) to the hash
+    index of the CAN_FRAMES variable (linear probing).
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    slot        - The indice of the frame in the table.
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANFramesIndexInsert(CAN_FRAMES *frames, uint16_t slot)
+{
+    uint16_t i = CAN_FRAMES_HASH(CAN_FRAMES_KEY(frames, slot)) & frames->index_mask;
+
+    while(frames->p_index[i] != 0)
+    {
+        i = (i + 1) & frames->index_mask;
+    }
+    frames->p_index[i] = slot + 1;
+}
+
+/*******************************************************************************
+  Function:
+    static void CANFramesIndexRebuild(CAN_FRAMES *frames)
+
+  Description:
+    This routine rebuilds the hash index when the frames have been moved
+    in the table (removal).
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANFramesIndexRebuild(CAN_FRAMES *frames)
+{
+    uint16_t i;
+
+    memset(frames->p_index, 0, (frames->index_mask + 1) * sizeof(uint16_t));
     for(i = 0 ; i < frames->numberOfFrame ; i++)
     {
-        if((mTickCompare(frames->ptrFrames[i].tick) >= frames->ptrFrames[i].period) && frames->ptrFrames[i].enable)
+        CANFramesIndexInsert(frames, i);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    static void CANHeapSet(CAN_FRAMES *frames, uint16_t position, uint16_t slot)
+
+  Description:
+    This routine stores a slot at a position of the transmission heap and
+    keeps the position in the frame (O(1) removal / update).
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    position    - The position in the heap.
+
+    slot        - The indice of the frame in the table.
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANHeapSet(CAN_FRAMES *frames, uint16_t position, uint16_t slot)
+{
+    frames->p_heap[position] = slot;
+    frames->ptrFrames[slot].heap_position = position;
+}
+
+/*******************************************************************************
+  Function:
+    static void CANHeapSiftUp(CAN_FRAMES *frames, uint16_t position)
+
+  Description:
+    This routine moves up a frame of the heap while its next transmission
+    time is earlier than the one of its parent.
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    position    - The position in the heap.
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANHeapSiftUp(CAN_FRAMES *frames, uint16_t position)
+{
+    uint16_t slot = frames->p_heap[position];
+    QWORD due = CAN_FRAME_DUE(frames, slot);
+    uint16_t parent;
+
+    while(position > 0)
+    {
+        parent = (position - 1) >> 1;
+        if(CAN_FRAME_DUE(frames, frames->p_heap[parent]) <= due)
         {
-            frames->ptrFrames[i].tick = mGetTick();
-            CANAddMessageFifoBuffer(module, CAN_CHANNEL0, frames->ptrFrames[i].id, frames->ptrFrames[i].idExtended, frames->ptrFrames[i].length, frames->ptrFrames[i].data);    
-        } 
+            break;
+        }
+        CANHeapSet(frames, position, frames->p_heap[parent]);
+        position = parent;
     }
-    // TxFlush
-    canRegisters->canFifoRegisters[CAN_CHANNEL0].CxFIFOCONSET = 0x00000008;
+    CANHeapSet(frames, position, slot);
+}
+
+/*******************************************************************************
+  Function:
+    static void CANHeapSiftDown(CAN_FRAMES *frames, uint16_t position)
+
+  Description:
+    This routine moves down a frame of the heap while its next transmission
+    time is later than the one of its earliest child.
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    position    - The position in the heap.
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANHeapSiftDown(CAN_FRAMES *frames, uint16_t position)
+{
+    uint16_t slot = frames->p_heap[position];
+    QWORD due = CAN_FRAME_DUE(frames, slot);
+    uint16_t child;
+
+    while((child = 2*position + 1) < frames->heap_size)
+    {
+        if(((child + 1) < frames->heap_size) && (CAN_FRAME_DUE(frames, frames->p_heap[child + 1]) < CAN_FRAME_DUE(frames, frames->p_heap[child])))
+        {
+            child++;
+        }
+        if(due <= CAN_FRAME_DUE(frames, frames->p_heap[child]))
+        {
+            break;
+        }
+        CANHeapSet(frames, position, frames->p_heap[child]);
+        position = child;
+    }
+    CANHeapSet(frames, position, slot);
+}
+
+/*******************************************************************************
+  Function:
+    static void CANHeapPush(CAN_FRAMES *frames, uint16_t slot)
+
+  Description:
+    This routine adds a frame in the transmission heap.
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    slot        - The indice of the frame in the table.
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANHeapPush(CAN_FRAMES *frames, uint16_t slot)
+{
+    frames->p_heap[frames->heap_size] = slot;
+    CANHeapSiftUp(frames, frames->heap_size++);
+}
+
+/*******************************************************************************
+  Function:
+    static void CANHeapRemove(CAN_FRAMES *frames, uint16_t slot)
+
+  Description:
+    This routine removes a frame from the transmission heap (the last
+    element of the heap takes its position).
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    slot        - The indice of the frame in the table (must be in the heap).
+
+  Returns:
+    None.
+  *****************************************************************************/
+static void CANHeapRemove(CAN_FRAMES *frames, uint16_t slot)
+{
+    uint16_t position = frames->ptrFrames[slot].heap_position;
+    uint16_t last = frames->p_heap[--frames->heap_size];
+
+    if(position < frames->heap_size)
+    {
+        CANHeapSet(frames, position, last);
+        CANHeapSiftUp(frames, position);
+        CANHeapSiftDown(frames, frames->ptrFrames[last].heap_position);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    static BOOL CANHeapContains(CAN_FRAMES *frames, uint16_t slot)
+
+  Description:
+    This routine checks if a frame is scheduled for transmission (the Rx
+    frames are never in the heap).
+
+  Parameters:
+    frames      - The CAN_FRAMES variable.
+
+    slot        - The indice of the frame in the table.
+
+  Returns:
+    TRUE if the frame is in the heap.
+  *****************************************************************************/
+static BOOL CANHeapContains(CAN_FRAMES *frames, uint16_t slot)
+{
+    uint16_t position = frames->ptrFrames[slot].heap_position;
+
+    return ((position < frames->heap_size) && (frames->p_heap[position] == slot));
 }
 
 /*******************************************************************************
@@ -541,12 +1328,13 @@ void CANTaskTx(CAN_MODULE module, CAN_FRAMES *frames)
     void CANAddFrame(CAN_FRAMES *frames, DWORD id, BOOL idExtended, BYTE length, QWORD period)
 
   Description:
-    This routine allow the user to create a new CAN frame. Each time a frame is
-    created (or removed) the RAM memory is dynamically modify. Thus the RAM
-    size is never constant and depends of the number of frame (Tx and Rx).
+    This routine allow the user to create a new CAN frame. The frames are
+    stored in the table allocated by CAN_FRAMES_DEF (no dynamic memory) and
+    scheduled for transmission (first transmission at TICK_INIT + period).
+    Nothing is done if the ID already exists or if the table is full.
 
   Parameters:
-    frames      - The CAN_FRAMES variable containing all dynamic frames.
+    frames      - The CAN_FRAMES variable containing all frames.
 
     id          - The desier identifier.
 
@@ -564,54 +1352,22 @@ void CANTaskTx(CAN_MODULE module, CAN_FRAMES *frames)
     </code>
   *****************************************************************************/
 void CANAddFrame(CAN_FRAMES *frames, DWORD id, BOOL idExtended, BYTE length, QWORD period)
-{    
-    BYTE i = 0;
-    BYTE ind = frames->numberOfFrame;
-    
-    if(CANGetIndiceID(*frames, id) == -1)
+{
+    uint16_t ind = frames->numberOfFrame;
+
+    if((CANGetIndiceID(frames, CAN_FRAME_KEY(id, idExtended)) == -1) && (frames->numberOfFrame < frames->maxNumberOfFrame))
     {
-        if(frames->numberOfFrame == 0)
-        {
-            frames->ptrFrames = malloc(sizeof(CAN_FRAME));
-        }
-        else
-        {
-            frames->ptrFrames = realloc(frames->ptrFrames, (frames->numberOfFrame + 1)*sizeof(CAN_FRAME));
-        }
-        
-        for(i = 0 ; i < frames->numberOfFrame ; i++)
-        {
-            if(frames->ptrFrames[i].period > period)
-            {
-                ind = i;
-                break;
-            }
-        }
-        
-        if(ind != frames->numberOfFrame)
-        {
-            for(i = frames->numberOfFrame ; i > ind ; i--)
-            {
-                memcpy(&frames->ptrFrames[i], &frames->ptrFrames[i-1], sizeof(CAN_FRAME));
-            }
-        }
-        
         frames->ptrFrames[ind].enable = ON;
         frames->ptrFrames[ind].id = id;
         frames->ptrFrames[ind].idExtended = idExtended;
         frames->ptrFrames[ind].length = length;
-        frames->ptrFrames[ind].data[0] = 0;
-        frames->ptrFrames[ind].data[1] = 0;
-        frames->ptrFrames[ind].data[2] = 0;
-        frames->ptrFrames[ind].data[3] = 0;
-        frames->ptrFrames[ind].data[4] = 0;
-        frames->ptrFrames[ind].data[5] = 0;
-        frames->ptrFrames[ind].data[6] = 0;
-        frames->ptrFrames[ind].data[7] = 0;
+        memset(frames->ptrFrames[ind].data, 0, 8);
         frames->ptrFrames[ind].period = period;
         frames->ptrFrames[ind].tick = TICK_INIT;
-        
+
         frames->numberOfFrame++;
+        CANFramesIndexInsert(frames, ind);
+        CANHeapPush(frames, ind);
     }
 }
 
@@ -620,14 +1376,14 @@ void CANAddFrame(CAN_FRAMES *frames, DWORD id, BOOL idExtended, BYTE length, QWO
     void CANRemoveFrame(CAN_FRAMES *frames, DWORD id)
 
   Description:
-    This routine allow the user to remove a CAN frame. Each time a frame is
-    created (or removed) the RAM memory is dynamically modify. Thus the RAM
-    size is never constant and depends of the number of frame (Tx and Rx).
+    This routine allow the user to remove a CAN frame. The last frame of the
+    table takes its place (no shift of the table).
 
   Parameters:
-    frames      - The CAN_FRAMES variable containing all dynamic frames.
+    frames      - The CAN_FRAMES variable containing all frames.
 
-    id          - The desire identifier to remove.
+    id          - The desire identifier to remove. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
   Returns:
     None.
@@ -638,50 +1394,62 @@ void CANAddFrame(CAN_FRAMES *frames, DWORD id, BOOL idExtended, BYTE length, QWO
   *****************************************************************************/
 void CANRemoveFrame(CAN_FRAMES *frames, DWORD id)
 {
-    BYTE i;
-    CHAR8 ind = CANGetIndiceID(*frames, id);
+    int16_t ind = CANGetIndiceID(frames, id);
+    uint16_t last;
+    
     if(ind >= 0)
     {
-        for(i = ind ; i < (frames->numberOfFrame - 1) ; i++)
+        if(CANHeapContains(frames, ind))
         {
-            memcpy(&frames->ptrFrames[i], &frames->ptrFrames[i+1], sizeof(CAN_FRAME));
+            CANHeapRemove(frames, ind);
         }
-        frames->numberOfFrame--;
-        frames->ptrFrames = realloc(frames->ptrFrames, frames->numberOfFrame*sizeof(CAN_FRAME));
+        last = --frames->numberOfFrame;
+        if(ind != last)
+        {
+            if(CANHeapContains(frames, last))
+            {
+                frames->p_heap[frames->ptrFrames[last].heap_position] = ind;
+            }
+            frames->ptrFrames[ind] = frames->ptrFrames[last];
+        }
+        CANFramesIndexRebuild(frames);
     }
 }
 
 /*******************************************************************************
   Function:
-    CHAR8 CANGetIndiceID(CAN_FRAMES frames, DWORD id)
+    int16_t CANGetIndiceID(CAN_FRAMES *frames, DWORD id)
 
   Description:
     This routine return the indice (of an array) corresponding of the desire ID.
     The CAN_FRAMES variable contains an array of CAN_FRAME, each CAN_FRAME as an unique
     identifier but we don't know where this frame is located in memory. This function
-    return this information.
+    return this information (hash index on the ID, O(1)).
 
   Parameters:
     frames      - The CAN_FRAMES variable containing all dynamic frames.
 
-    id          - The desire identifier to remove.
+    id          - The desire identifier to remove. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
   Returns:
-    CHAR8       - The indice of CAN_FRAME array.
+    int16_t     - The indice of CAN_FRAME array (-1 if the ID is not found).
 
   Example:
     <code>
     </code>
   *****************************************************************************/
-CHAR8 CANGetIndiceID(CAN_FRAMES frames, DWORD id)
+int16_t CANGetIndiceID(CAN_FRAMES *frames, DWORD id)
 {
-    BYTE i;
-    for(i = 0 ; i < frames.numberOfFrame ; i++)
+    uint16_t i = CAN_FRAMES_HASH(id) & frames->index_mask;
+    
+    while(frames->p_index[i] != 0)
     {
-        if(frames.ptrFrames[i].id == id)
+        if(CAN_FRAMES_KEY(frames, frames->p_index[i] - 1) == id)
         {
-            return i;
+            return (frames->p_index[i] - 1);
         }
+        i = (i + 1) & frames->index_mask;
     }
     return -1;
 }
@@ -691,12 +1459,14 @@ CHAR8 CANGetIndiceID(CAN_FRAMES frames, DWORD id)
     void CANEnableFrame(CAN_FRAMES *frames, DWORD id, BOOL enable)
 
   Description:
-    This routine allow the user to enable/disable a frame.
+    This routine allow the user to enable/disable a frame. An enabled frame
+    is sent as soon as its period is elapsed since its last transmission.
 
   Parameters:
     frames      - The CAN_FRAMES variable containing all dynamic frames.
 
-    id          - The desire identifier to enable/disable.
+    id          - The desire identifier to enable/disable. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
     enable      - ON: enable / OFF:disable.
 
@@ -706,7 +1476,7 @@ CHAR8 CANGetIndiceID(CAN_FRAMES frames, DWORD id)
   Example:
     <code>
 
-    CAN_FRAMES framesTx = INIT_CAN_FRAMES();
+    CAN_FRAMES_DEF(framesTx, 16);
     ...
     CANEnableFrame(&framesTx, 0x200, OFF);
     ...
@@ -715,10 +1485,18 @@ CHAR8 CANGetIndiceID(CAN_FRAMES frames, DWORD id)
   *****************************************************************************/
 void CANEnableFrame(CAN_FRAMES *frames, DWORD id, BOOL enable)
 {
-    CHAR8 ind = CANGetIndiceID(*frames, id);
+    int16_t ind = CANGetIndiceID(frames, id);
     if(ind >= 0)
     {
         frames->ptrFrames[ind].enable = enable;
+        if(enable && !CANHeapContains(frames, ind))
+        {
+            CANHeapPush(frames, ind);
+        }
+        else if(!enable && CANHeapContains(frames, ind))
+        {
+            CANHeapRemove(frames, ind);
+        }
     }
 }
 
@@ -733,7 +1511,8 @@ void CANEnableFrame(CAN_FRAMES *frames, DWORD id, BOOL enable)
   Parameters:
     frames      - The CAN_FRAMES variable containing all dynamic frames.
 
-    id          - The desire identifier to enable/disable.
+    id          - The desire identifier to enable/disable. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
     data        - new table of 8 BYTES.
 
@@ -743,7 +1522,7 @@ void CANEnableFrame(CAN_FRAMES *frames, DWORD id, BOOL enable)
   Example:
     <code>
 
-    CAN_FRAMES framesTx = INIT_CAN_FRAMES();
+    CAN_FRAMES_DEF(framesTx, 16);
     BYTE newDataArray[8] = {...};
     ...
     CANSetData(&framesTx, 0x200, newDataArray);
@@ -753,7 +1532,7 @@ void CANEnableFrame(CAN_FRAMES *frames, DWORD id, BOOL enable)
   *****************************************************************************/
 void CANSetData(CAN_FRAMES *frames, DWORD id, BYTE data[8])
 {
-    CHAR8 ind = CANGetIndiceID(*frames, id);
+    int16_t ind = CANGetIndiceID(frames, id);
     if(ind >= 0)
     {
         memcpy(frames->ptrFrames[ind].data, data, 8);
@@ -770,7 +1549,8 @@ void CANSetData(CAN_FRAMES *frames, DWORD id, BYTE data[8])
   Parameters:
     frames      - The CAN_FRAMES variable containing all dynamic frames.
 
-    id          - The desire identifier to enable/disable.
+    id          - The desire identifier to enable/disable. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
     data        - New table of 8 BYTES.
 
@@ -782,7 +1562,7 @@ void CANSetData(CAN_FRAMES *frames, DWORD id, BYTE data[8])
   Example:
     <code>
 
-    CAN_FRAMES framesTx = INIT_CAN_FRAMES();
+    CAN_FRAMES_DEF(framesTx, 16);
     BYTE newDataArray[8] = {...};
     ...
     CANSetData_mask(&framesTx, 0x200, newDataArray, 0b00111100); // Only BYTES 2, 3, 4, 5 will me modify in framesTx.
@@ -792,7 +1572,7 @@ void CANSetData(CAN_FRAMES *frames, DWORD id, BYTE data[8])
   *****************************************************************************/
 void CANSetData_mask(CAN_FRAMES *frames, DWORD id, BYTE data[8], BYTE mask)
 {
-    CHAR8 ind = CANGetIndiceID(*frames, id);
+    int16_t ind = CANGetIndiceID(frames, id);
     if(ind >= 0)
     {
         if((mask >> 0) & 0x01)      {frames->ptrFrames[ind].data[0] = data[0];}
@@ -816,7 +1596,8 @@ void CANSetData_mask(CAN_FRAMES *frames, DWORD id, BYTE data[8], BYTE mask)
   Parameters:
     frames      - The CAN_FRAMES variable containing all dynamic frames.
 
-    id          - The desire identifier to enable/disable.
+    id          - The desire identifier to enable/disable. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
     indiceData  - Indice of the BYTE array [0..7]
 
@@ -831,7 +1612,7 @@ void CANSetData_mask(CAN_FRAMES *frames, DWORD id, BYTE data[8], BYTE mask)
   *****************************************************************************/
 void CANSetData1Byte(CAN_FRAMES *frames, DWORD id, BYTE indiceData, BYTE data)
 {
-    CHAR8 ind = CANGetIndiceID(*frames, id);
+    int16_t ind = CANGetIndiceID(frames, id);
     if(ind >= 0)
     {
         frames->ptrFrames[ind].data[indiceData] = data;
@@ -845,10 +1626,9 @@ void CANSetData1Byte(CAN_FRAMES *frames, DWORD id, BYTE indiceData, BYTE data)
   Description:
     This routine create a link between the CAN_FRAMES variable (creating by user in the main)
     and the receive functions (not accessible by user). If this link is not realized then
-    each receive frames will not be stored in RAM memory (so frames will only be accessible
-    in the interrupt handler).
-    The CAN_FRAMES variable for reception is also dynamicaly managed. RAM size depends
-    of the number of reading CAN frame. A timeout can be setting in order to release memory
+    each receive frames will be dropped by CANDeamonRx.
+    The received frames are stored in the table of the CAN_FRAMES variable (cf. CAN_FRAMES_DEF)
+    up to its maximum number of frames. A timeout can be setting in order to release a place
     (for frame that are no longer present). Cf. CANFreedomReceiveMemory function.
 
   Parameters:
@@ -873,9 +1653,14 @@ void CANSetLinkForFramesReception(CAN_MODULE module, CAN_FRAMES *frames)
     void CANTaskRx(CAN_MODULE module)
 
   Description:
-    This routine is the deamon for the CAN reception (full management of frames).
-    This function must be called in the interrupt handler (called eache time a new
-    frame is received).
+    This routine must be called in the CAN interrupt handler (the flag of the
+    interrupt has to be cleared after). It drains all the Rx channels (1..31)
+    and pushes the messages, with their reception time, in the Rx ring of the
+    module. The frames are stored in the CAN_FRAMES table later by CANDeamonRx
+    (main loop) so the interrupt stays short: the hardware FIFOs are emptied
+    at each interrupt even with a fully loaded bus.
+    The hardware FIFO overflows and the ring overflows are counted
+    (cf. CANGetRxStats).
 
   Parameters:
     module      - The desire CAN module.
@@ -885,55 +1670,110 @@ void CANSetLinkForFramesReception(CAN_MODULE module, CAN_FRAMES *frames)
 
   Example:
     <code>
+    cf. can.c header
     </code>
   *****************************************************************************/
 void CANTaskRx(CAN_MODULE module)
 {
-    CAN_EVENT_CODE eventCode;
-    CANRxMessageBuffer* mCANGetMessageBuffer[CAN_NUM_OF_MODULES];
     CAN_REGISTERS * canRegisters = (CAN_REGISTERS *)mCANModules[module];
-    
-    if((CANGetModuleEvent(module) & CAN_RX_EVENT) != 0)
+    CANRxMessageBuffer *message;
+    QWORD tick = mGetTick();
+    UINT32 pending;
+    BYTE channel;
+    uint16_t head;
+
+    // Channel 0 is used for the transmission (cf. CANInit())
+    pending = canRegisters->CxRXOVF & 0xfffffffe;
+    while(pending != 0)
+    {
+        channel = __builtin_ctz(pending);
+        pending &= (pending - 1);
+        canRxStats[module].fifo_overflow++;
+        canRegisters->canFifoRegisters[channel].CxFIFOINTCLR = 0x00000008;     // RXOVFLIF
+    }
+
+    pending = canRegisters->CxFSTAT & 0xfffffffe;
+    while(pending != 0)
     {
-        eventCode = CANGetPendingEventCode(module);
-        switch(eventCode)
+        channel = __builtin_ctz(pending);
+        pending &= (pending - 1);
+        while((message = (CANRxMessageBuffer*) CANGetRxMessage(module, channel)) != NULL)
         {
-            case CAN_NO_EVENT:
-                break;
-            case CAN_ERROR_EVENT:
-                break;
-            case CAN_WAKEUP_EVENT:
-                break;
-            default:
-                // Up to 32 Channels Event (cf. CANInit() for configuration of channels)
-                mCANGetMessageBuffer[module] = (CANRxMessageBuffer*)CANGetRxMessage(module, eventCode);
-                // Update channel            
-                canRegisters->canFifoRegisters[eventCode].CxFIFOCONSET = 0x00002000;
-                if(mCANAdressFramesRx[module] != NULL)
-                {
-                    CANAddToReceivedBuffer(module, *mCANGetMessageBuffer[module]);
-                }
-                break;
+            head = canRxHead[module];
+            if(((head + 1) & (CAN_RX_RING_SIZE - 1)) != canRxTail[module])
+            {
+                canRxRing[module][head].message = *message;
+                canRxRing[module][head].tick = tick;
+                __sync_synchronize();       // The entry is written before being published
+                canRxHead[module] = (head + 1) & (CAN_RX_RING_SIZE - 1);
+            }
+            else
+            {
+                canRxStats[module].ring_overflow++;
+            }
+            canRxStats[module].received++;
+            // Update channel
+            canRegisters->canFifoRegisters[channel].CxFIFOCONSET = 0x00002000;
+        }
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void CANDeamonRx(CAN_MODULE module)
+
+  Description:
+    This routine is the deamon for the CAN reception. It stores the frames
+    pushed by CANTaskRx (interrupt) in the CAN_FRAMES variable linked with
+    CANSetLinkForFramesReception. It must be called in the main loop (go
+    inside as much as possible). Each ID is stored once: its data, length,
+    period and last reception time are updated.
+
+  Parameters:
+    module      - The desire CAN module.
+
+  Returns:
+    None.
+
+  Example:
+    <code>
+    cf. can.c header
+    </code>
+  *****************************************************************************/
+void CANDeamonRx(CAN_MODULE module)
+{
+    uint16_t tail = canRxTail[module];
+
+    while(tail != canRxHead[module])
+    {
+        __sync_synchronize();               // The entry is read after the head
+        if(mCANAdressFramesRx[module] != NULL)
+        {
+            CANAddToReceivedBuffer(module, &canRxRing[module][tail]);
         }
+        tail = (tail + 1) & (CAN_RX_RING_SIZE - 1);
+        __sync_synchronize();               // The entry is read before being released
+        canRxTail[module] = tail;
     }
 }
 
 /*******************************************************************************
   Function:
-    static void CANAddToReceivedBuffer(CAN_MODULE module, CANRxMessageBuffer frame)
+    static void CANAddToReceivedBuffer(CAN_MODULE module, const CAN_RX_ENTRY *entry)
 
   Description:
     This routine must not be called by user. It's an internal function used by
-    the CAN driver when the CANTaskRx is called.
-    When a new frame is detected then it's automaticaly store is the RAM
-    memory (dynamicaly) or data is updated if already stored.
+    the CAN driver when the CANDeamonRx is called.
+    When a new frame is detected then it's automaticaly stored in the table
+    of the CAN_FRAMES variable (if not full) or data is updated if already
+    stored (the frame is found with the hash index on its ID).
     Be careful, the CANSetLinkForFramesReception function must be called
     in order to use the RAM memory storage.
 
   Parameters:
-    frames      - The CAN_FRAMES variable containing all dynamic frames.
+    module      - The desire CAN module.
 
-    frame       - The CAN frame received.
+    entry       - The CAN frame received and its reception time.
 
   Returns:
     None.
@@ -942,46 +1782,63 @@ void CANTaskRx(CAN_MODULE module)
     <code>
     </code>
   *****************************************************************************/
-static void CANAddToReceivedBuffer(CAN_MODULE module, CANRxMessageBuffer frame)
+static void CANAddToReceivedBuffer(CAN_MODULE module, const CAN_RX_ENTRY *entry)
 {
-    CHAR8 ind;
-    if(frame.msgEID.IDE)        // Extended ID
+    CAN_FRAMES *frames = mCANAdressFramesRx[module];
+    CAN_FRAME *frame;
+    DWORD id;
+    int16_t ind;
+
+    if(entry->message.msgEID.IDE)       // Extended ID
     {
-        ind = CANGetIndiceID(*mCANAdressFramesRx[module], (DWORD) frame.msgEID.EID);
+        id = ((DWORD) entry->message.msgSID.SID << 18) | entry->message.msgEID.EID;
     }
-    else                        // Standar ID
+    else                                // Standar ID
     {
-        ind = CANGetIndiceID(*mCANAdressFramesRx[module], (DWORD) frame.msgSID.SID);
+        id = entry->message.msgSID.SID;
     }
 
-    if(ind == -1)               // New frame (not yet stored in receive buffer)
+    ind = CANGetIndiceID(frames, CAN_FRAME_KEY(id, entry->message.msgEID.IDE));
+    if(ind == -1)                       // New frame (not yet stored in receive buffer)
     {
-        ind = mCANAdressFramesRx[module]->numberOfFrame;
-        if(ind == 0)
-        {
-            mCANAdressFramesRx[module]->ptrFrames = malloc(sizeof(CAN_FRAME));
-        }
-        else
-        {
-            mCANAdressFramesRx[module]->ptrFrames = realloc(mCANAdressFramesRx[module]->ptrFrames, (ind + 1)*sizeof(CAN_FRAME));
-        }
-        mCANAdressFramesRx[module]->ptrFrames[ind].enable = ON;
-        if(frame.msgEID.IDE)    // Extended ID
+        if(frames->numberOfFrame >= frames->maxNumberOfFrame)
         {
-            mCANAdressFramesRx[module]->ptrFrames[ind].id = frame.msgEID.EID;
+            canRxStats[module].table_overflow++;
+            return;
         }
-        else                    // Standar ID
-        {
-            mCANAdressFramesRx[module]->ptrFrames[ind].id = frame.msgSID.SID;
-        }
-        mCANAdressFramesRx[module]->ptrFrames[ind].idExtended = frame.msgEID.IDE;
-        mCANAdressFramesRx[module]->numberOfFrame++;
+        ind = frames->numberOfFrame++;
+        frame = &frames->ptrFrames[ind];
+        frame->enable = ON;
+        frame->id = id;
+        frame->idExtended = entry->message.msgEID.IDE;
+        frame->tick = entry->tick;
+        CANFramesIndexInsert(frames, ind);
     }
 
-    mCANAdressFramesRx[module]->ptrFrames[ind].length = frame.msgEID.DLC;
-    memcpy(mCANAdressFramesRx[module]->ptrFrames[ind].data, frame.data, 8);
-    mCANAdressFramesRx[module]->ptrFrames[ind].period = mGetTick() - mCANAdressFramesRx[module]->ptrFrames[ind].tick;
-    mCANAdressFramesRx[module]->ptrFrames[ind].tick = mGetTick();
+    frame = &frames->ptrFrames[ind];
+    frame->length = entry->message.msgEID.DLC;
+    memcpy(frame->data, entry->message.data, 8);
+    frame->period = entry->tick - frame->tick;
+    frame->tick = entry->tick;
+}
+
+/*******************************************************************************
+  Function:
+    CAN_RX_STATS CANGetRxStats(CAN_MODULE module)
+
+  Description:
+    This routine returns the reception counters of a CAN module. A bus is
+    sustained as long as fifo_overflow and ring_overflow stay at 0.
+
+  Parameters:
+    module      - The desire CAN module.
+
+  Returns:
+    The reception counters.
+  *****************************************************************************/
+CAN_RX_STATS CANGetRxStats(CAN_MODULE module)
+{
+    return canRxStats[module];
 }
 
 /*******************************************************************************
@@ -989,13 +1846,14 @@ static void CANAddToReceivedBuffer(CAN_MODULE module, CANRxMessageBuffer frame)
     void CANFreedomReceiveMemory(CAN_FRAMES *frame, QWORD timeout)
 
   Description:
-    This routine allow the program to realease RAM memory when a frame is no longer
-    present on the BUS. This timeout is define by the user.
-    We are doing that because the CAN_FRAMES variable for reception is dynamicaly managed.
-    RAM size depends of the number of reading CAN frame.
+    This routine allow the program to release a place of the table when a frame
+    is no longer present on the BUS (last reception older than timeout).
+    One frame is checked at each call (the position of the check is kept in 
+    the CAN_FRAMES variable: several tables can be released).
+    The table stays in the order of reception (the next frames are moved).
 
   Parameters:
-    frames      - The CAN_FRAMES variable containing all dynamic frames.
+    frames      - The CAN_FRAMES variable containing all frames.
 
     timeout     - The desire timeout.
 
@@ -1008,29 +1866,32 @@ static void CANAddToReceivedBuffer(CAN_MODULE module, CANRxMessageBuffer frame)
   *****************************************************************************/
 void CANFreedomReceiveMemory(CAN_FRAMES *frames, QWORD timeout)
 {
-    static BYTE i = 0, j = 0;
+    uint16_t i = frames->free_cursor;
 
     if(frames->numberOfFrame > 0)
     {
+        if(i >= frames->numberOfFrame)
+        {
+            i = 0;
+        }
         if(mTickCompare(frames->ptrFrames[i].tick) > timeout)
         {
-            for(j = i ; j < (frames->numberOfFrame - 1) ; j++)
-            {
-                memcpy(&frames->ptrFrames[j], &frames->ptrFrames[j+1], sizeof(CAN_FRAME));
-            }
+            // The next frame takes the place i: it is checked at the next call.
+            memmove(&frames->ptrFrames[i], &frames->ptrFrames[i+1], (frames->numberOfFrame - i - 1)*sizeof(CAN_FRAME));
             frames->numberOfFrame--;
-            frames->ptrFrames = realloc(frames->ptrFrames, frames->numberOfFrame*sizeof(CAN_FRAME));
+            CANFramesIndexRebuild(frames);
         }
-        if(++i >= frames->numberOfFrame)
+        else
         {
-            i = 0;
+            i++;
         }
+        frames->free_cursor = (i >= frames->numberOfFrame) ? 0 : i;
     }
 }
 
 /*******************************************************************************
   Function:
-    CAN_FRAME* CANGetFrame(CAN_FRAMES frame, DWORD id)
+    CAN_FRAME* CANGetFrame(CAN_FRAMES *frames, DWORD id)
 
   Description:
     This routine allow the user to get the content of a frame (define by the
@@ -1039,7 +1900,8 @@ void CANFreedomReceiveMemory(CAN_FRAMES *frames, QWORD timeout)
   Parameters:
     frames      - The CAN_FRAMES variable containing all dynamic frames.
 
-    id          - The identifier of the receive frame.
+    id          - The identifier of the receive frame. CAN_FRAME_KEY(id, CAN_ID_EXTENDED)
+                  for an extended frame.
 
   Returns:
     A pointer on the content of the receive frame (if existing) otherwhise 
@@ -1050,13 +1912,13 @@ void CANFreedomReceiveMemory(CAN_FRAMES *frames, QWORD timeout)
     cf. can.c header
     </code>
   *****************************************************************************/
-CAN_FRAME* CANGetFrame(CAN_FRAMES frame, DWORD id)
+CAN_FRAME* CANGetFrame(CAN_FRAMES *frames, DWORD id)
 {
-    CHAR8 indId = CANGetIndiceID(frame, id);
+    int16_t indId = CANGetIndiceID(frames, id);
     
     if(indId != -1)
     {
-        return (CAN_FRAME*) (&frame.ptrFrames[indId]);
+        return (CAN_FRAME*) (&frames->ptrFrames[indId]);
     }
     else
     {
@@ -337,16 +337,61 @@ typedef struct
     BOOL    idExtended;
     BYTE    length;
     BYTE    data[8];
-    QWORD   period;
-    QWORD   tick;
+    QWORD   period;             // Tx: transmission period / Rx: time between the two last receptions
+    QWORD   tick;               // Tx: last transmission / Rx: last reception (last seen)
+    uint16_t heap_position;     // Tx: position in the transmission schedule (enabled frames only)
 }CAN_FRAME;
 
 typedef struct
 {
-    BYTE    numberOfFrame;
-    CAN_FRAME *ptrFrames;
+    uint16_t    numberOfFrame;
+    uint16_t    maxNumberOfFrame;
+    CAN_FRAME   *ptrFrames;
+    uint16_t    *p_index;       // Open addressing hash table on the key (ID + IDE): slot + 1 (0: empty)
+    uint16_t    index_mask;     // Size of the hash table - 1 (power of 2 >= 2 * maxNumberOfFrame)
+    uint16_t    *p_heap;        // Tx: min-heap of the enabled slots on the next transmission time (tick + period)
+    uint16_t    heap_size;
+    uint16_t    free_cursor;    // Rx: next frame checked by CANFreedomReceiveMemory
 }CAN_FRAMES;
 
+typedef struct
+{
+    CANRxMessageBuffer  message;
+    QWORD               tick;   // Reception time (read in the interrupt)
+}CAN_RX_ENTRY;
+
+typedef struct
+{
+    DWORD   received;           // Frames read from the hardware FIFOs
+    DWORD   ring_overflow;      // Frames lost because the Rx ring was full (CANDeamonRx not called enough)
+    DWORD   table_overflow;     // Frames ignored because the CAN_FRAMES table was full
+    DWORD   fifo_overflow;      // Hardware FIFO overflows (frames lost before the interrupt)
+}CAN_RX_STATS;
+
+#define CAN_RX_RING_SIZE            64      // Must be a power of 2
+
+#define CAN_FRAMES_MAX              2048    // Max number of frames of a CAN_FRAMES variable
+#define CAN_FRAMES_INDEX_SIZE(n)    ((2*(n) <= 16) ? 16 : (2*(n) <= 32) ? 32 : (2*(n) <= 64) ? 64 : (2*(n) <= 128) ? 128 : (2*(n) <= 256) ? 256 : \
+                                    (2*(n) <= 512) ? 512 : (2*(n) <= 1024) ? 1024 : (2*(n) <= 2048) ? 2048 : 4096)
+
+#define CAN_FRAMES_INSTANCE(_max, _p_frames, _p_index, _p_heap) \
+{                                                           \
+    .numberOfFrame = 0,                                     \
+    .maxNumberOfFrame = _max,                               \
+    .ptrFrames = _p_frames,                                 \
+    .p_index = _p_index,                                    \
+    .index_mask = CAN_FRAMES_INDEX_SIZE(_max) - 1,          \
+    .p_heap = _p_heap,                                      \
+    .heap_size = 0,                                         \
+    .free_cursor = 0                                        \
+}
+
+#define CAN_FRAMES_DEF(_name, _max)                                                         \
+static CAN_FRAME _name ## _frames_ram_allocation[_max];                                     \
+static uint16_t _name ## _index_ram_allocation[CAN_FRAMES_INDEX_SIZE(_max)] = {0};          \
+static uint16_t _name ## _heap_ram_allocation[_max];                                        \
+static CAN_FRAMES _name = CAN_FRAMES_INSTANCE(_max, _name ## _frames_ram_allocation, _name ## _index_ram_allocation, _name ## _heap_ram_allocation)
+
 typedef struct
 {
     UINT32  mask[4];
@@ -354,8 +399,40 @@ typedef struct
     BYTE    enableFilterAndAttachMask[31];
 }CAN_FILTERS;
 
-#define INIT_CAN_FRAME(id, idExtended, length, period)      {ON, id, idExtended, length, {0}, period, TICK_INIT}
-#define INIT_CAN_FRAMES()                                   {0, NULL}
+typedef struct
+{
+    DWORD   first;
+    DWORD   last;
+}CAN_ID_RANGE;
+
+typedef struct
+{
+    UINT32  id;
+    UINT32  mask;
+}CAN_FILTER_ENTRY;
+
+typedef struct
+{
+    DWORD   subscribed;         // Number of IDs subscribed by the application
+    QWORD   accepted;           // Number of IDs accepted by the hardware filters (upper bound with extended IDs: up to 31 * 2^29)
+    WORD    falseAcceptRatio;   // (accepted - subscribed) / accepted in per mille
+    BYTE    numberOfFilters;
+    BYTE    numberOfMasks;
+}CAN_FILTERS_REPORT;
+
+#define CAN_ID_MAX                  0x1FFFFFFF
+#define CAN_FRAME_KEY_EXTENDED      0x80000000  // Key of a frame in a CAN_FRAMES variable: ID | IDE << 31
+#define CAN_FRAME_KEY(id, idExtended)                       ((DWORD) (id) | ((idExtended) ? CAN_FRAME_KEY_EXTENDED : 0))
+#define CAN_FILTER_EXTENDED         0x20000000  // ID: extended frame, (SID << 18) | EID / Mask: same layout
+#define CAN_FILTER_MIDE             0x40000000  // Mask: the type of frame (standard / extended) is compared
+#define CAN_FILTER_KEY_MAX          0x3FFFFFFF  // CANFiltersCompile: IDE (bit 29), SID (bits 28..18), EID (bits 17..0)
+#define CAN_FILTERS_PLAN_SIZE       64      // Working entries of CANFiltersCompile (on the stack)
+
+#define INIT_CAN_ID(id)                                     {id, id}
+#define INIT_CAN_ID_RANGE(first, last)                      {first, last}
+#define INIT_CAN_EXT_ID(id)                                 {(id) | CAN_FILTER_EXTENDED, (id) | CAN_FILTER_EXTENDED}
+#define INIT_CAN_EXT_ID_RANGE(first, last)                  {(first) | CAN_FILTER_EXTENDED, (last) | CAN_FILTER_EXTENDED}
+#define INIT_CAN_FRAME(id, idExtended, length, period)      {ON, id, idExtended, length, {0}, period, TICK_INIT, 0}
 #define INIT_CAN_FILTERS()                                  {{0}, {0}, {0}}
 
 void CANInit(CAN_MODULE module, DWORD busSpeed);
@@ -363,20 +440,39 @@ static void CANConfigFilter(CAN_MODULE module, CAN_FILTER filter, UINT32 id);
 static void CANConfigMask(CAN_MODULE module, CAN_FILTER_MASK mask, UINT32 maskbits);
 static void CANLinkFilterToChannelAndEnable(CAN_MODULE module, CAN_FILTER filter, CAN_FILTER_MASK mask, CAN_CHANNEL channel, BOOL enable);
 void CANDeamonFilters(CAN_MODULE module, CAN_FILTERS *filters);
+static UINT32 CANFilterEntrySize(UINT32 mask);
+static UINT32 CANFilterEntryAccepted(const CAN_FILTER_ENTRY *entry);
+static BOOL CANFiltersRangeGet(const CAN_ID_RANGE *range, UINT32 *first, UINT32 *last);
+static BYTE CANFiltersPlanAbsorb(CAN_FILTER_ENTRY *entries, BYTE n, BYTE ind);
+static BYTE CANFiltersPlanMergeBest(CAN_FILTER_ENTRY *entries, BYTE n);
+static BYTE CANFiltersPlanGetMasks(CAN_FILTER_ENTRY *entries, BYTE n, UINT32 *masks);
+static BYTE CANFiltersPlanMergeMasks(CAN_FILTER_ENTRY *entries, BYTE n);
+static BYTE CANFiltersPlanAdd(CAN_FILTER_ENTRY *entries, BYTE n, UINT32 id, UINT32 mask);
+void CANFiltersCompile(CAN_FILTERS *filters, const CAN_ID_RANGE *ranges, BYTE numberOfRanges, CAN_FILTERS_REPORT *report);
 static BOOL CANAddMessageFifoBuffer(CAN_MODULE module, CAN_CHANNEL channel, DWORD id, BOOL idExtended, BYTE length, BYTE* data);
 BOOL CANSendMessage(CAN_MODULE module, CAN_CHANNEL channel, DWORD id, BOOL idExtended, BYTE length, BYTE* data);
 void CANTaskTx(CAN_MODULE module, CAN_FRAMES *frame);
+static void CANFramesIndexInsert(CAN_FRAMES *frames, uint16_t slot);
+static void CANFramesIndexRebuild(CAN_FRAMES *frames);
+static void CANHeapSet(CAN_FRAMES *frames, uint16_t position, uint16_t slot);
+static void CANHeapSiftUp(CAN_FRAMES *frames, uint16_t position);
+static void CANHeapSiftDown(CAN_FRAMES *frames, uint16_t position);
+static void CANHeapPush(CAN_FRAMES *frames, uint16_t slot);
+static void CANHeapRemove(CAN_FRAMES *frames, uint16_t slot);
+static BOOL CANHeapContains(CAN_FRAMES *frames, uint16_t slot);
 void CANAddFrame(CAN_FRAMES *frames, DWORD id, BOOL idExtended, BYTE length, QWORD period);
 void CANRemoveFrame(CAN_FRAMES *frames, DWORD id);
-CHAR8 CANGetIndiceID(CAN_FRAMES frames, DWORD id);
+int16_t CANGetIndiceID(CAN_FRAMES *frames, DWORD id);
 void CANEnableFrame(CAN_FRAMES *frames, DWORD id, BOOL enable);
 void CANSetData(CAN_FRAMES *frames, DWORD id, BYTE data[8]);
 void CANSetData_mask(CAN_FRAMES *frames, DWORD id, BYTE data[8], BYTE mask);
 void CANSetData1Byte(CAN_FRAMES *frames, DWORD id, BYTE indiceData, BYTE data);
 void CANSetLinkForFramesReception(CAN_MODULE module, CAN_FRAMES *frames);
 void CANTaskRx(CAN_MODULE module);
-static void CANAddToReceivedBuffer(CAN_MODULE module, CANRxMessageBuffer frame);
+void CANDeamonRx(CAN_MODULE module);
+static void CANAddToReceivedBuffer(CAN_MODULE module, const CAN_RX_ENTRY *entry);
+CAN_RX_STATS CANGetRxStats(CAN_MODULE module);
 void CANFreedomReceiveMemory(CAN_FRAMES *frame, QWORD timeout);
-CAN_FRAME* CANGetFrame(CAN_FRAMES frame, DWORD id);
+CAN_FRAME* CANGetFrame(CAN_FRAMES *frames, DWORD id);
 
 #endif
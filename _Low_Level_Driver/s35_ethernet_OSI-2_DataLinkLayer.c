@@ -7,6 +7,8 @@
  *		13/05/2014		- Initial release
  *      04/10/2016      - Global update for this layer
  *      22/05/2017      - Global update and add external PHYTER LAN8740 compatibility
+ *      17/10/2026      - MACGetReadPtr (zero-copy UDP reads)
+ *      17/10/2026      - MACPutArrayChecksum (checksum while copying)
  *********************************************************************/
 #include "../PLIB.h"
 
@@ -237,6 +239,18 @@ void MACPutArray(BYTE *buff, WORD len)
     _CurrWrPtr += len;
 }
 
+/******************************************************************************
+ * ---MACPutArrayChecksum
+ * Same as MACPutArray but the bytes are added to the one's complement sum
+ * 'sum' while they are copied (cf. CalcIPChecksumCopy). Returns the new sum.
+ ******************************************************************************/
+WORD MACPutArrayChecksum(BYTE *buff, WORD len, WORD sum) 
+{
+    sum = CalcIPChecksumCopy(sum, _CurrWrPtr, buff, len);
+    _CurrWrPtr += len;
+    return sum;
+}
+
 /******************************************************************************
  * ---MACGetHeader
  * Input:           *remote: Location to store the Source MAC address of the
@@ -433,6 +447,16 @@ PTR_BASE MACSetReadPtr(PTR_BASE address)
     return (PTR_BASE) oldPtr;
 }
 
+/******************************************************************************
+ * ---MACGetReadPtr
+ *   This function returns the current read pointer (address in the current
+ *   RX buffer, used for the zero-copy reads).
+ ******************************************************************************/
+PTR_BASE MACGetReadPtr(void) 
+{
+    return (PTR_BASE) _CurrRdPtr;
+}
+
 /******************************************************************************
  * ---MACGetFreeRxSize
  *   An estimate of how much RX buffer space is free at the present time.
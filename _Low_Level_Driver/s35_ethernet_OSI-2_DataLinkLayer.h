@@ -265,6 +265,7 @@ BYTE MACGet(void);
 void MACPut(BYTE val);
 WORD MACGetArray(BYTE *address, WORD len);
 void MACPutArray(BYTE *buff, WORD len);
+WORD MACPutArrayChecksum(BYTE *buff, WORD len, WORD sum);
 BOOL MACGetHeader(MAC_ADDR *remote, BYTE *type);
 void MACPutHeader(MAC_ADDR *remote, BYTE type, WORD dataLen);
 
@@ -277,6 +278,7 @@ void MACSetReadPtrInRx(WORD offset);
 PTR_BASE MACGetTxBaseAddr(void);
 PTR_BASE MACSetWritePtr(PTR_BASE address);
 PTR_BASE MACSetReadPtr(PTR_BASE address);
+PTR_BASE MACGetReadPtr(void);
 WORD MACGetFreeRxSize(void);
 WORD CalcIPBufferChecksum(WORD len);
 
@@ -1,6 +1,6 @@
 #include "../PLIB.h"
 
-static NODE_INFO    Cache;
+static ARP_ENTRY    ARPCache[ARP_CACHE_SIZE];
 static BYTE         IPHeaderLen;
 
 static ICMP_FLAGS   ICMPFlags = {0};
@@ -9,20 +9,191 @@ static NODE_INFO    ICMPRemote = {0};
 static QWORD        ICMPTimer;
 static WORD         ICMPSequenceNumber;
 
+/*********************************************************************
+ * ---ARPNextHop
+ * Returns the IP address to resolve for a destination: the destination
+ * itself on our subnet, the gateway otherwise.
+ ********************************************************************/
+static DWORD ARPNextHop(IP_ADDR* IPAddr)
+{
+    return ((AppConfig.MyIPAddr.Val ^ IPAddr->Val) & AppConfig.MyMask.Val) ? AppConfig.MyGateway.Val : IPAddr->Val;
+}
+
+/*********************************************************************
+ * ---ARPFindEntry
+ * Returns the cache entry of a next hop IP address (NULL if unknown).
+ ********************************************************************/
+static ARP_ENTRY* ARPFindEntry(DWORD IPAddr)
+{
+    BYTE i;
+
+    for(i = 0 ; i < ARP_CACHE_SIZE ; i++)
+    {
+        if((ARPCache[i].state != ARP_ENTRY_FREE) && (ARPCache[i].node.IPAddr.Val == IPAddr))
+        {
+            return &ARPCache[i];
+        }
+    }
+    return NULL;
+}
+
+/*********************************************************************
+ * ---ARPNewEntry
+ * Returns a free entry or, if the cache is full, the least recently
+ * used entry (a resolved entry is replaced before a pending one).
+ ********************************************************************/
+static ARP_ENTRY* ARPNewEntry(DWORD IPAddr)
+{
+    ARP_ENTRY *entry = NULL;
+    BYTE i;
+
+    for(i = 0 ; i < ARP_CACHE_SIZE ; i++)
+    {
+        if(ARPCache[i].state == ARP_ENTRY_FREE)
+        {
+            entry = &ARPCache[i];
+            break;
+        }
+        if((entry == NULL) || (ARPCache[i].state > entry->state) || ((ARPCache[i].state == entry->state) && (ARPCache[i].tickUse < entry->tickUse)))
+        {
+            entry = &ARPCache[i];
+        }
+    }
+
+    entry->state = ARP_ENTRY_PENDING;
+    entry->node.IPAddr.Val = IPAddr;
+    entry->tickUpdate = mGetTick();
+    entry->tickUse = entry->tickUpdate;
+    entry->retryCount = 0;
+    entry->numberOfQueued = 0;
+    return entry;
+}
+
+/*********************************************************************
+ * ---ARPSendRequest
+ * This function transmits an ARP request for a next hop IP address.
+ ********************************************************************/
+static void ARPSendRequest(DWORD IPAddr)
+{
+    ARP_PACKET packet;
+
+    packet.HardwareType = swap_word(HW_ETHERNET);
+    packet.Protocol = swap_word(ARP_IP);
+    packet.MACAddrLen = sizeof(MAC_ADDR);
+    packet.ProtocolLen = sizeof(IP_ADDR);
+    packet.Operation = swap_word(ARP_OPERATION_REQ);
+    memset((void*) &packet.TargetMACAddr, 0xff, sizeof(MAC_ADDR));
+    packet.TargetIPAddr.Val = IPAddr;
+    packet.SenderMACAddr = AppConfig.MyMACAddr;
+    packet.SenderIPAddr = AppConfig.MyIPAddr;
+
+    while(!MACIsTxReady());
+    MACSetWritePtr(BASE_TX_ADDR);
+    MACPutHeader(&packet.TargetMACAddr, MAC_ARP, sizeof(ARP_PACKET));
+    MACPutArray((BYTE*) &packet, sizeof(ARP_PACKET));
+    MACFlush();
+}
+
+/*********************************************************************
+ * ---ARPSendPacket
+ * This function transmits an IP packet to a resolved next hop.
+ ********************************************************************/
+static void ARPSendPacket(ARP_ENTRY *entry, IP_ADDR IPAddr, BYTE protocol, BYTE* data, WORD len)
+{
+    NODE_INFO remote;
+
+    remote.IPAddr = IPAddr;
+    remote.MACAddr = entry->node.MACAddr;
+
+    while(!MACIsTxReady());
+    MACSetWritePtr(BASE_TX_ADDR + sizeof(ETHER_HEADER));
+    IPPutHeader(&remote, protocol, len);
+    MACPutArray(data, len);
+    MACFlush();
+}
+
+/*********************************************************************
+ * ---ARPUpdate
+ * Stores the MAC address of a next hop (new entry only if isNew) and
+ * transmits the packets held until its resolution.
+ ********************************************************************/
+static void ARPUpdate(IP_ADDR IPAddr, MAC_ADDR MACAddr, BOOL isNew)
+{
+    ARP_ENTRY *entry = ARPFindEntry(IPAddr.Val);
+    BYTE i;
+
+    if(entry == NULL)
+    {
+        if(!isNew)
+        {
+            return;
+        }
+        entry = ARPNewEntry(IPAddr.Val);
+    }
+
+    entry->node.MACAddr = MACAddr;
+    entry->state = ARP_ENTRY_RESOLVED;
+    entry->tickUpdate = mGetTick();
+
+    for(i = 0 ; i < entry->numberOfQueued ; i++)
+    {
+        ARPSendPacket(entry, entry->queue[i].IPAddr, entry->queue[i].protocol, entry->queue[i].data, entry->queue[i].length);
+    }
+    entry->numberOfQueued = 0;
+}
+
+/*********************************************************************
+ * ---ARPInit
+ * Releases all the entries of the ARP cache (and the held packets).
+ ********************************************************************/
+void ARPInit(void)
+{
+    memset((void*) ARPCache, 0x00, sizeof(ARPCache));
+}
+
+/*********************************************************************
+ * ---ARPTask
+ * Periodic ARP task: retransmits the requests of the pending entries,
+ * releases the pending entries without response after ARP_MAX_RETRY
+ * requests (the held packets are dropped) and the resolved entries
+ * older than ARP_ENTRY_TIMEOUT (aging).
+ ********************************************************************/
+void ARPTask(void)
+{
+    BYTE i;
+
+    for(i = 0 ; i < ARP_CACHE_SIZE ; i++)
+    {
+        if((ARPCache[i].state == ARP_ENTRY_PENDING) && (mTickCompare(ARPCache[i].tickUpdate) > ARP_RETRY_INTERVAL))
+        {
+            if(++ARPCache[i].retryCount >= ARP_MAX_RETRY)
+            {
+                ARPCache[i].state = ARP_ENTRY_FREE;
+            }
+            else
+            {
+                ARPCache[i].tickUpdate = mGetTick();
+                ARPSendRequest(ARPCache[i].node.IPAddr.Val);
+            }
+        }
+        else if((ARPCache[i].state == ARP_ENTRY_RESOLVED) && (mTickCompare(ARPCache[i].tickUpdate) > ARP_ENTRY_TIMEOUT))
+        {
+            ARPCache[i].state = ARP_ENTRY_FREE;
+        }
+    }
+}
+
 /*********************************************************************
  * ---ARPProcess
- * Retrieves an ARP packet from the MAC buffer and determines if it is a
- * response to our request (in which case the ARP is resolved) or if it
- * is a request requiring our response (in which case we transmit one.)
- *
- * TRUE - All processing of this ARP packet is complete.  Do not call
- * again until a new ARP packet is waiting in the RX buffer.
- * FALSE - This function must be called again.  More time is needed to
- * send an ARP response.
+ * Retrieves an ARP packet from the MAC buffer. The sender is stored in
+ * the cache if the packet is a response to our request or a request for
+ * our address; otherwise (gratuitous ARP, request for another host) only
+ * an existing entry is refreshed. A request for our address is answered.
  ********************************************************************/
 void ARPProcess(void) 
 {
     ARP_PACKET packet;
+    BOOL isForUs;
 
     // Obtain the incoming ARP packet (either an ARP request from a host OR a response from a host to our ARP request)
     MACGetArray((BYTE*) &packet, sizeof(ARP_PACKET));
@@ -30,12 +201,13 @@ void ARPProcess(void)
     // Validate the ARP packet
     if((packet.HardwareType == swap_word(HW_ETHERNET)) && (packet.MACAddrLen == sizeof(MAC_ADDR)) && (packet.ProtocolLen == sizeof(IP_ADDR)))
     {
-        if (packet.Operation == swap_word(ARP_OPERATION_RESP))  // Handle incoming ARP responses (a host is sending a response to our ARP request)
+        isForUs = (packet.TargetIPAddr.Val == AppConfig.MyIPAddr.Val) && (packet.SenderIPAddr.Val != AppConfig.MyIPAddr.Val);
+        if(packet.SenderIPAddr.Val != 0)
         {
-            Cache.MACAddr = packet.SenderMACAddr;
-            Cache.IPAddr = packet.SenderIPAddr;
+            ARPUpdate(packet.SenderIPAddr, packet.SenderMACAddr, isForUs);   // Packed fields: copied
         }
-        else if((packet.Operation == swap_word(ARP_OPERATION_REQ)) && (packet.TargetIPAddr.Val == AppConfig.MyIPAddr.Val))   // Handle incoming ARP requests for our MAC address (a host is sending an ARP request)
+
+        if((packet.Operation == swap_word(ARP_OPERATION_REQ)) && isForUs)   // Handle incoming ARP requests for our MAC address (a host is sending an ARP request)
         {
             packet.HardwareType = swap_word(HW_ETHERNET);
             packet.Protocol = swap_word(ARP_IP);
@@ -56,30 +228,41 @@ void ARPProcess(void)
     }
 }
 
+/*********************************************************************
+ * ---ARPLearn
+ * Learns the MAC address of a host of our subnet from an incoming IP
+ * packet addressed to us (no ARP round trip to answer it).
+ ********************************************************************/
+void ARPLearn(NODE_INFO *remote)
+{
+    if((remote->IPAddr.Val != 0) && (remote->IPAddr.Val != AppConfig.MyIPAddr.Val) && !((AppConfig.MyIPAddr.Val ^ remote->IPAddr.Val) & AppConfig.MyMask.Val))
+    {
+        ARPUpdate(remote->IPAddr, remote->MACAddr, TRUE);
+    }
+}
+
 /*********************************************************************
  * ---ARPResolve
- * This function transmits and ARP request to determine the hardware
- * address of a given IP address.
+ * This function transmits an ARP request to determine the hardware
+ * address of a given IP address (or of the gateway). Nothing is sent if
+ * the address is already in the cache.
  ********************************************************************/
 void ARPResolve(IP_ADDR* IPAddr) 
 {
-    ARP_PACKET packet;
-
-    packet.HardwareType = swap_word(HW_ETHERNET);
-    packet.Protocol = swap_word(ARP_IP);
-    packet.MACAddrLen = sizeof(MAC_ADDR);
-    packet.ProtocolLen = sizeof(IP_ADDR);
-    packet.Operation = swap_word(ARP_OPERATION_REQ);
-    memset((void*) &packet.TargetMACAddr, 0xff, sizeof(MAC_ADDR));
-    packet.TargetIPAddr = ((AppConfig.MyIPAddr.Val ^ IPAddr->Val) & AppConfig.MyMask.Val) ? AppConfig.MyGateway : *IPAddr;
-    packet.SenderMACAddr = AppConfig.MyMACAddr;
-    packet.SenderIPAddr = AppConfig.MyIPAddr;
+    DWORD nextHop = ARPNextHop(IPAddr);
+    ARP_ENTRY *entry = ARPFindEntry(nextHop);
 
-    while(!MACIsTxReady());
-    MACSetWritePtr(BASE_TX_ADDR);
-    MACPutHeader(&packet.TargetMACAddr, MAC_ARP, sizeof(ARP_PACKET));
-    MACPutArray((BYTE*) &packet, sizeof(ARP_PACKET));
-    MACFlush();
+    if(entry == NULL)
+    {
+        entry = ARPNewEntry(nextHop);
+    }
+    else if(entry->state == ARP_ENTRY_RESOLVED)
+    {
+        entry->tickUse = mGetTick();
+        return;
+    }
+    entry->tickUpdate = mGetTick();
+    ARPSendRequest(nextHop);
 }
 
 /*********************************************************************
@@ -89,15 +272,66 @@ void ARPResolve(IP_ADDR* IPAddr)
  ********************************************************************/
 BOOL ARPIsResolved(IP_ADDR* IPAddr, MAC_ADDR* MACAddr) 
 {
-    if((Cache.IPAddr.Val == IPAddr->Val) || ((Cache.IPAddr.Val == AppConfig.MyGateway.Val) && ((AppConfig.MyIPAddr.Val ^ IPAddr->Val) & AppConfig.MyMask.Val))) 
+    ARP_ENTRY *entry = ARPFindEntry(ARPNextHop(IPAddr));
+
+    if((entry != NULL) && (entry->state == ARP_ENTRY_RESOLVED))
     {
-        *MACAddr = Cache.MACAddr;
-//        memset((void*) &Cache, 0xff, sizeof(NODE_INFO));
+        *MACAddr = entry->node.MACAddr;
+        entry->tickUse = mGetTick();
         return TRUE;
     }
     return FALSE;
 }
 
+/*********************************************************************
+ * ---ARPQueuePacket
+ * Transmits an IP packet (header built here, data = IP payload) as soon
+ * as the next hop is resolved: immediately if it is in the cache,
+ * otherwise the packet is held by the entry until the ARP response.
+ * FALSE if the packet cannot be held (too long or queue full).
+ * The data may be in the MAC TX buffer (UDPFlush, SendTCP): it is copied
+ * before the ARP request is built in this buffer.
+ ********************************************************************/
+BOOL ARPQueuePacket(IP_ADDR* IPAddr, BYTE protocol, BYTE* data, WORD len)
+{
+    DWORD nextHop = ARPNextHop(IPAddr);
+    ARP_ENTRY *entry = ARPFindEntry(nextHop);
+    ARP_QUEUED_PACKET *packet;
+    BOOL isNew = FALSE;
+
+    if((entry != NULL) && (entry->state == ARP_ENTRY_RESOLVED))
+    {
+        entry->tickUse = mGetTick();
+        ARPSendPacket(entry, *IPAddr, protocol, data, len);
+        return TRUE;
+    }
+
+    if(len > ARP_QUEUE_PACKET_SIZE)
+    {
+        return FALSE;
+    }
+    if(entry == NULL)
+    {
+        entry = ARPNewEntry(nextHop);
+        isNew = TRUE;
+    }
+    if(entry->numberOfQueued >= ARP_QUEUE_DEPTH)
+    {
+        return FALSE;
+    }
+
+    packet = &entry->queue[entry->numberOfQueued++];
+    packet->IPAddr = *IPAddr;
+    packet->protocol = protocol;
+    packet->length = len;
+    memcpy(packet->data, data, len);
+    if(isNew)
+    {
+        ARPSendRequest(nextHop);
+    }
+    return TRUE;
+}
+
 /*********************************************************************
  * ---IPGetHeader
  * TRUE, if valid packet was received
@@ -214,16 +448,8 @@ void ICMPProcess(NODE_INFO *remote, IP_ADDR localIP, WORD len)
             }
 
             // Calculate new Type, Code, and Checksum values
+            dwVal.w[1] = CalcIPChecksumUpdate(dwVal.w[1], dwVal.w[0], dwVal.w[0] & 0xff00u);   // RFC 1624
             dwVal.v[0] = 0x00; // Type: 0 (ICMP echo/ping reply)
-            dwVal.v[2] += 8; // Subtract 0x0800 from the checksum
-            if (dwVal.v[2] < 8u) 
-            {
-                dwVal.v[3]++;
-                if (dwVal.v[3] == 0u)
-                {
-                    dwVal.v[2]++;
-                }
-            }
 
             // Wait for TX hardware to become available (finish transmitting
             // any previous packet)
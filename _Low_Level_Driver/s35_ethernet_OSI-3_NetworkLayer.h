@@ -53,6 +53,40 @@ typedef struct __attribute__((aligned(2), packed))
     IP_ADDR TargetIPAddr; // The target node's IP address.
 }ARP_PACKET;
 
+// ARP cache
+#define ARP_CACHE_SIZE              8               // Number of peers (next hop) stored in the ARP cache
+#define ARP_ENTRY_TIMEOUT           (30*TICK_10S)   // Aging: a resolved entry is released after 5 minutes
+#define ARP_RETRY_INTERVAL          (TICK_1S)       // Time between two ARP requests for a pending entry
+#define ARP_MAX_RETRY               (3)             // Number of ARP requests before releasing a pending entry
+#define ARP_QUEUE_DEPTH             (2)             // Number of outbound packets held by a pending entry
+#define ARP_QUEUE_PACKET_SIZE       (128)           // Max size of a held packet (IP payload)
+
+typedef enum
+{
+    ARP_ENTRY_FREE = 0,
+    ARP_ENTRY_PENDING,
+    ARP_ENTRY_RESOLVED
+}ARP_ENTRY_STATE;
+
+typedef struct
+{
+    IP_ADDR IPAddr;                 // Final destination (the entry is the next hop)
+    BYTE    protocol;
+    WORD    length;
+    BYTE    data[ARP_QUEUE_PACKET_SIZE];
+}ARP_QUEUED_PACKET;
+
+typedef struct
+{
+    ARP_ENTRY_STATE     state;
+    NODE_INFO           node;       // IP address of the next hop and its MAC address
+    QWORD               tickUpdate; // Resolved: last update (aging) / Pending: last ARP request
+    QWORD               tickUse;    // Last use (LRU replacement)
+    BYTE                retryCount;
+    BYTE                numberOfQueued;
+    ARP_QUEUED_PACKET   queue[ARP_QUEUE_DEPTH];
+}ARP_ENTRY;
+
 // ARP
 #define ARP_OPERATION_REQ           (0x0001u)		// Operation code indicating an ARP Request
 #define ARP_OPERATION_RESP          (0x0002u)		// Operation code indicating an ARP Response
@@ -77,9 +111,13 @@ BOOL IPGetHeader(IP_ADDR *remote, IP_HEADER *IPHeader);
 void IPSetRxBuffer(WORD Offset);
 
 // ARP
+void ARPInit(void);
+void ARPTask(void);
 void ARPProcess(void);
+void ARPLearn(NODE_INFO *remote);
 void ARPResolve(IP_ADDR* IPAddr);
 BOOL ARPIsResolved(IP_ADDR* IPAddr, MAC_ADDR* MACAddr);
+BOOL ARPQueuePacket(IP_ADDR* IPAddr, BYTE protocol, BYTE* data, WORD len);
 
 // ICMP
 void ICMPProcess(NODE_INFO *remote, IP_ADDR localIP, WORD len);
@@ -4,6 +4,17 @@
  *
  *	Revision history	:
  *		21/05/2014		- Initial release
+ *		17/10/2026		- UDP local port index, TCP socket hash table and
+ *						  TCPTick list (only the sockets with pending work
+ *						  are processed)
+ *		17/10/2026		- TX / RX buffers taken from a shared pool at TCPOpenEx
+ *						  time (sizes per socket) and released when the
+ *						  socket is closed, TCPFlush sends several segments
+ *		17/10/2026		- Zero-copy reads: UDPPeek / UDPConsume (view in the
+ *						  EMAC RX buffer) and TCPPeekSegments / TCPConsume
+ *						  (view in the socket RX FIFO)
+ *		17/10/2026		- SendTCP sums the segment while copying it in the
+ *						  TX buffer instead of reading it again
  *********************************************************************/
 
 #include "../PLIB.h"
@@ -16,6 +27,7 @@ static UDP_SOCKET	LastPutSocket = INVALID_UDP_SOCKET;	// Indicates the last sock
 static WORD         wPutOffset;		// Offset from beginning of payload where data is to be written.
 static WORD         wGetOffset;		// Offset from beginning of payload from where data is to be read.
 static UDP_SOCKET   SocketWithRxData = INVALID_UDP_SOCKET;
+static UDP_SOCKET   UDPPortTable[UDP_PORT_TABLE_SIZE];	// Heads of the sockets chained by local port
 /******************************************************************************
  * ---UDPSetTxBuffer
  * This function allows the write location within the TX buffer to be
@@ -59,9 +71,10 @@ static UDP_SOCKET FindMatchingSocket(UDP_HEADER *h, NODE_INFO *remoteNode)
 
 	partialMatch = INVALID_UDP_SOCKET;
 
-	p = UDPSocketInfo;
-    for(s = 0; s < MAX_UDP_SOCKETS; s++)
+	// Only the sockets chained in the bucket of the destination port are checked
+    for(s = UDPPortTable[h->DestinationPort & (UDP_PORT_TABLE_SIZE - 1)]; s != INVALID_UDP_SOCKET; s = p->portNext)
 	{
+		p = &UDPSocketInfo[s];
 		// This packet is said to be matching with current socket:
 		// 1. If its destination port matches with our local port and
 		// 2. Packet source IP address matches with previously saved socket remote IP address and
@@ -78,7 +91,6 @@ static UDP_SOCKET FindMatchingSocket(UDP_HEADER *h, NODE_INFO *remoteNode)
 
 			partialMatch = s;
 		}
-		p++;
 	}
 
 	if(partialMatch != INVALID_UDP_SOCKET)
@@ -93,6 +105,39 @@ static UDP_SOCKET FindMatchingSocket(UDP_HEADER *h, NODE_INFO *remoteNode)
 	return partialMatch;
 }
 
+/******************************************************************************
+ * ---UDPPortLink
+ * This function chains a socket (its local port is already set) in the
+ * bucket of UDPPortTable matching its local port.
+ ******************************************************************************/
+static void UDPPortLink(UDP_SOCKET s)
+{
+	UDP_SOCKET *head = &UDPPortTable[UDPSocketInfo[s].localPort & (UDP_PORT_TABLE_SIZE - 1)];
+
+	UDPSocketInfo[s].portNext = *head;
+	*head = s;
+}
+
+/******************************************************************************
+ * ---UDPPortUnlink
+ * This function removes a socket from the bucket of its local port.  Nothing
+ * is done if the socket is not chained.
+ ******************************************************************************/
+static void UDPPortUnlink(UDP_SOCKET s)
+{
+	UDP_SOCKET *p = &UDPPortTable[UDPSocketInfo[s].localPort & (UDP_PORT_TABLE_SIZE - 1)];
+
+	while(*p != INVALID_UDP_SOCKET)
+	{
+		if(*p == s)
+		{
+			*p = UDPSocketInfo[s].portNext;
+			return;
+		}
+		p = &UDPSocketInfo[*p].portNext;
+	}
+}
+
 /******************************************************************************
  * ---UDPInit
  *  Initializes the UDP module.  This function initializes all the UDP
@@ -102,6 +147,7 @@ void UDPInit(void)
 {
     UDP_SOCKET s;
 
+	memset((void*)UDPPortTable, INVALID_UDP_SOCKET, sizeof(UDPPortTable));
     for ( s = 0; s < MAX_UDP_SOCKETS; s++ )
     {
 		UDPClose(s);
@@ -198,13 +244,83 @@ WORD UDPGetArray(BYTE *cData, WORD wDataLen)
     return wDataLen;
 }
 
+/******************************************************************************
+ * ---UDPPeek
+ * This function gives a read-only view (no copy) of the bytes not yet read
+ * in the segment received by the socket s, which becomes the currently
+ * active socket.  The view points in the EMAC RX buffer: this buffer is not
+ * given back to the controller (and no other packet is processed by
+ * StackTask) until all the bytes are released with UDPConsume, or until the
+ * socket is closed with UDPClose.
+ * It returns the number of bytes of the view (0 if no data).
+ ******************************************************************************/
+WORD UDPPeek(UDP_SOCKET s, RX_VIEW *view)
+{
+	WORD wBytesAvailable = UDPIsGetReady(s);
+
+	view->data[1] = NULL;
+	view->length[1] = 0;
+	view->length[0] = wBytesAvailable;
+	view->data[0] = NULL;
+
+	if(wBytesAvailable)
+	{
+		// The read pointer may have been moved since the last read (TX checksums)
+		UDPSetRxBuffer(wGetOffset);
+		view->data[0] = (const BYTE*)MACGetReadPtr();
+		Flags.bViewBorrowed = 1;
+	}
+
+	return wBytesAvailable;
+}
+
+/******************************************************************************
+ * ---UDPConsume
+ * This function releases the first wDataLen bytes of the view obtained with
+ * UDPPeek on the socket s, which becomes the currently active socket.  When
+ * all the bytes are released, the EMAC RX buffer is given back.  It returns
+ * the number of bytes released.
+ ******************************************************************************/
+WORD UDPConsume(UDP_SOCKET s, WORD wDataLen)
+{
+	activeUDPSocket = s;
+	if((wGetOffset >= UDPRxCount) || (SocketWithRxData != s))
+		return 0;
+
+	UDPSetRxBuffer(wGetOffset);
+	wDataLen = UDPGetArray(NULL, wDataLen);
+
+	if(wGetOffset >= UDPRxCount)
+	{
+		Flags.bViewBorrowed = 0;
+		UDPDiscard();
+	}
+
+	return wDataLen;
+}
+
+/******************************************************************************
+ * ---UDPIsViewBorrowed
+ * This function returns TRUE while the application holds a view of the
+ * received segment (cf. UDPPeek).  StackTask does not process any other
+ * packet in the meantime.
+ ******************************************************************************/
+BOOL UDPIsViewBorrowed(void)
+{
+	return Flags.bViewBorrowed;
+}
+
 /******************************************************************************
  * ---UDPDiscard
  * This function discards any remaining received data in the currently
- * active UDP socket.
+ * active UDP socket.  Nothing is done while a view of the data is borrowed
+ * (cf. UDPPeek / UDPConsume).
  ******************************************************************************/
 void UDPDiscard(void)
 {
+	if(Flags.bViewBorrowed)
+		return;
+
 	if(!Flags.bWasDiscarded)
 	{
 		MACDiscardRx();
@@ -301,6 +417,7 @@ UDP_SOCKET UDPOpenEx(DWORD remoteHost, BYTE remoteHostType, UDP_PORT localPort,
                 }
                 p->localPort    = NextPort++;
 		   	}
+			UDPPortLink(s);
 			if((remoteHostType == UDP_OPEN_SERVER) || (remoteHost == 0))
 			{
                 //Set remote node as 0xFF ( broadcast address)
@@ -487,18 +604,41 @@ void UDPFlush(void)
     h.Length            = swap_word(wUDPLength);
     h.Checksum 			= 0x0000;
 
-	// Position the hardware write pointer where we will need to
-	// begin writing the IP header
-	MACSetWritePtr(BASE_TX_ADDR + sizeof(ETHER_HEADER));
+	// Client socket: the next hop may be resolved since the last UDPTask
+	if(((p->smState == UDP_GATEWAY_SEND_ARP) || (p->smState == UDP_GATEWAY_GET_ARP)) && ARPIsResolved(&p->remoteNode.IPAddr, &p->remoteNode.MACAddr))
+	{
+		p->smState = UDP_OPENED;
+	}
+
+	if(p->smState == UDP_OPENED)
+	{
+		// Position the hardware write pointer where we will need to
+		// begin writing the IP header
+		MACSetWritePtr(BASE_TX_ADDR + sizeof(ETHER_HEADER));
 
-	// Write IP header to packet
-	IPPutHeader(&p->remoteNode, IP_PROTOCOLE_UDP, wUDPLength);
+		// Write IP header to packet
+		IPPutHeader(&p->remoteNode, IP_PROTOCOLE_UDP, wUDPLength);
 
-    // Write UDP header to packet
-    MACPutArray((BYTE*)&h, sizeof(h));
+		// Write UDP header to packet
+		MACPutArray((BYTE*)&h, sizeof(h));
 
-	// Transmit the packet
-    MACFlush();
+		// Transmit the packet
+		MACFlush();
+	}
+	else
+	{
+		// Next hop not resolved yet: the datagram (UDP header + data, in
+		// the TX buffer) is held by the ARP cache until the ARP response
+		MACSetWritePtr(BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER));
+		MACPutArray((BYTE*)&h, sizeof(h));
+		ARPQueuePacket(&p->remoteNode.IPAddr, IP_PROTOCOLE_UDP, (BYTE*)(BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER)), wUDPLength);
+		if(p->smState == UDP_GATEWAY_SEND_ARP)
+		{
+			// The ARP request has been sent by the ARP cache
+			p->eventTime = (QWORD)(mGetTick() >> 8);
+			p->smState = UDP_GATEWAY_GET_ARP;
+		}
+	}
 
 	// Reset packet size counter for the next TX operation
     UDPTxCount = 0;
@@ -517,6 +657,18 @@ void UDPClose(UDP_SOCKET s)
 		return;
     }
 
+	// The segment received by this socket (and its view, cf. UDPPeek) is
+	// given back: StackTask would wait for UDPConsume forever otherwise
+	if(SocketWithRxData == s)
+	{
+		Flags.bViewBorrowed = 0;
+		UDPDiscard();
+	}
+
+	if(UDPSocketInfo[s].localPort != INVALID_UDP_PORT)
+	{
+		UDPPortUnlink(s);
+	}
 	UDPSocketInfo[s].localPort = INVALID_UDP_PORT;
 	UDPSocketInfo[s].remoteNode.IPAddr.Val = 0x00000000;
 	UDPSocketInfo[s].smState = UDP_CLOSED;
@@ -536,22 +688,22 @@ BYTE* UDPPutString(BYTE *strData)
 TCB                         MyTCB;
 TCB_STUB                    TCBStubs[MAX_TCP_SOCKETS];
 static TCP_SOCKET           hCurrentTCP = INVALID_SOCKET;
+static TCP_SOCKET           TCPHashTable[TCP_HASH_TABLE_SIZE];	// Heads of the sockets chained by remoteHash
+static TCP_SOCKET           TCPTickHead = INVALID_SOCKET;	// First socket of the list processed by TCPTick
 static TCP_SYN_QUEUE        SYNQueue[TCP_SYN_QUEUE_MAX_ENTRIES];	// Array of saved incoming SYN requests that need to be serviced later
-static BYTE                 TCPBufferInPIC[TCP_PIC_RAM_SIZE];
+static TCB                  TCBs[MAX_TCP_SOCKETS];	// Extended TCB of each socket (the current one is cached in MyTCB)
+static BYTE                 TCPBufferInPIC[TCP_PIC_RAM_SIZE];	// Pool of the socket TX / RX buffers
 static WORD                 NextPort __attribute__((persistent));	// Tracking variable for next local client port number
 
 /******************************************************************************
  * ---TCPInit
- * Initializes the TCP module.  This function sets up the TCP buffers
- * in memory and initializes each socket to the CLOSED state.  If
- * insufficient memory was allocated for the TCP sockets, the function
- * will hang here to be captured by the debugger.
+ * Initializes the TCP module.  This function initializes each socket to
+ * the CLOSED state.  No buffer is owned by a closed socket: the TX / RX
+ * buffers are taken from TCPBufferInPIC when the socket is opened.
  ******************************************************************************/
 void TCPInit(void)
 {
 	BYTE vSocketsAllocated;
-	PTR_BASE ptrBaseAddress;
-	PTR_BASE ptrCurrentPICAddress = TCP_PIC_RAM_BASE_ADDRESS;
 
     if(NextPort == 0u)
     {
@@ -561,23 +713,22 @@ void TCPInit(void)
 	// Mark all SYN Queue entries as invalid by zeroing the memory
 	memset((void*)SYNQueue, 0x00, sizeof(SYNQueue));
 
-	// Allocate all socket FIFO addresses
+	// Empty the hash table and the TCPTick list (CloseSocket fills them again)
+	memset((void*)TCPHashTable, INVALID_SOCKET, sizeof(TCPHashTable));
+	TCPTickHead = INVALID_SOCKET;
+
+	// Release all socket FIFOs
 	for(vSocketsAllocated = 0; vSocketsAllocated < MAX_TCP_SOCKETS; vSocketsAllocated++)
 	{
-		// Generate all needed sockets of each type (TCP_PURPOSE_*)
 		hCurrentTCP = vSocketsAllocated;
 
-        ptrBaseAddress = ptrCurrentPICAddress;
-        ptrCurrentPICAddress += sizeof(TCB) + TCP_SOCKET_TX_BUFFER_SIZE+1 + TCP_SOCKET_RX_BUFFER_SIZE+1;
-		// Do a sanity check to ensure that we aren't going to use memory that hasn't been allocated to us.
-		// If your code locks up right here, it means you've incorrectly allocated your TCP socket buffers.
-		while(ptrCurrentPICAddress > TCP_PIC_RAM_BASE_ADDRESS + TCP_PIC_RAM_SIZE);
-			
-		TCBStubs[hCurrentTCP].bufferTxStart	= ptrBaseAddress + sizeof(TCB);
-		TCBStubs[hCurrentTCP].bufferRxStart	= TCBStubs[hCurrentTCP].bufferTxStart + TCP_SOCKET_TX_BUFFER_SIZE + 1;
-		TCBStubs[hCurrentTCP].bufferEnd	= TCBStubs[hCurrentTCP].bufferRxStart + TCP_SOCKET_RX_BUFFER_SIZE;
+		TCBStubs[hCurrentTCP].bufferTxStart	= 0;
+		TCBStubs[hCurrentTCP].bufferRxStart	= 0;
+		TCBStubs[hCurrentTCP].bufferEnd	= 0;
 		TCBStubs[hCurrentTCP].smState	= TCP_CLOSED;
 		TCBStubs[hCurrentTCP].Flags.bServer	= FALSE;
+		TCBStubs[hCurrentTCP].Flags.bHashLinked	= 0;
+		TCBStubs[hCurrentTCP].Flags.bTickListed	= 0;
 
 		SyncTCB();
 		CloseSocket();
@@ -588,19 +739,42 @@ void TCPInit(void)
  * ---TCPTick
  * This function performs any required periodic TCP tasks.  Each
  * socket's state machine is checked, and any elapsed timeout periods are handled.
+ * Only the sockets of the TCPTick list are visited (cf. TCPArmTick): a socket
+ * is removed from the list as soon as it has nothing left to do (closed or
+ * listening without any queued SYN, and no timer enabled).
  ******************************************************************************/
 void TCPTick(void)
 {
 	TCP_SOCKET hTCP;
+	TCP_SOCKET hPrev;
+	TCP_SOCKET hNext;
 	BOOL bRetransmit;
 	BOOL bCloseSocket;
 	BYTE vFlags;
 	WORD w;
 
-	// Periodically all "not closed" sockets must perform timed operations
-	for(hTCP = 0; hTCP < MAX_TCP_SOCKETS; hTCP++)
+	// Periodically all the sockets having pending work must perform timed operations
+	hPrev = INVALID_SOCKET;
+	for(hTCP = TCPTickHead; hTCP != INVALID_SOCKET; hTCP = hNext)
 	{
 		hCurrentTCP = hTCP;
+		hNext = TCBStubs[hCurrentTCP].tickNext;
+
+		// Remove the idle sockets from the list (TCPArmTick adds them again)
+		if(TCPIsTickIdle())
+		{
+			if(hPrev == INVALID_SOCKET)
+			{
+				TCPTickHead = hNext;
+			}
+			else
+			{
+				TCBStubs[hPrev].tickNext = hNext;
+			}
+			TCBStubs[hCurrentTCP].Flags.bTickListed = 0;
+			continue;
+		}
+		hPrev = hTCP;
 
 		vFlags = 0x00;
 		bRetransmit = FALSE;
@@ -665,7 +839,7 @@ void TCPTick(void)
                     memcpy((void*)&MyTCB.remote.niRemoteMACIP, (void*)&SYNQueue[w].niSourceAddress, sizeof(NODE_INFO));
                     MyTCB.remotePort.Val = SYNQueue[w].wSourcePort;
                     MyTCB.RemoteSEQ = SYNQueue[w].dwSourceSEQ + 1;
-                    TCBStubs[hCurrentTCP].remoteHash.Val = (MyTCB.remote.niRemoteMACIP.IPAddr.w[1] + MyTCB.remote.niRemoteMACIP.IPAddr.w[0] + MyTCB.remotePort.Val) ^ MyTCB.localPort.Val;
+                    TCPSetRemoteHash((MyTCB.remote.niRemoteMACIP.IPAddr.w[1] + MyTCB.remote.niRemoteMACIP.IPAddr.w[0] + MyTCB.remotePort.Val) ^ MyTCB.localPort.Val);
                     vFlags = SYN | ACK;
                     TCBStubs[hCurrentTCP].smState = TCP_SYN_RECEIVED;
 
@@ -736,32 +910,12 @@ void TCPTick(void)
 		switch(TCBStubs[hCurrentTCP].smState)
 		{
                     case TCP_GATEWAY_SEND_ARP:
-                        // Obtain the MAC address associated with the server's IP address (either direct MAC address on same subnet, or the MAC address of the Gateway machine)
-                        TCBStubs[hCurrentTCP].eventTime2 = (QWORD)(mGetTick() >> 8);
-                        ARPResolve(&MyTCB.remote.niRemoteMACIP.IPAddr);
-                        TCBStubs[hCurrentTCP].smState = TCP_GATEWAY_GET_ARP;
-                        break;
-                    case TCP_GATEWAY_GET_ARP:
-                        // Wait for the MAC address to finish being obtained
-                        if(!ARPIsResolved(&MyTCB.remote.niRemoteMACIP.IPAddr, &MyTCB.remote.niRemoteMACIP.MACAddr))
-                        {
-                            // Time out if too much time is spent in this state
-                            // Note that this will continuously send out ARP
-                            // requests for an infinite time if the Gateway
-                            // never responds
-                            if((QWORD)(mGetTick() >> 8) - TCBStubs[hCurrentTCP].eventTime2 > (QWORD)MyTCB.retryInterval)
-                            {
-                                // Exponentially increase timeout until we reach 6 attempts then stay constant
-                                if(MyTCB.retryCount < 6u)
-                                {
-                                    MyTCB.retryCount++;
-                                    MyTCB.retryInterval <<= 1;
-                                }
-                                // Retransmit ARP request
-                                TCBStubs[hCurrentTCP].smState = TCP_GATEWAY_SEND_ARP;
-                            }
-                            break;
-                        }
+                        // MAC address of the server (or of the gateway): if it
+                        // is not in the ARP cache, the SYN is held by the cache
+                        // until the ARP response (cf. SendTCP). A next hop that
+                        // never responds is requested again with each SYN
+                        // retransmission.
+                        MyTCB.flags.bARPPending = !ARPIsResolved(&MyTCB.remote.niRemoteMACIP.IPAddr, &MyTCB.remote.niRemoteMACIP.MACAddr);
                         // Send out SYN connection request to remote node
                         // This automatically disables the Timer from
                         // continuously firing for this socket
@@ -984,6 +1138,7 @@ BOOL TCPProcess(NODE_INFO* remote, IP_ADDR localIP, WORD len)
 	if(FindMatchingSocket_TCP(&TCPHeader, remote))
 	{
 		HandleTCPSeg(&TCPHeader, len);
+		TCPArmTick();
 	}
 //	else
 //	{
@@ -1023,23 +1178,16 @@ static BOOL FindMatchingSocket_TCP(TCP_HEADER* h, NODE_INFO* remote)
 	partialMatch = INVALID_SOCKET;
 	hash = (remote->IPAddr.w[1]+remote->IPAddr.w[0] + h->SourcePort) ^ h->DestPort;
 
-	// Loop through all sockets looking for a socket that is expecting this
-	// packet or can handle it.
-	for(hTCP = 0; hTCP < MAX_TCP_SOCKETS; hTCP++ )
+	// Loop through the sockets chained with this hash looking for a socket
+	// that is expecting this packet.
+	for(hTCP = TCPHashTable[hash & (TCP_HASH_TABLE_SIZE - 1)]; hTCP != INVALID_SOCKET; hTCP = TCBStubs[hTCP].hashNext)
 	{
 		hCurrentTCP = hTCP;
 
-		if(TCBStubs[hCurrentTCP].smState == TCP_CLOSED)
+		if((TCBStubs[hCurrentTCP].smState == TCP_CLOSED) || (TCBStubs[hCurrentTCP].smState == TCP_LISTEN))
 		{
 			continue;
 		}
-		else if(TCBStubs[hCurrentTCP].smState == TCP_LISTEN)
-		{// For listening ports, check if this is the correct port
-			if(TCBStubs[hCurrentTCP].remoteHash.Val == h->DestPort)
-				partialMatch = hTCP;
-
-			continue;
-		}
 		else if(TCBStubs[hCurrentTCP].remoteHash.Val != hash)
 		{// Ignore if the hash doesn't match
 			continue;
@@ -1054,6 +1202,17 @@ static BOOL FindMatchingSocket_TCP(TCP_HEADER* h, NODE_INFO* remote)
 		}
 	}
 
+	// Listening sockets are chained with their local port: look for one
+	// which can handle it.
+	for(hTCP = TCPHashTable[h->DestPort & (TCP_HASH_TABLE_SIZE - 1)]; hTCP != INVALID_SOCKET; hTCP = TCBStubs[hTCP].hashNext)
+	{
+		if((TCBStubs[hTCP].smState == TCP_LISTEN) && (TCBStubs[hTCP].remoteHash.Val == h->DestPort))
+		{
+			partialMatch = hTCP;
+			break;
+		}
+	}
+
 
 	// If there is a partial match, then a listening socket is currently
 	// available.  Set up the extended TCB with the info needed
@@ -1070,7 +1229,7 @@ static BOOL FindMatchingSocket_TCP(TCP_HEADER* h, NODE_INFO* remote)
 		// and add to the SYN queue.
 		if(partialMatch != INVALID_SOCKET)
 		{
-			TCBStubs[hCurrentTCP].remoteHash.Val = hash;
+			TCPSetRemoteHash(hash);
 
 			memcpy((void*)&MyTCB.remote, (void*)remote, sizeof(NODE_INFO));
 			MyTCB.remotePort.Val = h->SourcePort;
@@ -1148,6 +1307,11 @@ static BOOL FindMatchingSocket_TCP(TCP_HEADER* h, NODE_INFO* remote)
 
 }
 
+/******************************************************************************
+ * ---SyncTCB
+ * This function saves the extended TCB of the previous socket and loads the
+ * one of hCurrentTCP in MyTCB.
+ ******************************************************************************/
 static void SyncTCB(void)
 {
 	static TCP_SOCKET hLastTCB = INVALID_SOCKET;
@@ -1158,15 +1322,99 @@ static void SyncTCB(void)
 	if(hLastTCB != INVALID_SOCKET)
 	{
 		// Save the current TCB
-		TCPRAMCopy(TCBStubs[hLastTCB].bufferTxStart - sizeof(MyTCB), TCP_PIC_RAM, (PTR_BASE)&MyTCB, TCP_PIC_RAM, sizeof(MyTCB));
+		TCPRAMCopy((PTR_BASE)&TCBs[hLastTCB], TCP_PIC_RAM, (PTR_BASE)&MyTCB, TCP_PIC_RAM, sizeof(MyTCB));
 	}
 
 	// Load up the new TCB
 	hLastTCB = hCurrentTCP;
-	TCPRAMCopy((PTR_BASE)&MyTCB, TCP_PIC_RAM, TCBStubs[hCurrentTCP].bufferTxStart - sizeof(MyTCB), TCP_PIC_RAM, sizeof(MyTCB));
+	TCPRAMCopy((PTR_BASE)&MyTCB, TCP_PIC_RAM, (PTR_BASE)&TCBs[hCurrentTCP], TCP_PIC_RAM, sizeof(MyTCB));
 
 }
 
+/******************************************************************************
+ * ---TCPSetRemoteHash
+ * This function changes the remoteHash of hCurrentTCP and moves the socket
+ * in the matching bucket of TCPHashTable.  Every write of remoteHash must go
+ * through this function so FindMatchingSocket_TCP can rely on the buckets.
+ ******************************************************************************/
+static void TCPSetRemoteHash(WORD hash)
+{
+	TCP_SOCKET *p;
+
+	if(TCBStubs[hCurrentTCP].Flags.bHashLinked)
+	{
+		p = &TCPHashTable[TCBStubs[hCurrentTCP].remoteHash.Val & (TCP_HASH_TABLE_SIZE - 1)];
+		while(*p != INVALID_SOCKET)
+		{
+			if(*p == hCurrentTCP)
+			{
+				*p = TCBStubs[hCurrentTCP].hashNext;
+				break;
+			}
+			p = &TCBStubs[*p].hashNext;
+		}
+	}
+
+	TCBStubs[hCurrentTCP].remoteHash.Val = hash;
+	p = &TCPHashTable[hash & (TCP_HASH_TABLE_SIZE - 1)];
+	TCBStubs[hCurrentTCP].hashNext = *p;
+	*p = hCurrentTCP;
+	TCBStubs[hCurrentTCP].Flags.bHashLinked = 1;
+}
+
+/******************************************************************************
+ * ---TCPArmTick
+ * This function adds hCurrentTCP to the list processed by TCPTick (if not
+ * already in).  It must be called each time a socket may get some work to do
+ * (timer enabled, state change, segment received, data queued).
+ ******************************************************************************/
+static void TCPArmTick(void)
+{
+	if(!TCBStubs[hCurrentTCP].Flags.bTickListed)
+	{
+		TCBStubs[hCurrentTCP].tickNext = TCPTickHead;
+		TCPTickHead = hCurrentTCP;
+		TCBStubs[hCurrentTCP].Flags.bTickListed = 1;
+	}
+}
+
+/******************************************************************************
+ * ---TCPIsTickIdle
+ * This function returns TRUE if hCurrentTCP has nothing to do in TCPTick:
+ * no timer or transmission pending, and closed (or listening without any
+ * SYN waiting for its port in the SYNQueue).  The established sockets are
+ * never idle because of the keep-alives.
+ ******************************************************************************/
+static BOOL TCPIsTickIdle(void)
+{
+	WORD w;
+
+	if(TCBStubs[hCurrentTCP].Flags.bTXASAP || TCBStubs[hCurrentTCP].Flags.bTXASAPWithoutTimerReset ||
+		TCBStubs[hCurrentTCP].Flags.bTimerEnabled || TCBStubs[hCurrentTCP].Flags.bTimer2Enabled ||
+		TCBStubs[hCurrentTCP].Flags.bDelayedACKTimerEnabled)
+	{
+		return FALSE;
+	}
+
+	switch(TCBStubs[hCurrentTCP].smState)
+	{
+		case TCP_CLOSED:
+		case TCP_CLOSED_BUT_RESERVED:
+			return TRUE;
+		case TCP_LISTEN:
+			for(w = 0; w < TCP_SYN_QUEUE_MAX_ENTRIES; w++)
+			{
+				if(SYNQueue[w].wDestPort == 0u)
+					break;
+				if(SYNQueue[w].wDestPort == TCBStubs[hCurrentTCP].remoteHash.Val)
+					return FALSE;
+			}
+			return TRUE;
+		default:
+			return FALSE;
+	}
+}
+
 /******************************************************************************
  * ---TCPRAMCopy
  * This function copies data between memory mediums (PIC RAM, SPI, RAM, and Ethernet buffer RAM).
@@ -1209,6 +1457,21 @@ static void TCPRAMCopy(PTR_BASE ptrDest, BYTE vDestType, PTR_BASE ptrSource, BYT
 	}
 }
 
+/******************************************************************************
+ * ---TCPRAMCopyChecksum
+ * This function copies data from PIC RAM to the Ethernet TX buffer (as
+ * TCPRAMCopy) and returns the one's complement sum of the copied bytes
+ * (computed during the copy).
+ ******************************************************************************/
+static WORD TCPRAMCopyChecksum(PTR_BASE ptrDest, PTR_BASE ptrSource, WORD wLength)
+{
+	if(ptrDest != (PTR_BASE)-1)
+	{
+		MACSetWritePtr(ptrDest);
+	}
+	return MACPutArrayChecksum((BYTE*)ptrSource, wLength, 0);
+}
+
 /******************************************************************************
  * ---SwapTCPHeader
  * This function swaps the endian-ness of a given TCP header for comparison.
@@ -1942,11 +2205,38 @@ static void HandleTCPSeg(TCP_HEADER* h, WORD len)
  * sockets). Server sockets can be freed using TCPClose only (calls to
  * TCPDisconnect will return server sockets to the listening state,
  * allowing reuse).
+
+ * The socket gets the default buffer sizes (TCP_SOCKET_TX_BUFFER_SIZE and
+ * TCP_SOCKET_RX_BUFFER_SIZE), cf. TCPOpenEx.
  ******************************************************************************/
 TCP_SOCKET TCPOpen(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort)
+{
+	return TCPOpenEx(dwRemoteHost, vRemoteHostType, wPort, TCP_SOCKET_TX_BUFFER_SIZE, TCP_SOCKET_RX_BUFFER_SIZE);
+}
+
+/******************************************************************************
+ * ---TCPOpenEx
+ * Same as TCPOpen but the sizes of the TX and RX FIFOs of the socket are
+ * given (1 to TCP_MAX_FIFO_SIZE bytes each, larger FIFOs are rejected: no
+ * window scaling).  The FIFOs are taken from the shared pool
+ * TCPBufferInPIC (TCP_PIC_RAM_SIZE bytes) and given back when the socket
+ * is closed (TCPDisconnect of a client socket, TCPClose).  A bulk transfer
+ * socket should get a RX FIFO of several TCP_MAX_SEG_SIZE_RX so the remote
+ * node can send several segments per round trip (the advertised window is
+ * the free space of the RX FIFO).
+
+ * INVALID_SOCKET is returned if no socket is free or if the pool has not
+ * a large enough free block.
+ ******************************************************************************/
+TCP_SOCKET TCPOpenEx(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort, WORD wTxSize, WORD wRxSize)
 {
 	TCP_SOCKET hTCP;
 
+	if((wTxSize == 0u) || (wRxSize == 0u) || (wTxSize > TCP_MAX_FIFO_SIZE) || (wRxSize > TCP_MAX_FIFO_SIZE))
+	{
+		return INVALID_SOCKET;
+	}
+
 	// Find an available socket that matches the specified socket type
 	for(hTCP = 0; hTCP < MAX_TCP_SOCKETS; hTCP++)
 	{
@@ -1957,6 +2247,10 @@ TCP_SOCKET TCPOpen(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort)
 			continue;
         }
 		SyncTCB();
+		if(!TCPAllocBuffers(wTxSize, wRxSize))
+		{
+			return INVALID_SOCKET;
+		}
 		// Start out assuming worst case Maximum Segment Size (changes when MSS
 		// option is received from remote node)
 		MyTCB.wRemoteMSS = 536;
@@ -1965,7 +2259,7 @@ TCP_SOCKET TCPOpen(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort)
 			MyTCB.localPort.Val = wPort;
 			TCBStubs[hCurrentTCP].Flags.bServer = TRUE;
 			TCBStubs[hCurrentTCP].smState = TCP_LISTEN;
-			TCBStubs[hCurrentTCP].remoteHash.Val = wPort;
+			TCPSetRemoteHash(wPort);
 		}
 		else
 		{
@@ -1981,7 +2275,7 @@ TCP_SOCKET TCPOpen(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort)
             // Flag to start the DNS, ARP, SYN processes
             TCBStubs[hCurrentTCP].eventTime = mGetTick();
             TCBStubs[hCurrentTCP].Flags.bTimerEnabled = 1;
-            TCBStubs[hCurrentTCP].remoteHash.Val = (((DWORD_VAL*)&dwRemoteHost)->w[1]+((DWORD_VAL*)&dwRemoteHost)->w[0] + wPort) ^ MyTCB.localPort.Val;
+            TCPSetRemoteHash((((DWORD_VAL*)&dwRemoteHost)->w[1]+((DWORD_VAL*)&dwRemoteHost)->w[0] + wPort) ^ MyTCB.localPort.Val);
             MyTCB.remote.niRemoteMACIP.IPAddr.Val = dwRemoteHost;
             MyTCB.retryCount = 2;
             MyTCB.retryInterval = (TICK_1S/4)/256;
@@ -1990,6 +2284,7 @@ TCP_SOCKET TCPOpen(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort)
         TCBStubs[hCurrentTCP].mLocalPort.Val = NextPort;
         TCBStubs[hCurrentTCP].mRemotePort.Val = wPort;
         memcpy((void*)&TCBStubs[hCurrentTCP].mRemoteNode, (void*)&MyTCB.remote, sizeof(NODE_INFO));
+		TCPArmTick();
 		return hTCP;
 	}
 	return INVALID_SOCKET;
@@ -2007,6 +2302,9 @@ static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags)
 	TCP_OPTIONS     options;
 	PSEUDO_HEADER   pseudoHeader;
 	WORD 		len;
+	WORD		wDataSum = 0;		// Sum of the data bytes copied in the TX buffer
+	WORD		wDataCopied = 0;	// Number of data bytes copied in the TX buffer
+	WORD		wHeaderLen;
 
 	SyncTCB();
 
@@ -2057,7 +2355,8 @@ static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags)
 			}
 
 			// Copy application data into the raw TX buffer
-			TCPRAMCopy(BASE_TX_ADDR+sizeof(ETHER_HEADER)+sizeof(IP_HEADER)+sizeof(TCP_HEADER), TCP_ETH_RAM, MyTCB.txUnackedTail, TCP_PIC_RAM, len);
+			wDataSum = TCPRAMCopyChecksum(BASE_TX_ADDR+sizeof(ETHER_HEADER)+sizeof(IP_HEADER)+sizeof(TCP_HEADER), MyTCB.txUnackedTail, len);
+			wDataCopied = len;
 			MyTCB.txUnackedTail += len;
 		}
 		else
@@ -2078,13 +2377,15 @@ static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags)
 				pseudoHeader.Length = len;
 
 			// Copy application data into the raw TX buffer
-			TCPRAMCopy(BASE_TX_ADDR+sizeof(ETHER_HEADER)+sizeof(IP_HEADER)+sizeof(TCP_HEADER), TCP_ETH_RAM, MyTCB.txUnackedTail, TCP_PIC_RAM, pseudoHeader.Length);
+			wDataSum = TCPRAMCopyChecksum(BASE_TX_ADDR+sizeof(ETHER_HEADER)+sizeof(IP_HEADER)+sizeof(TCP_HEADER), MyTCB.txUnackedTail, pseudoHeader.Length);
+			wDataCopied = pseudoHeader.Length;
 			pseudoHeader.Length = len - pseudoHeader.Length;
 
 			// Copy any left over chunks of application data over
 			if(pseudoHeader.Length)
 			{
-				TCPRAMCopy(BASE_TX_ADDR+sizeof(ETHER_HEADER)+sizeof(IP_HEADER)+sizeof(TCP_HEADER)+(TCBStubs[hCurrentTCP].bufferRxStart-MyTCB.txUnackedTail), TCP_ETH_RAM, TCBStubs[hCurrentTCP].bufferTxStart, TCP_PIC_RAM, pseudoHeader.Length);
+				wDataSum = CalcIPChecksumAdd(wDataSum, TCPRAMCopyChecksum(BASE_TX_ADDR+sizeof(ETHER_HEADER)+sizeof(IP_HEADER)+sizeof(TCP_HEADER)+(TCBStubs[hCurrentTCP].bufferRxStart-MyTCB.txUnackedTail), TCBStubs[hCurrentTCP].bufferTxStart, pseudoHeader.Length), wDataCopied);
+				wDataCopied += pseudoHeader.Length;
 			}
 
 			MyTCB.txUnackedTail += len;
@@ -2219,8 +2520,11 @@ static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags)
 		options.Kind = TCP_OPTIONS_MAX_SEG_SIZE;
 		options.Length = 0x04;
 
-		// Load MSS and swap to big endian
-		options.MaxSegSize.Val = (((TCP_MAX_SEG_SIZE_RX)&0x00FF)<<8) | (((TCP_MAX_SEG_SIZE_RX)&0xFF00)>>8);
+		// Load MSS (no larger than the RX FIFO) and swap to big endian
+		wVal.Val = TCBStubs[hCurrentTCP].bufferEnd - TCBStubs[hCurrentTCP].bufferRxStart;
+		if(wVal.Val > TCP_MAX_SEG_SIZE_RX)
+			wVal.Val = TCP_MAX_SEG_SIZE_RX;
+		options.MaxSegSize.Val = swap_word(wVal.Val);
 
 		header.DataOffset.Val   += sizeof(options) >> 2;
 	}
@@ -2234,21 +2538,47 @@ static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags)
 	SwapPseudoHeader(pseudoHeader);
 	header.Checksum = ~CalcIPChecksum((BYTE*)&pseudoHeader, sizeof(pseudoHeader));
 
+	// The next hop of a SYN held by the ARP cache is resolved with its response
+	if(MyTCB.flags.bARPPending && ARPIsResolved(&MyTCB.remote.niRemoteMACIP.IPAddr, &MyTCB.remote.niRemoteMACIP.MACAddr))
+	{
+		MyTCB.flags.bARPPending = 0;
+	}
+
 	// Write IP header
 	MACSetWritePtr(BASE_TX_ADDR + sizeof(ETHER_HEADER));
 	IPPutHeader(&MyTCB.remote.niRemoteMACIP, IP_PROTOCOLE_TCP, len);
-	MACPutArray((BYTE*)&header, sizeof(header));
+	wVal.Val = MACPutArrayChecksum((BYTE*)&header, sizeof(header), 0);
+	wHeaderLen = sizeof(header);
 	if(vTCPFlags & SYN)
-		MACPutArray((BYTE*)&options, sizeof(options));
+	{
+		wVal.Val = MACPutArrayChecksum((BYTE*)&options, sizeof(options), wVal.Val);
+		wHeaderLen += sizeof(options);
+	}
 
-	// Update the TCP checksum
-	MACSetReadPtr(BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER));
-	wVal.Val = CalcIPBufferChecksum(len);
+	// Update the TCP checksum: header (with the pseudo header sum) + data
+	// summed during the copy + the data not copied (keep-alive dummy byte)
+	wVal.Val = CalcIPChecksumAdd(wVal.Val, wDataSum, wHeaderLen);
+	if(len > wHeaderLen + wDataCopied)
+	{
+		wVal.Val = CalcIPChecksumAdd(wVal.Val, CalcIPChecksumPartial(0, (BYTE*)(BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER) + wHeaderLen + wDataCopied), len - wHeaderLen - wDataCopied), wHeaderLen + wDataCopied);
+	}
+	wVal.Val = ~wVal.Val;
 	MACSetWritePtr(BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER) + 16);
 	MACPutArray((BYTE*)&wVal, sizeof(WORD));
 
-	// Physically start the packet transmission over the network
-	MACFlush();
+	// Physically start the packet transmission over the network (or hold
+	// the segment in the ARP cache until the next hop is resolved)
+	if(MyTCB.flags.bARPPending)
+	{
+		ARPQueuePacket(&MyTCB.remote.niRemoteMACIP.IPAddr, IP_PROTOCOLE_TCP, (BYTE*)(BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER)), len);
+	}
+	else
+	{
+		MACFlush();
+	}
+
+	// Retransmission / FIN timers may have been started
+	TCPArmTick();
 }
 
 
@@ -2261,6 +2591,8 @@ static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags)
  ******************************************************************************/
 void TCPFlush(TCP_SOCKET hTCP)
 {
+    BYTE i;
+
     if(hTCP >= MAX_TCP_SOCKETS)
     {
         return;
@@ -2271,10 +2603,13 @@ void TCPFlush(TCP_SOCKET hTCP)
 
     // NOTE: Pending SSL data will NOT be transferred here
 
-    if(TCBStubs[hCurrentTCP].txHead != MyTCB.txUnackedTail)
+    // Send the unsent bytes in up to TCP_MAX_TX_BURST segments (each one is
+    // limited to the remote MSS) as long as the remote window is open
+    for(i = 0; (i < TCP_MAX_TX_BURST) && (TCBStubs[hCurrentTCP].txHead != MyTCB.txUnackedTail); i++)
     {
-        // Send the TCP segment with all unacked bytes
         SendTCP(ACK, SENDTCP_RESET_TIMERS);
+        if(MyTCB.remoteWindow == 0u)
+            break;
     }
 }
 
@@ -2324,7 +2659,6 @@ void TCPDisconnect(TCP_SOCKET hTCP)
 	{
 		case TCP_GET_DNS_MODULE:
 		case TCP_GATEWAY_SEND_ARP:
-		case TCP_GATEWAY_GET_ARP:
 		case TCP_SYN_SENT:
 			CloseSocket();
 			break;
@@ -2393,7 +2727,13 @@ static void CloseSocket(void)
 {
 	SyncTCB();
 
-	TCBStubs[hCurrentTCP].remoteHash.Val = MyTCB.localPort.Val;
+	// Only a server socket (back in listening state) keeps its FIFOs
+	if(!TCBStubs[hCurrentTCP].Flags.bServer)
+	{
+		TCPFreeBuffers();
+	}
+
+	TCPSetRemoteHash(MyTCB.localPort.Val);
 	TCBStubs[hCurrentTCP].txHead = TCBStubs[hCurrentTCP].bufferTxStart;
 	TCBStubs[hCurrentTCP].txTail = TCBStubs[hCurrentTCP].bufferTxStart;
 	TCBStubs[hCurrentTCP].rxHead = TCBStubs[hCurrentTCP].bufferRxStart;
@@ -2414,11 +2754,73 @@ static void CloseSocket(void)
 	MyTCB.flags.bSYNSent = 0;
 	MyTCB.flags.bRXNoneACKed1 = 0;
 	MyTCB.flags.bRXNoneACKed2 = 0;
+	MyTCB.flags.bARPPending = 0;
 	MyTCB.txUnackedTail = TCBStubs[hCurrentTCP].bufferTxStart;
 	((DWORD_VAL*)(&MyTCB.MySEQ))->w[0] = LFSRRand();
 	((DWORD_VAL*)(&MyTCB.MySEQ))->w[1] = LFSRRand();
 	MyTCB.sHoleSize = -1;
 	MyTCB.remoteWindow = 1;
+
+	// A server socket back in listening state may have a SYN waiting in the SYNQueue
+	TCPArmTick();
+}
+
+/******************************************************************************
+ * ---TCPAllocBuffers
+ * This function takes the TX (wTxSize + 1) and RX (wRxSize + 1) FIFOs of
+ * hCurrentTCP in a single block of TCPBufferInPIC (first fit: the block
+ * start is moved past each opened socket block it overlaps) and resets the
+ * FIFO pointers.  The extended TCB must be loaded (SyncTCB).  It returns
+ * FALSE if the pool has no free block large enough.
+ ******************************************************************************/
+static BOOL TCPAllocBuffers(WORD wTxSize, WORD wRxSize)
+{
+	PTR_BASE ptrStart = TCP_PIC_RAM_BASE_ADDRESS;
+	DWORD dwSize = (DWORD)wTxSize + 1 + (DWORD)wRxSize + 1;
+	TCP_SOCKET hTCP;
+	BOOL bMoved;
+
+	do
+	{
+		bMoved = FALSE;
+		for(hTCP = 0; hTCP < MAX_TCP_SOCKETS; hTCP++)
+		{
+			// bufferEnd is 0 for a socket without FIFOs
+			if(TCBStubs[hTCP].bufferEnd == 0u)
+				continue;
+
+			if((ptrStart <= TCBStubs[hTCP].bufferEnd) && (TCBStubs[hTCP].bufferTxStart < ptrStart + dwSize))
+			{
+				ptrStart = TCBStubs[hTCP].bufferEnd + 1;
+				bMoved = TRUE;
+			}
+		}
+	} while(bMoved && (ptrStart + dwSize <= TCP_PIC_RAM_BASE_ADDRESS + TCP_PIC_RAM_SIZE));
+
+	if(ptrStart + dwSize > TCP_PIC_RAM_BASE_ADDRESS + TCP_PIC_RAM_SIZE)
+		return FALSE;
+
+	TCBStubs[hCurrentTCP].bufferTxStart = ptrStart;
+	TCBStubs[hCurrentTCP].bufferRxStart = ptrStart + wTxSize + 1;
+	TCBStubs[hCurrentTCP].bufferEnd = TCBStubs[hCurrentTCP].bufferRxStart + wRxSize;
+	TCBStubs[hCurrentTCP].txHead = TCBStubs[hCurrentTCP].bufferTxStart;
+	TCBStubs[hCurrentTCP].txTail = TCBStubs[hCurrentTCP].bufferTxStart;
+	TCBStubs[hCurrentTCP].rxHead = TCBStubs[hCurrentTCP].bufferRxStart;
+	TCBStubs[hCurrentTCP].rxTail = TCBStubs[hCurrentTCP].bufferRxStart;
+	MyTCB.txUnackedTail = TCBStubs[hCurrentTCP].bufferTxStart;
+	return TRUE;
+}
+
+/******************************************************************************
+ * ---TCPFreeBuffers
+ * This function gives the FIFOs of hCurrentTCP back to the pool.  The FIFO
+ * pointers are reset by the caller (CloseSocket).
+ ******************************************************************************/
+static void TCPFreeBuffers(void)
+{
+	TCBStubs[hCurrentTCP].bufferTxStart = 0;
+	TCBStubs[hCurrentTCP].bufferRxStart = 0;
+	TCBStubs[hCurrentTCP].bufferEnd = 0;
 }
 
 /******************************************************************************
@@ -2502,10 +2904,49 @@ WORD TCPGetArray(TCP_SOCKET hTCP, BYTE* buffer, WORD len)
 		TCBStubs[hCurrentTCP].Flags.bTimer2Enabled = TRUE;
 		TCBStubs[hCurrentTCP].eventTime2 = (QWORD)(mGetTick() >> 8) + (TCP_WINDOW_UPDATE_TIMEOUT_VAL >> 8);
 	}
+	TCPArmTick();
 
 	return len;
 }
 
+/******************************************************************************
+ * ---TCPPeekSegments
+ * Gives a read-only view (no copy) of all the bytes waiting in the socket's
+ * receive FIFO: one segment, or two when the data wraps around the end of
+ * the FIFO.  The view stays valid until the bytes are released with
+ * TCPConsume (the FIFO space is only reused after that).  It returns the
+ * number of bytes of the view.
+ ******************************************************************************/
+WORD TCPPeekSegments(TCP_SOCKET hTCP, RX_VIEW *view)
+{
+	WORD wGetReadyCount;
+
+	view->data[0] = NULL;
+	view->data[1] = NULL;
+	view->length[0] = 0;
+	view->length[1] = 0;
+
+	wGetReadyCount = TCPIsGetReady(hTCP);
+	if(wGetReadyCount == 0u)
+		return 0x0000u;
+
+	view->data[0] = (const BYTE*)TCBStubs[hTCP].rxTail;
+	if(TCBStubs[hTCP].rxTail + wGetReadyCount > TCBStubs[hTCP].bufferEnd)
+	{
+		view->length[0] = TCBStubs[hTCP].bufferEnd - TCBStubs[hTCP].rxTail + 1;
+		view->length[1] = wGetReadyCount - view->length[0];
+		// No second segment when the data ends exactly on bufferEnd
+		if(view->length[1] != 0u)
+			view->data[1] = (const BYTE*)TCBStubs[hTCP].bufferRxStart;
+	}
+	else
+	{
+		view->length[0] = wGetReadyCount;
+	}
+
+	return wGetReadyCount;
+}
+
 /******************************************************************************
  * ---TCPPutArray
  * Writes an array from RAM to a TCP socket.
@@ -2569,6 +3010,7 @@ WORD TCPPutArray(TCP_SOCKET hTCP, BYTE* data, WORD len)
 		TCBStubs[hCurrentTCP].Flags.bTimer2Enabled = TRUE;
 		TCBStubs[hCurrentTCP].eventTime2 = (QWORD)(mGetTick() >> 8) + (TCP_AUTO_TRANSMIT_TIMEOUT_VAL >> 8);
 	}
+	TCPArmTick();
 
 	return wActualLen + wRightLen;
 }
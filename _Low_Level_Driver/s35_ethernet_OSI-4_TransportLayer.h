@@ -17,10 +17,22 @@ typedef WORD UDP_PORT;
 #define IPSetTxBuffer(b) MACSetWritePtr(b + BASE_TX_ADDR + sizeof(ETHER_HEADER) + sizeof(IP_HEADER))
 #define SwapPseudoHeader(h)  (h.Length = swap_word(h.Length))
 
-#define MAX_UDP_SOCKETS             (8u)
+#ifndef MAX_UDP_SOCKETS
+#define MAX_UDP_SOCKETS             (8u)		// Can be overridden by the project (< INVALID_UDP_SOCKET)
+#endif
 #define INVALID_UDP_SOCKET          (0xffu)		// Indicates a UDP socket that is not valid
 #define INVALID_UDP_PORT            (0ul)		// Indicates a UDP port that is not valid
 
+// Number of buckets of the local port index (power of 2). Sockets whose local
+// ports share the same low bits are chained in the same bucket.
+#ifndef UDP_PORT_TABLE_SIZE
+#define UDP_PORT_TABLE_SIZE         (8u)
+#endif
+
+#if (MAX_UDP_SOCKETS >= INVALID_UDP_SOCKET)
+#error "TransportLayer.h - MAX_UDP_SOCKETS must be lower than INVALID_UDP_SOCKET"
+#endif
+
 #define UDP_OPEN_SERVER		0u
 #define UDP_OPEN_IP_ADDRESS	3u
 #define UDP_OPEN_NODE_INFO	4u
@@ -31,8 +43,16 @@ typedef WORD UDP_PORT;
 static struct {
     unsigned char bFirstRead : 1; // No data has been read from this segment yet
     unsigned char bWasDiscarded : 1; // The data in this segment has been discarded
+    unsigned char bViewBorrowed : 1; // The application holds a view of this segment (cf. UDPPeek)
 } Flags;
 
+// Read-only view of received data, without copy (cf. UDPPeek / TCPPeekSegments).
+// The second segment is used when the data wraps around the end of a TCP RX FIFO.
+typedef struct {
+    const BYTE *data[2];
+    WORD length[2];
+} RX_VIEW;
+
 typedef enum {
     UDP_DNS_IS_RESOLVED, // Special state for UDP client mode sockets
     UDP_DNS_RESOLVE, // Special state for UDP client mode sockets
@@ -62,6 +82,7 @@ typedef struct
 		unsigned char bRemoteHostIsROM : 1;	// Remote host is stored in ROM
 	}flags;
 	QWORD eventTime;
+	UDP_SOCKET portNext;		// Next socket in the same bucket of UDPPortTable
 } UDP_SOCKET_INFO;
 
 /*********************************************************************
@@ -89,10 +110,37 @@ typedef BYTE TCP_SOCKET;
 #define INVALID_SOCKET                          (0xFE)	// The socket is invalid or could not be opened
 #define UNKNOWN_SOCKET                          (0xFF)	// The socket is not known
 
-#define MAX_TCP_SOCKETS                         (3)
-#define TCP_SOCKET_TX_BUFFER_SIZE               (200)   // For each TCP Socket
-#define TCP_SOCKET_RX_BUFFER_SIZE               (500)  // For each TCP Socket
-#define TCP_PIC_RAM_SIZE                        (MAX_TCP_SOCKETS*(TCP_SOCKET_TX_BUFFER_SIZE + TCP_SOCKET_RX_BUFFER_SIZE + 150))
+#ifndef MAX_TCP_SOCKETS
+#define MAX_TCP_SOCKETS                         (3)     // Can be overridden by the project (< INVALID_SOCKET)
+#endif
+// Number of buckets of the socket hash table (power of 2). Connected sockets
+// are chained on their remoteHash, listening sockets on their local port.
+#ifndef TCP_HASH_TABLE_SIZE
+#define TCP_HASH_TABLE_SIZE                     (8u)
+#endif
+
+#if (MAX_TCP_SOCKETS >= INVALID_SOCKET)
+#error "TransportLayer.h - MAX_TCP_SOCKETS must be lower than INVALID_SOCKET"
+#endif
+#ifndef TCP_SOCKET_TX_BUFFER_SIZE
+#define TCP_SOCKET_TX_BUFFER_SIZE               (200)   // Default for each TCP Socket (cf. TCPOpenEx)
+#endif
+#ifndef TCP_SOCKET_RX_BUFFER_SIZE
+#define TCP_SOCKET_RX_BUFFER_SIZE               (500)   // Default for each TCP Socket (cf. TCPOpenEx)
+#endif
+// Largest TX / RX FIFO of a socket. No window scale option (RFC 1323): the
+// advertised window (free RX space) must fit in 16 bits and the sequence
+// roll back of the retransmissions is done on a SHORT.
+#define TCP_MAX_FIFO_SIZE                       (0x7FFFu)
+
+#if (TCP_SOCKET_TX_BUFFER_SIZE > TCP_MAX_FIFO_SIZE) || (TCP_SOCKET_RX_BUFFER_SIZE > TCP_MAX_FIFO_SIZE)
+#error "TransportLayer.h - TCP_SOCKET_TX_BUFFER_SIZE and TCP_SOCKET_RX_BUFFER_SIZE must not exceed TCP_MAX_FIFO_SIZE"
+#endif
+// Pool shared by the TX / RX buffers of the opened sockets (each socket takes wTxSize + wRxSize + 2 bytes)
+#ifndef TCP_PIC_RAM_SIZE
+#define TCP_PIC_RAM_SIZE                        (MAX_TCP_SOCKETS*(TCP_SOCKET_TX_BUFFER_SIZE + TCP_SOCKET_RX_BUFFER_SIZE + 2))
+#endif
+#define TCP_MAX_TX_BURST                        (4u)    // Maximum number of segments sent back to back by TCPFlush (remote window allowing)
 
 #define TCP_ETH_RAM                             0u
 #define TCP_PIC_RAM                             1u
@@ -115,6 +163,7 @@ typedef BYTE TCP_SOCKET;
 #define LOCAL_PORT_END_NUMBER           (5000u)
 
 #define TCPPutROMString(a,b)            TCPPutString(a,(BYTE*)b)
+#define TCPConsume(a,b)                 TCPGetArray(a,NULL,b)   // Releases the bytes of a view obtained with TCPPeekSegments
 #define TCP_MAX_SEG_SIZE_TX             (1460u)
 #define TCP_MAX_SEG_SIZE_RX             (536u)
 
@@ -126,7 +175,6 @@ typedef enum {
     TCP_GET_DNS_MODULE, // Special state for TCP client mode sockets
     TCP_DNS_RESOLVE, // Special state for TCP client mode sockets
     TCP_GATEWAY_SEND_ARP, // Special state for TCP client mode sockets
-    TCP_GATEWAY_GET_ARP, // Special state for TCP client mode sockets
 
     TCP_LISTEN, // Socket is listening for connections
     TCP_SYN_SENT, // A SYN has been sent, awaiting an SYN+ACK
@@ -178,10 +226,13 @@ typedef struct
         unsigned char bTXFIN : 1; // FIN needs to be transmitted
         unsigned char bSocketReset : 1; // Socket has been reset (self-clearing semaphore)
         unsigned char bSSLHandshaking : 1; // Socket is in an SSL handshake
-        unsigned char filler : 2; // Future expansion
+        unsigned char bHashLinked : 1; // Socket is chained in TCPHashTable
+        unsigned char bTickListed : 1; // Socket is in the list processed by TCPTick
     } Flags;
     WORD_VAL remoteHash; // Consists of remoteIP, remotePort, localPort for connected sockets.  It is a localPort number only for listening server sockets.
     BYTE vMemoryMedium;
+    TCP_SOCKET hashNext; // Next socket in the same bucket of TCPHashTable
+    TCP_SOCKET tickNext; // Next socket in the TCPTick list
 } TCB_STUB;
 
 typedef struct {
@@ -214,7 +265,8 @@ typedef struct {
         unsigned char bRemoteHostIsROM : 1; // Remote host is stored in ROM
         unsigned char bRXNoneACKed1 : 1; // A duplicate ACK was likely received
         unsigned char bRXNoneACKed2 : 1; // A second duplicate ACK was likely received
-        unsigned char filler : 3; // future use
+        unsigned char bARPPending : 1; // Next hop not resolved: the segments are held by the ARP cache
+        unsigned char filler : 2; // future use
     } flags;
     WORD wRemoteMSS; // Maximum Segment Size option advirtised by the remote node during initial handshaking
     BYTE retryCount; // Counter for transmission retries
@@ -279,6 +331,8 @@ extern TCB_STUB TCBStubs[MAX_TCP_SOCKETS];
 void UDPSetTxBuffer(WORD wOffset);
 void UDPSetRxBuffer(WORD wOffset);
 static UDP_SOCKET FindMatchingSocket(UDP_HEADER *h, NODE_INFO *remoteNode);
+static void UDPPortLink(UDP_SOCKET s);
+static void UDPPortUnlink(UDP_SOCKET s);
 
 void UDPInit(void);
 WORD UDPIsGetReady(UDP_SOCKET s);
@@ -286,6 +340,9 @@ WORD UDPIsPutReady(UDP_SOCKET s);
 
 BOOL UDPGet(BYTE *v);
 WORD UDPGetArray(BYTE *cData, WORD wDataLen);
+WORD UDPPeek(UDP_SOCKET s, RX_VIEW *view);
+WORD UDPConsume(UDP_SOCKET s, WORD wDataLen);
+BOOL UDPIsViewBorrowed(void);
 void UDPDiscard(void);
 WORD UDPPutArray(BYTE *cData, WORD wDataLen);
 BOOL UDPPut(BYTE v);
@@ -304,11 +361,18 @@ void TCPTick(void);
 BOOL TCPProcess(NODE_INFO* remote, IP_ADDR localIP, WORD len);
 static BOOL FindMatchingSocket_TCP(TCP_HEADER* h, NODE_INFO* remote);
 static void SyncTCB(void);
+static void TCPSetRemoteHash(WORD hash);
+static void TCPArmTick(void);
+static BOOL TCPIsTickIdle(void);
 static void TCPRAMCopy(PTR_BASE ptrDest, BYTE vDestType, PTR_BASE ptrSource, BYTE vSourceType, WORD wLength);
+static WORD TCPRAMCopyChecksum(PTR_BASE ptrDest, PTR_BASE ptrSource, WORD wLength);
 static void SwapTCPHeader(TCP_HEADER* header);
 static void HandleTCPSeg(TCP_HEADER* h, WORD len);
 
 TCP_SOCKET TCPOpen(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort);
+TCP_SOCKET TCPOpenEx(DWORD dwRemoteHost, BYTE vRemoteHostType, WORD wPort, WORD wTxSize, WORD wRxSize);
+static BOOL TCPAllocBuffers(WORD wTxSize, WORD wRxSize);
+static void TCPFreeBuffers(void);
 static void SendTCP(BYTE vTCPFlags, BYTE vSendFlags);
 void TCPFlush(TCP_SOCKET hTCP);
 void TCPDisconnect(TCP_SOCKET hTCP);
@@ -317,6 +381,7 @@ void TCPClose(TCP_SOCKET hTCP);
 
 BYTE* TCPPutString(TCP_SOCKET hTCP, BYTE* data);
 WORD TCPGetArray(TCP_SOCKET hTCP, BYTE* buffer, WORD len);
+WORD TCPPeekSegments(TCP_SOCKET hTCP, RX_VIEW *view);
 WORD TCPPutArray(TCP_SOCKET hTCP, BYTE* data, WORD len);
 WORD TCPIsGetReady(TCP_SOCKET hTCP);
 WORD TCPIsPutReady(TCP_SOCKET hTCP);
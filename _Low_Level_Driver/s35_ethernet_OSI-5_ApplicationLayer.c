@@ -42,6 +42,8 @@ void ETH_StackInit(BYTE *str_mac, BYTE *str_ip, BOOL dhcpEnabled)
     
     if(!MACInit())
     {
+        ARPInit();
+
         UDPInit();
 
         TCPInit();
@@ -70,6 +72,7 @@ void ETH_StackTask(void)
                 AppConfig.MyIPAddr.Val = AppConfig.DefaultIPAddr.Val;
                 AppConfig.MyMask.Val = AppConfig.DefaultMask.Val;
                 AppConfig.bInConfigMode = TRUE;
+                ARPInit();
                 DHCPInit();
             }
         }
@@ -82,6 +85,8 @@ void ETH_StackTask(void)
         }
     }
 
+    ARPTask();
+
     TCPTick();
 
     UDPTask();
@@ -91,6 +96,12 @@ void ETH_StackTask(void)
     {
         UDPDiscard();
 
+        // The RX buffer of a UDP segment borrowed with UDPPeek is kept until UDPConsume
+        if (UDPIsViewBorrowed())
+        {
+            break;
+        }
+
         if (!MACGetHeader(&remoteNode.MACAddr, &frameType))
         {
             break;
@@ -105,6 +116,10 @@ void ETH_StackTask(void)
             case MAC_IP:
                 if (IPGetHeader(&remoteNode.IPAddr, &IPHeader))
                 {
+                    if(IPHeader.DestAddress.Val == AppConfig.MyIPAddr.Val)
+                    {
+                        ARPLearn(&remoteNode);
+                    }
                     if(IPHeader.Protocol == IP_PROTOCOLE_ICMP)
                     {
                         ICMPProcess(&remoteNode, IPHeader.DestAddress, (WORD)(swap_word(IPHeader.TotalLength) - ((IPHeader.VersionIHL & 0x0f) << 2)));
@@ -205,7 +205,7 @@ BOOL StringToMACAddress(BYTE* str, BYTE* MACAddress)
         summed).  This checksum is defined in RFC 793.
 
   Precondition:
-        buffer is WORD aligned (even memory address) on 16- and 32-bit PICs.
+        None (any alignment, cf. CalcIPChecksumPartial).
 
   Parameters:
         buffer - pointer to the data to be checksummed
@@ -213,29 +213,262 @@ BOOL StringToMACAddress(BYTE* str, BYTE* MACAddress)
 
   Returns:
         The calculated checksum.
-
-  Internal:
-        This function could be improved to do 32-bit sums on PIC32 platforms.
  ***************************************************************************/
 WORD CalcIPChecksum(BYTE* buffer, WORD count) 
 {
-    WORD i = count >> 1; // divide by 2;
-    WORD *val = (WORD*) buffer;
-    DWORD_VAL sum;
-    
-    sum.Val = 0;
-    while (i--)
+    return ~CalcIPChecksumPartial(0, buffer, count);
+}
+
+/*****************************************************************************
+  Function:
+        WORD CalcIPChecksumPartial(WORD sum, const BYTE* buffer, WORD count)
+
+  Summary:
+        Adds an array to a one's complement sum (not complemented).
+
+  Description:
+        The 16-bit words are summed in a 32-bit accumulator with aligned
+        32-bit loads (4 per loop).  The leading bytes up to the first
+        32-bit boundary are handled apart: when the buffer starts at an odd
+        address the sum is computed as if it was shifted by one byte and
+        swapped at the end (the one's complement sum is byte order
+        independent).  The 32-bit accumulator cannot overflow: at most
+        32768 halfwords are added.
+
+  Precondition:
+        To chain the calls over a packet, all the arrays but the last must
+        have an even length (else use CalcIPChecksumAdd).
+
+  Parameters:
+        sum    - sum of the previous arrays (0 for the first one)
+        buffer - pointer to the data to be summed
+        count  - number of bytes to be summed
+
+  Returns:
+        The folded 16-bit sum (to be complemented to get a checksum).
+ ***************************************************************************/
+WORD CalcIPChecksumPartial(WORD sum, const BYTE* buffer, WORD count)
+{
+    const BYTE *p = buffer;
+    BOOL bOdd = ((PTR_BASE) p & 0x1) != 0;
+    DWORD acc = 0;
+    DWORD w;
+
+    if (bOdd && count)
     {
-        sum.Val += (DWORD) *val++;
+        acc = (DWORD) *p++ << 8;    // High byte of its (aligned) halfword
+        count--;
     }
-    // Add in the sum of the remaining byte, if present
-    if(count & 0x1)
+    if ((count >= 2) && ((PTR_BASE) p & 0x2))
     {
-        sum.Val += (DWORD)*(BYTE*) val;
+        acc += *(const WORD*) p;
+        p += 2;
+        count -= 2;
     }
-    
-    sum.Val = (DWORD) sum.w[0] + (DWORD) sum.w[1];  // Do an end-around carry (one's complement arrithmatic)
-    sum.w[0] += sum.w[1];       // Do another end-around carry in case if the prior add caused a carry out
+    while (count >= 16)
+    {
+        w = ((const DWORD*) p)[0];
+        acc += (w & 0xffff) + (w >> 16);
+        w = ((const DWORD*) p)[1];
+        acc += (w & 0xffff) + (w >> 16);
+        w = ((const DWORD*) p)[2];
+        acc += (w & 0xffff) + (w >> 16);
+        w = ((const DWORD*) p)[3];
+        acc += (w & 0xffff) + (w >> 16);
+        p += 16;
+        count -= 16;
+    }
+    while (count >= 4)
+    {
+        w = *(const DWORD*) p;
+        acc += (w & 0xffff) + (w >> 16);
+        p += 4;
+        count -= 4;
+    }
+    if (count >= 2)
+    {
+        acc += *(const WORD*) p;
+        p += 2;
+        count -= 2;
+    }
+    if (count)
+    {
+        acc += *p;                  // Low byte, zero padded
+    }
+
+    acc = (acc & 0xffff) + (acc >> 16);     // End-around carries
+    acc = (acc & 0xffff) + (acc >> 16);
+    if (bOdd)
+    {
+        acc = ((acc & 0xff) << 8) | (acc >> 8);
+    }
+    acc += sum;
+    acc = (acc & 0xffff) + (acc >> 16);
+    return (WORD) acc;
+}
+
+/*****************************************************************************
+  Function:
+        WORD CalcIPChecksumCopy(WORD sum, BYTE* dest, const BYTE* source, WORD count)
+
+  Summary:
+        Copies an array and adds it to a one's complement sum.
+
+  Description:
+        When the source and the destination have the same alignment, each
+        32-bit word is summed while it is copied (one load for both).
+        Otherwise the array is copied (memcpy) then summed in the
+        destination (still in the cache).
+
+  Precondition:
+        Same as CalcIPChecksumPartial (the offsets are the ones of dest).
+
+  Parameters:
+        sum    - sum of the previous arrays (0 for the first one)
+        dest   - pointer to the destination
+        source - pointer to the data to be copied and summed
+        count  - number of bytes to be copied and summed
+
+  Returns:
+        The folded 16-bit sum (to be complemented to get a checksum).
+ ***************************************************************************/
+WORD CalcIPChecksumCopy(WORD sum, BYTE* dest, const BYTE* source, WORD count)
+{
+    BYTE *d = dest;
+    const BYTE *s = source;
+    BOOL bOdd = ((PTR_BASE) d & 0x1) != 0;
+    DWORD acc = 0;
+    DWORD w;
+
+    if (((PTR_BASE) d ^ (PTR_BASE) s) & 0x3)
+    {
+        memcpy(dest, source, count);
+        return CalcIPChecksumPartial(sum, dest, count);
+    }
+
+    if (bOdd && count)
+    {
+        *d = *s++;
+        acc = (DWORD) *d++ << 8;
+        count--;
+    }
+    if ((count >= 2) && ((PTR_BASE) d & 0x2))
+    {
+        *(WORD*) d = *(const WORD*) s;
+        acc += *(WORD*) d;
+        d += 2;
+        s += 2;
+        count -= 2;
+    }
+    while (count >= 16)
+    {
+        w = ((const DWORD*) s)[0];
+        ((DWORD*) d)[0] = w;
+        acc += (w & 0xffff) + (w >> 16);
+        w = ((const DWORD*) s)[1];
+        ((DWORD*) d)[1] = w;
+        acc += (w & 0xffff) + (w >> 16);
+        w = ((const DWORD*) s)[2];
+        ((DWORD*) d)[2] = w;
+        acc += (w & 0xffff) + (w >> 16);
+        w = ((const DWORD*) s)[3];
+        ((DWORD*) d)[3] = w;
+        acc += (w & 0xffff) + (w >> 16);
+        d += 16;
+        s += 16;
+        count -= 16;
+    }
+    while (count >= 4)
+    {
+        w = *(const DWORD*) s;
+        *(DWORD*) d = w;
+        acc += (w & 0xffff) + (w >> 16);
+        d += 4;
+        s += 4;
+        count -= 4;
+    }
+    if (count >= 2)
+    {
+        *(WORD*) d = *(const WORD*) s;
+        acc += *(WORD*) d;
+        d += 2;
+        s += 2;
+        count -= 2;
+    }
+    if (count)
+    {
+        *d = *s;
+        acc += *d;
+    }
+
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    if (bOdd)
+    {
+        acc = ((acc & 0xff) << 8) | (acc >> 8);
+    }
+    acc += sum;
+    acc = (acc & 0xffff) + (acc >> 16);
+    return (WORD) acc;
+}
+
+/*****************************************************************************
+  Function:
+        WORD CalcIPChecksumAdd(WORD sum, WORD sumBlock, WORD offset)
+
+  Summary:
+        Adds the sum of a block located at any offset of a packet.
+
+  Description:
+        A block starting at an odd offset has its bytes in the other half
+        of the 16-bit words: its sum is swapped before being added.
+
+  Parameters:
+        sum      - sum of the bytes before the block
+        sumBlock - sum of the block (computed from its first byte)
+        offset   - offset of the block in the packet
+
+  Returns:
+        The folded 16-bit sum.
+ ***************************************************************************/
+WORD CalcIPChecksumAdd(WORD sum, WORD sumBlock, WORD offset)
+{
+    DWORD acc = sumBlock;
+
+    if (offset & 0x1)
+    {
+        acc = ((acc & 0xff) << 8) | (acc >> 8);
+    }
+    acc += sum;
+    acc = (acc & 0xffff) + (acc >> 16);
+    return (WORD) acc;
+}
+
+/*****************************************************************************
+  Function:
+        WORD CalcIPChecksumUpdate(WORD checksum, WORD oldValue, WORD newValue)
+
+  Summary:
+        Updates a checksum after a 16-bit field changed (RFC 1624).
+
+  Description:
+        HC' = ~(~HC + ~m + m') (RFC 1624, eqn. 3): no need to sum the whole
+        data again when only a field (at an even offset) changes.  The
+        values are taken in the same byte order as the checksum.
+
+  Parameters:
+        checksum - the current checksum
+        oldValue - the former value of the field
+        newValue - the new value of the field
+
+  Returns:
+        The updated checksum.
+ ***************************************************************************/
+WORD CalcIPChecksumUpdate(WORD checksum, WORD oldValue, WORD newValue)
+{
+    DWORD acc = (DWORD) (WORD) ~checksum + (DWORD) (WORD) ~oldValue + newValue;
 
-    return ~sum.w[0];
+    acc = (acc & 0xffff) + (acc >> 16);
+    acc = (acc & 0xffff) + (acc >> 16);
+    return ~(WORD) acc;
 }
@@ -70,5 +70,9 @@ DWORD   GenerateRandomDWORD(void);
 BOOL    StringToIPAddress(BYTE* str, IP_ADDR* IPAddress);
 BOOL    StringToMACAddress(BYTE* str, BYTE* MACAddress);
 WORD    CalcIPChecksum(BYTE* buffer, WORD len);
+WORD    CalcIPChecksumPartial(WORD sum, const BYTE* buffer, WORD count);
+WORD    CalcIPChecksumCopy(WORD sum, BYTE* dest, const BYTE* source, WORD count);
+WORD    CalcIPChecksumAdd(WORD sum, WORD sumBlock, WORD offset);
+WORD    CalcIPChecksumUpdate(WORD checksum, WORD oldValue, WORD newValue);
 
 #endif